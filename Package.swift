@@ -387,9 +387,11 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/call_tracer_wrapper.cc",
         "src/core/ext/transport/chttp2/transport/call_tracer_wrapper.h",
         "src/core/ext/transport/chttp2/transport/chttp2_transport.cc",
+        "src/core/ext/transport/chttp2/transport/data_scheduling_policy.cc",
         "src/core/ext/transport/chttp2/transport/chttp2_transport.h",
-        "src/core/ext/transport/chttp2/transport/decode_huff.cc",
-        "src/core/ext/transport/chttp2/transport/decode_huff.h",
+        "src/core/ext/transport/chttp2/transport/data_scheduling_policy.h",
+        "src/core/ext/transport/chttp2/transport/decode_huff_multi.cc",
+        "src/core/ext/transport/chttp2/transport/decode_huff_multi.h",
         "src/core/ext/transport/chttp2/transport/flow_control.cc",
         "src/core/ext/transport/chttp2/transport/flow_control.h",
         "src/core/ext/transport/chttp2/transport/flow_control_manager.h",
@@ -464,7 +466,9 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/varint.cc",
         "src/core/ext/transport/chttp2/transport/varint.h",
         "src/core/ext/transport/chttp2/transport/writable_streams.h",
+        "src/core/ext/transport/chttp2/transport/write_coalescing_policy.cc",
         "src/core/ext/transport/chttp2/transport/write_size_policy.cc",
+        "src/core/ext/transport/chttp2/transport/write_coalescing_policy.h",
         "src/core/ext/transport/chttp2/transport/write_size_policy.h",
         "src/core/ext/transport/chttp2/transport/writing.cc",
         "src/core/ext/transport/inproc/inproc_transport.cc",
@@ -1411,8 +1415,12 @@ let package = Package(
         "src/core/lib/event_engine/nameser.h",
         "src/core/lib/event_engine/poller.h",
         "src/core/lib/event_engine/posix.h",
+        "src/core/lib/event_engine/posix_engine/busy_poller.cc",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc",
+        "src/core/lib/event_engine/posix_engine/busy_poller.h",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.cc",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.h",
         "src/core/lib/event_engine/posix_engine/event_poller.h",
@@ -1422,7 +1430,9 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/file_descriptor_collection.h",
         "src/core/lib/event_engine/posix_engine/grpc_polled_fd_posix.h",
         "src/core/lib/event_engine/posix_engine/internal_errqueue.cc",
+        "src/core/lib/event_engine/posix_engine/listener_shard.cc",
         "src/core/lib/event_engine/posix_engine/internal_errqueue.h",
+        "src/core/lib/event_engine/posix_engine/listener_shard.h",
         "src/core/lib/event_engine/posix_engine/lockfree_event.cc",
         "src/core/lib/event_engine/posix_engine/lockfree_event.h",
         "src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.cc",
@@ -1443,11 +1453,17 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/posix_write_event_sink.h",
         "src/core/lib/event_engine/posix_engine/set_socket_dualstack.cc",
         "src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc",
+        "src/core/lib/event_engine/posix_engine/tcp_zerocopy_send_policy.cc",
+        "src/core/lib/event_engine/posix_engine/tcp_zerocopy_receiver.cc",
         "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h",
+        "src/core/lib/event_engine/posix_engine/tcp_zerocopy_send_policy.h",
+        "src/core/lib/event_engine/posix_engine/tcp_zerocopy_receiver.h",
         "src/core/lib/event_engine/posix_engine/timer.cc",
         "src/core/lib/event_engine/posix_engine/timer.h",
         "src/core/lib/event_engine/posix_engine/timer_heap.cc",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.cc",
         "src/core/lib/event_engine/posix_engine/timer_heap.h",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.h",
         "src/core/lib/event_engine/posix_engine/timer_manager.cc",
         "src/core/lib/event_engine/posix_engine/timer_manager.h",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.cc",
@@ -1471,6 +1487,8 @@ let package = Package(
         "src/core/lib/event_engine/tcp_socket_utils.h",
         "src/core/lib/event_engine/thread_local.cc",
         "src/core/lib/event_engine/thread_local.h",
+        "src/core/lib/event_engine/thread_pool/cpu_topology.cc",
+        "src/core/lib/event_engine/thread_pool/cpu_topology.h",
         "src/core/lib/event_engine/thread_pool/thread_count.cc",
         "src/core/lib/event_engine/thread_pool/thread_count.h",
         "src/core/lib/event_engine/thread_pool/thread_pool.h",
@@ -1812,6 +1830,7 @@ let package = Package(
         "src/core/load_balancing/lb_policy_factory.h",
         "src/core/load_balancing/lb_policy_registry.cc",
         "src/core/load_balancing/lb_policy_registry.h",
+        "src/core/load_balancing/least_request/least_request.cc",
         "src/core/load_balancing/oob_backend_metric.cc",
         "src/core/load_balancing/oob_backend_metric.h",
         "src/core/load_balancing/oob_backend_metric_internal.h",
@@ -1820,6 +1839,8 @@ let package = Package(
         "src/core/load_balancing/pick_first/pick_first.cc",
         "src/core/load_balancing/pick_first/pick_first.h",
         "src/core/load_balancing/priority/priority.cc",
+        "src/core/load_balancing/ring_hash/lookup_table.cc",
+        "src/core/load_balancing/ring_hash/lookup_table.h",
         "src/core/load_balancing/ring_hash/ring_hash.cc",
         "src/core/load_balancing/ring_hash/ring_hash.h",
         "src/core/load_balancing/rls/rls.cc",
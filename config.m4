@@ -172,7 +172,8 @@ if test "$PHP_GRPC" != "no"; then
     src/core/ext/transport/chttp2/transport/bin_encoder.cc \
     src/core/ext/transport/chttp2/transport/call_tracer_wrapper.cc \
     src/core/ext/transport/chttp2/transport/chttp2_transport.cc \
-    src/core/ext/transport/chttp2/transport/decode_huff.cc \
+    src/core/ext/transport/chttp2/transport/data_scheduling_policy.cc \
+    src/core/ext/transport/chttp2/transport/decode_huff_multi.cc \
     src/core/ext/transport/chttp2/transport/flow_control.cc \
     src/core/ext/transport/chttp2/transport/frame.cc \
     src/core/ext/transport/chttp2/transport/frame_data.cc \
@@ -203,6 +204,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/ext/transport/chttp2/transport/stream_lists.cc \
     src/core/ext/transport/chttp2/transport/transport_common.cc \
     src/core/ext/transport/chttp2/transport/varint.cc \
+    src/core/ext/transport/chttp2/transport/write_coalescing_policy.cc \
     src/core/ext/transport/chttp2/transport/write_size_policy.cc \
     src/core/ext/transport/chttp2/transport/writing.cc \
     src/core/ext/transport/inproc/inproc_transport.cc \
@@ -582,11 +584,14 @@ if test "$PHP_GRPC" != "no"; then
     src/core/lib/event_engine/default_event_engine_factory.cc \
     src/core/lib/event_engine/endpoint_channel_arg_wrapper.cc \
     src/core/lib/event_engine/event_engine.cc \
+    src/core/lib/event_engine/posix_engine/busy_poller.cc \
     src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc \
+    src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc \
     src/core/lib/event_engine/posix_engine/ev_poll_posix.cc \
     src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc \
     src/core/lib/event_engine/posix_engine/file_descriptor_collection.cc \
     src/core/lib/event_engine/posix_engine/internal_errqueue.cc \
+    src/core/lib/event_engine/posix_engine/listener_shard.cc \
     src/core/lib/event_engine/posix_engine/lockfree_event.cc \
     src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.cc \
     src/core/lib/event_engine/posix_engine/posix_endpoint.cc \
@@ -598,8 +603,11 @@ if test "$PHP_GRPC" != "no"; then
     src/core/lib/event_engine/posix_engine/posix_write_event_sink.cc \
     src/core/lib/event_engine/posix_engine/set_socket_dualstack.cc \
     src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc \
+    src/core/lib/event_engine/posix_engine/tcp_zerocopy_send_policy.cc \
+    src/core/lib/event_engine/posix_engine/tcp_zerocopy_receiver.cc \
     src/core/lib/event_engine/posix_engine/timer.cc \
     src/core/lib/event_engine/posix_engine/timer_heap.cc \
+    src/core/lib/event_engine/posix_engine/timer_wheel.cc \
     src/core/lib/event_engine/posix_engine/timer_manager.cc \
     src/core/lib/event_engine/posix_engine/traced_buffer_list.cc \
     src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc \
@@ -611,6 +619,7 @@ if test "$PHP_GRPC" != "no"; then
     src/core/lib/event_engine/slice_buffer.cc \
     src/core/lib/event_engine/tcp_socket_utils.cc \
     src/core/lib/event_engine/thread_local.cc \
+    src/core/lib/event_engine/thread_pool/cpu_topology.cc \
     src/core/lib/event_engine/thread_pool/thread_count.cc \
     src/core/lib/event_engine/thread_pool/thread_pool_factory.cc \
     src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.cc \
@@ -766,10 +775,12 @@ if test "$PHP_GRPC" != "no"; then
     src/core/load_balancing/health_check_client.cc \
     src/core/load_balancing/lb_policy.cc \
     src/core/load_balancing/lb_policy_registry.cc \
+    src/core/load_balancing/least_request/least_request.cc \
     src/core/load_balancing/oob_backend_metric.cc \
     src/core/load_balancing/outlier_detection/outlier_detection.cc \
     src/core/load_balancing/pick_first/pick_first.cc \
     src/core/load_balancing/priority/priority.cc \
+    src/core/load_balancing/ring_hash/lookup_table.cc \
     src/core/load_balancing/ring_hash/ring_hash.cc \
     src/core/load_balancing/rls/rls.cc \
     src/core/load_balancing/round_robin/round_robin.cc \
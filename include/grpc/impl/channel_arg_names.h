@@ -242,6 +242,12 @@
     values set in the LB policy config will be capped to this value.
     Default is 4096. */
 #define GRPC_ARG_RING_HASH_LB_RING_SIZE_CAP "grpc.lb.ring_hash.ring_size_cap"
+/** Cap for the Maglev lookup table size in the ring_hash LB policy.  Tables
+    grow past the configured maglevTableSize to keep 100 slots per endpoint,
+    but no further than the largest prime within this value.
+    Default is 5000011. */
+#define GRPC_ARG_RING_HASH_LB_MAGLEV_TABLE_SIZE_CAP \
+  "grpc.lb.ring_hash.maglev_table_size_cap"
 /** The grpc_socket_mutator instance that set the socket options. A pointer. */
 #define GRPC_ARG_SOCKET_MUTATOR "grpc.socket_mutator"
 /** The grpc_socket_factory instance to create and bind sockets. A pointer. */
@@ -17,11 +17,90 @@
 #include <grpc/support/port_platform.h>
 
 #include <algorithm>
+#include <utility>
 
 namespace grpc_core {
 
+CallArenaAllocator::~CallArenaAllocator() {
+  for (ArenaPool& pool : pools_) {
+    MutexLock lock(&pool.mu);
+    FreeStorage(pool.storage, pool.count, pool.storage_size);
+    pool.count = 0;
+  }
+}
+
+RefCountedPtr<Arena> CallArenaAllocator::MakeArena() {
+  const size_t size =
+      Arena::InitialZoneSize(call_size_estimator_.CallSizeEstimate());
+  void* storage = nullptr;
+  {
+    ArenaPool& pool = pools_.this_cpu();
+    MutexLock lock(&pool.mu);
+    if (pool.count > 0 && pool.storage_size == size) {
+      storage = pool.storage[--pool.count];
+    }
+  }
+  if (storage != nullptr) {
+    return Arena::CreateInRecycledStorage(storage, size, Ref());
+  }
+  return Arena::Create(size, Ref());
+}
+
 void CallArenaAllocator::FinalizeArena(Arena* arena) {
   call_size_estimator_.UpdateCallSizeEstimate(arena->TotalUsedBytes());
 }
 
+bool CallArenaAllocator::RecycleArenaStorage(void* storage, size_t size) {
+  void* to_free[kMaxPooledArenas];
+  size_t num_to_free = 0;
+  size_t free_size = 0;
+  bool recycled = false;
+  {
+    ArenaPool& pool = pools_.this_cpu();
+    MutexLock lock(&pool.mu);
+    if (pool.recycles_until_pressure_check == 0) {
+      pool.recycles_until_pressure_check = kRecyclesPerPressureCheck;
+      pool.under_pressure = UnderMemoryPressure();
+    }
+    --pool.recycles_until_pressure_check;
+    // Empty the pool if the quota is under pressure, or if the call size
+    // estimate has moved on to a different arena size.
+    if (pool.storage_size != size) {
+      if (!pool.under_pressure &&
+          size != Arena::InitialZoneSize(
+                      call_size_estimator_.CallSizeEstimate())) {
+        return false;
+      }
+      num_to_free = std::exchange(pool.count, 0);
+      free_size = std::exchange(pool.storage_size, size);
+    } else if (pool.under_pressure) {
+      num_to_free = std::exchange(pool.count, 0);
+      free_size = size;
+    }
+    std::copy_n(pool.storage, num_to_free, to_free);
+    if (!pool.under_pressure && pool.count < kMaxPooledArenas) {
+      pool.storage[pool.count++] = storage;
+      recycled = true;
+    }
+  }
+  FreeStorage(to_free, num_to_free, free_size);
+  return recycled;
+}
+
+bool CallArenaAllocator::UnderMemoryPressure() {
+  // Ranged reservations are scaled down once the quota is under pressure, so
+  // getting less than we asked for means we should stop holding on to memory.
+  const size_t reserved =
+      allocator().Reserve(MemoryRequest(0, kPressureProbeBytes));
+  allocator().Release(reserved);
+  return reserved < kPressureProbeBytes;
+}
+
+void CallArenaAllocator::FreeStorage(void* const* storage, size_t n,
+                                     size_t size) {
+  if (n == 0) return;
+  for (size_t i = 0; i < n; ++i) Arena::FreeStorage(storage[i]);
+  allocator().Release(n * size);
+}
+
 }  // namespace grpc_core
@@ -20,10 +20,14 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted.h"
+#include "src/core/util/sync.h"
+#include "absl/base/thread_annotations.h"
 
 namespace grpc_core {
 
@@ -68,22 +72,49 @@ class CallSizeEstimator final {
   std::atomic<size_t> call_size_estimate_;
 };
 
+// Makes the arenas for the calls on a channel, sized to fit a typical call.
+// The storage of finished calls' arenas is pooled per cpu and reused for later
+// calls, as long as the estimated call size stays the same, to save a malloc
+// and free per call. Pooled storage stays reserved against the memory quota,
+// and the pools are emptied when the quota comes under pressure.
 class CallArenaAllocator final : public ArenaFactory {
  public:
   CallArenaAllocator(MemoryAllocator allocator, size_t initial_size)
       : ArenaFactory(std::move(allocator)),
         call_size_estimator_(initial_size) {}
+  ~CallArenaAllocator() override;
 
-  RefCountedPtr<Arena> MakeArena() override {
-    return Arena::Create(call_size_estimator_.CallSizeEstimate(), Ref());
-  }
+  RefCountedPtr<Arena> MakeArena() override;
 
   void FinalizeArena(Arena* arena) override;
 
+  bool RecycleArenaStorage(void* storage, size_t size) override;
+
   size_t CallSizeEstimate() { return call_size_estimator_.CallSizeEstimate(); }
 
  private:
+  static constexpr size_t kMaxPooledArenas = 8;
+  // How often each pool samples memory pressure.
+  static constexpr uint32_t kRecyclesPerPressureCheck = 256;
+  // Size of the ranged reservation used to sample memory pressure.
+  static constexpr size_t kPressureProbeBytes = 1024;
+
+  struct alignas(GPR_CACHELINE_SIZE) ArenaPool {
+    Mutex mu;
+    // Initial zone size of all the pooled storage.
+    size_t storage_size ABSL_GUARDED_BY(mu) = 0;
+    size_t count ABSL_GUARDED_BY(mu) = 0;
+    void* storage[kMaxPooledArenas] ABSL_GUARDED_BY(mu);
+    uint32_t recycles_until_pressure_check ABSL_GUARDED_BY(mu) = 0;
+    bool under_pressure ABSL_GUARDED_BY(mu) = false;
+  };
+
+  bool UnderMemoryPressure();
+  // Frees n pooled arenas' storage of the given size.
+  void FreeStorage(void* const* storage, size_t n, size_t size);
+
   CallSizeEstimator call_size_estimator_;
+  PerCpu<ArenaPool> pools_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(16)};
 };
 
 }  // namespace grpc_core
@@ -63,6 +63,20 @@ ABSL_FLAG(absl::optional<std::string>, grpc_poll_strategy, {},
           "Declares which polling engines to try when starting gRPC. This is a "
           "comma-separated list of engines, which are tried in priority order "
           "first -> last.");
+ABSL_FLAG(absl::optional<std::string>, grpc_event_engine_timer_list, {},
+          "Declares which data structure the posix EventEngine keeps its "
+          "timers in. One of 'heap' (sharded binary heaps) or 'wheel' "
+          "(hierarchical timing wheels, cheaper for workloads that cancel most "
+          "of their timers).");
+ABSL_FLAG(absl::optional<int32_t>, grpc_event_engine_busy_poll_threads, {},
+          "Number of dedicated threads with which the posix EventEngine "
+          "busy-polls its sockets instead of sleeping in the poller. Closures "
+          "made ready by those threads run on them rather than on the thread "
+          "pool. Each thread keeps a core busy. 0 turns busy polling off.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_event_engine_busy_poll_us, {},
+          "When the posix EventEngine busy-polls, the SO_BUSY_POLL time in "
+          "microseconds given to its sockets, which also get "
+          "SO_PREFER_BUSY_POLL.");
 ABSL_FLAG(absl::optional<bool>, grpc_abort_on_leaks, {},
           "A debugging aid to cause a call to abort() when gRPC objects are "
           "leaked past grpc_shutdown()");
@@ -105,6 +119,14 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(FLAGS_grpc_client_channel_backup_poll_interval_ms,
                      "GRPC_CLIENT_CHANNEL_BACKUP_POLL_INTERVAL_MS",
                      overrides.client_channel_backup_poll_interval_ms, 5000)),
+      event_engine_busy_poll_threads_(
+          LoadConfig(FLAGS_grpc_event_engine_busy_poll_threads,
+                     "GRPC_EVENT_ENGINE_BUSY_POLL_THREADS",
+                     overrides.event_engine_busy_poll_threads, 0)),
+      event_engine_busy_poll_us_(
+          LoadConfig(FLAGS_grpc_event_engine_busy_poll_us,
+                     "GRPC_EVENT_ENGINE_BUSY_POLL_US",
+                     overrides.event_engine_busy_poll_us, 50)),
       channelz_max_orphaned_nodes_(
           LoadConfig(FLAGS_grpc_channelz_max_orphaned_nodes,
                      "GRPC_CHANNELZ_MAX_ORPHANED_NODES",
@@ -144,6 +166,9 @@ ConfigVars::ConfigVars(const Overrides& overrides)
                             GPR_DEFAULT_LOG_VERBOSITY_STRING)),
       poll_strategy_(LoadConfig(FLAGS_grpc_poll_strategy, "GRPC_POLL_STRATEGY",
                                 overrides.poll_strategy, "all")),
+      event_engine_timer_list_(LoadConfig(
+          FLAGS_grpc_event_engine_timer_list, "GRPC_EVENT_ENGINE_TIMER_LIST",
+          overrides.event_engine_timer_list, "heap")),
       ssl_cipher_suites_(LoadConfig(
           FLAGS_grpc_ssl_cipher_suites, "GRPC_SSL_CIPHER_SUITES",
           overrides.ssl_cipher_suites,
@@ -179,6 +204,10 @@ std::string ConfigVars::ToString() const {
       absl::CEscape(Verbosity()), "\"",
       ", enable_fork_support: ", EnableForkSupport() ? "true" : "false",
       ", poll_strategy: ", "\"", absl::CEscape(PollStrategy()), "\"",
+      ", event_engine_timer_list: ", "\"",
+      absl::CEscape(EventEngineTimerList()), "\"",
+      ", event_engine_busy_poll_threads: ", EventEngineBusyPollThreads(),
+      ", event_engine_busy_poll_us: ", EventEngineBusyPollUs(),
       ", abort_on_leaks: ", AbortOnLeaks() ? "true" : "false",
       ", system_ssl_roots_dir: ", "\"", absl::CEscape(SystemSslRootsDir()),
       "\"", ", default_ssl_roots_file_path: ", "\"",
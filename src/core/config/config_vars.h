@@ -35,6 +35,8 @@ class GPR_DLL ConfigVars {
  public:
   struct Overrides {
     absl::optional<int32_t> client_channel_backup_poll_interval_ms;
+    absl::optional<int32_t> event_engine_busy_poll_threads;
+    absl::optional<int32_t> event_engine_busy_poll_us;
     absl::optional<int32_t> channelz_max_orphaned_nodes;
     absl::optional<double> experimental_target_memory_pressure;
     absl::optional<double> experimental_memory_pressure_threshold;
@@ -47,6 +49,7 @@ class GPR_DLL ConfigVars {
     absl::optional<std::string> dns_resolver;
     absl::optional<std::string> verbosity;
     absl::optional<std::string> poll_strategy;
+    absl::optional<std::string> event_engine_timer_list;
     absl::optional<std::string> system_ssl_roots_dir;
     absl::optional<std::string> default_ssl_roots_file_path;
     absl::optional<std::string> ssl_cipher_suites;
@@ -92,6 +95,22 @@ class GPR_DLL ConfigVars {
   // comma-separated list of engines, which are tried in priority order first ->
   // last.
   absl::string_view PollStrategy() const { return poll_strategy_; }
+  // Declares which data structure the posix EventEngine keeps its timers in.
+  // One of 'heap' (sharded binary heaps) or 'wheel' (hierarchical timing
+  // wheels, cheaper for workloads that cancel most of their timers).
+  absl::string_view EventEngineTimerList() const {
+    return event_engine_timer_list_;
+  }
+  // Number of dedicated threads with which the posix EventEngine busy-polls its
+  // sockets instead of sleeping in the poller. Closures made ready by those
+  // threads run on them rather than on the thread pool. Each thread keeps a
+  // core busy. 0 turns busy polling off.
+  int32_t EventEngineBusyPollThreads() const {
+    return event_engine_busy_poll_threads_;
+  }
+  // When the posix EventEngine busy-polls, the SO_BUSY_POLL time in
+  // microseconds given to its sockets, which also get SO_PREFER_BUSY_POLL.
+  int32_t EventEngineBusyPollUs() const { return event_engine_busy_poll_us_; }
   // A debugging aid to cause a call to abort() when gRPC objects are leaked
   // past grpc_shutdown()
   bool AbortOnLeaks() const { return abort_on_leaks_; }
@@ -139,6 +158,8 @@ class GPR_DLL ConfigVars {
   static const ConfigVars& Load();
   static std::atomic<ConfigVars*> config_vars_;
   int32_t client_channel_backup_poll_interval_ms_;
+  int32_t event_engine_busy_poll_threads_;
+  int32_t event_engine_busy_poll_us_;
   int32_t channelz_max_orphaned_nodes_;
   double experimental_target_memory_pressure_;
   double experimental_memory_pressure_threshold_;
@@ -151,6 +172,7 @@ class GPR_DLL ConfigVars {
   std::string dns_resolver_;
   std::string verbosity_;
   std::string poll_strategy_;
+  std::string event_engine_timer_list_;
   std::string ssl_cipher_suites_;
   std::string experiments_;
   std::string trace_;
@@ -0,0 +1,74 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CALL_URGENCY_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CALL_URGENCY_H
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include "src/core/call/metadata.h"
+#include "src/core/call/metadata_batch.h"
+#include "src/core/util/time.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+// Client metadata key carrying a call's priority: a non-negative integer,
+// larger meaning more urgent. Calls without it have priority zero.
+inline constexpr absl::string_view kCallPriorityMetadataKey =
+    "chaotic-good-priority";
+
+// How soon the peer needs the messages of a call. Carried with each outgoing
+// frame so that data endpoint schedulers can put urgent calls ahead of bulk
+// transfers.
+struct CallUrgency {
+  Timestamp deadline = Timestamp::InfFuture();
+  uint32_t priority = 0;
+
+  // Should `a` be offered to the scheduler before `b`?
+  static bool MoreUrgent(const CallUrgency& a, const CallUrgency& b) {
+    if (a.priority != b.priority) return a.priority > b.priority;
+    return a.deadline < b.deadline;
+  }
+
+  // Seconds from `now` until the deadline: infinite without one.
+  double SecondsUntilDeadline(Timestamp now) const {
+    if (deadline == Timestamp::InfFuture()) {
+      return std::numeric_limits<double>::infinity();
+    }
+    return (deadline - now).seconds();
+  }
+};
+
+inline CallUrgency CallUrgencyFromMetadata(const ClientMetadata& md) {
+  CallUrgency urgency;
+  urgency.deadline =
+      md.get(GrpcTimeoutMetadata()).value_or(Timestamp::InfFuture());
+  std::string buffer;
+  auto priority = md.GetStringValue(kCallPriorityMetadataKey, &buffer);
+  if (priority.has_value() &&
+      !absl::SimpleAtoi(*priority, &urgency.priority)) {
+    urgency.priority = 0;
+  }
+  return urgency;
+}
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CALL_URGENCY_H
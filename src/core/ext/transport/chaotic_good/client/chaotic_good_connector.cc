@@ -226,6 +226,7 @@ void ChaoticGoodConnector::Connect(const Args& args, Result* result,
       [result_notifier_ptr, resolved_addr]() mutable {
         chaotic_good_frame::Settings client_settings;
         client_settings.set_data_channel(false);
+        result_notifier_ptr->config.ClientPrepareSharedMemory(resolved_addr);
         result_notifier_ptr->config.PrepareClientOutgoingSettings(
             client_settings);
         return TrySeq(
@@ -249,17 +250,17 @@ void ChaoticGoodConnector::Connect(const Args& args, Result* result,
               auto socket_node = TcpFrameTransport::MakeSocketNode(
                   result_notifier_ptr->args.channel_args,
                   result.connect_result.endpoint);
-              auto frame_transport = MakeOrphanable<TcpFrameTransport>(
-                  result_notifier_ptr->config.MakeTcpFrameTransportOptions(),
-                  std::move(result.connect_result.endpoint),
-                  result_notifier_ptr->config.TakePendingDataEndpoints(),
-                  MakeRefCounted<TransportContext>(
-                      result_notifier_ptr->args.channel_args,
-                      std::move(socket_node)));
+              auto frame_transport =
+                  result_notifier_ptr->config.MakeFrameTransport(
+                      std::move(result.connect_result.endpoint),
+                      MakeRefCounted<TransportContext>(
+                          result_notifier_ptr->args.channel_args,
+                          std::move(socket_node)));
               auto transport = MakeOrphanable<ChaoticGoodClientTransport>(
                   result_notifier_ptr->args.channel_args,
                   std::move(frame_transport),
-                  result_notifier_ptr->config.MakeMessageChunker());
+                  result_notifier_ptr->config.MakeMessageChunker(),
+                  result_notifier_ptr->config.decode_alignment());
               result_notifier_ptr->result->transport = transport.release();
               result_notifier_ptr->result->channel_args =
                   result.connect_result.channel_args;
@@ -26,6 +26,7 @@
 #include <tuple>
 #include <utility>
 
+#include "src/core/ext/transport/chaotic_good/call_urgency.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
 #include "src/core/ext/transport/chaotic_good/frame_transport.h"
@@ -55,9 +56,10 @@ using grpc_event_engine::experimental::EventEngine;
 
 ChaoticGoodClientTransport::StreamDispatch::StreamDispatch(
     MpscSender<OutgoingFrame> outgoing_frames,
-    std::shared_ptr<EventEngine> event_engine)
+    std::shared_ptr<EventEngine> event_engine, uint32_t decode_alignment)
     : outgoing_frames_(std::move(outgoing_frames)),
-      event_engine_(std::move(event_engine)) {}
+      event_engine_(std::move(event_engine)),
+      decode_alignment_(decode_alignment) {}
 
 RefCountedPtr<ChaoticGoodClientTransport::Stream>
 ChaoticGoodClientTransport::StreamDispatch::LookupStream(uint32_t stream_id) {
@@ -213,8 +215,9 @@ uint32_t ChaoticGoodClientTransport::StreamDispatch::MakeStream(
         self->stream_map_.erase(stream_id);
       });
   if (!on_done_added) return 0;
-  stream_map_.emplace(stream_id,
-                      MakeRefCounted<Stream>(std::move(call_handler)));
+  stream_map_.emplace(
+      stream_id, MakeRefCounted<Stream>(std::move(call_handler),
+                                        decode_alignment_, reassembly_stats_));
   return stream_id;
 }
 
@@ -248,7 +251,7 @@ void ChaoticGoodClientTransport::StreamDispatch::StopWatch(
 
 ChaoticGoodClientTransport::ChaoticGoodClientTransport(
     const ChannelArgs& args, OrphanablePtr<FrameTransport> frame_transport,
-    MessageChunker message_chunker)
+    MessageChunker message_chunker, uint32_t decode_alignment)
     : channelz::DataSource(frame_transport->ctx()->socket_node),
       ctx_(frame_transport->ctx()),
       allocator_(args.GetObject<ResourceQuota>()
@@ -263,7 +266,7 @@ ChaoticGoodClientTransport::ChaoticGoodClientTransport(
   MpscReceiver<OutgoingFrame> outgoing_frames{256 * 1024 * 1024};
   outgoing_frames_ = outgoing_frames.MakeSender();
   stream_dispatch_ = MakeRefCounted<StreamDispatch>(
-      outgoing_frames.MakeSender(), ctx_->event_engine);
+      outgoing_frames.MakeSender(), ctx_->event_engine, decode_alignment);
   frame_transport_->Start(party_.get(), std::move(outgoing_frames),
                           stream_dispatch_);
   SourceConstructed();
@@ -285,6 +288,8 @@ void ChaoticGoodClientTransport::Orphan() {
 void ChaoticGoodClientTransport::AddData(channelz::DataSink sink) {
   // TODO(ctiller): add calls in stream dispatch
   party_->ExportToChannelz("transport_party", sink);
+  sink.AddData("message_reassembly",
+               stream_dispatch_->reassembly_stats().ToPropertyList());
 }
 
 auto ChaoticGoodClientTransport::CallOutboundLoop(uint32_t stream_id,
@@ -300,24 +305,27 @@ auto ChaoticGoodClientTransport::CallOutboundLoop(uint32_t stream_id,
     return outgoing_frames_.Send(OutgoingFrame{std::move(frame), call_tracer},
                                  tokens);
   };
-  auto send_message = [this, stream_id, call_tracer,
+  // Filled in from the initial metadata, before any message is sent.
+  CallUrgency* const urgency = call_handler.arena()->New<CallUrgency>();
+  auto send_message = [this, stream_id, call_tracer, urgency,
                        message_chunker =
                            message_chunker_](MessageHandle message) mutable {
     if (ctx_->socket_node != nullptr) {
       ctx_->socket_node->RecordMessagesSent(1);
     }
     return message_chunker.Send(std::move(message), stream_id, call_tracer,
-                                outgoing_frames_);
+                                *urgency, outgoing_frames_);
   };
   return GRPC_LATENT_SEE_PROMISE(
       "CallOutboundLoop",
       TrySeq(
           // Wait for initial metadata then send it out.
           call_handler.PullClientInitialMetadata(),
-          [send_fragment](ClientMetadataHandle md) mutable {
+          [send_fragment, urgency](ClientMetadataHandle md) mutable {
             GRPC_TRACE_LOG(chaotic_good, INFO)
                 << "CHAOTIC_GOOD: Sending initial metadata: "
                 << md->DebugString();
+            *urgency = CallUrgencyFromMetadata(*md);
             ClientInitialMetadataFrame frame;
             frame.body = ClientMetadataProtoFromGrpc(*md);
             return send_fragment(std::move(frame));
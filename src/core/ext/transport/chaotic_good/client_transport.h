@@ -71,7 +71,8 @@ class ChaoticGoodClientTransport final : public ClientTransport,
  public:
   ChaoticGoodClientTransport(const ChannelArgs& args,
                              OrphanablePtr<FrameTransport> frame_transport,
-                             MessageChunker message_chunker);
+                             MessageChunker message_chunker,
+                             uint32_t decode_alignment = 1);
   ~ChaoticGoodClientTransport() override;
 
   FilterStackTransport* filter_stack_transport() override { return nullptr; }
@@ -98,8 +99,10 @@ class ChaoticGoodClientTransport final : public ClientTransport,
 
  private:
   struct Stream : public RefCounted<Stream> {
-    explicit Stream(CallHandler call)
+    Stream(CallHandler call, uint32_t decode_alignment,
+           std::shared_ptr<MessageReassemblyStats> reassembly_stats)
         : call(std::move(call)),
+          message_reassembly(decode_alignment, std::move(reassembly_stats)),
           frame_dispatch_serializer(this->call.party()->MakeSpawnSerializer()) {
     }
     CallHandler call;
@@ -112,7 +115,8 @@ class ChaoticGoodClientTransport final : public ClientTransport,
    public:
     StreamDispatch(MpscSender<OutgoingFrame> outgoing_frames,
                    std::shared_ptr<grpc_event_engine::experimental::EventEngine>
-                       event_engine);
+                       event_engine,
+                   uint32_t decode_alignment);
 
     void OnIncomingFrame(IncomingFrame incoming_frame) override;
     void OnFrameTransportClosed(absl::Status status) override;
@@ -127,6 +131,10 @@ class ChaoticGoodClientTransport final : public ClientTransport,
     void StartWatch(RefCountedPtr<StateWatcher> watcher);
     void StopWatch(RefCountedPtr<StateWatcher> watcher);
 
+    const MessageReassemblyStats& reassembly_stats() const {
+      return *reassembly_stats_;
+    }
+
    private:
     template <typename T>
     void DispatchFrame(IncomingFrame incoming_frame);
@@ -157,6 +165,9 @@ class ChaoticGoodClientTransport final : public ClientTransport,
     RefCountedPtr<StateWatcher> watcher_ ABSL_GUARDED_BY(mu_);
     MpscSender<OutgoingFrame> outgoing_frames_;
     std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
+    const uint32_t decode_alignment_;
+    const std::shared_ptr<MessageReassemblyStats> reassembly_stats_ =
+        std::make_shared<MessageReassemblyStats>();
   };
 
   auto CallOutboundLoop(uint32_t stream_id, CallHandler call_handler);
@@ -15,14 +15,18 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CONFIG_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CONFIG_H
 
+#include <memory>
 #include <vector>
 
 #include "src/core/ext/transport/chaotic_good/chaotic_good_frame.pb.h"
 #include "src/core/ext/transport/chaotic_good/message_chunker.h"
 #include "src/core/ext/transport/chaotic_good/pending_connection.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory_frame_transport.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory_region.h"
 #include "src/core/ext/transport/chaotic_good/tcp_frame_transport.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/extensions/tcp_trace.h"
+#include "src/core/util/orphanable.h"
 #include "absl/container/flat_hash_set.h"
 
 namespace grpc_core {
@@ -35,8 +39,25 @@ namespace chaotic_good {
   "grpc.chaotic_good.max_send_chunk_size"
 #define GRPC_ARG_CHAOTIC_GOOD_INLINED_PAYLOAD_SIZE_THRESHOLD \
   "grpc.chaotic_good.inlined_payload_size_threshold"
+// Data endpoint scheduler: "<name>(:<key>=<value>)*", with name one of
+// spanrr (the default), rand, pick_best or deadline. The deadline scheduler
+// puts calls that are near their deadline, or whose client metadata gives
+// them a priority (see kCallPriorityMetadataKey), ahead of bulk transfers.
 #define GRPC_ARG_CHAOTIC_GOOD_SCHEDULER_CONFIG \
   "grpc.chaotic_good.scheduler_config"
+// Size in bytes of the shared memory ring used for data frame payloads in
+// each direction when client and server are on the same host; 0 (the
+// default) disables shared memory. Clients offer to share a region of this
+// size, and servers create one for offers of up to this size.
+// Servers built before shared memory support ignore the offer.
+#define GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_SIZE \
+  "grpc.chaotic_good.shared_memory_size"
+// If set on both client and server, the number of data connections adapts
+// to load during the life of each connection, between one and the smaller of
+// the two values; the server starts with its configured number of data
+// connections. 0 (the default) keeps that number fixed.
+#define GRPC_ARG_CHAOTIC_GOOD_MAX_DATA_CONNECTIONS \
+  "grpc.chaotic_good.max_data_connections"
 
 // Transport configuration.
 // Most of our configuration is derived from channel args, and then exchanged
@@ -71,6 +92,12 @@ class Config {
                .value_or(inline_payload_size_threshold_));
     tracing_enabled_ =
         channel_args.GetBool(GRPC_ARG_TCP_TRACING_ENABLED).value_or(false);
+    shared_memory_size_ = std::max(
+        0, channel_args.GetInt(GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_SIZE)
+               .value_or(0));
+    max_data_connections_ = std::max(
+        0, channel_args.GetInt(GRPC_ARG_CHAOTIC_GOOD_MAX_DATA_CONNECTIONS)
+               .value_or(0));
   }
 
   Config(const Config&) = delete;
@@ -89,17 +116,86 @@ class Config {
   }
 
   void PrepareServerOutgoingSettings(chaotic_good_frame::Settings& settings) {
+    if (shared_memory_region_ != nullptr) {
+      *settings.mutable_shared_memory() = shared_memory_answer_;
+    }
     for (const auto& pending_data_endpoint : pending_data_endpoints_) {
       settings.add_connection_id(pending_data_endpoint.id());
     }
+    if (shared_memory_region_ == nullptr && max_data_connections_ != 0) {
+      settings.set_max_data_channels(max_data_connections_);
+    }
     PrepareOutgoingSettings(settings);
   }
 
   void PrepareClientOutgoingSettings(chaotic_good_frame::Settings& settings) {
     CHECK_EQ(pending_data_endpoints_.size(), 0u);
+    if (shared_memory_rendezvous_ != nullptr) {
+      shared_memory_rendezvous_->FillOffer(*settings.mutable_shared_memory());
+    }
+    if (max_data_connections_ != 0) {
+      settings.set_max_data_channels(max_data_connections_);
+    }
     PrepareOutgoingSettings(settings);
   }
 
+  // Server: where to get more data connections from, should their number
+  // adapt to load.
+  void ServerSetDataConnectionFactory(
+      RefCountedPtr<ServerConnectionFactory> factory,
+      ChannelArgs handshake_result_args) {
+    if (max_data_connections_ == 0) return;
+    data_endpoint_factory_.request =
+        [factory = std::move(factory),
+         args = std::move(handshake_result_args)]() {
+          return factory->RequestDataConnection(args);
+        };
+  }
+
+  // Client: listen for a shared memory region to offer in our settings, if
+  // shared memory is enabled and the server is on this host.
+  void ClientPrepareSharedMemory(
+      const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+          server_address) {
+    if (shared_memory_size_ == 0 || !IsSameHostPeer(server_address)) return;
+    auto rendezvous = SharedMemoryRendezvous::Listen(shared_memory_size_);
+    if (!rendezvous.ok()) {
+      GRPC_TRACE_LOG(chaotic_good, INFO)
+          << "CHAOTIC_GOOD: Not offering shared memory: "
+          << rendezvous.status();
+      return;
+    }
+    shared_memory_rendezvous_ = std::move(*rendezvous);
+  }
+
+  // Server: create a shared memory region and hand it over to the client, if
+  // it offered to share one. Failing to is not an error: the connection just
+  // uses data endpoints.
+  void ServerAcceptSharedMemory(
+      const chaotic_good_frame::Settings& settings,
+      const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+          client_address) {
+    if (!settings.has_shared_memory() || shared_memory_size_ == 0 ||
+        settings.shared_memory().ring_size() > shared_memory_size_ ||
+        !IsSameHostPeer(client_address)) {
+      return;
+    }
+    auto region =
+        SharedMemoryRegion::Create(settings.shared_memory().ring_size());
+    absl::Status status = region.status();
+    if (status.ok()) status = (*region)->HandOver(settings.shared_memory());
+    if (!status.ok()) {
+      GRPC_TRACE_LOG(chaotic_good, INFO)
+          << "CHAOTIC_GOOD: Not accepting shared memory: " << status;
+      return;
+    }
+    shared_memory_region_ = std::move(*region);
+    shared_memory_answer_ = settings.shared_memory();
+    shared_memory_region_->FillAnswer(shared_memory_answer_);
+  }
+
+  bool uses_shared_memory() const { return shared_memory_region_ != nullptr; }
+
   absl::Status ReceiveServerIncomingSettings(
       const chaotic_good_frame::Settings& settings,
       ClientConnectionFactory& connector) {
@@ -115,9 +211,27 @@ class Config {
       }
     }
     supported_features_.swap(supported_features);
+    // The server answers our offer if it handed a region over. It then asks
+    // for no data connections, so we cannot fall back to them.
+    if (shared_memory_rendezvous_ != nullptr && settings.has_shared_memory()) {
+      auto region =
+          shared_memory_rendezvous_->Accept(settings.shared_memory());
+      if (!region.ok()) return region.status();
+      shared_memory_region_ = std::move(*region);
+    }
+    shared_memory_rendezvous_.reset();
     for (const auto& connection_id : settings.connection_id()) {
       pending_data_endpoints_.emplace_back(connector.Connect(connection_id));
     }
+    // The server echoes max_data_channels if it adapts the data connections.
+    max_data_connections_ =
+        std::min(max_data_connections_, settings.max_data_channels());
+    if (max_data_connections_ != 0) {
+      data_endpoint_factory_.connect =
+          [connector = connector.Ref()](absl::string_view connection_id) {
+            return connector->Connect(connection_id);
+          };
+    }
     return ReceiveIncomingSettings(settings);
   }
 
@@ -144,6 +258,8 @@ class Config {
     if (settings.connection_id_size() != 0) {
       return absl::InternalError("Client cannot specify connection ids");
     }
+    max_data_connections_ =
+        std::min(max_data_connections_, settings.max_data_channels());
     return ReceiveIncomingSettings(settings);
   }
 
@@ -155,9 +271,27 @@ class Config {
     options.inlined_payload_size_threshold = inline_payload_size_threshold_;
     options.scheduler_config = scheduler_config_;
     options.enable_tracing = tracing_enabled_;
+    options.max_data_endpoints = max_data_connections_;
     return options;
   }
 
+  // Factory: make the frame transport for the negotiated settings, over the
+  // given control endpoint.
+  OrphanablePtr<FrameTransport> MakeFrameTransport(
+      PromiseEndpoint control_endpoint, TransportContextPtr ctx) {
+    if (shared_memory_region_ != nullptr) {
+      SharedMemoryFrameTransport::Options options;
+      options.inlined_payload_size_threshold = inline_payload_size_threshold_;
+      return MakeOrphanable<SharedMemoryFrameTransport>(
+          options, std::move(control_endpoint),
+          std::move(shared_memory_region_), std::move(ctx));
+    }
+    return MakeOrphanable<TcpFrameTransport>(
+        MakeTcpFrameTransportOptions(), std::move(control_endpoint),
+        TakePendingDataEndpoints(), std::move(ctx),
+        std::move(data_endpoint_factory_));
+  }
+
   // Factory: create a message chunker based on negotiated settings.
   MessageChunker MakeMessageChunker() const {
     return MessageChunker(max_send_chunk_size_, encode_alignment_);
@@ -225,8 +359,14 @@ class Config {
   uint32_t max_send_chunk_size_ = 1024 * 1024;
   uint32_t max_recv_chunk_size_ = 1024 * 1024;
   uint32_t inline_payload_size_threshold_ = 8 * 1024;
+  uint32_t shared_memory_size_ = 0;
+  uint32_t max_data_connections_ = 0;
   std::string scheduler_config_;
   std::vector<PendingConnection> pending_data_endpoints_;
+  TcpFrameTransport::DataEndpointFactory data_endpoint_factory_;
+  std::unique_ptr<SharedMemoryRendezvous> shared_memory_rendezvous_;
+  RefCountedPtr<SharedMemoryRegion> shared_memory_region_;
+  chaotic_good_frame::SharedMemoryOffer shared_memory_answer_;
   absl::flat_hash_set<chaotic_good_frame::Settings::Features>
       supported_features_;
 };
@@ -0,0 +1,114 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/data_endpoint_policy.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+
+namespace grpc_core {
+namespace chaotic_good {
+
+uint32_t DataEndpointPolicy::Update(const Sample& sample) {
+  const uint32_t count = sample.endpoints.size();
+  auto clamp = [this](uint32_t n) {
+    return std::clamp(n, options_.min_endpoints,
+                      std::max(options_.min_endpoints, options_.max_endpoints));
+  };
+  if (ceiling_ == 0) ceiling_ = options_.max_endpoints;
+  double rate = 0;
+  for (const auto& endpoint : sample.endpoints) {
+    // Until every endpoint has been measured (new ones take a moment) we
+    // cannot tell how fast the backlog drains, so hold still.
+    if (endpoint.bytes_per_second >= SendRate::kUnmeasuredBytesPerSecond) {
+      return desired_ = clamp(std::max(count, desired_));
+    }
+    rate += endpoint.bytes_per_second;
+  }
+  if (rate <= 0) return desired_ = clamp(count);
+  const double drain_seconds = sample.outstanding_bytes / rate;
+  last_rate_ = rate;
+  last_drain_seconds_ = drain_seconds;
+  if (drain_seconds > options_.add_backlog_seconds) {
+    ++over_;
+    under_ = 0;
+  } else if (drain_seconds < options_.retire_backlog_seconds) {
+    ++under_;
+    over_ = 0;
+  } else {
+    over_ = 0;
+    under_ = 0;
+  }
+  if (rate_before_add_.has_value() && under_ != 0) {
+    // The load went away: the addition can no longer be judged, nor is it
+    // still wanted.
+    rate_before_add_.reset();
+  }
+  if (rate_before_add_.has_value()) {
+    if (count <= endpoints_before_add_) {
+      // Still waiting for the endpoint that we asked for.
+      return desired_ = clamp(endpoints_before_add_ + 1);
+    }
+    // Judge the addition once it has had as long to ramp up as we waited
+    // before asking for it.
+    if (over_ < options_.hysteresis) return desired_ = clamp(count);
+    const double rate_before_add = *rate_before_add_;
+    rate_before_add_.reset();
+    if (rate < rate_before_add * (1 + options_.min_gain)) {
+      ceiling_ = count - 1;
+      over_ = 0;
+      return desired_ = clamp(count - 1);
+    }
+  }
+  desired_ = count;
+  if (over_ >= options_.hysteresis && count < ceiling_) {
+    over_ = 0;
+    rate_before_add_ = rate;
+    endpoints_before_add_ = count;
+    desired_ = count + 1;
+  } else if (under_ >= options_.hysteresis &&
+             count > options_.min_endpoints) {
+    under_ = 0;
+    ceiling_ = options_.max_endpoints;
+    desired_ = count - 1;
+  }
+  return desired_ = clamp(desired_);
+}
+
+std::optional<size_t> DataEndpointPolicy::EndpointToRetire(
+    const Sample& sample) {
+  std::optional<size_t> slowest;
+  for (size_t i = 0; i < sample.endpoints.size(); ++i) {
+    if (!slowest.has_value() ||
+        sample.endpoints[i].bytes_per_second <=
+            sample.endpoints[*slowest].bytes_per_second) {
+      slowest = i;
+    }
+  }
+  return slowest;
+}
+
+channelz::PropertyList DataEndpointPolicy::ChannelzProperties() const {
+  return channelz::PropertyList()
+      .Set("min_endpoints", options_.min_endpoints)
+      .Set("max_endpoints", options_.max_endpoints)
+      .Set("desired_endpoints", desired_)
+      .Set("ceiling", ceiling_)
+      .Set("last_rate", last_rate_)
+      .Set("last_drain_seconds", last_drain_seconds_);
+}
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
@@ -0,0 +1,96 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_DATA_ENDPOINT_POLICY_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_DATA_ENDPOINT_POLICY_H
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "src/core/channelz/property_list.h"
+#include "src/core/ext/transport/chaotic_good/send_rate.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+// Decides how many data endpoints a connection should have, from periodic
+// samples of the load on them.
+//
+// Each sample gives the bytes waiting to go out (queued for the scheduler
+// plus queued at the endpoints) and the delivery rate that SendRate measured
+// for each endpoint. Dividing one by the sum of the other gives the time the
+// backlog would take to drain. Whilst that stays above add_backlog_seconds we
+// ask for one more endpoint; whilst it stays below retire_backlog_seconds we
+// ask for one fewer.
+//
+// Extra endpoints only help while the individual connections are the limit
+// (congestion windows, per-flow policers, one core per flow, ...): once the
+// path itself is full they just split the same bandwidth more ways. So each
+// addition is checked: if the aggregate rate did not grow by min_gain once
+// the new endpoint is measured, we ask to retire it again and stop adding
+// until the load has dropped.
+//
+// Not thread safe: one owner samples and acts on the result.
+class DataEndpointPolicy {
+ public:
+  struct Options {
+    uint32_t min_endpoints = 1;
+    uint32_t max_endpoints = 1;
+    double add_backlog_seconds = 0.05;
+    double retire_backlog_seconds = 0.005;
+    // Consecutive samples that must agree before the desired count moves.
+    uint32_t hysteresis = 3;
+    double min_gain = 0.1;
+  };
+
+  struct Sample {
+    // Bytes that are waiting to be written to some data endpoint.
+    double outstanding_bytes = 0;
+    // Delivery data for each endpoint that payloads may be scheduled on.
+    std::vector<SendRate::DeliveryData> endpoints;
+  };
+
+  explicit DataEndpointPolicy(Options options) : options_(options) {}
+
+  // Returns the number of endpoints that we would like to have.
+  uint32_t Update(const Sample& sample);
+
+  // Index into sample.endpoints of the endpoint that it would cost least to
+  // retire, or nullopt if there are none.
+  static std::optional<size_t> EndpointToRetire(const Sample& sample);
+
+  const Options& options() const { return options_; }
+  channelz::PropertyList ChannelzProperties() const;
+
+ private:
+  const Options options_;
+  uint32_t desired_ = 0;
+  // Consecutive samples with too much/too little backlog.
+  uint32_t over_ = 0;
+  uint32_t under_ = 0;
+  // Do not add endpoints beyond this many; lowered when an addition did not
+  // help, and reset when we retire for lack of load.
+  uint32_t ceiling_ = 0;
+  // Aggregate rate, and endpoint count, when we last asked for an addition.
+  std::optional<double> rate_before_add_;
+  uint32_t endpoints_before_add_ = 0;
+  double last_drain_seconds_ = 0;
+  double last_rate_ = 0;
+};
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_DATA_ENDPOINT_POLICY_H
@@ -16,6 +16,7 @@
 
 #include <grpc/event_engine/event_engine.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -25,6 +26,7 @@
 #include <utility>
 
 #include "src/core/channelz/property_list.h"
+#include "src/core/ext/transport/chaotic_good/call_urgency.h"
 #include "src/core/ext/transport/chaotic_good/tcp_frame_header.h"
 #include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
 #include "src/core/ext/transport/chaotic_good/transport_context.h"
@@ -32,9 +34,11 @@
 #include "src/core/lib/event_engine/extensions/tcp_trace.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/promise/if.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/race.h"
+#include "src/core/lib/promise/seq.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/transport/transport_framing_endpoint_extension.h"
 #include "src/core/telemetry/default_tcp_tracer.h"
@@ -57,7 +61,10 @@ namespace data_endpoints_detail {
 
 namespace {
 const uint64_t kSecurityFramePayloadTag = 0;
-}
+// Written last on a retired data endpoint. Control frame headers carry 56 bit
+// payload tags, so no payload can use this one.
+const uint64_t kRetiredPayloadTag = std::numeric_limits<uint64_t>::max();
+}  // namespace
 
 ///////////////////////////////////////////////////////////////////////////////
 // OutputBuffers
@@ -89,6 +96,10 @@ OutputBuffers::Reader::PollReadNext() {
   while (true) {
     GRPC_LATENT_SEE_SCOPE("OutputBuffers::PollReadNext::loop");
     if (frames_.empty()) {
+      if (retiring_) {
+        mu_.Unlock();
+        return std::vector<QueuedFrame>();
+      }
       if (!reading_) {
         reading_ = true;
         output_buffers_->WakeupScheduler();
@@ -107,6 +118,20 @@ OutputBuffers::Reader::PollReadNext() {
   }
 }
 
+void OutputBuffers::Reader::Retire() {
+  mu_.Lock();
+  if (retiring_) {
+    mu_.Unlock();
+    return;
+  }
+  retiring_ = true;
+  reading_ = false;
+  auto waker = std::move(waker_);
+  mu_.Unlock();
+  output_buffers_->num_readers_.fetch_sub(1, std::memory_order_relaxed);
+  waker.Wakeup();
+}
+
 void OutputBuffers::Reader::SetNetworkMetrics(
     const std::optional<SendRate::NetworkSend>& network_send,
     const SendRate::NetworkMetrics& metrics) {
@@ -120,6 +145,7 @@ channelz::PropertyList OutputBuffers::Reader::ChannelzProperties() {
   MutexLock lock(&mu_);
   return channelz::PropertyList()
       .Set("reading", reading_)
+      .Set("retiring", retiring_)
       .Merge(send_rate_.ChannelzProperties())
       .Set("queued_frames", [this]() -> std::optional<channelz::PropertyTable> {
         mu_.AssertHeld();
@@ -169,10 +195,11 @@ void OutputBuffers::DestroyReader(uint32_t id) {
   mu_reader_data_.Unlock();
   reader->mu_.Lock();
   reader->reading_ = false;
+  const bool retiring = reader->retiring_;
   auto waker = std::move(reader->waker_);
   reader->mu_.Unlock();
   waker.Wakeup();
-  num_readers_.fetch_sub(1, std::memory_order_relaxed);
+  if (!retiring) num_readers_.fetch_sub(1, std::memory_order_relaxed);
 }
 
 void OutputBuffers::WakeupScheduler(bool async) {
@@ -240,9 +267,31 @@ Poll<Empty> OutputBuffers::SchedulerPollForWork() {
   }
 }
 
+void OutputBuffers::SortFramesByUrgency() {
+  bool added = false;
+  while (auto* message = frames_queue_.Peek()) {
+    frames_by_urgency_.emplace_back(std::move(*message));
+    frames_queue_.Pop();
+    added = true;
+  }
+  if (!added) return;
+  std::stable_sort(frames_by_urgency_.begin(), frames_by_urgency_.end(),
+                   [](const QueuedFrame& a, const QueuedFrame& b) {
+                     return CallUrgency::MoreUrgent(a.frame->urgency,
+                                                    b.frame->urgency);
+                   });
+}
+
 void OutputBuffers::Schedule() {
   GRPC_LATENT_SEE_SCOPE("OutputBuffers::Schedule");
-  auto* first_message = frames_queue_.Peek();
+  // Frames are offered to the scheduler in the order they were written,
+  // unless it wants the most urgent first.
+  const bool by_urgency = scheduler_->OrdersByUrgency();
+  if (by_urgency) SortFramesByUrgency();
+  auto* first_message =
+      by_urgency ? (frames_by_urgency_.empty() ? nullptr
+                                               : &frames_by_urgency_.front())
+                 : frames_queue_.Peek();
   if (first_message == nullptr) return;
   std::vector<SchedulingData> scheduling_data;
   uint64_t queued_tokens = 0;
@@ -268,6 +317,10 @@ void OutputBuffers::Schedule() {
       SchedulingData& scheduling = scheduling_data[i];
       if (scheduling.reader == nullptr) continue;
       scheduling.reader->mu_.Lock();
+      if (scheduling.reader->retiring_) {
+        scheduling.reader->mu_.Unlock();
+        continue;
+      }
       auto delivery_data = scheduling.reader->send_rate_.GetDeliveryData(now);
       bool reading = scheduling.reader->reading_;
       scheduling.reader->mu_.Unlock();
@@ -280,11 +333,22 @@ void OutputBuffers::Schedule() {
   }
   {
     GRPC_LATENT_SEE_SCOPE("OutputBuffers::Schedule::PlaceMessages");
+    const Timestamp deadline_now = Timestamp::Now();
+    size_t placed_by_urgency = 0;
     while (true) {
-      auto* message = frames_queue_.Peek();
-      if (message == nullptr) break;
-      auto selected_reader =
-          scheduler_->AllocateMessage(message->frame.tokens());
+      QueuedFrame* message;
+      if (by_urgency) {
+        if (placed_by_urgency == frames_by_urgency_.size()) break;
+        message = &frames_by_urgency_[placed_by_urgency];
+      } else {
+        message = frames_queue_.Peek();
+        if (message == nullptr) break;
+      }
+      const CallUrgency& call_urgency = message->frame->urgency;
+      auto selected_reader = scheduler_->AllocateMessage(
+          message->frame.tokens(),
+          MessageUrgency{call_urgency.SecondsUntilDeadline(deadline_now),
+                         call_urgency.priority});
       if (!selected_reader.has_value()) {
         // No reader is ready to read this frame.
         // We'll try again later.
@@ -298,8 +362,15 @@ void OutputBuffers::Schedule() {
       SchedulingData& scheduling = scheduling_data[*selected_reader];
       scheduling.queued_bytes += WriteSizeForFrame(*message);
       scheduling.frames.emplace_back(std::move(*message));
-      frames_queue_.Pop();
+      if (by_urgency) {
+        ++placed_by_urgency;
+      } else {
+        frames_queue_.Pop();
+      }
     }
+    frames_by_urgency_.erase(
+        frames_by_urgency_.begin(),
+        frames_by_urgency_.begin() + placed_by_urgency);
   }
   {
     GRPC_LATENT_SEE_SCOPE("OutputBuffers::Schedule::PublishSchedule");
@@ -308,8 +379,9 @@ void OutputBuffers::Schedule() {
       auto& reader = scheduling.reader;
       DCHECK_NE(reader.get(), nullptr);
       reader->mu_.Lock();
-      if (reader->dropped_) {
-        // Frames were assigned to this reader, but it's not allocated anymore.
+      if (reader->dropped_ || reader->retiring_) {
+        // Frames were assigned to this reader, but it's not allocated anymore
+        // (or is being retired).
         auto frames = std::move(scheduling.frames);
         scheduling.frames.clear();
         reader->mu_.Unlock();
@@ -630,6 +702,25 @@ auto Endpoint::PullDataPayload(RefCountedPtr<EndpointContext> ctx) {
           ValueOrFailure<std::vector<OutputBuffers::QueuedFrame>> queued_frames)
           -> ValueOrFailure<SliceBuffer> {
         if (!queued_frames.ok()) return Failure{};
+        const size_t header_padding = DataConnectionPadding(
+            TcpDataFrameHeader::kFrameHeaderSize, ctx->encode_alignment);
+        const size_t header_size =
+            TcpDataFrameHeader::kFrameHeaderSize + header_padding;
+        if (queued_frames->empty()) {
+          // The reader is retiring and has handed out all of its frames: tell
+          // the peer that nothing more will be written here.
+          GRPC_TRACE_LOG(chaotic_good, INFO)
+              << "CHAOTIC_GOOD: Retire data endpoint #" << ctx->id;
+          ctx->retire_marker_sent = true;
+          auto marker = MutableSlice::CreateUninitialized(header_size);
+          TcpDataFrameHeader{kRetiredPayloadTag, ctx->clock->Now(), 0}
+              .Serialize(marker.data());
+          memset(marker.data() + TcpDataFrameHeader::kFrameHeaderSize, 0,
+                 header_padding);
+          SliceBuffer buffer;
+          buffer.Append(Slice(std::move(marker)));
+          return std::move(buffer);
+        }
         GRPC_TRACE_LOG(chaotic_good, INFO)
             << "CHAOTIC_GOOD: " << ctx->reader.get() << " "
             << ResolvedAddressToString(ctx->endpoint->GetPeerAddress())
@@ -641,10 +732,6 @@ auto Endpoint::PullDataPayload(RefCountedPtr<EndpointContext> ctx) {
         GRPC_LATENT_SEE_SCOPE("SerializePayload");
         // Frame everything into a slice buffer.
         SliceBuffer buffer;
-        const size_t header_padding = DataConnectionPadding(
-            TcpDataFrameHeader::kFrameHeaderSize, ctx->encode_alignment);
-        const size_t header_size =
-            TcpDataFrameHeader::kFrameHeaderSize + header_padding;
         auto header_frames = MutableSlice::CreateUninitialized(
             header_size * queued_frames->size() + ctx->encode_alignment);
         auto padding_mut =
@@ -729,10 +816,11 @@ auto Endpoint::WriteLoop(RefCountedPtr<EndpointContext> ctx) {
                 return status;
               });
         },
-        [id = ctx->id, reader = ctx->reader]() -> LoopCtl<absl::Status> {
+        [ctx]() -> LoopCtl<absl::Status> {
           GRPC_TRACE_LOG(chaotic_good, INFO)
-              << "CHAOTIC_GOOD: " << reader.get() << " "
-              << "Write done to data endpoint #" << id;
+              << "CHAOTIC_GOOD: " << ctx->reader.get() << " "
+              << "Write done to data endpoint #" << ctx->id;
+          if (ctx->retire_marker_sent) return absl::OkStatus();
           return Continue{};
         });
   });
@@ -781,6 +869,13 @@ auto Endpoint::ReadLoop(RefCountedPtr<EndpointContext> ctx) {
               << " on data connection #" << ctx->id;
           buffer.RemoveLastNBytesNoInline(DataConnectionPadding(
               frame_header.payload_length, ctx->decode_alignment));
+          if (GPR_UNLIKELY(frame_header.payload_tag == kRetiredPayloadTag)) {
+            // The peer will write nothing more here: stop scheduling here
+            // too, if we had not already.
+            ctx->reader->Retire();
+            ctx->peer_retired.Set();
+            return absl::OkStatus();
+          }
           if (GPR_UNLIKELY(frame_header.payload_tag ==
                            kSecurityFramePayloadTag)) {
             ReceiveSecurityFrame(*ctx->endpoint, std::move(buffer));
@@ -830,6 +925,7 @@ Endpoint::Endpoint(uint32_t id, uint32_t encode_alignment,
   auto ep_ctx = MakeRefCounted<EndpointContext>();
   ctx_ = ep_ctx;
   ep_ctx->id = id;
+  ep_ctx->connection_id = std::string(pending_connection.id());
   ep_ctx->encode_alignment = encode_alignment;
   ep_ctx->decode_alignment = decode_alignment;
   ep_ctx->enable_tracing = enable_tracing;
@@ -906,17 +1002,37 @@ Endpoint::Endpoint(uint32_t id, uint32_t encode_alignment,
                   [ep_ctx](absl::Status status) {
                     GRPC_TRACE_LOG(chaotic_good, INFO)
                         << "CHAOTIC_GOOD: read party done: " << status;
+                    // The read loop only finishes cleanly at the peer's
+                    // retirement marker.
+                    if (status.ok()) return;
                     ep_ctx->input_queues->SetClosed(std::move(status));
                   });
-              return Map(GRPC_LATENT_SEE_PROMISE("DataEndpointWrite",
-                                                 WriteLoop(std::move(ep_ctx))),
-                         [read_party, socket_node = std::move(socket_node)](
-                             auto x) { return x; });
+              return Map(
+                  Seq(GRPC_LATENT_SEE_PROMISE("DataEndpointWrite",
+                                              WriteLoop(ep_ctx)),
+                      [ep_ctx](absl::Status status) {
+                        // Having retired our direction, keep reading until
+                        // the peer has retired theirs.
+                        return If(
+                            status.ok(),
+                            [ep_ctx]() {
+                              return Map(ep_ctx->peer_retired.Wait(),
+                                         [](Empty) { return absl::OkStatus(); });
+                            },
+                            [status]() { return status; });
+                      }),
+                  [read_party, socket_node = std::move(socket_node)](
+                      auto x) { return x; });
             });
       },
       [ep_ctx](absl::Status status) {
         GRPC_TRACE_LOG(chaotic_good, INFO)
             << "CHAOTIC_GOOD: write party done: " << status;
+        if (status.ok()) {
+          // Both directions retired: nothing of the transport's is left here.
+          ep_ctx->retired.store(true, std::memory_order_release);
+          return;
+        }
         ep_ctx->input_queues->SetClosed(std::move(status));
       });
 }
@@ -932,6 +1048,12 @@ DataEndpoints::DataEndpoints(
     std::shared_ptr<TcpZTraceCollector> ztrace_collector, bool enable_tracing,
     std::string scheduler_config, data_endpoints_detail::Clock* clock)
     : channelz::DataSource(ctx->socket_node),
+      ctx_(ctx),
+      encode_alignment_(encode_alignment),
+      decode_alignment_(decode_alignment),
+      ztrace_collector_(ztrace_collector),
+      enable_tracing_(enable_tracing),
+      clock_(clock),
       output_buffers_(MakeRefCounted<data_endpoints_detail::OutputBuffers>(
           clock, encode_alignment, ztrace_collector,
           std::move(scheduler_config), ctx)),
@@ -945,6 +1067,72 @@ DataEndpoints::DataEndpoints(
   SourceConstructed();
 }
 
+void DataEndpoints::AddEndpoint(PendingConnection endpoint) {
+  RemoveRetiredEndpoints();
+  MutexLock lock(&mu_);
+  // Reuse the lowest free id, so that the scheduler's channel ids stay small.
+  uint32_t id = 0;
+  while (std::any_of(endpoints_.begin(), endpoints_.end(),
+                     [id](const auto& ep) { return ep->id() == id; })) {
+    ++id;
+  }
+  GRPC_TRACE_LOG(chaotic_good, INFO)
+      << "CHAOTIC_GOOD: Add data endpoint #" << id << " for connection "
+      << endpoint.id();
+  endpoints_.emplace_back(std::make_unique<data_endpoints_detail::Endpoint>(
+      id, encode_alignment_, decode_alignment_, clock_, output_buffers_,
+      input_queues_, std::move(endpoint), enable_tracing_, ctx_,
+      ztrace_collector_));
+}
+
+bool DataEndpoints::RetireEndpoint(absl::string_view connection_id) {
+  MutexLock lock(&mu_);
+  for (auto& endpoint : endpoints_) {
+    if (endpoint->connection_id() != connection_id) continue;
+    if (endpoint->retiring()) return false;
+    GRPC_TRACE_LOG(chaotic_good, INFO)
+        << "CHAOTIC_GOOD: Retire data endpoint #" << endpoint->id()
+        << " for connection " << connection_id;
+    endpoint->Retire();
+    return true;
+  }
+  return false;
+}
+
+DataEndpointPolicy::Sample DataEndpoints::SampleLoad(
+    std::vector<std::string>* connection_ids) {
+  RemoveRetiredEndpoints();
+  DataEndpointPolicy::Sample sample;
+  sample.outstanding_bytes = output_buffers_->QueuedTokens();
+  const uint64_t now = clock_->Now();
+  MutexLock lock(&mu_);
+  for (auto& endpoint : endpoints_) {
+    if (endpoint->retiring()) continue;
+    sample.endpoints.push_back(endpoint->reader().GetDeliveryData(now));
+    if (connection_ids != nullptr) {
+      connection_ids->emplace_back(endpoint->connection_id());
+    }
+  }
+  return sample;
+}
+
+void DataEndpoints::RemoveRetiredEndpoints() {
+  std::vector<std::unique_ptr<data_endpoints_detail::Endpoint>> retired;
+  {
+    MutexLock lock(&mu_);
+    for (auto it = endpoints_.begin(); it != endpoints_.end();) {
+      if ((*it)->retired()) {
+        retired.emplace_back(std::move(*it));
+        it = endpoints_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  // Destroy them outside of mu_: this drops their readers.
+  retired.clear();
+}
+
 void DataEndpoints::AddData(channelz::DataSink sink) {
   output_buffers_->AddData(sink);
   input_queues_->AddData(sink);
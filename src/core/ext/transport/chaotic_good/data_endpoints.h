@@ -24,12 +24,14 @@
 
 #include "src/core/channelz/channelz.h"
 #include "src/core/channelz/property_list.h"
+#include "src/core/ext/transport/chaotic_good/data_endpoint_policy.h"
 #include "src/core/ext/transport/chaotic_good/frame_transport.h"
 #include "src/core/ext/transport/chaotic_good/pending_connection.h"
 #include "src/core/ext/transport/chaotic_good/scheduler.h"
 #include "src/core/ext/transport/chaotic_good/send_rate.h"
 #include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
 #include "src/core/ext/transport/chaotic_good/transport_context.h"
+#include "src/core/lib/promise/inter_activity_latch.h"
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/mpsc.h"
 #include "src/core/lib/promise/party.h"
@@ -120,6 +122,17 @@ class OutputBuffers final
       MutexLock lock(&mu_);
       send_rate_.FinishEndpointWrite();
     }
+    SendRate::DeliveryData GetDeliveryData(uint64_t now) {
+      MutexLock lock(&mu_);
+      return send_rate_.GetDeliveryData(now);
+    }
+    // Stop taking new frames: once the frames already taken have been
+    // handed out, Next() resolves to an empty batch.
+    void Retire();
+    bool retiring() {
+      MutexLock lock(&mu_);
+      return retiring_;
+    }
 
    private:
     friend class OutputBuffers;
@@ -161,6 +174,7 @@ class OutputBuffers final
 
     Mutex mu_;
     bool reading_ ABSL_GUARDED_BY(mu_) = false;
+    bool retiring_ ABSL_GUARDED_BY(mu_) = false;
     bool dropped_{false};
     SendRate send_rate_ ABSL_GUARDED_BY(mu_);
     Waker waker_ ABSL_GUARDED_BY(mu_);
@@ -171,10 +185,18 @@ class OutputBuffers final
 
   void Write(uint64_t payload_tag, MpscQueued<OutgoingFrame> output_buffer);
 
+  // Readers that are not retiring.
   size_t ReadyEndpoints() const {
     return num_readers_.load(std::memory_order_relaxed);
   }
 
+  // Bytes accepted by the transport that are not yet written to an endpoint:
+  // the outstanding bytes that the scheduler plans against.
+  uint64_t QueuedTokens() {
+    MutexLock lock(&mu_reader_data_);
+    return mpsc_probe_.QueuedTokens();
+  }
+
   [[nodiscard]] RefCountedPtr<Reader> MakeReader(uint32_t id)
       ABSL_LOCKS_EXCLUDED(mu_reader_data_);
 
@@ -200,6 +222,8 @@ class OutputBuffers final
   void WakeupScheduler(bool async = false);
   Poll<Empty> SchedulerPollForWork();
   void Schedule() ABSL_LOCKS_EXCLUDED(mu_reader_data_);
+  // Move newly queued frames into frames_by_urgency_, keeping it sorted.
+  void SortFramesByUrgency();
 
   uint64_t WriteSizeForFrame(const QueuedFrame& queued_frame) {
     auto& frame =
@@ -229,6 +253,9 @@ class OutputBuffers final
   // Must be held to push into big_frames_queue_ or small_frames_queue_.
   Mutex mu_write_;
   ArenaSpsc<QueuedFrame, false> frames_queue_{arena_.get()};
+  // For schedulers that order by urgency: everything taken from frames_queue_
+  // but not yet placed, most urgent first. Only touched by Schedule().
+  std::vector<QueuedFrame> frames_by_urgency_;
   std::atomic<uintptr_t> scheduling_state_{kSchedulingProcessing};
   RefCountedPtr<Party> scheduling_party_;
   const std::unique_ptr<Scheduler> scheduler_;
@@ -430,9 +457,22 @@ class Endpoint final {
 
   void AddData(channelz::DataSink sink);
 
+  uint32_t id() const { return ctx_->id; }
+  absl::string_view connection_id() const { return ctx_->connection_id; }
+  OutputBuffers::Reader& reader() const { return *ctx_->reader; }
+  // Stop scheduling payloads here; close once those already scheduled are
+  // written and the peer has done the same.
+  void Retire() { ctx_->reader->Retire(); }
+  bool retiring() const { return ctx_->reader->retiring(); }
+  // Both directions have finished: the endpoint can be destroyed.
+  bool retired() const {
+    return ctx_->retired.load(std::memory_order_acquire);
+  }
+
  private:
   struct EndpointContext : public RefCounted<EndpointContext> {
     uint32_t id;
+    std::string connection_id;
     uint32_t encode_alignment;
     uint32_t decode_alignment;
     bool enable_tracing;
@@ -447,6 +487,12 @@ class Endpoint final {
     Clock* clock;
     RefCountedPtr<OutputBuffers::Reader> reader;
     Timestamp last_metrics_update = Timestamp::ProcessEpoch();
+    // Retirement: set by the write loop once it has queued the retirement
+    // marker, by the read loop once the peer's marker arrived, and when
+    // both loops are done.
+    bool retire_marker_sent = false;
+    InterActivityLatch<void> peer_retired;
+    std::atomic<bool> retired{false};
   };
 
   static auto PullDataPayload(RefCountedPtr<EndpointContext> ctx);
@@ -491,6 +537,20 @@ class DataEndpoints final : public channelz::DataSource {
 
   bool empty() const { return output_buffers_->ReadyEndpoints() == 0; }
 
+  // Add a data endpoint to a running transport.
+  void AddEndpoint(PendingConnection endpoint) ABSL_LOCKS_EXCLUDED(mu_);
+  // Stop scheduling payloads on the data endpoint for connection_id. It is
+  // closed once the payloads already scheduled on it have been written and
+  // the peer has retired it too (which the peer does by itself once it sees
+  // the marker that we write last). Returns false if there is no such
+  // endpoint, or it is already retiring.
+  bool RetireEndpoint(absl::string_view connection_id)
+      ABSL_LOCKS_EXCLUDED(mu_);
+  // Load on the endpoints that payloads may still be scheduled on, for
+  // DataEndpointPolicy, along with the connection id of each of them.
+  DataEndpointPolicy::Sample SampleLoad(
+      std::vector<std::string>* connection_ids) ABSL_LOCKS_EXCLUDED(mu_);
+
   void SetMpscProbe(MpscProbe<OutgoingFrame> probe) {
     output_buffers_->SetMpscProbe(std::move(probe));
   }
@@ -507,6 +567,14 @@ class DataEndpoints final : public channelz::DataSource {
     return &clock;
   }
 
+  void RemoveRetiredEndpoints() ABSL_LOCKS_EXCLUDED(mu_);
+
+  const TransportContextPtr ctx_;
+  const uint32_t encode_alignment_;
+  const uint32_t decode_alignment_;
+  const std::shared_ptr<TcpZTraceCollector> ztrace_collector_;
+  const bool enable_tracing_;
+  data_endpoints_detail::Clock* const clock_;
   RefCountedPtr<data_endpoints_detail::OutputBuffers> output_buffers_;
   RefCountedPtr<data_endpoints_detail::InputQueue> input_queues_;
   Mutex mu_;
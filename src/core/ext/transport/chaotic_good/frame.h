@@ -166,6 +166,10 @@ struct EmptyStreamFrame final : public FrameInterface {
 
 using SettingsFrame =
     ProtoTransportFrame<FrameType::kSettings, chaotic_good_frame::Settings>;
+// Handled by TcpFrameTransport itself, and so not part of Frame.
+using DataChannelsFrame =
+    ProtoTransportFrame<FrameType::kTcpDataChannels,
+                        chaotic_good_frame::DataChannels>;
 using ClientInitialMetadataFrame =
     ProtoStreamFrame<FrameType::kClientInitialMetadata,
                      chaotic_good_frame::ClientMetadata>;
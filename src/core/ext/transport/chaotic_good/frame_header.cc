@@ -51,6 +51,8 @@ std::string FrameTypeString(FrameType type) {
       return "MessageChunk";
     case FrameType::kTcpSecurityFrame:
       return "TcpSecurityFrame";
+    case FrameType::kTcpDataChannels:
+      return "TcpDataChannels";
   }
   return absl::StrCat("Unknown[0x", absl::Hex(static_cast<int>(type)), "]");
 }
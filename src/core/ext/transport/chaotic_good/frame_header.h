@@ -31,6 +31,7 @@ namespace chaotic_good {
 enum class FrameType : uint8_t {
   kSettings = 0x00,
   kTcpSecurityFrame = 0x01,  // For TcpFrameTransport
+  kTcpDataChannels = 0x02,   // For TcpFrameTransport
   kClientInitialMetadata = 0x80,
   kClientEndOfStream = 0x81,
   kServerInitialMetadata = 0x91,
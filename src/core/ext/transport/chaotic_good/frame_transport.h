@@ -15,6 +15,7 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_FRAME_TRANSPORT_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_FRAME_TRANSPORT_H
 
+#include "src/core/ext/transport/chaotic_good/call_urgency.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/transport_context.h"
 #include "src/core/lib/promise/map.h"
@@ -72,6 +73,7 @@ struct OutgoingFrame {
   Frame payload;
   // TODO(ctiller): what to do for non-TCP transports??
   std::shared_ptr<TcpCallTracer> call_tracer;
+  CallUrgency urgency;
 };
 
 inline uint32_t FrameMpscTokens(OutgoingFrame frame) {
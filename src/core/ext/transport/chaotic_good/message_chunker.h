@@ -67,6 +67,11 @@ class PayloadChunker {
           if (take > max_chunk_size_) take = max_chunk_size_;
         }
       }
+      // Every chunk but the last is a whole number of alignment units, so each
+      // chunk starts at an aligned offset into the message and the receiver
+      // can stitch them together as they were read, without padding between
+      // them or copying to realign.
+      if (alignment_ > 1 && take > alignment_) take -= take % alignment_;
       payload_.MoveFirstNBytesIntoSliceBuffer(take, result.frame.payload);
       result.frame.stream_id = stream_id_;
       result.done = false;
@@ -94,7 +99,8 @@ class MessageChunker {
 
   template <typename Output>
   auto Send(MessageHandle message, uint32_t stream_id,
-            std::shared_ptr<TcpCallTracer> call_tracer, Output& output) {
+            std::shared_ptr<TcpCallTracer> call_tracer, CallUrgency urgency,
+            Output& output) {
     return If(
         ShouldChunk(*message),
         [&]() {
@@ -103,16 +109,19 @@ class MessageChunker {
           begin.stream_id = stream_id;
           uint32_t tokens = begin.MakeHeader().payload_length;
           return Seq(
-              output.Send(OutgoingFrame{std::move(begin), call_tracer}, tokens),
+              output.Send(OutgoingFrame{std::move(begin), call_tracer, urgency},
+                          tokens),
               Loop([chunker = message_chunker_detail::PayloadChunker(
                         max_chunk_size_, alignment_, stream_id,
                         std::move(*message->payload())),
-                    &output, call_tracer = std::move(call_tracer)]() mutable {
+                    &output, call_tracer = std::move(call_tracer),
+                    urgency]() mutable {
                 auto next = chunker.NextChunk();
                 uint32_t tokens = FrameMpscTokens(next.frame);
                 return Map(
                     output.Send(
-                        OutgoingFrame{std::move(next.frame), call_tracer},
+                        OutgoingFrame{std::move(next.frame), call_tracer,
+                                      urgency},
                         tokens),
                     [done = next.done](StatusFlag x) -> LoopCtl<StatusFlag> {
                       if (!done) return Continue{};
@@ -125,7 +134,8 @@ class MessageChunker {
           frame.message = std::move(message);
           frame.stream_id = stream_id;
           uint32_t tokens = FrameMpscTokens(frame);
-          return output.Send(OutgoingFrame{std::move(frame), nullptr}, tokens);
+          return output.Send(
+              OutgoingFrame{std::move(frame), nullptr, urgency}, tokens);
         });
   }
 
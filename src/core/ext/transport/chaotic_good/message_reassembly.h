@@ -15,17 +15,142 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_REASSEMBLY_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_MESSAGE_REASSEMBLY_H
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
 #include "src/core/call/call_spine.h"
+#include "src/core/channelz/property_list.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/util/grpc_check.h"
 #include "absl/log/log.h"
 
 namespace grpc_core {
 namespace chaotic_good {
 
+// Counters for the chunked messages reassembled on all streams of a
+// transport, for channelz.
+struct MessageReassemblyStats {
+  std::atomic<uint64_t> messages{0};
+  std::atomic<uint64_t> chunks{0};
+  std::atomic<uint64_t> bytes{0};
+  // Reassembly takes references to the slices that chunks were read into;
+  // the only bytes it copies are those of slices small enough to be held
+  // inline, which have no reference to take.
+  std::atomic<uint64_t> bytes_copied{0};
+  std::atomic<uint64_t> max_bytes_copied_per_message{0};
+  // Chunks that did not start at a decode_alignment boundary in memory, and
+  // so reached the application unaligned: the endpoint could not place the
+  // read where we asked.
+  std::atomic<uint64_t> misaligned_chunks{0};
+
+  void RecordMessage(uint64_t message_bytes, uint64_t message_chunks,
+                     uint64_t message_bytes_copied,
+                     uint64_t message_misaligned_chunks) {
+    messages.fetch_add(1, std::memory_order_relaxed);
+    chunks.fetch_add(message_chunks, std::memory_order_relaxed);
+    bytes.fetch_add(message_bytes, std::memory_order_relaxed);
+    if (message_bytes_copied != 0) {
+      bytes_copied.fetch_add(message_bytes_copied, std::memory_order_relaxed);
+      uint64_t max =
+          max_bytes_copied_per_message.load(std::memory_order_relaxed);
+      while (max < message_bytes_copied &&
+             !max_bytes_copied_per_message.compare_exchange_weak(
+                 max, message_bytes_copied, std::memory_order_relaxed)) {
+      }
+    }
+    if (message_misaligned_chunks != 0) {
+      misaligned_chunks.fetch_add(message_misaligned_chunks,
+                                  std::memory_order_relaxed);
+    }
+  }
+
+  channelz::PropertyList ToPropertyList() const {
+    const uint64_t messages = this->messages.load(std::memory_order_relaxed);
+    const uint64_t bytes_copied =
+        this->bytes_copied.load(std::memory_order_relaxed);
+    return channelz::PropertyList()
+        .Set("messages", messages)
+        .Set("chunks", chunks.load(std::memory_order_relaxed))
+        .Set("bytes", bytes.load(std::memory_order_relaxed))
+        .Set("bytes_copied", bytes_copied)
+        .Set("mean_bytes_copied_per_message",
+             messages == 0 ? 0.0
+                           : static_cast<double>(bytes_copied) / messages)
+        .Set("max_bytes_copied_per_message",
+             max_bytes_copied_per_message.load(std::memory_order_relaxed))
+        .Set("misaligned_chunks",
+             misaligned_chunks.load(std::memory_order_relaxed));
+  }
+};
+
+// The chunks of one message, stitched together by reference in the slices
+// they were read into.
+class ChunkedMessage {
+ public:
+  ChunkedMessage(size_t length, uint32_t alignment)
+      : bytes_remaining_(length), alignment_(alignment) {}
+
+  size_t bytes_remaining() const { return bytes_remaining_; }
+
+  // Moves the slices of `payload` onto the end of the message; `payload`
+  // must be no longer than bytes_remaining().
+  void AddChunk(SliceBuffer& payload) {
+    GRPC_DCHECK_LE(payload.Length(), bytes_remaining_);
+    bytes_remaining_ -= payload.Length();
+    ++chunks_;
+    if (payload.Count() == 0) return;
+    for (size_t i = 0; i < payload.Count(); ++i) {
+      const grpc_slice& slice = payload.c_slice_at(i);
+      if (slice.refcount == nullptr) bytes_copied_ += GRPC_SLICE_LENGTH(slice);
+    }
+    const uintptr_t start = reinterpret_cast<uintptr_t>(
+        GRPC_SLICE_START_PTR(payload.c_slice_at(0)));
+    if (alignment_ > 1 && start % alignment_ != 0) ++misaligned_chunks_;
+    payload_.TakeAndAppend(payload);
+  }
+
+  // Once bytes_remaining() is zero: the message, recorded in `stats` if that
+  // is not null.
+  SliceBuffer TakePayload(MessageReassemblyStats* stats) {
+    GRPC_DCHECK_EQ(bytes_remaining_, 0u);
+    if (stats != nullptr) {
+      stats->RecordMessage(payload_.Length(), chunks_, bytes_copied_,
+                           misaligned_chunks_);
+    }
+    return std::move(payload_);
+  }
+
+  uint64_t chunks() const { return chunks_; }
+  uint64_t bytes_copied() const { return bytes_copied_; }
+  uint64_t misaligned_chunks() const { return misaligned_chunks_; }
+
+ private:
+  size_t bytes_remaining_;
+  const uint32_t alignment_;
+  SliceBuffer payload_;
+  uint64_t chunks_ = 0;
+  uint64_t bytes_copied_ = 0;
+  uint64_t misaligned_chunks_ = 0;
+};
+
 // Reassemble chunks of messages into messages, and enforce invariants about
 // never having two messages in flight on the same stream.
+//
+// Chunks are stitched together by ChunkedMessage: since every chunk but the
+// last is a whole number of alignment units (see PayloadChunker), a message
+// whose chunks were each read to a `decode_alignment` boundary reaches the
+// application with all of its slices aligned, with nothing copied.
 class MessageReassembly {
  public:
+  MessageReassembly() = default;
+  MessageReassembly(uint32_t decode_alignment,
+                    std::shared_ptr<MessageReassemblyStats> stats)
+      : decode_alignment_(decode_alignment), stats_(std::move(stats)) {}
+
   void FailCall(CallInitiator& call, absl::string_view msg) {
     LOG_EVERY_N_SEC(INFO, 10) << "Call failed during reassembly: " << msg;
     call.Cancel();
@@ -64,8 +189,8 @@ class MessageReassembly {
     } else {
       GRPC_TRACE_LOG(chaotic_good, INFO)
           << this << " begin message " << frame.body.ShortDebugString();
-      chunk_receiver_ = std::make_unique<ChunkReceiver>();
-      chunk_receiver_->bytes_remaining = frame.body.length();
+      chunked_message_ = std::make_unique<ChunkedMessage>(frame.body.length(),
+                                                          decode_alignment_);
       ok = true;
     }
     return Immediate(StatusFlag(ok));
@@ -77,17 +202,17 @@ class MessageReassembly {
     bool done = false;
     if (in_message_boundary()) {
       FailCall(sink, "Received message chunk without BeginMessage");
-    } else if (chunk_receiver_->bytes_remaining < frame.payload.Length()) {
+    } else if (chunked_message_->bytes_remaining() <
+               frame.payload.Length()) {
       FailCall(sink, "Message chunks are longer than BeginMessage declared");
     } else {
       GRPC_TRACE_LOG(chaotic_good, INFO)
           << "CHAOTIC_GOOD: " << this << " got chunk " << frame.payload.Length()
-          << "b in message with " << chunk_receiver_->bytes_remaining
+          << "b in message with " << chunked_message_->bytes_remaining()
           << "b left";
-      chunk_receiver_->bytes_remaining -= frame.payload.Length();
-      chunk_receiver_->incoming.Append(frame.payload);
+      chunked_message_->AddChunk(frame.payload);
       ok = true;
-      done = chunk_receiver_->bytes_remaining == 0;
+      done = chunked_message_->bytes_remaining() == 0;
       GRPC_TRACE_LOG(chaotic_good, INFO)
           << "CHAOTIC_GOOD: " << this << " " << GRPC_DUMP_ARGS(ok, done);
     }
@@ -95,21 +220,19 @@ class MessageReassembly {
         done,
         [&]() {
           auto message = Arena::MakePooled<Message>(
-              std::move(chunk_receiver_->incoming), 0);
-          chunk_receiver_.reset();
+              chunked_message_->TakePayload(stats_.get()), 0);
+          chunked_message_.reset();
           return sink.PushMessage(std::move(message));
         },
         [ok]() { return StatusFlag(ok); });
   }
 
-  bool in_message_boundary() { return chunk_receiver_ == nullptr; }
+  bool in_message_boundary() { return chunked_message_ == nullptr; }
 
  private:
-  struct ChunkReceiver {
-    size_t bytes_remaining;
-    SliceBuffer incoming;
-  };
-  std::unique_ptr<ChunkReceiver> chunk_receiver_;
+  uint32_t decode_alignment_ = 1;
+  std::shared_ptr<MessageReassemblyStats> stats_;
+  std::unique_ptr<ChunkedMessage> chunked_message_;
 };
 
 }  // namespace chaotic_good
@@ -107,7 +107,10 @@ class SimpleScheduler : public Scheduler {
   void AddChannel(uint32_t id, bool ready,
                   const SendRate::DeliveryData& delivery_data) override {
     channels_.emplace_back(Channel{id, ready, delivery_data});
-    scheduled_bytes_per_channel_.push_back(0);
+    // Ids need not be dense: retired endpoints leave holes.
+    if (scheduled_bytes_per_channel_.size() <= id) {
+      scheduled_bytes_per_channel_.resize(id + 1, 0);
+    }
   }
 
   void MakePlan(TcpZTraceCollector&) override {
@@ -116,7 +119,8 @@ class SimpleScheduler : public Scheduler {
                  channels_.begin();
   }
 
-  std::optional<uint32_t> AllocateMessage(uint64_t bytes) override {
+  std::optional<uint32_t> AllocateMessage(uint64_t bytes,
+                                          const MessageUrgency&) override {
     const Channel* c = ChooseChannel(bytes);
 
     if (c == nullptr) return std::nullopt;
@@ -407,6 +411,9 @@ class RandomChoiceScheduler final : public SimpleScheduler {
 // channels only when there's a small amount of work available.
 class SpanScheduler : public Scheduler {
  public:
+  SpanScheduler() = default;
+  explicit SpanScheduler(double step) : end_time_requested_(step) {}
+
   void NewStep(double outstanding_bytes, double min_tokens) override;
 
   void SetConfig(absl::string_view name, absl::string_view value) override;
@@ -421,7 +428,8 @@ class SpanScheduler : public Scheduler {
   // If successful, returns the id of a ready channel to assign the bytes.
   // If this is not possible (all messages must go to non-ready channels),
   // returns nullopt.
-  std::optional<uint32_t> AllocateMessage(uint64_t bytes) override;
+  std::optional<uint32_t> AllocateMessage(
+      uint64_t bytes, const MessageUrgency& urgency) override;
 
  protected:
   struct Channel {
@@ -447,6 +455,8 @@ class SpanScheduler : public Scheduler {
   const Channel* channel(size_t i) const { return &channels_[i]; }
   size_t num_ready() const { return num_ready_; }
   size_t num_channels() const { return channels_.size(); }
+  // The time by which this step's plan delivers the outstanding bytes.
+  double end_time() const { return end_time_; }
 
   std::string BaseConfig() const {
     return absl::StrCat(":step=", end_time_requested_);
@@ -455,7 +465,8 @@ class SpanScheduler : public Scheduler {
  private:
   void AdjustEndTimeForMinTokens();
   bool DistributeBytesToCollective(size_t max_channel_idx);
-  virtual const Channel* ChooseChannel(uint64_t bytes) = 0;
+  virtual const Channel* ChooseChannel(uint64_t bytes,
+                                       const MessageUrgency& urgency) = 0;
 
   double initial_outstanding_bytes_;
   double end_time_requested_ = 1.0;
@@ -577,9 +588,10 @@ bool SpanScheduler::DistributeBytesToCollective(size_t max_channel_idx) {
   return true;
 }
 
-std::optional<uint32_t> SpanScheduler::AllocateMessage(uint64_t bytes) {
+std::optional<uint32_t> SpanScheduler::AllocateMessage(
+    uint64_t bytes, const MessageUrgency& urgency) {
   if (num_ready_ == 0) return std::nullopt;
-  const Channel* c = ChooseChannel(bytes);
+  const Channel* c = ChooseChannel(bytes, urgency);
   if (c == nullptr || c >= channels_.data() + num_ready_) return std::nullopt;
   Channel& chan = channels_[(c - channels_.data())];
   DCHECK(chan.ready);
@@ -638,7 +650,8 @@ class SpanRoundRobinScheduler final : public SpanScheduler {
     }
   }
 
-  const Channel* ChooseChannel(uint64_t bytes) override {
+  const Channel* ChooseChannel(uint64_t bytes,
+                               const MessageUrgency&) override {
     DCHECK_LT(next_ready_, num_ready());
     // First search: we round robin through the ready channels, and choose the
     // first one that has space.
@@ -696,6 +709,94 @@ class SpanRoundRobinScheduler final : public SpanScheduler {
   EndOfBurst end_of_burst_ = EndOfBurst::kRandomDeliveryTime;
 };
 
+// DeadlineScheduler plans like SpanScheduler, but also looks at how soon each
+// message is needed, so that short urgent calls do not queue behind bulk
+// transfers on the same data endpoint.
+//
+// Messages are offered most urgent first. A message is urgent if its call's
+// priority is at least urgent_priority, or its call's deadline is less than
+// urgent_deadline seconds away: urgent messages go to whichever ready channel
+// will deliver them soonest, whatever the plan says.
+//
+// Other messages are placed round robin against the plan, as with spanrr,
+// except that:
+// - a message that would miss its deadline on its round robin channel goes to
+//   the ready channel that delivers it soonest instead.
+// - once the plan is used up, messages are held back instead of being queued
+//   onto channels that are busy past the end of the step (so long as some
+//   channel is busy, and will ask for more when it is done). With the short
+//   default step this keeps bulk data from building up on the endpoints that
+//   urgent messages will need.
+class DeadlineScheduler final : public SpanScheduler {
+ public:
+  DeadlineScheduler() : SpanScheduler(/*step=*/0.01) {}
+
+  void NewStep(double outstanding_bytes, double min_tokens) override {
+    SpanScheduler::NewStep(outstanding_bytes, min_tokens);
+    next_ready_ = 0;
+  }
+
+  void SetConfig(absl::string_view name, absl::string_view value) override {
+    if (!ParseConfig(name, value)
+             .Var("urgent_priority", urgent_priority_)
+             .Var("urgent_deadline", urgent_deadline_)
+             .parsed()) {
+      SpanScheduler::SetConfig(name, value);
+    }
+  }
+
+  bool OrdersByUrgency() const override { return true; }
+
+  std::string Config() const override {
+    return absl::StrCat("deadline:urgent_priority=", urgent_priority_,
+                        ":urgent_deadline=", urgent_deadline_, BaseConfig());
+  }
+
+ private:
+  bool IsUrgent(const MessageUrgency& urgency) const {
+    return urgency.priority >= urgent_priority_ ||
+           urgency.deadline < urgent_deadline_;
+  }
+
+  static double DeliveryTime(const Channel* c, uint64_t bytes) {
+    return c->start_time + bytes / c->bytes_per_second;
+  }
+
+  const Channel* SoonestReadyChannel(uint64_t bytes) const {
+    const Channel* soonest = nullptr;
+    for (const Channel& c : ready_channels()) {
+      if (soonest == nullptr ||
+          DeliveryTime(&c, bytes) < DeliveryTime(soonest, bytes)) {
+        soonest = &c;
+      }
+    }
+    return soonest;
+  }
+
+  const Channel* ChooseChannel(uint64_t bytes,
+                               const MessageUrgency& urgency) override {
+    DCHECK_LT(next_ready_, num_ready());
+    if (IsUrgent(urgency)) return SoonestReadyChannel(bytes);
+    const size_t first_checked = next_ready_;
+    do {
+      const Channel* c = channel(next_ready_);
+      next_ready_ = (next_ready_ + 1) % num_ready();
+      if (c->allowed_bytes < bytes) continue;
+      if (DeliveryTime(c, bytes) > urgency.deadline) break;
+      return c;
+    } while (next_ready_ != first_checked);
+    const Channel* c = SoonestReadyChannel(bytes);
+    if (c->start_time > end_time() && num_ready() < num_channels()) {
+      return nullptr;
+    }
+    return c;
+  }
+
+  size_t next_ready_ = 0;
+  uint64_t urgent_priority_ = 1;
+  double urgent_deadline_ = 1.0;
+};
+
 }  // namespace
 
 std::unique_ptr<Scheduler> MakeScheduler(absl::string_view config) {
@@ -708,6 +809,8 @@ std::unique_ptr<Scheduler> MakeScheduler(absl::string_view config) {
     scheduler = std::make_unique<RandomChoiceScheduler>();
   } else if (name == "pick_best") {
     scheduler = std::make_unique<PickBestScheduler>();
+  } else if (name == "deadline") {
+    scheduler = std::make_unique<DeadlineScheduler>();
   } else {
     LOG(ERROR) << "Unknown scheduler type: " << name
                << " using spanrr scheduler";
@@ -15,6 +15,8 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SCHEDULER_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SCHEDULER_H
 
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <string>
@@ -25,6 +27,14 @@
 
 namespace grpc_core::chaotic_good {
 
+// How soon a message is needed, as the scheduler sees it.
+struct MessageUrgency {
+  // Seconds from now until the deadline of the message's call.
+  double deadline = std::numeric_limits<double>::infinity();
+  // Larger is more urgent.
+  uint32_t priority = 0;
+};
+
 // Scheduler defines an interface for scheduling frames across multiple data
 // endpoints.
 // This class is used in two phases:
@@ -56,7 +66,12 @@ class Scheduler {
   // If successful, returns the id of a ready channel to assign the bytes.
   // If this is not possible (all messages must go to non-ready channels),
   // returns nullopt.
-  virtual std::optional<uint32_t> AllocateMessage(uint64_t bytes) = 0;
+  virtual std::optional<uint32_t> AllocateMessage(
+      uint64_t bytes, const MessageUrgency& urgency) = 0;
+
+  // If true, messages are offered to AllocateMessage most urgent first
+  // (CallUrgency::MoreUrgent) instead of in the order they were sent.
+  virtual bool OrdersByUrgency() const { return false; }
 
   // Should only return config data.
   virtual std::string Config() const = 0;
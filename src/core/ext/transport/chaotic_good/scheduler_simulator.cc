@@ -0,0 +1,382 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/scheduler_simulator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/core/ext/transport/chaotic_good/scheduler.h"
+#include "src/core/ext/transport/chaotic_good/send_rate.h"
+#include "src/core/util/grpc_check.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/str_join.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+double SimulatedLink::BytesPerSecondAt(double time) const {
+  if (rates.empty()) return 0;
+  auto it = std::upper_bound(
+      rates.begin(), rates.end(), time,
+      [](double time, const Rate& rate) { return time < rate.time; });
+  if (it == rates.begin()) return it->bytes_per_second;
+  return std::prev(it)->bytes_per_second;
+}
+
+SchedulerWorkload MakeSyntheticWorkload(std::vector<SimulatedLink> links,
+                                        absl::Span<const SyntheticFlow> flows) {
+  SchedulerWorkload workload;
+  workload.links = std::move(links);
+  for (const SyntheticFlow& flow : flows) {
+    GRPC_CHECK_GT(flow.bytes_per_second, 0);
+    GRPC_CHECK_GT(flow.message_size, 0u);
+    const double interval = flow.message_size / flow.bytes_per_second;
+    for (uint64_t i = 0;; ++i) {
+      // Multiply rather than accumulate, so long flows do not drift.
+      const double send_time = flow.start_time + i * interval;
+      if (send_time >= flow.end_time) break;
+      workload.messages.push_back(SimulatedMessage{
+          send_time, flow.message_size, flow.priority, flow.deadline});
+    }
+  }
+  std::stable_sort(workload.messages.begin(), workload.messages.end(),
+                   [](const SimulatedMessage& a, const SimulatedMessage& b) {
+                     return a.send_time < b.send_time;
+                   });
+  return workload;
+}
+
+void TraceWorkloadBuilder::AddSchedule(double time,
+                                       const TraceWriteSchedule& schedule) {
+  for (const TraceScheduledChannel& scheduled : schedule.channels) {
+    Channel& channel = channels_[scheduled.id];
+    channel.min_start_time =
+        std::min(channel.min_start_time, scheduled.start_time);
+    const double rate = scheduled.bytes_per_second;
+    if (rate <= 0 || rate >= SendRate::kUnmeasuredBytesPerSecond) continue;
+    if (channel.rates.empty() ||
+        channel.rates.back().bytes_per_second != rate) {
+      channel.rates.push_back(SimulatedLink::Rate{time, rate});
+    }
+  }
+}
+
+void TraceWorkloadBuilder::AddWrite(double time,
+                                    const WriteLargeFrameHeaderTrace& write) {
+  messages_.push_back(SimulatedMessage{time, write.payload_size});
+}
+
+absl::StatusOr<SchedulerWorkload> TraceWorkloadBuilder::Build() const {
+  SchedulerWorkload workload;
+  for (const auto& [id, channel] : channels_) {
+    if (channel.rates.empty()) continue;
+    SimulatedLink link;
+    link.rates = channel.rates;
+    std::stable_sort(
+        link.rates.begin(), link.rates.end(),
+        [](const SimulatedLink::Rate& a, const SimulatedLink::Rate& b) {
+          return a.time < b.time;
+        });
+    link.one_way_delay = std::max(0.0, channel.min_start_time);
+    workload.links.push_back(std::move(link));
+  }
+  if (workload.links.empty()) {
+    return absl::InvalidArgumentError(
+        "trace has no data endpoint with a measured rate");
+  }
+  if (messages_.empty()) {
+    return absl::InvalidArgumentError("trace has no data endpoint writes");
+  }
+  workload.messages = messages_;
+  std::stable_sort(workload.messages.begin(), workload.messages.end(),
+                   [](const SimulatedMessage& a, const SimulatedMessage& b) {
+                     return a.send_time < b.send_time;
+                   });
+  return workload;
+}
+
+SchedulerSimulationResult::Distribution
+SchedulerSimulationResult::Distribution::FromSamples(
+    std::vector<double> samples) {
+  Distribution distribution;
+  if (samples.empty()) return distribution;
+  std::sort(samples.begin(), samples.end());
+  auto percentile = [&samples](double fraction) {
+    return samples[std::min(samples.size() - 1,
+                            static_cast<size_t>(fraction * samples.size()))];
+  };
+  distribution.mean =
+      std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+  distribution.p50 = percentile(0.5);
+  distribution.p90 = percentile(0.9);
+  distribution.p99 = percentile(0.99);
+  distribution.p999 = percentile(0.999);
+  distribution.max = samples.back();
+  return distribution;
+}
+
+std::string SchedulerSimulationResult::ToString() const {
+  auto milliseconds = [](const Distribution& distribution) {
+    return absl::StrFormat(
+        "mean=%.3fms p50=%.3fms p90=%.3fms p99=%.3fms p99.9=%.3fms "
+        "max=%.3fms",
+        distribution.mean * 1e3, distribution.p50 * 1e3,
+        distribution.p90 * 1e3, distribution.p99 * 1e3,
+        distribution.p999 * 1e3, distribution.max * 1e3);
+  };
+  std::string out = absl::StrFormat(
+      "%s: delivered %d/%d messages (%d bytes) in %.3fs: %.3fMB/s\n"
+      "  queueing delay: %s\n"
+      "  latency:        %s\n",
+      scheduler_config, messages_delivered, messages_sent, bytes_delivered,
+      duration, bytes_per_second / 1e6, milliseconds(queueing_delay),
+      milliseconds(latency));
+  if (latency_by_priority.size() > 1) {
+    for (const auto& [priority, distribution] : latency_by_priority) {
+      absl::StrAppendFormat(&out, "    priority %d: %s\n", priority,
+                            milliseconds(distribution));
+    }
+  }
+  absl::StrAppendFormat(&out, "  deadlines missed: %d; bytes per link: [%s]\n",
+                        deadlines_missed, absl::StrJoin(bytes_per_link, ", "));
+  return out;
+}
+
+namespace {
+
+// SendRate treats a zero timestamp as unset.
+constexpr uint64_t kStartNanos = 1000000000;
+
+class Simulation {
+ public:
+  Simulation(absl::string_view scheduler_config,
+             const SchedulerWorkload& workload,
+             const SchedulerSimulationOptions& options)
+      : workload_(workload),
+        options_(options),
+        scheduler_(MakeScheduler(scheduler_config)),
+        links_(workload.links.size()),
+        messages_(workload.messages.size()) {
+    result_.scheduler_config = std::string(scheduler_config);
+    result_.messages_sent = workload.messages.size();
+    result_.bytes_per_link.resize(workload.links.size(), 0);
+  }
+
+  SchedulerSimulationResult Run() {
+    const uint64_t tick_nanos =
+        std::max<uint64_t>(1, std::llround(options_.tick_seconds * 1e9));
+    double next_measurement = options_.measurement_interval;
+    for (uint64_t tick = 0; delivered_ < messages_.size(); ++tick) {
+      const uint64_t now_nanos = kStartNanos + tick * tick_nanos;
+      const double now = tick * tick_nanos * 1e-9;
+      if (now > options_.max_seconds) break;
+      if (now >= next_measurement) {
+        Measure(now, now_nanos);
+        next_measurement += options_.measurement_interval;
+      }
+      while (next_to_send_ < messages_.size() &&
+             workload_.messages[next_to_send_].send_time <= now) {
+        pending_.push_back(next_to_send_++);
+      }
+      Schedule(now, now_nanos);
+      Transmit(now, tick_nanos * 1e-9);
+    }
+    return Finish();
+  }
+
+ private:
+  struct Link {
+    SendRate send_rate;
+    // Messages placed on this link, and bytes of each still to send.
+    std::deque<std::pair<size_t, uint64_t>> queue;
+    uint64_t queued_bytes = 0;
+    // Fraction of a byte that the link could have sent last tick.
+    double credit = 0;
+  };
+
+  struct MessageState {
+    double placed = -1;
+    double delivered = -1;
+  };
+
+  void Measure(double now, uint64_t now_nanos) {
+    for (size_t i = 0; i < links_.size(); ++i) {
+      const SimulatedLink& model = workload_.links[i];
+      links_[i].send_rate.SetNetworkMetrics(
+          SendRate::NetworkSend{now_nanos, links_[i].queued_bytes},
+          SendRate::NetworkMetrics{
+              static_cast<uint64_t>(model.one_way_delay * 2e6),
+              model.BytesPerSecondAt(now) * 1e-9});
+    }
+  }
+
+  void Schedule(double now, uint64_t now_nanos) {
+    if (pending_.empty()) return;
+    const bool by_urgency = scheduler_->OrdersByUrgency();
+    if (by_urgency) {
+      std::stable_sort(pending_.begin(), pending_.end(),
+                       [this](size_t a, size_t b) {
+                         const SimulatedMessage& x = workload_.messages[a];
+                         const SimulatedMessage& y = workload_.messages[b];
+                         if (x.priority != y.priority) {
+                           return x.priority > y.priority;
+                         }
+                         return x.send_time + x.deadline <
+                                y.send_time + y.deadline;
+                       });
+    }
+    double outstanding_bytes = 0;
+    for (size_t index : pending_) {
+      outstanding_bytes += workload_.messages[index].bytes;
+    }
+    scheduler_->NewStep(outstanding_bytes,
+                        workload_.messages[pending_.front()].bytes);
+    for (size_t i = 0; i < links_.size(); ++i) {
+      const bool ready = links_[i].queued_bytes < options_.send_buffer_bytes;
+      scheduler_->AddChannel(i, ready,
+                             links_[i].send_rate.GetDeliveryData(now_nanos));
+    }
+    scheduler_->MakePlan(ztrace_collector_);
+    size_t placed = 0;
+    for (; placed < pending_.size(); ++placed) {
+      const size_t index = pending_[placed];
+      const SimulatedMessage& message = workload_.messages[index];
+      auto id = scheduler_->AllocateMessage(
+          message.bytes,
+          MessageUrgency{message.send_time + message.deadline - now,
+                         message.priority});
+      if (!id.has_value()) break;
+      GRPC_CHECK_LT(*id, links_.size());
+      Link& link = links_[*id];
+      link.queue.emplace_back(index, message.bytes);
+      link.queued_bytes += message.bytes;
+      link.send_rate.EnqueueToReader(message.bytes, now_nanos);
+      link.send_rate.DequeueFromReader(now_nanos);
+      messages_[index].placed = now;
+    }
+    pending_.erase(pending_.begin(), pending_.begin() + placed);
+  }
+
+  // Each link sends from the front of its queue for one tick: a message is
+  // delivered one way delay after its last byte left.
+  void Transmit(double now, double tick_seconds) {
+    for (size_t i = 0; i < links_.size(); ++i) {
+      Link& link = links_[i];
+      const double rate = workload_.links[i].BytesPerSecondAt(now);
+      if (link.queue.empty() || rate <= 0) {
+        link.credit = 0;
+        continue;
+      }
+      double budget = rate * tick_seconds + link.credit;
+      double used = 0;
+      while (!link.queue.empty() && budget - used >= 1) {
+        auto& [index, remaining] = link.queue.front();
+        const uint64_t sent = std::min<uint64_t>(
+            remaining, static_cast<uint64_t>(budget - used));
+        remaining -= sent;
+        used += sent;
+        link.queued_bytes -= sent;
+        if (remaining != 0) break;
+        const SimulatedMessage& message = workload_.messages[index];
+        messages_[index].delivered =
+            now + used / rate + workload_.links[i].one_way_delay;
+        result_.bytes_per_link[i] += message.bytes;
+        ++delivered_;
+        link.queue.pop_front();
+      }
+      link.credit = link.queue.empty() ? 0 : budget - used;
+      if (link.queue.empty()) link.send_rate.FinishEndpointWrite();
+    }
+  }
+
+  SchedulerSimulationResult Finish() {
+    std::vector<double> queueing_delays;
+    std::vector<double> latencies;
+    std::map<uint32_t, std::vector<double>> latencies_by_priority;
+    double first_send = std::numeric_limits<double>::infinity();
+    double last_delivery = 0;
+    for (size_t i = 0; i < messages_.size(); ++i) {
+      const SimulatedMessage& message = workload_.messages[i];
+      const MessageState& state = messages_[i];
+      first_send = std::min(first_send, message.send_time);
+      if (state.placed >= 0) {
+        queueing_delays.push_back(state.placed - message.send_time);
+      }
+      if (state.delivered < 0) {
+        if (std::isfinite(message.deadline)) ++result_.deadlines_missed;
+        continue;
+      }
+      const double latency = state.delivered - message.send_time;
+      latencies.push_back(latency);
+      latencies_by_priority[message.priority].push_back(latency);
+      last_delivery = std::max(last_delivery, state.delivered);
+      ++result_.messages_delivered;
+      result_.bytes_delivered += message.bytes;
+      if (latency > message.deadline) ++result_.deadlines_missed;
+    }
+    if (result_.messages_delivered != 0) {
+      result_.duration = last_delivery - first_send;
+      if (result_.duration > 0) {
+        result_.bytes_per_second = result_.bytes_delivered / result_.duration;
+      }
+    }
+    result_.queueing_delay =
+        SchedulerSimulationResult::Distribution::FromSamples(
+            std::move(queueing_delays));
+    result_.latency = SchedulerSimulationResult::Distribution::FromSamples(
+        std::move(latencies));
+    for (auto& [priority, samples] : latencies_by_priority) {
+      result_.latency_by_priority[priority] =
+          SchedulerSimulationResult::Distribution::FromSamples(
+              std::move(samples));
+    }
+    return std::move(result_);
+  }
+
+  const SchedulerWorkload& workload_;
+  const SchedulerSimulationOptions& options_;
+  std::unique_ptr<Scheduler> scheduler_;
+  TcpZTraceCollector ztrace_collector_;
+  std::vector<Link> links_;
+  std::vector<MessageState> messages_;
+  // Messages that have been sent but not yet placed on a link.
+  std::vector<size_t> pending_;
+  size_t next_to_send_ = 0;
+  size_t delivered_ = 0;
+  SchedulerSimulationResult result_;
+};
+
+}  // namespace
+
+SchedulerSimulationResult SimulateScheduler(
+    absl::string_view scheduler_config, const SchedulerWorkload& workload,
+    const SchedulerSimulationOptions& options) {
+  return Simulation(scheduler_config, workload, options).Run();
+}
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
@@ -0,0 +1,179 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SCHEDULER_SIMULATOR_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SCHEDULER_SIMULATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+// Offline simulation of chaotic_good data endpoint scheduling: replays a
+// workload (synthetic, or rebuilt from a connection's ztrace) through any
+// MakeScheduler() config against a model of the data endpoints' links, with
+// no network involved, so that configs can be compared in tests and tools.
+
+namespace grpc_core {
+namespace chaotic_good {
+
+// One data endpoint's path to the peer.
+struct SimulatedLink {
+  struct Rate {
+    // Seconds since the start of the simulation.
+    double time;
+    double bytes_per_second;
+  };
+  // Piecewise constant, sorted by time: each rate holds until the next. The
+  // first holds from the start.
+  std::vector<Rate> rates;
+  // Seconds from a byte leaving the socket to its arrival at the peer.
+  double one_way_delay = 0;
+
+  static SimulatedLink Constant(double bytes_per_second,
+                                double one_way_delay) {
+    return SimulatedLink{{{0, bytes_per_second}}, one_way_delay};
+  }
+
+  double BytesPerSecondAt(double time) const;
+};
+
+// A payload handed to the data endpoints.
+struct SimulatedMessage {
+  // Seconds since the start of the simulation.
+  double send_time;
+  uint64_t bytes;
+  uint32_t priority = 0;
+  // Seconds after send_time.
+  double deadline = std::numeric_limits<double>::infinity();
+};
+
+struct SchedulerWorkload {
+  std::vector<SimulatedLink> links;
+  // Sorted by send_time.
+  std::vector<SimulatedMessage> messages;
+};
+
+// Messages of message_size bytes sent evenly at bytes_per_second from
+// start_time until end_time.
+struct SyntheticFlow {
+  double start_time = 0;
+  double end_time;
+  double bytes_per_second;
+  uint64_t message_size;
+  uint32_t priority = 0;
+  double deadline = std::numeric_limits<double>::infinity();
+};
+
+SchedulerWorkload MakeSyntheticWorkload(std::vector<SimulatedLink> links,
+                                        absl::Span<const SyntheticFlow> flows);
+
+// Rebuilds a workload from the ztrace of a connection: each
+// WriteLargeFrameHeaderTrace becomes a message sent at the time it was
+// recorded, and the channels of each TraceWriteSchedule give the links.
+// A link's rate follows the measured rates recorded for its channel, and its
+// one way delay is the smallest start time recorded for it (when nothing was
+// queued on it, that is all that is left).
+//
+// The recorded writes are when the scheduler that was running placed each
+// payload, not when the application sent it, so a replay measures queueing
+// on top of whatever that scheduler added: use it to compare configs with
+// each other rather than with the recording.
+class TraceWorkloadBuilder {
+ public:
+  // `time` is in seconds since the start of the recording.
+  void AddSchedule(double time, const TraceWriteSchedule& schedule);
+  void AddWrite(double time, const WriteLargeFrameHeaderTrace& write);
+
+  // Fails if no channel ever had a measured rate, or nothing was written.
+  absl::StatusOr<SchedulerWorkload> Build() const;
+
+ private:
+  struct Channel {
+    std::vector<SimulatedLink::Rate> rates;
+    double min_start_time = std::numeric_limits<double>::infinity();
+  };
+
+  std::map<uint32_t, Channel> channels_;
+  std::vector<SimulatedMessage> messages_;
+};
+
+struct SchedulerSimulationOptions {
+  // Simulated time between scheduling steps.
+  double tick_seconds = 0.001;
+  // A link is ready for more payloads while less than this much is queued
+  // on it.
+  uint64_t send_buffer_bytes = 512 * 1024;
+  // How often each link's rate and delay are reported to its SendRate, as
+  // the kernel's metrics would be.
+  double measurement_interval = 0.01;
+  // Stop after this much simulated time, delivered or not.
+  double max_seconds = 600;
+};
+
+struct SchedulerSimulationResult {
+  struct Distribution {
+    double mean = 0;
+    double p50 = 0;
+    double p90 = 0;
+    double p99 = 0;
+    double p999 = 0;
+    double max = 0;
+
+    static Distribution FromSamples(std::vector<double> samples);
+  };
+
+  std::string scheduler_config;
+  size_t messages_sent = 0;
+  size_t messages_delivered = 0;
+  uint64_t bytes_delivered = 0;
+  // Seconds from the first message being sent to the last being delivered.
+  double duration = 0;
+  // bytes_delivered / duration.
+  double bytes_per_second = 0;
+  // Seconds from a message being sent until the scheduler placed it.
+  Distribution queueing_delay;
+  // Seconds from a message being sent until the peer had all of it.
+  Distribution latency;
+  // The same, for the messages of each priority.
+  std::map<uint32_t, Distribution> latency_by_priority;
+  size_t deadlines_missed = 0;
+  // Indexed like SchedulerWorkload::links.
+  std::vector<uint64_t> bytes_per_link;
+
+  std::string ToString() const;
+};
+
+// Runs `workload` through MakeScheduler(scheduler_config), stepping the
+// scheduler as OutputBuffers does: each tick the queued messages are offered
+// in order (or most urgent first if the scheduler asks) until it declines
+// one, and each link then sends what its rate allows, first in first out.
+//
+// Simulated time makes runs repeatable, save for schedulers that make random
+// choices.
+SchedulerSimulationResult SimulateScheduler(
+    absl::string_view scheduler_config, const SchedulerWorkload& workload,
+    const SchedulerSimulationOptions& options = {});
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SCHEDULER_SIMULATOR_H
@@ -80,7 +80,8 @@ SendRate::DeliveryData SendRate::GetDeliveryData(uint64_t current_time) const {
       ToRelativeTime(timestamps_.last_reader_dequeued_time, current_time);
   if (current_rate_ <= 0) {
     return DeliveryData{
-        (start_time + rtt_usec_ * 500.0) * 1e-9, 1e14, queued_bytes_,
+        (start_time + rtt_usec_ * 500.0) * 1e-9, kUnmeasuredBytesPerSecond,
+        queued_bytes_,
         DeliveryData::RelativeTimestamps{relative_last_scheduled_time,
                                          relative_last_reader_dequeued_time}};
   } else {
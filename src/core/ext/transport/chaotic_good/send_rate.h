@@ -25,6 +25,9 @@ namespace chaotic_good {
 
 class SendRate {
  public:
+  // DeliveryData::bytes_per_second until the rate has been measured.
+  static constexpr double kUnmeasuredBytesPerSecond = 1e14;
+
   explicit SendRate(
       double initial_rate = 0 /* <=0 ==> not set, bytes per nanosecond */)
       : current_rate_(initial_rate) {}
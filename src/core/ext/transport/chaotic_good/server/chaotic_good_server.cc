@@ -515,10 +515,18 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
                       auto settings_status =
                           config.ReceiveClientIncomingSettings(frame.body);
                       if (!settings_status.ok()) return settings_status;
+                      config.ServerAcceptSharedMemory(
+                          frame.body,
+                          self->connection_->endpoint_.GetPeerAddress());
+                      // Payloads go through shared memory if we can map it,
+                      // so then there is no need for data connections.
                       const int num_data_connections =
-                          self->connection_->listener_->args()
-                              .GetInt(GRPC_ARG_CHAOTIC_GOOD_DATA_CONNECTIONS)
-                              .value_or(1);
+                          config.uses_shared_memory()
+                              ? 0
+                              : self->connection_->listener_->args()
+                                    .GetInt(
+                                        GRPC_ARG_CHAOTIC_GOOD_DATA_CONNECTIONS)
+                                    .value_or(1);
                       auto& data_connection_listener =
                           *self->connection_->listener_
                                ->data_connection_listener_;
@@ -527,6 +535,10 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
                             data_connection_listener.RequestDataConnection(
                                 self->connection_->handshake_result_args()));
                       }
+                      config.ServerSetDataConnectionFactory(
+                          self->connection_->listener_
+                              ->data_connection_listener_,
+                          self->connection_->handshake_result_args());
                       self->data_.emplace<ControlConnection>(std::move(config));
                     }
                     return !frame.body.data_channel();
@@ -559,16 +571,15 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
         auto& ep = self->connection_->endpoint_;
         auto socket_node =
             TcpFrameTransport::MakeSocketNode(self->connection_->args(), ep);
-        auto frame_transport = MakeOrphanable<TcpFrameTransport>(
-            config.MakeTcpFrameTransportOptions(), std::move(ep),
-            config.TakePendingDataEndpoints(),
-            MakeRefCounted<TransportContext>(
-                self->connection_->handshake_result_args(),
-                std::move(socket_node)));
+        auto frame_transport = config.MakeFrameTransport(
+            std::move(ep), MakeRefCounted<TransportContext>(
+                               self->connection_->handshake_result_args(),
+                               std::move(socket_node)));
         return self->connection_->listener_->server_->SetupTransport(
             new ChaoticGoodServerTransport(
                 self->connection_->handshake_result_args(),
-                std::move(frame_transport), config.MakeMessageChunker()),
+                std::move(frame_transport), config.MakeMessageChunker(),
+                config.decode_alignment()),
             nullptr, self->connection_->handshake_result_args());
       });
 }
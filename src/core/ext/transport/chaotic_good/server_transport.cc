@@ -112,44 +112,46 @@ void ChaoticGoodServerTransport::StreamDispatch::DispatchFrame(
 
 auto ChaoticGoodServerTransport::StreamDispatch::SendCallBody(
     uint32_t stream_id, CallInitiator call_initiator,
-    std::shared_ptr<TcpCallTracer> call_tracer) {
+    std::shared_ptr<TcpCallTracer> call_tracer, CallUrgency urgency) {
   // Continuously send client frame with client to server messages.
   return ForEach(MessagesFrom(call_initiator),
-                 [this, stream_id, call_tracer = std::move(call_tracer)](
-                     MessageHandle message) mutable {
+                 [this, stream_id, call_tracer = std::move(call_tracer),
+                  urgency](MessageHandle message) mutable {
                    return message_chunker_.Send(std::move(message), stream_id,
-                                                call_tracer, outgoing_frames_);
+                                                call_tracer, urgency,
+                                                outgoing_frames_);
                  });
 }
 
 auto ChaoticGoodServerTransport::StreamDispatch::SendCallInitialMetadataAndBody(
     uint32_t stream_id, CallInitiator call_initiator,
-    std::shared_ptr<TcpCallTracer> call_tracer) {
+    std::shared_ptr<TcpCallTracer> call_tracer, CallUrgency urgency) {
   return TrySeq(
       // Wait for initial metadata then send it out.
       call_initiator.PullServerInitialMetadata(),
-      [stream_id, call_initiator, call_tracer = std::move(call_tracer),
+      [stream_id, call_initiator, call_tracer = std::move(call_tracer), urgency,
        this](std::optional<ServerMetadataHandle> md) mutable {
         GRPC_TRACE_LOG(chaotic_good, INFO)
             << "CHAOTIC_GOOD: SendCallInitialMetadataAndBody: md="
             << (md.has_value() ? (*md)->DebugString() : "null");
         return If(
             md.has_value(),
-            [&md, stream_id, &call_initiator, &call_tracer, this]() {
+            [&md, stream_id, &call_initiator, &call_tracer, urgency, this]() {
               ServerInitialMetadataFrame frame;
               frame.body = ServerMetadataProtoFromGrpc(**md);
               frame.stream_id = stream_id;
               return TrySeq(
                   outgoing_frames_.Send(
                       OutgoingFrame{std::move(frame), call_tracer}, 1),
-                  SendCallBody(stream_id, call_initiator, call_tracer));
+                  SendCallBody(stream_id, call_initiator, call_tracer,
+                               urgency));
             },
             []() { return StatusFlag(true); });
       });
 }
 
 auto ChaoticGoodServerTransport::StreamDispatch::CallOutboundLoop(
-    uint32_t stream_id, CallInitiator call_initiator) {
+    uint32_t stream_id, CallInitiator call_initiator, CallUrgency urgency) {
   std::shared_ptr<TcpCallTracer> call_tracer;
   auto tracer = call_initiator.arena()->GetContext<CallTracer>();
   if (tracer != nullptr && tracer->IsSampled()) {
@@ -158,7 +160,7 @@ auto ChaoticGoodServerTransport::StreamDispatch::CallOutboundLoop(
   return GRPC_LATENT_SEE_PROMISE(
       "CallOutboundLoop",
       Seq(Map(SendCallInitialMetadataAndBody(stream_id, call_initiator,
-                                             call_tracer),
+                                             call_tracer, urgency),
               [stream_id](StatusFlag main_body_result) {
                 GRPC_TRACE_VLOG(chaotic_good, 2)
                     << "CHAOTIC_GOOD: CallOutboundLoop: stream_id=" << stream_id
@@ -186,6 +188,8 @@ absl::Status ChaoticGoodServerTransport::StreamDispatch::NewStream(
   RefCountedPtr<Arena> arena(call_arena_allocator_->MakeArena());
   arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       ctx_->event_engine.get());
+  // Responses are as urgent as the request said the call was.
+  const CallUrgency urgency = CallUrgencyFromMetadata(**md);
   std::optional<CallInitiator> call_initiator;
   auto call = MakeCallPair(std::move(*md), std::move(arena));
   call_initiator.emplace(std::move(call.initiator));
@@ -196,9 +200,10 @@ absl::Status ChaoticGoodServerTransport::StreamDispatch::NewStream(
   }
   call_initiator->SpawnGuarded(
       "server-write", [this, stream_id, call_initiator = *call_initiator,
-                       call_handler = std::move(call.handler)]() mutable {
+                       call_handler = std::move(call.handler),
+                       urgency]() mutable {
         call_destination_->StartCall(std::move(call_handler));
-        return CallOutboundLoop(stream_id, call_initiator);
+        return CallOutboundLoop(stream_id, call_initiator, urgency);
       });
   return absl::OkStatus();
 }
@@ -261,13 +266,14 @@ void ChaoticGoodServerTransport::StreamDispatch::OnIncomingFrame(
 
 ChaoticGoodServerTransport::ChaoticGoodServerTransport(
     const ChannelArgs& args, OrphanablePtr<FrameTransport> frame_transport,
-    MessageChunker message_chunker)
-    : state_{std::make_unique<ConstructionParameters>(args, message_chunker)},
+    MessageChunker message_chunker, uint32_t decode_alignment)
+    : state_{std::make_unique<ConstructionParameters>(args, message_chunker,
+                                                      decode_alignment)},
       frame_transport_(std::move(frame_transport)) {}
 
 ChaoticGoodServerTransport::StreamDispatch::StreamDispatch(
     const ChannelArgs& args, FrameTransport* frame_transport,
-    MessageChunker message_chunker,
+    MessageChunker message_chunker, uint32_t decode_alignment,
     RefCountedPtr<UnstartedCallDestination> call_destination)
     : channelz::DataSource(frame_transport->ctx()->socket_node),
       ctx_(frame_transport->ctx()),
@@ -277,7 +283,8 @@ ChaoticGoodServerTransport::StreamDispatch::StreamDispatch(
               ->CreateMemoryAllocator("chaotic-good"),
           1024)),
       call_destination_(std::move(call_destination)),
-      message_chunker_(message_chunker) {
+      message_chunker_(message_chunker),
+      decode_alignment_(decode_alignment) {
   GRPC_CHECK(ctx_ != nullptr);
   auto party_arena = SimpleArenaAllocator(0)->MakeArena();
   party_arena->SetContext<grpc_event_engine::experimental::EventEngine>(
@@ -293,6 +300,7 @@ ChaoticGoodServerTransport::StreamDispatch::StreamDispatch(
 void ChaoticGoodServerTransport::StreamDispatch::AddData(
     channelz::DataSink sink) {
   party_->ExportToChannelz("transport_party", sink);
+  sink.AddData("message_reassembly", reassembly_stats_->ToPropertyList());
   MutexLock lock(&mu_);
   sink.AddData("transport_state",
                channelz::PropertyList()
@@ -306,7 +314,8 @@ void ChaoticGoodServerTransport::SetCallDestination(
       std::move(std::get<std::unique_ptr<ConstructionParameters>>(state_));
   state_ = MakeRefCounted<StreamDispatch>(
       construction_parameters->args, frame_transport_.get(),
-      construction_parameters->message_chunker, std::move(call_destination));
+      construction_parameters->message_chunker,
+      construction_parameters->decode_alignment, std::move(call_destination));
 }
 
 void ChaoticGoodServerTransport::Orphan() {
@@ -393,8 +402,9 @@ absl::Status ChaoticGoodServerTransport::StreamDispatch::AddStream(
   if (!on_done_added) {
     return absl::CancelledError();
   }
-  stream_map_.emplace(stream_id,
-                      MakeRefCounted<Stream>(std::move(call_initiator)));
+  stream_map_.emplace(
+      stream_id, MakeRefCounted<Stream>(std::move(call_initiator),
+                                        decode_alignment_, reassembly_stats_));
   return absl::OkStatus();
 }
 
@@ -36,6 +36,7 @@
 #include <variant>
 
 #include "src/core/call/metadata_batch.h"
+#include "src/core/ext/transport/chaotic_good/call_urgency.h"
 #include "src/core/ext/transport/chaotic_good/config.h"
 #include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_header.h"
@@ -81,7 +82,8 @@ class ChaoticGoodServerTransport final : public ServerTransport {
  public:
   ChaoticGoodServerTransport(const ChannelArgs& args,
                              OrphanablePtr<FrameTransport> frame_transport,
-                             MessageChunker message_chunker);
+                             MessageChunker message_chunker,
+                             uint32_t decode_alignment = 1);
 
   FilterStackTransport* filter_stack_transport() override { return nullptr; }
   ClientTransport* client_transport() override { return nullptr; }
@@ -109,7 +111,10 @@ class ChaoticGoodServerTransport final : public ServerTransport {
 
  private:
   struct Stream : public RefCounted<Stream> {
-    explicit Stream(CallInitiator call) : call(std::move(call)) {}
+    Stream(CallInitiator call, uint32_t decode_alignment,
+           std::shared_ptr<MessageReassemblyStats> reassembly_stats)
+        : call(std::move(call)),
+          message_reassembly(decode_alignment, std::move(reassembly_stats)) {}
     CallInitiator call;
     MessageReassembly message_reassembly;
     Party::SpawnSerializer* spawn_serializer =
@@ -121,7 +126,7 @@ class ChaoticGoodServerTransport final : public ServerTransport {
                                public channelz::DataSource {
    public:
     StreamDispatch(const ChannelArgs& args, FrameTransport* frame_transport,
-                   MessageChunker message_chunker,
+                   MessageChunker message_chunker, uint32_t decode_alignment,
                    RefCountedPtr<UnstartedCallDestination> call_destination);
     ~StreamDispatch() override { SourceDestructing(); }
 
@@ -154,10 +159,12 @@ class ChaoticGoodServerTransport final : public ServerTransport {
                            MessageChunkFrame frame);
     auto SendCallInitialMetadataAndBody(
         uint32_t stream_id, CallInitiator call_initiator,
-        std::shared_ptr<TcpCallTracer> call_tracer);
+        std::shared_ptr<TcpCallTracer> call_tracer, CallUrgency urgency);
     auto SendCallBody(uint32_t stream_id, CallInitiator call_initiator,
-                      std::shared_ptr<TcpCallTracer> call_tracer);
-    auto CallOutboundLoop(uint32_t stream_id, CallInitiator call_initiator);
+                      std::shared_ptr<TcpCallTracer> call_tracer,
+                      CallUrgency urgency);
+    auto CallOutboundLoop(uint32_t stream_id, CallInitiator call_initiator,
+                          CallUrgency urgency);
     auto ProcessNextFrame(IncomingFrame frame);
 
     Mutex mu_;
@@ -170,16 +177,23 @@ class ChaoticGoodServerTransport final : public ServerTransport {
     const RefCountedPtr<UnstartedCallDestination> call_destination_;
     Party::SpawnSerializer* incoming_frame_spawner_;
     MessageChunker message_chunker_;
+    const uint32_t decode_alignment_;
+    const std::shared_ptr<MessageReassemblyStats> reassembly_stats_ =
+        std::make_shared<MessageReassemblyStats>();
     MpscSender<OutgoingFrame> outgoing_frames_;
     RefCountedPtr<Party> party_;
   };
 
   struct ConstructionParameters {
     ConstructionParameters(const ChannelArgs& args,
-                           MessageChunker message_chunker)
-        : args(args), message_chunker(message_chunker) {}
+                           MessageChunker message_chunker,
+                           uint32_t decode_alignment)
+        : args(args),
+          message_chunker(message_chunker),
+          decode_alignment(decode_alignment) {}
     ChannelArgs args;
     MessageChunker message_chunker;
+    uint32_t decode_alignment;
   };
 
   // Read different parts of the server frame from control/data endpoints
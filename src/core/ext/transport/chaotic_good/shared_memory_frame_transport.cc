@@ -0,0 +1,228 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/shared_memory_frame_transport.h"
+
+#include <cstdint>
+#include <optional>
+
+#include "src/core/ext/transport/chaotic_good/control_endpoint.h"
+#include "src/core/ext/transport/chaotic_good/frame_transport.h"
+#include "src/core/ext/transport/chaotic_good/tcp_frame_header.h"
+#include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
+#include "src/core/ext/transport/chaotic_good/transport_context.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/promise/if.h"
+#include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/race.h"
+#include "src/core/lib/promise/try_seq.h"
+#include "src/core/lib/transport/transport_framing_endpoint_extension.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+namespace {
+TransportFramingEndpointExtension* GetTransportFramingEndpointExtension(
+    grpc_event_engine::experimental::EventEngine::Endpoint& endpoint) {
+  return grpc_event_engine::experimental::QueryExtension<
+      TransportFramingEndpointExtension>(&endpoint);
+}
+}  // namespace
+
+SharedMemoryFrameTransport::SharedMemoryFrameTransport(
+    Options options, PromiseEndpoint control_endpoint,
+    RefCountedPtr<SharedMemoryRegion> region, TransportContextPtr ctx)
+    : DataSource(ctx->socket_node),
+      ctx_(ctx),
+      control_endpoint_(std::move(control_endpoint), ctx, ztrace_collector_),
+      region_(std::move(region)),
+      options_(options) {
+  auto* transport_framing_endpoint_extension =
+      GetTransportFramingEndpointExtension(
+          *control_endpoint_.GetEventEngineEndpoint());
+  if (transport_framing_endpoint_extension != nullptr) {
+    transport_framing_endpoint_extension->SetSendFrameCallback(
+        control_endpoint_.SecureFrameWriterCallback());
+  }
+  SourceConstructed();
+}
+
+auto SharedMemoryFrameTransport::WriteFrame(
+    MpscQueued<OutgoingFrame> queued_frame) {
+  const auto& frame =
+      absl::ConvertVariantTo<FrameInterface&>(queued_frame->payload);
+  FrameHeader header = frame.MakeHeader();
+  GRPC_TRACE_LOG(chaotic_good, INFO)
+      << "CHAOTIC_GOOD: WriteFrame to:"
+      << ResolvedAddressToString(control_endpoint_.GetPeerAddress())
+             .value_or("<<unknown peer address>>")
+      << " " << frame.ToString();
+  SliceBuffer payload;
+  frame.SerializePayload(payload);
+  // Large payloads go through the region when it has room; everything else
+  // follows its header on the control endpoint.
+  std::optional<uint64_t> tag;
+  if (header.payload_length > options_.inlined_payload_size_threshold) {
+    tag = region_->WritePayload(payload);
+    if (tag.has_value()) {
+      shared_memory_payloads_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      region_full_payloads_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  SliceBuffer output;
+  TcpFrameHeader hdr{header, tag.value_or(0)};
+  GRPC_TRACE_LOG(chaotic_good, INFO)
+      << "CHAOTIC_GOOD: Send control frame " << hdr.ToString();
+  ztrace_collector_->Append(WriteFrameHeaderTrace{hdr});
+  hdr.Serialize(output.AddTiny(TcpFrameHeader::kFrameHeaderSize));
+  if (!tag.has_value()) output.TakeAndAppend(payload);
+  return control_endpoint_.Write(std::move(output));
+}
+
+auto SharedMemoryFrameTransport::WriteLoop(MpscReceiver<OutgoingFrame> frames) {
+  return Loop([self = RefAsSubclass<SharedMemoryFrameTransport>(),
+               frames = std::move(frames)]() mutable {
+    return TrySeq(
+        frames.Next(),
+        [self = self.get()](MpscQueued<OutgoingFrame> outgoing_frame) {
+          return self->WriteFrame(std::move(outgoing_frame));
+        },
+        []() -> LoopCtl<absl::Status> { return Continue(); });
+  });
+}
+
+auto SharedMemoryFrameTransport::ReadFrameBytes() {
+  return Loop([this]() {
+    return TrySeq(
+        control_endpoint_.ReadSlice(TcpFrameHeader::kFrameHeaderSize),
+        [this](Slice read_buffer) {
+          auto frame_header =
+              TcpFrameHeader::Parse(reinterpret_cast<const uint8_t*>(
+                  GRPC_SLICE_START_PTR(read_buffer.c_slice())));
+          GRPC_TRACE_LOG(chaotic_good, INFO)
+              << "CHAOTIC_GOOD: ReadHeader from:"
+              << ResolvedAddressToString(control_endpoint_.GetPeerAddress())
+                     .value_or("<<unknown peer address>>")
+              << " "
+              << (frame_header.ok() ? frame_header->ToString()
+                                    : frame_header.status().ToString());
+          return frame_header;
+        },
+        [this](TcpFrameHeader frame_header) {
+          ztrace_collector_->Append(ReadFrameHeaderTrace{frame_header});
+          return If(
+              frame_header.payload_tag == 0,
+              // The payload follows the header on the control endpoint.
+              [this, frame_header]() {
+                return Map(
+                    control_endpoint_.Read(frame_header.header.payload_length),
+                    [frame_header, this](absl::StatusOr<SliceBuffer> payload)
+                        -> absl::StatusOr<LoopCtl<IncomingFrame>> {
+                      if (!payload.ok()) return payload.status();
+                      if (frame_header.header.type ==
+                          FrameType::kTcpSecurityFrame) {
+                        auto* transport_framing_endpoint_extension =
+                            GetTransportFramingEndpointExtension(
+                                *control_endpoint_.GetEventEngineEndpoint());
+                        if (transport_framing_endpoint_extension != nullptr) {
+                          transport_framing_endpoint_extension->ReceiveFrame(
+                              std::move(*payload));
+                        }
+                        return Continue{};
+                      }
+                      return IncomingFrame(frame_header.header,
+                                           std::move(payload));
+                    });
+              },
+              // The payload is already in the region: the peer wrote it
+              // before sending this header.
+              [this, frame_header]() -> absl::StatusOr<LoopCtl<IncomingFrame>> {
+                if (frame_header.header.type == FrameType::kTcpSecurityFrame) {
+                  return absl::UnavailableError(
+                      "Security frame sent with a payload tag");
+                }
+                return IncomingFrame(
+                    frame_header.header,
+                    region_->ReadPayload(frame_header.payload_tag,
+                                         frame_header.header.payload_length));
+              });
+        });
+  });
+}
+
+template <typename Promise>
+auto SharedMemoryFrameTransport::UntilClosed(Promise promise) {
+  return Race(Map(closed_.Wait(),
+                  [self = RefAsSubclass<SharedMemoryFrameTransport>()](Empty) {
+                    return absl::UnavailableError("Frame transport closed");
+                  }),
+              std::move(promise));
+}
+
+void SharedMemoryFrameTransport::Start(Party* party,
+                                       MpscReceiver<OutgoingFrame> frames,
+                                       RefCountedPtr<FrameTransportSink> sink) {
+  auto write_party = Party::Make(party->arena()->Ref());
+  write_party->Spawn(
+      "shm-write",
+      [self = RefAsSubclass<SharedMemoryFrameTransport>(),
+       frames = std::move(frames)]() mutable {
+        return self->UntilClosed(self->WriteLoop(std::move(frames)));
+      },
+      [sink, ztrace_collector = ztrace_collector_](absl::Status status) {
+        ztrace_collector->Append(TransportError</*read=*/false>{status});
+        sink->OnFrameTransportClosed(std::move(status));
+      });
+  party->Spawn(
+      "shm-read",
+      [self = RefAsSubclass<SharedMemoryFrameTransport>(), sink = sink]() {
+        return self->UntilClosed(Loop([self = self.get(), sink = sink.get()]() {
+          return TrySeq(
+              self->ReadFrameBytes(),
+              [sink](IncomingFrame incoming_frame) -> LoopCtl<absl::Status> {
+                sink->OnIncomingFrame(std::move(incoming_frame));
+                return Continue{};
+              });
+        }));
+      },
+      [sink, ztrace_collector = ztrace_collector_,
+       write_party = std::move(write_party)](absl::Status status) {
+        ztrace_collector->Append(TransportError</*read=*/true>{status});
+        sink->OnFrameTransportClosed(std::move(status));
+      });
+}
+
+void SharedMemoryFrameTransport::Orphan() {
+  ztrace_collector_->Append(OrphanTrace{});
+  closed_.Set();
+  Unref();
+}
+
+void SharedMemoryFrameTransport::AddData(channelz::DataSink sink) {
+  sink.AddData(
+      "shared_memory",
+      channelz::PropertyList()
+          .Set("ring_size", region_->ring_size())
+          .Set("outgoing_bytes_in_use", region_->outgoing_bytes_in_use())
+          .Set("inlined_payload_size_threshold",
+               options_.inlined_payload_size_threshold)
+          .Set("shared_memory_payloads",
+               shared_memory_payloads_.load(std::memory_order_relaxed))
+          .Set("region_full_payloads",
+               region_full_payloads_.load(std::memory_order_relaxed)));
+}
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
@@ -0,0 +1,85 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_FRAME_TRANSPORT_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_FRAME_TRANSPORT_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "src/core/ext/transport/chaotic_good/control_endpoint.h"
+#include "src/core/ext/transport/chaotic_good/frame_transport.h"
+#include "src/core/ext/transport/chaotic_good/shared_memory_region.h"
+#include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
+#include "src/core/ext/transport/chaotic_good/transport_context.h"
+#include "src/core/lib/promise/inter_activity_latch.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+// FrameTransport for peers on the same host: frame headers and small payloads
+// go over the control endpoint exactly as with TcpFrameTransport, but larger
+// payloads go through a SharedMemoryRegion instead of data endpoints, and
+// are received without being copied.
+class SharedMemoryFrameTransport final : public FrameTransport,
+                                         public channelz::DataSource {
+ public:
+  struct Options {
+    uint32_t inlined_payload_size_threshold = 8 * 1024;
+  };
+
+  SharedMemoryFrameTransport(Options options, PromiseEndpoint control_endpoint,
+                             RefCountedPtr<SharedMemoryRegion> region,
+                             TransportContextPtr ctx);
+  ~SharedMemoryFrameTransport() override { SourceDestructing(); }
+
+  void Start(Party* party, MpscReceiver<OutgoingFrame> outgoing_frames,
+             RefCountedPtr<FrameTransportSink> sink) override;
+  void Orphan() override;
+  TransportContextPtr ctx() override { return ctx_; }
+  std::unique_ptr<channelz::ZTrace> GetZTrace(absl::string_view name) override {
+    if (name == "transport_frames") {
+      return ztrace_collector_->MakeZTrace();
+    }
+    return DataSource::GetZTrace(name);
+  }
+  void AddData(channelz::DataSink sink) override;
+
+ private:
+  auto WriteFrame(MpscQueued<OutgoingFrame> queued_frame);
+  auto WriteLoop(MpscReceiver<OutgoingFrame> frames);
+  // Read one frame header, and its payload if that is on the control
+  // endpoint. Resolves to StatusOr<IncomingFrame>.
+  auto ReadFrameBytes();
+  template <typename Promise>
+  auto UntilClosed(Promise promise);
+
+  const TransportContextPtr ctx_;
+  std::shared_ptr<TcpZTraceCollector> ztrace_collector_ =
+      std::make_shared<TcpZTraceCollector>();
+  ControlEndpoint control_endpoint_;
+  const RefCountedPtr<SharedMemoryRegion> region_;
+  const Options options_;
+  InterActivityLatch<void> closed_;
+  // Payloads sent through the region, and payloads that were big enough to
+  // but had to be inlined because the region was full.
+  std::atomic<uint64_t> shared_memory_payloads_{0};
+  std::atomic<uint64_t> region_full_payloads_{0};
+};
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_FRAME_TRANSPORT_H
@@ -0,0 +1,496 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/shared_memory_region.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/shared_bit_gen.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+
+#ifdef GPR_LINUX
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif  // GPR_LINUX
+
+namespace grpc_core {
+namespace chaotic_good {
+
+namespace {
+// Chunks, and so payloads, start on multiples of this.
+constexpr uint64_t kChunkAlignment = 64;
+// Identifies a chaotic_good shared memory region, version 1.
+constexpr uint64_t kMagic = 0x0100'6d68'7367'6367;
+constexpr size_t kNonceSize = 16;
+
+// Written by the creator at the start of the region.
+struct RegionHeader {
+  uint64_t magic;
+  uint64_t ring_size;
+  uint8_t nonce[kNonceSize];
+};
+
+enum ChunkState : uint32_t {
+  // Never written, or reclaimed by the sender.
+  kFree = 0,
+  // Holds a payload that the receiver has not finished with.
+  kWritten = 1,
+  // Released by the receiver (or padding), waiting to be reclaimed.
+  kReleased = 2,
+};
+
+uint64_t RoundUp(uint64_t n, uint64_t multiple) {
+  return (n + multiple - 1) / multiple * multiple;
+}
+
+#ifdef GPR_LINUX
+// Seals that a region must carry before we map one that we were sent.
+constexpr int kRequiredSeals = F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL;
+// Connections that a rendezvous queues before refusing more.
+constexpr int kRendezvousBacklog = 8;
+
+// Fill addr with the abstract unix socket address called name.
+bool MakeAbstractAddress(absl::string_view name, sockaddr_un& addr,
+                         socklen_t& addr_len) {
+  if (name.empty() || name.size() >= sizeof(addr.sun_path)) return false;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  memcpy(addr.sun_path + 1, name.data(), name.size());
+  addr_len = offsetof(sockaddr_un, sun_path) + 1 + name.size();
+  return true;
+}
+#endif  // GPR_LINUX
+}  // namespace
+
+struct SharedMemoryRegion::ChunkHeader {
+  std::atomic<uint32_t> state;
+  // Bytes from the start of this chunk to the start of the next one.
+  uint32_t size;
+};
+
+// Keeps the region mapped while the receiver holds a payload, and releases
+// the payload's chunk back to the sender when dropped.
+class SharedMemoryRegion::ChunkRef {
+ public:
+  ChunkRef(RefCountedPtr<SharedMemoryRegion> region, ChunkHeader* chunk)
+      : region_(std::move(region)), chunk_(chunk) {}
+
+  static void Release(void* p) {
+    auto* ref = static_cast<ChunkRef*>(p);
+    ref->chunk_->state.store(kReleased, std::memory_order_release);
+    delete ref;
+  }
+
+ private:
+  RefCountedPtr<SharedMemoryRegion> region_;
+  ChunkHeader* const chunk_;
+};
+
+bool IsSameHostPeer(
+    const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+        address) {
+#ifdef GPR_LINUX
+  grpc_event_engine::experimental::EventEngine::ResolvedAddress v4;
+  const sockaddr* addr = address.address();
+  if (grpc_event_engine::experimental::ResolvedAddressIsV4Mapped(address,
+                                                                 &v4)) {
+    addr = v4.address();
+  }
+  switch (addr->sa_family) {
+    case AF_UNIX:
+      return true;
+    case AF_INET:
+      return (ntohl(reinterpret_cast<const sockaddr_in*>(addr)
+                        ->sin_addr.s_addr) >>
+              24) == 127;
+    case AF_INET6:
+      return IN6_IS_ADDR_LOOPBACK(
+          &reinterpret_cast<const sockaddr_in6*>(addr)->sin6_addr);
+  }
+#else
+  (void)address;
+#endif  // GPR_LINUX
+  return false;
+}
+
+absl::StatusOr<RefCountedPtr<SharedMemoryRegion>> SharedMemoryRegion::Create(
+    uint64_t ring_size) {
+#ifdef GPR_LINUX
+  ring_size = RoundUp(ring_size, kPageSize);
+  if (ring_size == 0 || ring_size > kMaxRingSize) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Bad shared memory ring size: ", ring_size));
+  }
+  const uint64_t region_size = kPageSize + 2 * ring_size;
+  int fd = memfd_create("grpc-chaotic-good", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (fd < 0) {
+    return absl::UnavailableError(
+        absl::StrCat("memfd_create: ", std::strerror(errno)));
+  }
+  // Sealed, the region cannot be shrunk under a peer that mapped it, which
+  // would then fault on its next access.
+  if (ftruncate(fd, region_size) != 0 ||
+      fcntl(fd, F_ADD_SEALS, kRequiredSeals) != 0) {
+    absl::Status status = absl::UnavailableError(
+        absl::StrCat("Sizing shared memory: ", std::strerror(errno)));
+    close(fd);
+    return status;
+  }
+  void* base =
+      mmap(nullptr, region_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (base == MAP_FAILED) {
+    absl::Status status =
+        absl::UnavailableError(absl::StrCat("mmap: ", std::strerror(errno)));
+    close(fd);
+    return status;
+  }
+  auto* header = static_cast<RegionHeader*>(base);
+  header->magic = kMagic;
+  header->ring_size = ring_size;
+  SharedBitGen g;
+  for (uint8_t& byte : header->nonce) byte = absl::Uniform<uint8_t>(g);
+  return RefCountedPtr<SharedMemoryRegion>(new SharedMemoryRegion(
+      fd, static_cast<char*>(base), ring_size, /*created=*/true));
+#else
+  (void)ring_size;
+  return absl::UnimplementedError("Shared memory needs Linux");
+#endif  // GPR_LINUX
+}
+
+absl::StatusOr<RefCountedPtr<SharedMemoryRegion>> SharedMemoryRegion::Attach(
+    int fd, const chaotic_good_frame::SharedMemoryOffer& answer) {
+#ifdef GPR_LINUX
+  const uint64_t ring_size = answer.ring_size();
+  const uint64_t region_size = kPageSize + 2 * ring_size;
+  // Without these seals whoever sent the memfd could still resize it.
+  const int seals = fcntl(fd, F_GET_SEALS);
+  if (seals < 0 || (seals & kRequiredSeals) != kRequiredSeals) {
+    close(fd);
+    return absl::UnavailableError("Shared memory region is not sealed");
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || static_cast<uint64_t>(st.st_size) != region_size) {
+    close(fd);
+    return absl::UnavailableError(
+        "Shared memory region is not the size that was answered");
+  }
+  void* base =
+      mmap(nullptr, region_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  // The mapping keeps the memory alive, so we have no more use for the fd.
+  close(fd);
+  if (base == MAP_FAILED) {
+    return absl::UnavailableError(
+        absl::StrCat("mmap: ", std::strerror(errno)));
+  }
+  const auto* header = static_cast<const RegionHeader*>(base);
+  if (header->magic != kMagic || header->ring_size != ring_size ||
+      memcmp(header->nonce, answer.nonce().data(), kNonceSize) != 0) {
+    munmap(base, region_size);
+    return absl::UnavailableError(
+        "Shared memory region is not the one that was answered");
+  }
+  return RefCountedPtr<SharedMemoryRegion>(new SharedMemoryRegion(
+      -1, static_cast<char*>(base), ring_size, /*created=*/false));
+#else
+  (void)fd;
+  (void)answer;
+  return absl::UnimplementedError("Shared memory needs Linux");
+#endif  // GPR_LINUX
+}
+
+SharedMemoryRegion::SharedMemoryRegion(int fd, char* base, uint64_t ring_size,
+                                       bool created)
+    : fd_(fd), base_(base), ring_size_(ring_size), created_(created) {}
+
+SharedMemoryRegion::~SharedMemoryRegion() {
+#ifdef GPR_LINUX
+  munmap(base_, kPageSize + 2 * ring_size_);
+  if (fd_ >= 0) close(fd_);
+#endif  // GPR_LINUX
+}
+
+absl::Status SharedMemoryRegion::HandOver(
+    const chaotic_good_frame::SharedMemoryOffer& offer) {
+  GRPC_CHECK(created_);
+  GRPC_CHECK_GE(fd_, 0);
+#ifdef GPR_LINUX
+  sockaddr_un addr;
+  socklen_t addr_len;
+  if (!MakeAbstractAddress(offer.socket_name(), addr, addr_len)) {
+    return absl::InvalidArgumentError("Bad shared memory socket name");
+  }
+  // Non-blocking, so that a full backlog fails the connect rather than
+  // waiting on the client, which only accepts after our answer.
+  int sock = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (sock < 0) {
+    return absl::UnavailableError(
+        absl::StrCat("socket: ", std::strerror(errno)));
+  }
+  absl::Status status;
+  if (connect(sock, reinterpret_cast<const sockaddr*>(&addr), addr_len) !=
+      0) {
+    status = absl::UnavailableError(
+        absl::StrCat("connect: ", std::strerror(errno)));
+  } else {
+    // The message, and the memfd with it, waits on the connection until
+    // the client accepts it, even once we close our end.
+    char byte = 0;
+    iovec iov = {&byte, 1};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &fd_, sizeof(int));
+    if (sendmsg(sock, &msg, MSG_NOSIGNAL) != 1) {
+      status = absl::UnavailableError(
+          absl::StrCat("sendmsg: ", std::strerror(errno)));
+    }
+  }
+  close(sock);
+  if (!status.ok()) return status;
+  close(fd_);
+  fd_ = -1;
+  return absl::OkStatus();
+#else
+  (void)offer;
+  return absl::UnimplementedError("Shared memory needs Linux");
+#endif  // GPR_LINUX
+}
+
+void SharedMemoryRegion::FillAnswer(
+    chaotic_good_frame::SharedMemoryOffer& offer) const {
+  GRPC_CHECK(created_);
+  offer.set_ring_size(ring_size_);
+  offer.set_nonce(reinterpret_cast<const RegionHeader*>(base_)->nonce,
+                  kNonceSize);
+}
+
+uint8_t* SharedMemoryRegion::OutgoingRing() const {
+  return reinterpret_cast<uint8_t*>(base_ + kPageSize +
+                                    (created_ ? 0 : ring_size_));
+}
+
+uint8_t* SharedMemoryRegion::IncomingRing() const {
+  return reinterpret_cast<uint8_t*>(base_ + kPageSize +
+                                    (created_ ? ring_size_ : 0));
+}
+
+SharedMemoryRegion::ChunkHeader* SharedMemoryRegion::OutgoingChunk(
+    uint64_t position) const {
+  return reinterpret_cast<ChunkHeader*>(OutgoingRing() +
+                                        position % ring_size_);
+}
+
+void SharedMemoryRegion::Reclaim() {
+  while (tail_ != head_) {
+    ChunkHeader* chunk = OutgoingChunk(tail_);
+    if (chunk->state.load(std::memory_order_acquire) != kReleased) break;
+    tail_ += chunk->size;
+    chunk->state.store(kFree, std::memory_order_relaxed);
+  }
+}
+
+std::optional<uint64_t> SharedMemoryRegion::WritePayload(
+    SliceBuffer& payload) {
+  static_assert(sizeof(ChunkHeader) <= kChunkAlignment);
+  Reclaim();
+  const uint64_t chunk_size =
+      kChunkAlignment + RoundUp(payload.Length(), kChunkAlignment);
+  uint64_t offset = head_ % ring_size_;
+  // Chunks never wrap: if this one would run off the end of the ring, pad
+  // out the rest of the ring and start again at the beginning.
+  const uint64_t padding =
+      offset + chunk_size > ring_size_ ? ring_size_ - offset : 0;
+  if (head_ - tail_ + padding + chunk_size > ring_size_) {
+    outgoing_bytes_in_use_.store(head_ - tail_, std::memory_order_relaxed);
+    return std::nullopt;
+  }
+  if (padding != 0) {
+    ChunkHeader* chunk = OutgoingChunk(head_);
+    chunk->size = padding;
+    chunk->state.store(kReleased, std::memory_order_relaxed);
+    head_ += padding;
+    offset = 0;
+  }
+  ChunkHeader* chunk = OutgoingChunk(head_);
+  GRPC_DCHECK_EQ(chunk->state.load(std::memory_order_relaxed), kFree);
+  chunk->size = chunk_size;
+  payload.CopyToBuffer(reinterpret_cast<uint8_t*>(chunk) + kChunkAlignment);
+  chunk->state.store(kWritten, std::memory_order_release);
+  head_ += chunk_size;
+  outgoing_bytes_in_use_.store(head_ - tail_, std::memory_order_relaxed);
+  return offset / kChunkAlignment + 1;
+}
+
+absl::StatusOr<SliceBuffer> SharedMemoryRegion::ReadPayload(uint64_t tag,
+                                                            uint32_t length) {
+  if (tag == 0 || tag > ring_size_ / kChunkAlignment) {
+    return absl::InternalError(
+        absl::StrCat("Bad shared memory payload tag: ", tag));
+  }
+  const uint64_t offset = (tag - 1) * kChunkAlignment;
+  auto* chunk = reinterpret_cast<ChunkHeader*>(IncomingRing() + offset);
+  if (chunk->state.load(std::memory_order_acquire) != kWritten) {
+    return absl::InternalError(
+        absl::StrCat("No shared memory payload at tag ", tag));
+  }
+  const uint64_t chunk_size = chunk->size;
+  if (chunk_size < kChunkAlignment + length ||
+      offset + chunk_size > ring_size_) {
+    return absl::InternalError(absl::StrCat(
+        "Shared memory payload at tag ", tag, " is not ", length, " bytes"));
+  }
+  SliceBuffer payload;
+  payload.Append(Slice(grpc_slice_new_with_user_data(
+      reinterpret_cast<uint8_t*>(chunk) + kChunkAlignment, length,
+      ChunkRef::Release, new ChunkRef(Ref(), chunk))));
+  return payload;
+}
+
+absl::StatusOr<std::unique_ptr<SharedMemoryRendezvous>>
+SharedMemoryRendezvous::Listen(uint64_t ring_size) {
+#ifdef GPR_LINUX
+  ring_size = RoundUp(ring_size, SharedMemoryRegion::kPageSize);
+  if (ring_size == 0 || ring_size > SharedMemoryRegion::kMaxRingSize) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Bad shared memory ring size: ", ring_size));
+  }
+  // A random name, so that peers cannot guess it ahead of our offer.
+  SharedBitGen g;
+  std::string name = "grpc-chaotic-good-";
+  for (int i = 0; i < 16; i++) {
+    absl::StrAppend(&name, absl::Hex(absl::Uniform<uint8_t>(g),
+                                     absl::kZeroPad2));
+  }
+  sockaddr_un addr;
+  socklen_t addr_len;
+  GRPC_CHECK(MakeAbstractAddress(name, addr, addr_len));
+  int fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    return absl::UnavailableError(
+        absl::StrCat("socket: ", std::strerror(errno)));
+  }
+  if (bind(fd, reinterpret_cast<const sockaddr*>(&addr), addr_len) != 0 ||
+      listen(fd, kRendezvousBacklog) != 0) {
+    absl::Status status = absl::UnavailableError(
+        absl::StrCat("Listening on ", name, ": ", std::strerror(errno)));
+    close(fd);
+    return status;
+  }
+  return std::unique_ptr<SharedMemoryRendezvous>(
+      new SharedMemoryRendezvous(fd, std::move(name), ring_size));
+#else
+  (void)ring_size;
+  return absl::UnimplementedError("Shared memory needs Linux");
+#endif  // GPR_LINUX
+}
+
+SharedMemoryRendezvous::SharedMemoryRendezvous(int fd, std::string name,
+                                               uint64_t ring_size)
+    : fd_(fd), name_(std::move(name)), ring_size_(ring_size) {}
+
+SharedMemoryRendezvous::~SharedMemoryRendezvous() {
+#ifdef GPR_LINUX
+  close(fd_);
+#endif  // GPR_LINUX
+}
+
+void SharedMemoryRendezvous::FillOffer(
+    chaotic_good_frame::SharedMemoryOffer& offer) const {
+  offer.set_socket_name(name_);
+  offer.set_ring_size(ring_size_);
+}
+
+absl::StatusOr<RefCountedPtr<SharedMemoryRegion>>
+SharedMemoryRendezvous::Accept(
+    const chaotic_good_frame::SharedMemoryOffer& answer) {
+#ifdef GPR_LINUX
+  if (answer.socket_name() != name_ || answer.ring_size() != ring_size_ ||
+      answer.nonce().size() != kNonceSize) {
+    return absl::InvalidArgumentError("Bad shared memory answer");
+  }
+  // The server connected before it answered, so its connection is queued.
+  // Other local processes may have connected too, so look at each connection
+  // until one carries the region that was answered.
+  // The backlog bounds how many can be queued ahead of the server's.
+  absl::Status status =
+      absl::UnavailableError("No shared memory region was handed over");
+  for (int i = 0; i <= kRendezvousBacklog; i++) {
+    const int conn = accept4(fd_, nullptr, nullptr, SOCK_CLOEXEC);
+    if (conn < 0) {
+      if (errno == EINTR) continue;
+      break;
+    }
+    char byte;
+    iovec iov = {&byte, 1};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    const ssize_t n = recvmsg(conn, &msg, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+    close(conn);
+    int fd = -1;
+    cmsghdr* cmsg = n == 1 ? CMSG_FIRSTHDR(&msg) : nullptr;
+    if (cmsg != nullptr && cmsg->cmsg_level == SOL_SOCKET &&
+        cmsg->cmsg_type == SCM_RIGHTS &&
+        cmsg->cmsg_len == CMSG_LEN(sizeof(int))) {
+      memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+    }
+    // With more fds than we have room for, the kernel drops the rest and
+    // marks the message truncated.
+    if (fd < 0 || (msg.msg_flags & MSG_CTRUNC) != 0) {
+      if (fd >= 0) close(fd);
+      status = absl::UnavailableError(
+          "Shared memory connection carried no memfd");
+      continue;
+    }
+    auto region = SharedMemoryRegion::Attach(fd, answer);
+    if (region.ok()) return region;
+    status = region.status();
+  }
+  return status;
+#else
+  (void)answer;
+  return absl::UnimplementedError("Shared memory needs Linux");
+#endif  // GPR_LINUX
+}
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
@@ -0,0 +1,165 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_REGION_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_REGION_H
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "src/core/ext/transport/chaotic_good/chaotic_good_frame.pb.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+
+// True if a peer at this address is on the same host, and so could map a
+// SharedMemoryRegion that we create.
+bool IsSameHostPeer(
+    const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
+        address);
+
+// A memfd backed region shared between the two ends of one chaotic_good
+// connection, holding a ring of data frame payloads for each direction.
+//
+// The client listens on a SharedMemoryRendezvous and offers it in its
+// settings frame; the server creates the region, seals its size, sends it to
+// the rendezvous over SCM_RIGHTS and answers the offer to accept it, and the
+// client then maps what it received. Frame headers keep flowing over the
+// control endpoint, carrying a tag that locates the payload in the sender's
+// ring, so the control endpoint both orders and announces the payloads and
+// the rings need no signalling of their own.
+//
+// Each ring is a sequence of 64 byte aligned chunks, each a small header
+// followed by one payload. Only the sender moves through its ring: the
+// receiver hands payloads up as slices pointing into the region, and marks
+// a chunk released once the last of those slices is gone. The sender
+// reclaims released chunks in ring order, so a payload that is held for a
+// long time stops the ring from advancing; when a payload does not fit the
+// sender just inlines it on the control endpoint instead.
+class SharedMemoryRegion final : public RefCounted<SharedMemoryRegion> {
+ public:
+  // Rings are rounded up to a multiple of this.
+  static constexpr uint64_t kPageSize = 4096;
+  // Largest ring that we create or accept.
+  static constexpr uint64_t kMaxRingSize = uint64_t{1} << 30;
+
+  // Server: create a region with rings of (about) ring_size bytes.
+  static absl::StatusOr<RefCountedPtr<SharedMemoryRegion>> Create(
+      uint64_t ring_size);
+
+  ~SharedMemoryRegion() override;
+
+  SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+  SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+  // Server: send the region to the rendezvous that the client offered.
+  // Until then only we can map it, and afterwards we keep no fd for it.
+  absl::Status HandOver(const chaotic_good_frame::SharedMemoryOffer& offer);
+  // Server: answer the client's offer with this region, for our settings
+  // frame.
+  void FillAnswer(chaotic_good_frame::SharedMemoryOffer& offer) const;
+
+  // Copy payload into our ring. Returns the tag to send in the frame header,
+  // or nullopt if the ring has no room for it.
+  // Only the transport's write loop may call this.
+  std::optional<uint64_t> WritePayload(SliceBuffer& payload);
+  // Return the payload that our peer wrote with the given tag, referencing
+  // the region rather than copying it out.
+  absl::StatusOr<SliceBuffer> ReadPayload(uint64_t tag, uint32_t length);
+
+  uint64_t ring_size() const { return ring_size_; }
+  // Bytes of our ring not yet released by the peer (as of the last write).
+  uint64_t outgoing_bytes_in_use() const {
+    return outgoing_bytes_in_use_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  friend class SharedMemoryRendezvous;
+  struct ChunkHeader;
+  class ChunkRef;
+
+  // Client: map the region in a memfd that the server handed over, if it is
+  // the one that the server answered with. Takes ownership of fd.
+  static absl::StatusOr<RefCountedPtr<SharedMemoryRegion>> Attach(
+      int fd, const chaotic_good_frame::SharedMemoryOffer& answer);
+
+  SharedMemoryRegion(int fd, char* base, uint64_t ring_size, bool created);
+
+  uint8_t* OutgoingRing() const;
+  uint8_t* IncomingRing() const;
+  ChunkHeader* OutgoingChunk(uint64_t position) const;
+  // Advance tail_ past every chunk the peer has released.
+  void Reclaim();
+
+  // memfd backing the region; kept open by the creator until it hands the
+  // region over, -1 afterwards and in the peer.
+  int fd_;
+  char* const base_;
+  const uint64_t ring_size_;
+  // The creator writes to the first ring and reads from the second.
+  const bool created_;
+  // Positions in our ring, counted in bytes written since creation.
+  uint64_t head_ = 0;
+  uint64_t tail_ = 0;
+  std::atomic<uint64_t> outgoing_bytes_in_use_{0};
+};
+
+// Client: an abstract unix socket that the server sends the region to.
+// Connections to it are only accepted once the server has answered our
+// offer, and then carry the region with them, so neither side ever waits on
+// the other.
+class SharedMemoryRendezvous {
+ public:
+  // Listen for a region with rings of (about) ring_size bytes.
+  static absl::StatusOr<std::unique_ptr<SharedMemoryRendezvous>> Listen(
+      uint64_t ring_size);
+
+  ~SharedMemoryRendezvous();
+
+  SharedMemoryRendezvous(const SharedMemoryRendezvous&) = delete;
+  SharedMemoryRendezvous& operator=(const SharedMemoryRendezvous&) = delete;
+
+  // Describe the rendezvous, for our settings frame.
+  void FillOffer(chaotic_good_frame::SharedMemoryOffer& offer) const;
+  // Map the region that the server handed over, given its answer to our
+  // offer. Fails if no connection carries a region that was created sealed
+  // and that matches the answer.
+  absl::StatusOr<RefCountedPtr<SharedMemoryRegion>> Accept(
+      const chaotic_good_frame::SharedMemoryOffer& answer);
+
+ private:
+  SharedMemoryRendezvous(int fd, std::string name, uint64_t ring_size);
+
+  // Listening socket.
+  const int fd_;
+  // Abstract socket name, without the leading NUL.
+  const std::string name_;
+  const uint64_t ring_size_;
+};
+
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_SHARED_MEMORY_REGION_H
@@ -16,9 +16,12 @@
 
 #include <sys/types.h>
 
+#include <algorithm>
 #include <cstdint>
 
+#include "src/core/ext/transport/chaotic_good/chaotic_good_frame.pb.h"
 #include "src/core/ext/transport/chaotic_good/control_endpoint.h"
+#include "src/core/ext/transport/chaotic_good/frame.h"
 #include "src/core/ext/transport/chaotic_good/frame_transport.h"
 #include "src/core/ext/transport/chaotic_good/serialize_little_endian.h"
 #include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
@@ -29,6 +32,7 @@
 #include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/race.h"
 #include "src/core/lib/promise/seq.h"
+#include "src/core/lib/promise/sleep.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/transport/transport_framing_endpoint_extension.h"
 
@@ -49,7 +53,7 @@ TransportFramingEndpointExtension* GetTransportFramingEndpointExtension(
 TcpFrameTransport::TcpFrameTransport(
     Options options, PromiseEndpoint control_endpoint,
     std::vector<PendingConnection> pending_data_endpoints,
-    TransportContextPtr ctx)
+    TransportContextPtr ctx, DataEndpointFactory data_endpoint_factory)
     : DataSource(ctx->socket_node),
       ctx_(ctx),
       control_endpoint_(std::move(control_endpoint), ctx, ztrace_collector_),
@@ -57,7 +61,15 @@ TcpFrameTransport::TcpFrameTransport(
                       options.encode_alignment, options.decode_alignment,
                       ztrace_collector_, options.enable_tracing,
                       options.scheduler_config),
-      options_(options) {
+      options_(options),
+      data_endpoint_factory_(std::move(data_endpoint_factory)) {
+  if (options_.max_data_endpoints != 0 &&
+      (data_endpoint_factory_.request != nullptr ||
+       data_endpoint_factory_.connect != nullptr)) {
+    DataEndpointPolicy::Options policy_options;
+    policy_options.max_endpoints = options_.max_data_endpoints;
+    data_endpoint_policy_.emplace(policy_options);
+  }
   auto* transport_framing_endpoint_extension =
       GetTransportFramingEndpointExtension(
           *control_endpoint_.GetEventEngineEndpoint());
@@ -172,6 +184,13 @@ auto TcpFrameTransport::ReadFrameBytes() {
                         // reporting the security frame to the upper layer.
                         return Continue{};
                       }
+                      if (frame_header.header.type ==
+                          FrameType::kTcpDataChannels) {
+                        auto status = ReceiveDataChannelsFrame(
+                            frame_header.header, std::move(*payload));
+                        if (!status.ok()) return status;
+                        return Continue{};
+                      }
                       return IncomingFrame(frame_header.header,
                                            std::move(payload));
                     });
@@ -181,9 +200,11 @@ auto TcpFrameTransport::ReadFrameBytes() {
               //     in the call promise to asynchronously wait for those bytes
               //     to be available.
               [this, frame_header]() -> absl::StatusOr<LoopCtl<IncomingFrame>> {
-                if (frame_header.header.type == FrameType::kTcpSecurityFrame) {
+                if (frame_header.header.type == FrameType::kTcpSecurityFrame ||
+                    frame_header.header.type == FrameType::kTcpDataChannels) {
                   return absl::UnavailableError(
-                      "Security frame sent with a payload tag");
+                      absl::StrCat(FrameTypeString(frame_header.header.type),
+                                   " frame sent with a payload tag"));
                 }
                 return IncomingFrame(
                     frame_header.header,
@@ -193,6 +214,98 @@ auto TcpFrameTransport::ReadFrameBytes() {
   });
 }
 
+SliceBuffer TcpFrameTransport::AdaptDataEndpoints() {
+  SliceBuffer output;
+  std::vector<std::string> connection_ids;
+  const auto sample = data_endpoints_.SampleLoad(&connection_ids);
+  uint32_t desired = data_endpoint_policy_->Update(sample);
+  chaotic_good_frame::DataChannels update;
+  if (data_endpoint_factory_.request == nullptr) {
+    // Client: let the server know, it decides.
+    if (desired == sent_desired_data_endpoints_) return output;
+    sent_desired_data_endpoints_ = desired;
+    update.set_desired_count(desired);
+  } else {
+    // Server: meet whichever direction needs more endpoints.
+    const auto& policy_options = data_endpoint_policy_->options();
+    desired = std::clamp(
+        std::max(desired, peer_desired_data_endpoints_.load(
+                              std::memory_order_relaxed)),
+        policy_options.min_endpoints, policy_options.max_endpoints);
+    const size_t count = sample.endpoints.size();
+    if (desired > count) {
+      PendingConnection pending = data_endpoint_factory_.request();
+      update.set_add_connection_id(std::string(pending.id()));
+      data_endpoints_.AddEndpoint(std::move(pending));
+    } else if (desired < count) {
+      const auto index = DataEndpointPolicy::EndpointToRetire(sample);
+      if (!index.has_value() ||
+          !data_endpoints_.RetireEndpoint(connection_ids[*index])) {
+        return output;
+      }
+      update.set_retire_connection_id(connection_ids[*index]);
+    } else {
+      return output;
+    }
+  }
+  DataChannelsFrame frame(std::move(update));
+  TcpFrameHeader hdr{frame.MakeHeader(), 0};
+  GRPC_TRACE_LOG(chaotic_good, INFO)
+      << "CHAOTIC_GOOD: Send " << frame.ToString();
+  ztrace_collector_->Append(WriteFrameHeaderTrace{hdr});
+  hdr.Serialize(output.AddTiny(TcpFrameHeader::kFrameHeaderSize));
+  frame.SerializePayload(output);
+  return output;
+}
+
+auto TcpFrameTransport::AdaptDataEndpointsLoop() {
+  return Loop([self = RefAsSubclass<TcpFrameTransport>()]() {
+    return Seq(
+        // Data endpoints refresh their network metrics about this often.
+        Sleep(Duration::Milliseconds(100)),
+        [self = self.get()](absl::Status) {
+          SliceBuffer control_bytes = self->AdaptDataEndpoints();
+          return If(
+              control_bytes.Length() != 0,
+              [self, &control_bytes]() {
+                return Map(self->control_endpoint_.Write(
+                               std::move(control_bytes)),
+                           [](Empty) -> LoopCtl<absl::Status> {
+                             return Continue{};
+                           });
+              },
+              []() -> LoopCtl<absl::Status> { return Continue{}; });
+        });
+  });
+}
+
+absl::Status TcpFrameTransport::ReceiveDataChannelsFrame(
+    const FrameHeader& header, SliceBuffer payload) {
+  if (!data_endpoint_policy_.has_value()) {
+    return absl::InternalError(
+        "Data channels frame received without adaptive data channels");
+  }
+  DataChannelsFrame frame;
+  auto status = frame.Deserialize(header, std::move(payload));
+  if (!status.ok()) return status;
+  GRPC_TRACE_LOG(chaotic_good, INFO)
+      << "CHAOTIC_GOOD: Received " << frame.ToString();
+  if (data_endpoint_factory_.connect == nullptr) {
+    // Server: only the client's wishes come this way.
+    peer_desired_data_endpoints_.store(frame.body.desired_count(),
+                                       std::memory_order_relaxed);
+    return absl::OkStatus();
+  }
+  if (!frame.body.add_connection_id().empty()) {
+    data_endpoints_.AddEndpoint(
+        data_endpoint_factory_.connect(frame.body.add_connection_id()));
+  }
+  if (!frame.body.retire_connection_id().empty()) {
+    data_endpoints_.RetireEndpoint(frame.body.retire_connection_id());
+  }
+  return absl::OkStatus();
+}
+
 template <typename Promise>
 auto TcpFrameTransport::UntilClosed(Promise promise) {
   return Race(Map(closed_.Wait(),
@@ -216,6 +329,14 @@ void TcpFrameTransport::Start(Party* party, MpscReceiver<OutgoingFrame> frames,
         ztrace_collector->Append(TransportError</*read=*/false>{status});
         sink->OnFrameTransportClosed(std::move(status));
       });
+  if (data_endpoint_policy_.has_value()) {
+    write_party->Spawn(
+        "tcp-adapt-data-endpoints",
+        [self = RefAsSubclass<TcpFrameTransport>()]() {
+          return self->UntilClosed(self->AdaptDataEndpointsLoop());
+        },
+        [](absl::Status) {});
+  }
   party->Spawn(
       "tcp-read",
       [self = RefAsSubclass<TcpFrameTransport>(), sink = sink]() {
@@ -248,7 +369,8 @@ void TcpFrameTransport::AddData(channelz::DataSink sink) {
                    .Set("decode_alignment", options_.decode_alignment)
                    .Set("inlined_payload_size_threshold",
                         options_.inlined_payload_size_threshold)
-                   .Set("enable_tracing", options_.enable_tracing));
+                   .Set("enable_tracing", options_.enable_tracing)
+                   .Set("max_data_endpoints", options_.max_data_endpoints));
 }
 
 RefCountedPtr<channelz::SocketNode> TcpFrameTransport::MakeSocketNode(
@@ -15,9 +15,12 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_TCP_FRAME_TRANSPORT_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_TCP_FRAME_TRANSPORT_H
 
+#include <atomic>
+#include <optional>
 #include <vector>
 
 #include "src/core/ext/transport/chaotic_good/control_endpoint.h"
+#include "src/core/ext/transport/chaotic_good/data_endpoint_policy.h"
 #include "src/core/ext/transport/chaotic_good/data_endpoints.h"
 #include "src/core/ext/transport/chaotic_good/frame_transport.h"
 #include "src/core/ext/transport/chaotic_good/pending_connection.h"
@@ -25,6 +28,7 @@
 #include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
 #include "src/core/ext/transport/chaotic_good/transport_context.h"
 #include "src/core/lib/promise/inter_activity_latch.h"
+#include "absl/functional/any_invocable.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -44,11 +48,24 @@ class TcpFrameTransport final : public FrameTransport,
     uint32_t inlined_payload_size_threshold = 8 * 1024;
     std::string scheduler_config = "spanrr";
     bool enable_tracing = false;
+    // If non-zero, the number of data endpoints adapts to load, up to this
+    // many (see DataEndpointPolicy); needs a DataEndpointFactory.
+    uint32_t max_data_endpoints = 0;
+  };
+
+  // Where new data endpoints come from when their number adapts to load.
+  // The server decides on additions and retirements: it sets `request`,
+  // which makes a connection for the client to connect to. The client sets
+  // `connect`, to connect to the connection the server asked for.
+  struct DataEndpointFactory {
+    absl::AnyInvocable<PendingConnection()> request;
+    absl::AnyInvocable<PendingConnection(absl::string_view)> connect;
   };
 
   TcpFrameTransport(Options options, PromiseEndpoint control_endpoint,
                     std::vector<PendingConnection> pending_data_endpoints,
-                    TransportContextPtr ctx);
+                    TransportContextPtr ctx,
+                    DataEndpointFactory data_endpoint_factory = {});
   ~TcpFrameTransport() override { SourceDestructing(); }
 
   static RefCountedPtr<channelz::SocketNode> MakeSocketNode(
@@ -74,6 +91,13 @@ class TcpFrameTransport final : public FrameTransport,
   auto ReadFrameBytes();
   template <typename Promise>
   auto UntilClosed(Promise promise);
+  // Periodically sample the load on the data endpoints, and add or retire
+  // endpoints (server), or tell the server what we would like (client).
+  auto AdaptDataEndpointsLoop();
+  // Returns control bytes to send to our peer, if any.
+  SliceBuffer AdaptDataEndpoints();
+  absl::Status ReceiveDataChannelsFrame(const FrameHeader& header,
+                                        SliceBuffer payload);
 
   const TransportContextPtr ctx_;
   std::shared_ptr<TcpZTraceCollector> ztrace_collector_ =
@@ -83,6 +107,14 @@ class TcpFrameTransport final : public FrameTransport,
   const Options options_;
   InterActivityLatch<void> closed_;
   uint64_t next_payload_tag_ = 1;
+  DataEndpointFactory data_endpoint_factory_;
+  // Set if the number of data endpoints adapts to load; only touched by
+  // AdaptDataEndpointsLoop.
+  std::optional<DataEndpointPolicy> data_endpoint_policy_;
+  // Server: the number of data endpoints that the client last asked for.
+  std::atomic<uint32_t> peer_desired_data_endpoints_{0};
+  // Client: the number that we last asked for.
+  uint32_t sent_desired_data_endpoints_ = 0;
 };
 
 }  // namespace chaotic_good
@@ -25,14 +25,14 @@
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
 #include "src/core/util/grpc_check.h"
 
-static const char alphabet[] =
+static constexpr char alphabet[] =
     "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
 struct b64_huff_sym {
   uint16_t bits;
   uint8_t length;
 };
-static const b64_huff_sym huff_alphabet[64] = {
+static constexpr b64_huff_sym huff_alphabet[64] = {
     {0x21, 6}, {0x5d, 7}, {0x5e, 7},   {0x5f, 7}, {0x60, 7}, {0x61, 7},
     {0x62, 7}, {0x63, 7}, {0x64, 7},   {0x65, 7}, {0x66, 7}, {0x67, 7},
     {0x68, 7}, {0x69, 7}, {0x6a, 7},   {0x6b, 7}, {0x6c, 7}, {0x6d, 7},
@@ -47,6 +47,35 @@ static const b64_huff_sym huff_alphabet[64] = {
 
 static const uint8_t tail_xtra[3] = {0, 2, 3};
 
+// Each 12 bits of input map to two base64 characters: looking both up at once
+// halves the number of table lookups per input triplet.
+struct b64_pair_table {
+  char pairs[4096][2]{};
+  constexpr b64_pair_table() {
+    for (int i = 0; i < 4096; i++) {
+      pairs[i][0] = alphabet[i >> 6];
+      pairs[i][1] = alphabet[i & 0x3f];
+    }
+  }
+};
+static constexpr b64_pair_table b64_pairs;
+
+// As b64_pair_table, but mapping 12 bits of input straight to the huffman code
+// of the two base64 characters they encode to: the code is in the low 22 bits,
+// and its length in the top 8.
+struct b64_huff_pair_table {
+  uint32_t codes[4096]{};
+  constexpr b64_huff_pair_table() {
+    for (int i = 0; i < 4096; i++) {
+      const b64_huff_sym a = huff_alphabet[i >> 6];
+      const b64_huff_sym b = huff_alphabet[i & 0x3f];
+      codes[i] = (static_cast<uint32_t>(a.length + b.length) << 24) |
+                 (static_cast<uint32_t>(a.bits) << b.length) | b.bits;
+    }
+  }
+};
+static constexpr b64_huff_pair_table b64_huff_pairs;
+
 grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   size_t input_length = GRPC_SLICE_LENGTH(input);
   size_t input_triplets = input_length / 3;
@@ -59,10 +88,10 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
 
   // encode full triplets
   for (i = 0; i < input_triplets; i++) {
-    out[0] = alphabet[in[0] >> 2];
-    out[1] = alphabet[((in[0] & 0x3) << 4) | (in[1] >> 4)];
-    out[2] = alphabet[((in[1] & 0xf) << 2) | (in[2] >> 6)];
-    out[3] = alphabet[in[2] & 0x3f];
+    const uint32_t triplet = (static_cast<uint32_t>(in[0]) << 16) |
+                             (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    memcpy(out, b64_pairs.pairs[triplet >> 12], 2);
+    memcpy(out + 2, b64_pairs.pairs[triplet & 0xfff], 2);
     out += 4;
     in += 3;
   }
@@ -135,35 +164,39 @@ grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
   return output;
 }
 
+// Huffman code bits waiting to be written out. Codes are appended at the
+// bottom of temp; only its low temp_length bits are meaningful.
 struct huff_out {
-  uint32_t temp;
+  uint64_t temp;
   uint32_t temp_length;
   uint8_t* out;
 };
-static void enc_flush_some(huff_out* out) {
-  while (out->temp_length > 8) {
-    out->temp_length -= 8;
-    *out->out++ = static_cast<uint8_t>(out->temp >> out->temp_length);
+
+// Appends up to 22 bits of code, writing out four bytes at a time.
+static void enc_add(huff_out* out, uint32_t code, uint32_t length) {
+  out->temp = (out->temp << length) | code;
+  out->temp_length += length;
+  if (out->temp_length >= 32) {
+    out->temp_length -= 32;
+    const uint32_t word = static_cast<uint32_t>(out->temp >> out->temp_length);
+    out->out[0] = static_cast<uint8_t>(word >> 24);
+    out->out[1] = static_cast<uint8_t>(word >> 16);
+    out->out[2] = static_cast<uint8_t>(word >> 8);
+    out->out[3] = static_cast<uint8_t>(word);
+    out->out += 4;
   }
 }
 
-static void enc_add2(huff_out* out, uint8_t a, uint8_t b, uint32_t* wire_size) {
-  *wire_size += 2;
-  b64_huff_sym sa = huff_alphabet[a];
-  b64_huff_sym sb = huff_alphabet[b];
-  out->temp = (out->temp << (sa.length + sb.length)) |
-              (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
-  out->temp_length +=
-      static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length);
-  enc_flush_some(out);
+// Appends the huffman codes of the two base64 characters encoding the 12 bits
+// in pair.
+static void enc_add2(huff_out* out, uint32_t pair) {
+  const uint32_t entry = b64_huff_pairs.codes[pair];
+  enc_add(out, entry & 0x3fffff, entry >> 24);
 }
 
-static void enc_add1(huff_out* out, uint8_t a, uint32_t* wire_size) {
-  *wire_size += 1;
+static void enc_add1(huff_out* out, uint8_t a) {
   b64_huff_sym sa = huff_alphabet[a];
-  out->temp = (out->temp << sa.length) | sa.bits;
-  out->temp_length += sa.length;
-  enc_flush_some(out);
+  enc_add(out, sa.bits, sa.length);
 }
 
 grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
@@ -183,17 +216,14 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
   out.temp = 0;
   out.temp_length = 0;
   out.out = start_out;
-  *wire_size = 0;
+  *wire_size = static_cast<uint32_t>(output_syms);
 
   // encode full triplets
   for (i = 0; i < input_triplets; i++) {
-    const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-    const uint8_t high_to_low = in[1] >> 4;
-    enc_add2(&out, in[0] >> 2, low_to_high | high_to_low, wire_size);
-
-    const uint8_t a = static_cast<uint8_t>((in[1] & 0xf) << 2);
-    const uint8_t b = (in[2] >> 6);
-    enc_add2(&out, a | b, in[2] & 0x3f, wire_size);
+    const uint32_t triplet = (static_cast<uint32_t>(in[0]) << 16) |
+                             (static_cast<uint32_t>(in[1]) << 8) | in[2];
+    enc_add2(&out, triplet >> 12);
+    enc_add2(&out, triplet & 0xfff);
     in += 3;
   }
 
@@ -202,20 +232,20 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     case 0:
       break;
     case 1:
-      enc_add2(&out, in[0] >> 2, static_cast<uint8_t>((in[0] & 0x3) << 4),
-               wire_size);
+      enc_add2(&out, static_cast<uint32_t>(in[0]) << 4);
       in += 1;
       break;
-    case 2: {
-      const uint8_t low_to_high = static_cast<uint8_t>((in[0] & 0x3) << 4);
-      const uint8_t high_to_low = in[1] >> 4;
-      enc_add2(&out, in[0] >> 2, low_to_high | high_to_low, wire_size);
-      enc_add1(&out, static_cast<uint8_t>((in[1] & 0xf) << 2), wire_size);
+    case 2:
+      enc_add2(&out, (static_cast<uint32_t>(in[0]) << 4) | (in[1] >> 4));
+      enc_add1(&out, static_cast<uint8_t>((in[1] & 0xf) << 2));
       in += 2;
       break;
-    }
   }
 
+  while (out.temp_length >= 8) {
+    out.temp_length -= 8;
+    *out.out++ = static_cast<uint8_t>(out.temp >> out.temp_length);
+  }
   if (out.temp_length) {
     // NB: the following integer arithmetic operation needs to be in its
     // expanded form due to the "integral promotion" performed (see section
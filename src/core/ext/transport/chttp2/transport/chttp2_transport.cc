@@ -49,12 +49,14 @@
 #include "src/core/channelz/property_list.h"
 #include "src/core/config/config_vars.h"
 #include "src/core/ext/transport/chttp2/transport/call_tracer_wrapper.h"
+#include "src/core/ext/transport/chttp2/transport/data_scheduling_policy.h"
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
 #include "src/core/ext/transport/chttp2/transport/frame_data.h"
 #include "src/core/ext/transport/chttp2/transport/frame_goaway.h"
 #include "src/core/ext/transport/chttp2/transport/frame_rst_stream.h"
 #include "src/core/ext/transport/chttp2/transport/frame_security.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_parser_table.h"
 #include "src/core/ext/transport/chttp2/transport/http2_settings.h"
 #include "src/core/ext/transport/chttp2/transport/http2_settings_manager.h"
 #include "src/core/ext/transport/chttp2/transport/http2_stats_collector.h"
@@ -68,6 +70,7 @@
 #include "src/core/ext/transport/chttp2/transport/stream_lists.h"
 #include "src/core/ext/transport/chttp2/transport/transport_common.h"
 #include "src/core/ext/transport/chttp2/transport/varint.h"
+#include "src/core/ext/transport/chttp2/transport/write_coalescing_policy.h"
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/event_engine/extensions/channelz.h"
@@ -161,6 +164,10 @@ static void write_action_end(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
                              grpc_error_handle error);
 static void write_action_end_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport>, grpc_error_handle error);
+static void write_coalescing_timer_fired_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error);
+static void release_held_write(grpc_chttp2_transport* t);
 
 static void read_action(grpc_core::RefCountedPtr<grpc_chttp2_transport>,
                         grpc_error_handle error);
@@ -525,6 +532,9 @@ static void read_channel_args(grpc_chttp2_transport* t,
     t->settings.mutable_local().SetInitialWindowSize(value);
     t->flow_control.set_target_initial_window_size(value);
   }
+  t->flow_control.set_autotune_frame_size(
+      channel_args.GetBool(GRPC_ARG_HTTP2_MAX_FRAME_SIZE_AUTOTUNING)
+          .value_or(false));
   value = channel_args.GetInt(GRPC_ARG_HTTP2_ENABLE_TRUE_BINARY).value_or(-1);
   if (value >= 0) {
     t->settings.mutable_local().SetAllowTrueBinaryMetadata(value != 0);
@@ -726,6 +736,8 @@ grpc_chttp2_transport::grpc_chttp2_transport(
           channel_args.GetBool(GRPC_ARG_HTTP2_BDP_PROBE).value_or(true),
           &memory_owner),
       deframe_state(is_client ? GRPC_DTS_FH_0 : GRPC_DTS_CLIENT_PREFIX_0),
+      write_coalescing_policy(channel_args),
+      data_scheduling_policy(channel_args),
       is_client(is_client) {
   context_list = new grpc_core::ContextList();
 
@@ -806,6 +818,9 @@ grpc_chttp2_transport::grpc_chttp2_transport(
   grpc_auth_context* auth_context = channel_args.GetObject<grpc_auth_context>();
   http2_stats = grpc_core::CreateHttp2StatsCollector(auth_context);
   hpack_parser.hpack_table()->SetHttp2StatsCollector(http2_stats);
+  hpack_parser.hpack_table()->SetCompactStorage(
+      channel_args.GetBool(GRPC_ARG_HTTP2_HPACK_COMPACT_DECODER_TABLE)
+          .value_or(false));
 
 #ifdef GRPC_POSIX_SOCKET_TCP
   closure_barrier_may_cover_write =
@@ -860,6 +875,8 @@ static void close_transport_locked(grpc_chttp2_transport* t,
           grpc_error_set_int(error, grpc_core::StatusIntProperty::kRpcStatus,
                              GRPC_STATUS_UNAVAILABLE);
     }
+    // Don't make the close wait out a write held back for coalescing.
+    release_held_write(t);
     if (t->write_state != GRPC_CHTTP2_WRITE_STATE_IDLE) {
       if (t->close_transport_on_writes_finished.ok()) {
         t->close_transport_on_writes_finished =
@@ -1096,12 +1113,74 @@ static void set_write_state(grpc_chttp2_transport* t,
   }
 }
 
+// Can a write asked for with this reason be held back for coalescing? Only
+// writes carrying new call data can: holding pings, settings, resets or flow
+// control updates would stall the peer.
+static bool write_may_be_held(grpc_chttp2_initiate_write_reason reason) {
+  switch (reason) {
+    case GRPC_CHTTP2_INITIATE_WRITE_START_NEW_STREAM:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_MESSAGE:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_INITIAL_METADATA:
+    case GRPC_CHTTP2_INITIATE_WRITE_SEND_TRAILING_METADATA:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Begin the write held back by write_coalescing_policy now rather than when
+// its timer fires.
+static void release_held_write(grpc_chttp2_transport* t) {
+  if (t->write_coalescing_timer_handle == TaskHandle::kInvalid) return;
+  // If the timer could not be cancelled it is about to fire, and
+  // write_coalescing_timer_fired_locked will begin the write.
+  if (!t->event_engine->Cancel(t->write_coalescing_timer_handle)) return;
+  t->write_coalescing_timer_handle = TaskHandle::kInvalid;
+  t->combiner->FinallyRun(
+      grpc_core::InitTransportClosure<write_action_begin_locked>(
+          t->Ref(), &t->write_action_begin_locked),
+      absl::OkStatus());
+}
+
+static void write_coalescing_timer_fired_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error) {
+  GRPC_DCHECK(error.ok());
+  GRPC_CHECK(t->write_coalescing_timer_handle != TaskHandle::kInvalid);
+  t->write_coalescing_timer_handle = TaskHandle::kInvalid;
+  auto* tp = t.get();
+  tp->combiner->FinallyRun(
+      grpc_core::InitTransportClosure<write_action_begin_locked>(
+          std::move(t), &tp->write_action_begin_locked),
+      absl::OkStatus());
+}
+
 void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
                                 grpc_chttp2_initiate_write_reason reason) {
   switch (t->write_state) {
     case GRPC_CHTTP2_WRITE_STATE_IDLE:
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING,
                       grpc_chttp2_initiate_write_reason_string(reason));
+      // If coalescing is enabled and not enough is queued yet to be worth a
+      // write of its own, hold the write back (staying in WRITING so later
+      // requests just add to it) until either enough is queued or
+      // max_delay() passes.
+      if (t->closed_with_error.ok() &&
+          t->write_coalescing_policy.ShouldHold(write_may_be_held(reason))) {
+        t->write_coalescing_policy.Hold(
+            grpc_core::Chttp2WriteCoalescingPolicy::Clock::now());
+        t->write_coalescing_timer_handle = t->event_engine->RunAfter(
+            t->write_coalescing_policy.max_delay(), [t = t->Ref()]() mutable {
+              grpc_core::ExecCtx exec_ctx;
+              auto* tp = t.get();
+              tp->combiner->Run(
+                  grpc_core::InitTransportClosure<
+                      write_coalescing_timer_fired_locked>(
+                      std::move(t), &tp->write_coalescing_timer_fired_locked),
+                  absl::OkStatus());
+            });
+        break;
+      }
       // Note that the 'write_action_begin_locked' closure is being scheduled
       // on the 'finally_scheduler' of t->combiner. This means that
       // 'write_action_begin_locked' is called only *after* all the other
@@ -1124,6 +1203,15 @@ void grpc_chttp2_initiate_write(grpc_chttp2_transport* t,
           absl::OkStatus());
       break;
     case GRPC_CHTTP2_WRITE_STATE_WRITING:
+      // A held write has not gathered anything yet, so it will pick up
+      // whatever this request is for.
+      if (t->write_coalescing_timer_handle != TaskHandle::kInvalid) {
+        if (!t->write_coalescing_policy.ShouldHold(
+                write_may_be_held(reason))) {
+          release_held_write(t);
+        }
+        break;
+      }
       set_write_state(t, GRPC_CHTTP2_WRITE_STATE_WRITING_WITH_MORE,
                       grpc_chttp2_initiate_write_reason_string(reason));
       break;
@@ -1152,6 +1240,13 @@ static void write_action_begin_locked(
     grpc_error_handle /*error_ignored*/) {
   GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("write_action_begin_locked");
   GRPC_CHECK(t->write_state != GRPC_CHTTP2_WRITE_STATE_IDLE);
+  if (t->write_coalescing_policy.enabled()) {
+    auto held = t->write_coalescing_policy.BeginWrite(
+        grpc_core::Chttp2WriteCoalescingPolicy::Clock::now());
+    if (held.has_value()) {
+      t->http2_stats->IncrementHttp2WriteCoalescingDelay(held->count());
+    }
+  }
   grpc_chttp2_begin_write_result r;
   if (!t->closed_with_error.ok()) {
     r.writing = false;
@@ -1585,6 +1680,10 @@ static void send_initial_metadata_locked(
         std::min(s->deadline,
                  s->send_initial_metadata->get(grpc_core::GrpcTimeoutMetadata())
                      .value_or(grpc_core::Timestamp::InfFuture()));
+    if (t->data_scheduling_policy.fair()) {
+      s->data_share.set_weight(
+          grpc_core::Chttp2StreamWeightFromMetadata(*s->send_initial_metadata));
+    }
   }
   if (contains_non_ok_status(s->send_initial_metadata)) {
     s->seen_error = true;
@@ -1651,6 +1750,8 @@ static void send_message_locked(
   t->num_messages_in_next_write++;
   t->http2_stats->IncrementHttp2SendMessageSize(
       op->payload->send_message.send_message->Length());
+  t->write_coalescing_policy.QueuedBytes(
+      op->payload->send_message.send_message->Length());
   on_complete->next_data.scratch |= t->closure_barrier_may_cover_write;
   s->send_message_finished = add_closure_barrier(op->on_complete);
   uint32_t flags = 0;
@@ -2279,6 +2380,11 @@ void grpc_chttp2_maybe_complete_recv_initial_metadata(grpc_chttp2_transport* t,
     if (s->seen_error) {
       grpc_slice_buffer_reset_and_unref(&s->frame_storage);
     }
+    // Responses are scheduled with the priority of the request.
+    if (!t->is_client && t->data_scheduling_policy.fair()) {
+      s->data_share.set_weight(
+          grpc_core::Chttp2StreamWeightFromMetadata(s->initial_metadata_buffer));
+    }
     *s->recv_initial_metadata = std::move(s->initial_metadata_buffer);
     s->recv_initial_metadata->Set(grpc_core::PeerString(),
                                   t->peer_string.Ref());
@@ -0,0 +1,51 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/data_scheduling_policy.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <string>
+
+#include "absl/strings/numbers.h"
+
+namespace grpc_core {
+
+uint32_t Chttp2StreamWeightFromMetadata(const grpc_metadata_batch& md) {
+  std::string buffer;
+  auto value = md.GetStringValue(kHttp2StreamPriorityMetadataKey, &buffer);
+  uint32_t priority = 0;
+  if (!value.has_value() || !absl::SimpleAtoi(*value, &priority)) return 1;
+  return std::min(priority, kMaxHttp2StreamPriority) + 1;
+}
+
+namespace {
+
+uint32_t QuantumFromArgs(const ChannelArgs& args) {
+  const int quantum =
+      args.GetInt(GRPC_ARG_HTTP2_FAIR_SCHEDULING_QUANTUM_BYTES).value_or(0);
+  if (quantum <= 0) return 0;
+  return std::max<uint32_t>(quantum, kMinHttp2FairSchedulingQuantumBytes);
+}
+
+}  // namespace
+
+Chttp2DataSchedulingPolicy::Chttp2DataSchedulingPolicy(const ChannelArgs& args)
+    : quantum_(QuantumFromArgs(args)),
+      small_message_lane_bytes_(std::max(
+          0, args.GetInt(GRPC_ARG_HTTP2_SMALL_MESSAGE_LANE_BYTES)
+                 .value_or(0))) {}
+
+}  // namespace grpc_core
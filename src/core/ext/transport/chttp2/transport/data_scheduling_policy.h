@@ -0,0 +1,120 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DATA_SCHEDULING_POLICY_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DATA_SCHEDULING_POLICY_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+
+#include "src/core/call/metadata_batch.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+// How many bytes of DATA a stream of weight 1 may send each time it is
+// scheduled, before it goes to the back of the line. Zero (the default)
+// leaves streams sending as much as flow control and the write size allow
+// each time, in FIFO order. Smaller positive values are raised to
+// kMinHttp2FairSchedulingQuantumBytes.
+#define GRPC_ARG_HTTP2_FAIR_SCHEDULING_QUANTUM_BYTES \
+  "grpc.http2.fair_scheduling_quantum_bytes"
+// Streams with no more than this many bytes of messages waiting are written
+// ahead of every other stream. Zero (the default) disables this lane.
+#define GRPC_ARG_HTTP2_SMALL_MESSAGE_LANE_BYTES \
+  "grpc.http2.small_message_lane_bytes"
+
+// Client metadata key carrying a call's scheduling priority: an integer from
+// 0 (the default) to kMaxHttp2StreamPriority. A stream of priority p gets
+// p + 1 quanta each turn, so the weights span the 1..256 range of RFC 7540
+// stream weights. The server schedules its responses with the priority of
+// the request.
+inline constexpr absl::string_view kHttp2StreamPriorityMetadataKey =
+    "http2-stream-priority";
+inline constexpr uint32_t kMaxHttp2StreamPriority = 255;
+
+// The smallest quantum fair scheduling uses: below this, each turn would cut
+// DATA frames so small that their headers cost more than their payload.
+inline constexpr uint32_t kMinHttp2FairSchedulingQuantumBytes = 1024;
+
+// The weight that a call's metadata asks for: see
+// kHttp2StreamPriorityMetadataKey.
+uint32_t Chttp2StreamWeightFromMetadata(const grpc_metadata_batch& md);
+
+// Decides how DATA frames of different streams share a connection:
+// - deficit round robin: each time a stream is scheduled it is granted
+//   quantum() bytes per unit of weight, and sends at most what it has been
+//   granted and not yet used before the next stream gets its turn, so a bulk
+//   stream can't take a whole write to itself;
+// - a strict priority lane for streams with only a little to send, so that
+//   unary calls and pings don't queue behind bulk transfers.
+class Chttp2DataSchedulingPolicy {
+ public:
+  explicit Chttp2DataSchedulingPolicy(const ChannelArgs& args);
+
+  bool fair() const { return quantum_ != 0; }
+  uint32_t quantum() const { return quantum_; }
+  uint32_t small_message_lane_bytes() const {
+    return small_message_lane_bytes_;
+  }
+
+  // Should a stream with `pending_bytes` of messages waiting be written ahead
+  // of the others?
+  bool IsSmall(size_t pending_bytes) const {
+    return small_message_lane_bytes_ != 0 &&
+           pending_bytes <= small_message_lane_bytes_;
+  }
+
+ private:
+  const uint32_t quantum_;
+  const uint32_t small_message_lane_bytes_;
+};
+
+// The deficit round robin state of one stream.
+class Chttp2StreamDataShare {
+ public:
+  uint32_t weight() const { return weight_; }
+  void set_weight(uint32_t weight) { weight_ = weight; }
+
+  // The stream is being scheduled: grants it its quanta and returns how many
+  // bytes it may send this turn.
+  uint64_t BeginTurn(const Chttp2DataSchedulingPolicy& policy) {
+    if (!policy.fair()) return std::numeric_limits<uint64_t>::max();
+    deficit_ += static_cast<uint64_t>(policy.quantum()) * weight_;
+    return deficit_;
+  }
+  // The stream sent `bytes` of DATA this turn.
+  void Sent(uint64_t bytes) { deficit_ -= std::min(bytes, deficit_); }
+  // The stream's turn is over. A stream with nothing left to send forfeits
+  // what it did not use, as in DRR: otherwise an idle stream would build up
+  // credit to burst with later.
+  void EndTurn(bool drained) {
+    if (drained) deficit_ = 0;
+  }
+
+  uint64_t deficit() const { return deficit_; }
+
+ private:
+  uint32_t weight_ = 1;
+  uint64_t deficit_ = 0;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DATA_SCHEDULING_POLICY_H
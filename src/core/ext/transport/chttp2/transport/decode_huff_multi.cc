@@ -0,0 +1,211 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multi.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/transport/chttp2/transport/huffsyms.h"
+
+namespace grpc_core {
+
+namespace {
+
+// Bits of input resolved by one lookup in the fast table. Any pair of symbols
+// whose codes fit in this many bits is emitted by a single lookup.
+constexpr int kFastBits = 12;
+constexpr size_t kFastEntries = size_t{1} << kFastBits;
+// The longest code in the HPACK table (EOS).
+constexpr int kMaxCodeLength = 30;
+constexpr int kEos = 256;
+
+struct Symbol {
+  int value;
+  int length;
+};
+
+// HPACK's huffman code is canonical: within each code length codes are
+// consecutive integers, and they are ordered by length. That allows decoding
+// any code by comparing the next 32 bits of input against one limit per length.
+class CanonicalCode {
+ public:
+  CanonicalCode() {
+    int count[kMaxCodeLength + 1] = {};
+    for (int i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; i++) {
+      ++count[grpc_chttp2_huffsyms[i].length];
+    }
+    uint32_t code = 0;
+    int offset = 0;
+    for (int length = 1; length <= kMaxCodeLength; length++) {
+      first_code_[length] = code;
+      offset_[length] = offset;
+      code += count[length];
+      limit_[length] = static_cast<uint64_t>(code) << (32 - length);
+      offset += count[length];
+      code <<= 1;
+    }
+    for (int i = 0; i < GRPC_CHTTP2_NUM_HUFFSYMS; i++) {
+      const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[i];
+      symbols_[offset_[sym.length] + (sym.bits - first_code_[sym.length])] = i;
+    }
+  }
+
+  // Decodes the code starting at the most significant bit of window.
+  Symbol Decode(uint32_t window) const {
+    for (int length = 1;; length++) {
+      if (window < limit_[length]) {
+        return Symbol{
+            symbols_[offset_[length] +
+                     ((window >> (32 - length)) - first_code_[length])],
+            length};
+      }
+    }
+  }
+
+ private:
+  uint32_t first_code_[kMaxCodeLength + 1];
+  int offset_[kMaxCodeLength + 1];
+  // One past the largest window (left aligned) holding a code of each length.
+  uint64_t limit_[kMaxCodeLength + 1];
+  int symbols_[GRPC_CHTTP2_NUM_HUFFSYMS];
+};
+
+// Fast table entries pack up to two symbols with their lengths:
+//   bits 0-7: first symbol, bits 8-15: second symbol,
+//   bits 16-19: first code length, bits 20-23: total code length,
+//   bits 24-25: number of symbols (zero if the first code is longer than
+//   kFastBits).
+class DecodeTables {
+ public:
+  DecodeTables() {
+    for (size_t i = 0; i < kFastEntries; i++) {
+      const uint32_t window = static_cast<uint32_t>(i) << (32 - kFastBits);
+      const Symbol first = canonical_.Decode(window);
+      if (first.length > kFastBits) {
+        fast_[i] = 0;
+        continue;
+      }
+      uint32_t entry = first.value | (first.length << 16);
+      const Symbol second = canonical_.Decode(window << first.length);
+      if (first.length + second.length <= kFastBits) {
+        entry |= (second.value << 8) |
+                 ((first.length + second.length) << 20) | (2 << 24);
+      } else {
+        entry |= (first.length << 20) | (1 << 24);
+      }
+      fast_[i] = entry;
+    }
+  }
+
+  uint32_t Fast(uint64_t window) const {
+    return fast_[window >> (64 - kFastBits)];
+  }
+  Symbol Slow(uint64_t window) const {
+    return canonical_.Decode(static_cast<uint32_t>(window >> 32));
+  }
+
+ private:
+  CanonicalCode canonical_;
+  uint32_t fast_[kFastEntries];
+};
+
+// Compilers turn this into a single load and byte swap.
+uint64_t LoadBigEndian64(const uint8_t* p) {
+  return (static_cast<uint64_t>(p[0]) << 56) |
+         (static_cast<uint64_t>(p[1]) << 48) |
+         (static_cast<uint64_t>(p[2]) << 40) |
+         (static_cast<uint64_t>(p[3]) << 32) |
+         (static_cast<uint64_t>(p[4]) << 24) |
+         (static_cast<uint64_t>(p[5]) << 16) |
+         (static_cast<uint64_t>(p[6]) << 8) | static_cast<uint64_t>(p[7]);
+}
+
+const DecodeTables& Tables() {
+  static const DecodeTables* const tables = new DecodeTables();
+  return *tables;
+}
+
+}  // namespace
+
+std::optional<size_t> HuffDecodeMultiSymbol(const uint8_t* begin,
+                                            const uint8_t* end, uint8_t* out) {
+  const DecodeTables& tables = Tables();
+  uint8_t* const out_begin = out;
+  // Input bits not yet decoded, left aligned. Bits past the first 'bits' are
+  // either zero or a copy of the input that follows, so refills may OR the
+  // same bytes in more than once.
+  uint64_t buffer = 0;
+  int bits = 0;
+
+  // Fast path: while at least eight bytes remain, top the window up to 56 or
+  // more bits with a single load, then decode from it for as long as a fast
+  // table lookup is sure to be complete. Codes too long for the fast table
+  // need up to kMaxCodeLength bits, and force a refill first if short of that.
+  while (end - begin >= 8) {
+    buffer |= LoadBigEndian64(begin) >> bits;
+    begin += (63 - bits) >> 3;
+    bits |= 56;
+    do {
+      const uint32_t entry = tables.Fast(buffer);
+      if (GPR_UNLIKELY(entry == 0)) {
+        if (bits < kMaxCodeLength) break;
+        const Symbol symbol = tables.Slow(buffer);
+        if (symbol.value == kEos) return out - out_begin;
+        *out++ = static_cast<uint8_t>(symbol.value);
+        buffer <<= symbol.length;
+        bits -= symbol.length;
+        continue;
+      }
+      out[0] = static_cast<uint8_t>(entry);
+      out[1] = static_cast<uint8_t>(entry >> 8);
+      out += entry >> 24;
+      const int consumed = (entry >> 20) & 0xf;
+      buffer <<= consumed;
+      bits -= consumed;
+    } while (bits >= kFastBits);
+  }
+
+  // Tail: one symbol at a time, treating the window as padded with ones so
+  // that a code running past the end of the input can be recognized.
+  while (true) {
+    while (bits < 56 && begin != end) {
+      buffer |= static_cast<uint64_t>(*begin++) << (56 - bits);
+      bits += 8;
+    }
+    if (bits == 0) break;
+    const uint64_t window = buffer | (~uint64_t{0} >> bits);
+    const uint32_t entry = tables.Fast(window);
+    Symbol symbol;
+    if (entry != 0) {
+      symbol = Symbol{static_cast<uint8_t>(entry),
+                      static_cast<int>((entry >> 16) & 0xf)};
+    } else {
+      symbol = tables.Slow(window);
+    }
+    if (symbol.length > bits) {
+      // What is left is not a whole code, and must be padding: all ones.
+      if ((window >> (64 - bits)) != (~uint64_t{0} >> (64 - bits))) {
+        return std::nullopt;
+      }
+      break;
+    }
+    if (symbol.value == kEos) break;
+    *out++ = static_cast<uint8_t>(symbol.value);
+    buffer <<= symbol.length;
+    bits -= symbol.length;
+  }
+  return out - out_begin;
+}
+
+}  // namespace grpc_core
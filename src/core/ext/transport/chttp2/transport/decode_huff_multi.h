@@ -0,0 +1,46 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_MULTI_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_MULTI_H
+
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace grpc_core {
+
+// Size of the output buffer HuffDecodeMultiSymbol needs to decode `length`
+// bytes of HPACK huffman code: the shortest code is five bits long, and the
+// decoder may store one byte past the end of its output.
+inline size_t HuffDecodeMultiSymbolBufferSize(size_t length) {
+  return length * 8 / 5 + 1;
+}
+
+// Decodes the HPACK huffman coded string in [begin, end) into out, which must
+// have room for HuffDecodeMultiSymbolBufferSize(end - begin) bytes.
+// Returns the number of bytes decoded, or nullopt if the input is malformed.
+//
+// Unlike the generated HuffDecoder, which is driven one symbol at a time
+// through a callback, this refills a 64 bit window eight input bytes at a time
+// and resolves up to two symbols per table lookup, storing them to out
+// directly. It accepts and rejects exactly the same inputs as HuffDecoder.
+std::optional<size_t> HuffDecodeMultiSymbol(const uint8_t* begin,
+                                            const uint8_t* end, uint8_t* out);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_DECODE_HUFF_MULTI_H
@@ -249,6 +249,33 @@ TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
   }
 }
 
+uint32_t TransportFlowControl::TargetFrameSizeBasedOnMemoryPressureAndBdp(
+    uint32_t target_initial_window_size) const {
+  // Enough frames per BDP that streams interleave and the receiver is busy
+  // with one frame while the next is on the wire; few enough that the cost of
+  // each frame is small next to its payload.
+  constexpr double kFramesPerBdp = 8.0;
+  double frame_size = bdp_estimator_.EstimateBdp() / kFramesPerBdp;
+  // Past the pressure at which the window starts dropping towards zero, drop
+  // the frame size towards the minimum alongside it.
+  const double kAdjustedToBdpPressure = 0.5;
+  const double memory_pressure =
+      memory_owner_->GetPressureInfo().pressure_control_value;
+  if (memory_pressure >= 1.0) {
+    frame_size = 0;
+  } else if (memory_pressure > kAdjustedToBdpPressure) {
+    frame_size *= (1.0 - memory_pressure) / (1.0 - kAdjustedToBdpPressure);
+  }
+  // A frame bigger than a stream's window could never be sent whole.
+  frame_size =
+      std::min(frame_size, static_cast<double>(target_initial_window_size));
+  return Clamp(RoundUpToPowerOf2(static_cast<uint32_t>(Clamp(
+                   frame_size, 0.0,
+                   static_cast<double>(Http2Settings::max_max_frame_size())))),
+               Http2Settings::min_max_frame_size(),
+               Http2Settings::max_max_frame_size());
+}
+
 void TransportFlowControl::UpdateSetting(
     absl::string_view name, int64_t* desired_value, uint32_t new_desired_value,
     FlowControlAction* action,
@@ -310,10 +337,14 @@ FlowControlAction TransportFlowControl::PeriodicUpdate() {
                   std::min(target, Http2Settings::max_initial_window_size()),
                   &action, &FlowControlAction::set_send_initial_window_update);
     // we target the max of BDP or bandwidth in microseconds.
-    UpdateSetting(Http2Settings::max_frame_size_name(), &target_frame_size_,
-                  Clamp(target, Http2Settings::min_max_frame_size(),
-                        Http2Settings::max_max_frame_size()),
-                  &action, &FlowControlAction::set_send_max_frame_size_update);
+    UpdateSetting(
+        Http2Settings::max_frame_size_name(), &target_frame_size_,
+        autotune_frame_size_
+            ? TargetFrameSizeBasedOnMemoryPressureAndBdp(
+                  static_cast<uint32_t>(target_initial_window_size_))
+            : Clamp(target, Http2Settings::min_max_frame_size(),
+                    Http2Settings::max_max_frame_size()),
+        &action, &FlowControlAction::set_send_max_frame_size_update);
 
     if (IsTcpFrameSizeTuningEnabled()) {
       // Advertise PREFERRED_RECEIVE_CRYPTO_FRAME_SIZE to peer. By advertising
@@ -44,6 +44,11 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 
+// Size the max frame size we advertise from the BDP estimate, rather than
+// from the target window: see TransportFlowControl::set_autotune_frame_size().
+#define GRPC_ARG_HTTP2_MAX_FRAME_SIZE_AUTOTUNING \
+  "grpc.http2.max_frame_size_autotuning"
+
 namespace grpc_core {
 namespace chttp2 {
 
@@ -342,6 +347,14 @@ class TransportFlowControl final {
         std::min(value, Http2Settings::max_initial_window_size());
   }
 
+  // By default PeriodicUpdate() advertises a max frame size equal to the
+  // target window. With autotuning, it advertises a fraction of the BDP, so
+  // that several frames are in flight per round trip whatever the link, and
+  // scales that down under memory pressure along with the window.
+  void set_autotune_frame_size(bool autotune) {
+    autotune_frame_size_ = autotune;
+  }
+
   // Getters
   int64_t remote_window() const { return remote_window_; }
   int64_t test_only_announced_window() const { return announced_window(); }
@@ -423,6 +436,8 @@ class TransportFlowControl final {
   }
 
   double TargetInitialWindowSizeBasedOnMemoryPressureAndBdp() const;
+  uint32_t TargetFrameSizeBasedOnMemoryPressureAndBdp(
+      uint32_t target_initial_window_size) const;
   int64_t target_window() const;
   int64_t target_frame_size() const { return target_frame_size_; }
   int64_t target_preferred_rx_crypto_frame_size() const {
@@ -458,6 +473,7 @@ class TransportFlowControl final {
 
   /// should we probe bdp?
   const bool enable_bdp_probe_;
+  bool autotune_frame_size_ = false;
 
   // bdp estimation
   BdpEstimator bdp_estimator_;
@@ -132,11 +132,6 @@ void Write3b(uint32_t x, uint8_t* output) {
   output[2] = static_cast<uint8_t>(x);
 }
 
-uint32_t Read3b(const uint8_t* input) {
-  return static_cast<uint32_t>(input[0]) << 16 |
-         static_cast<uint32_t>(input[1]) << 8 | static_cast<uint32_t>(input[2]);
-}
-
 constexpr uint32_t k8BitMask = 0x7f;
 
 void Write31bits(uint32_t x, uint8_t* output) {
@@ -666,14 +661,6 @@ void Http2FrameHeader::Serialize(uint8_t* output) const {
   Write4b(stream_id, output + 5);
 }
 
-Http2FrameHeader Http2FrameHeader::Parse(const uint8_t* input) {
-  return Http2FrameHeader{
-      /* Length(24) */ Read3b(input),
-      /* Type(8) */ input[3],
-      /* Flags(8) */ input[4],
-      /* Reserved(1), Stream Identifier(31) */ Read31bits(input + 5)};
-}
-
 namespace {
 
 std::string Http2FrameTypeString(FrameType frame_type) {
@@ -216,7 +216,25 @@ struct Http2FrameHeader {
   // Crashes if length > 16777215 (as this is unencodable)
   void Serialize(uint8_t* output) const;
   // Parse header from 9 byte long buffer input
-  static Http2FrameHeader Parse(const uint8_t* input);
+  // Defined here so that readers of the header can inline it: the first eight
+  // bytes are assembled as one big endian word, which compilers turn into a
+  // single load and byte swap, and the fields are cut out of that.
+  static Http2FrameHeader Parse(const uint8_t* input) {
+    const uint64_t word = static_cast<uint64_t>(input[0]) << 56 |
+                          static_cast<uint64_t>(input[1]) << 48 |
+                          static_cast<uint64_t>(input[2]) << 40 |
+                          static_cast<uint64_t>(input[3]) << 32 |
+                          static_cast<uint64_t>(input[4]) << 24 |
+                          static_cast<uint64_t>(input[5]) << 16 |
+                          static_cast<uint64_t>(input[6]) << 8 |
+                          static_cast<uint64_t>(input[7]);
+    return Http2FrameHeader{
+        /* Length(24) */ static_cast<uint32_t>(word >> 40),
+        /* Type(8) */ static_cast<uint8_t>(word >> 32),
+        /* Flags(8) */ static_cast<uint8_t>(word >> 24),
+        /* Reserved(1), Stream Identifier(31) */
+        static_cast<uint32_t>((word & 0x7fffff) << 8 | input[8])};
+  }
   std::string ToString() const;
 
   bool operator==(const Http2FrameHeader& other) const {
@@ -245,6 +245,49 @@ class StringKey {
 };
 }  // namespace
 
+void HPackCompressor::EncodeRequestHeaderBlock(
+    const grpc_metadata_batch& headers, hpack_encoder_detail::Encoder& encoder,
+    SliceBuffer& output) {
+  if (request_header_cache_size_ == 0 ||
+      headers.get_pointer(HttpPathMetadata()) == nullptr ||
+      headers.get_pointer(HttpAuthorityMetadata()) == nullptr) {
+    return;
+  }
+  encoder.SkipRequestHeaderBlock();
+  if (const Slice* encoded =
+          request_header_cache_.Lookup(headers, table_.generation())) {
+    output.Append(encoded->Ref());
+    return;
+  }
+  // Encode the block on its own, so that it can be kept if it turns out not
+  // to have changed the table.
+  const uint32_t generation = table_.generation();
+  SliceBuffer block;
+  hpack_encoder_detail::Encoder block_encoder(this, false, block);
+  auto encode = [&headers, &block_encoder](auto trait) {
+    if (const auto* value = headers.get_pointer(trait)) {
+      block_encoder.Encode(trait, *value);
+    }
+  };
+  encode(HttpPathMetadata());
+  encode(HttpAuthorityMetadata());
+  encode(HttpMethodMetadata());
+  encode(HttpSchemeMetadata());
+  encode(ContentTypeMetadata());
+  encode(TeMetadata());
+  encode(UserAgentMetadata());
+  if (block_encoder.saw_encoding_errors()) {
+    encoder.NoteEncodingError();
+  } else if (table_.generation() == generation) {
+    Slice encoded = block.JoinIntoSlice();
+    output.Append(encoded.Ref());
+    request_header_cache_.Insert(headers, std::move(encoded), generation,
+                                 request_header_cache_size_);
+    return;
+  }
+  output.TakeAndAppend(block);
+}
+
 namespace hpack_encoder_detail {
 void Encoder::EmitIndexed(uint32_t elem_index) {
   VarintWriter<1> w(elem_index);
@@ -314,6 +357,67 @@ void Encoder::EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
   output_.Append(emit.data());
 }
 
+RequestHeaderBlockCache::Entry::Entry(const grpc_metadata_batch& headers)
+    : path(headers.get_pointer(HttpPathMetadata())->Ref()),
+      authority(headers.get_pointer(HttpAuthorityMetadata())->Ref()),
+      method(headers.get(HttpMethodMetadata())),
+      scheme(headers.get(HttpSchemeMetadata())),
+      content_type(headers.get(ContentTypeMetadata())),
+      te(headers.get(TeMetadata())) {
+  if (const Slice* value = headers.get_pointer(UserAgentMetadata())) {
+    user_agent = value->Ref();
+  }
+}
+
+bool RequestHeaderBlockCache::Entry::Matches(
+    const grpc_metadata_batch& headers) const {
+  const Slice* user_agent_value = headers.get_pointer(UserAgentMetadata());
+  return *headers.get_pointer(HttpPathMetadata()) == path &&
+         *headers.get_pointer(HttpAuthorityMetadata()) == authority &&
+         headers.get(HttpMethodMetadata()) == method &&
+         headers.get(HttpSchemeMetadata()) == scheme &&
+         headers.get(ContentTypeMetadata()) == content_type &&
+         headers.get(TeMetadata()) == te &&
+         (user_agent_value == nullptr
+              ? !user_agent.has_value()
+              : user_agent.has_value() && *user_agent_value == *user_agent);
+}
+
+const Slice* RequestHeaderBlockCache::Lookup(const grpc_metadata_batch& headers,
+                                             uint32_t table_generation) {
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    if (!it->Matches(headers)) continue;
+    if (it->table_generation != table_generation) {
+      entries_.erase(it);
+      return nullptr;
+    }
+    // Bubble this entry up, as SliceIndex does, so that the methods called
+    // most often are found soonest.
+    if (it != entries_.begin()) {
+      std::swap(*it, *(it - 1));
+      --it;
+    }
+    return &it->encoded;
+  }
+  return nullptr;
+}
+
+void RequestHeaderBlockCache::Insert(const grpc_metadata_batch& headers,
+                                     Slice encoded, uint32_t table_generation,
+                                     size_t max_entries) {
+  // Blocks from an older generation can never be used again.
+  entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+                                [table_generation](const Entry& entry) {
+                                  return entry.table_generation !=
+                                         table_generation;
+                                }),
+                 entries_.end());
+  if (entries_.size() >= max_entries) entries_.pop_back();
+  Entry& entry = entries_.emplace_back(headers);
+  entry.encoded = std::move(encoded);
+  entry.table_generation = table_generation;
+}
+
 void Encoder::AdvertiseTableSizeChange() {
   VarintWriter<3> w(compressor_->table_.max_size());
   w.Write(0x20, output_.AddTiny(w.length()));
@@ -24,6 +24,8 @@
 #include <stddef.h>
 
 #include <cstdint>
+#include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -50,6 +52,18 @@ class HPackCompressor;
 
 namespace hpack_encoder_detail {
 
+// The request headers that are the same on nearly every call to a method:
+// HPackCompressor emits them from a cached, pre-encoded block when it can.
+template <typename MetadataTrait>
+inline constexpr bool kInRequestHeaderBlock =
+    std::is_same_v<MetadataTrait, HttpPathMetadata> ||
+    std::is_same_v<MetadataTrait, HttpAuthorityMetadata> ||
+    std::is_same_v<MetadataTrait, HttpMethodMetadata> ||
+    std::is_same_v<MetadataTrait, HttpSchemeMetadata> ||
+    std::is_same_v<MetadataTrait, ContentTypeMetadata> ||
+    std::is_same_v<MetadataTrait, TeMetadata> ||
+    std::is_same_v<MetadataTrait, UserAgentMetadata>;
+
 class Encoder {
  public:
   Encoder(HPackCompressor* compressor, bool use_true_binary_metadata,
@@ -85,11 +99,16 @@ class Encoder {
   void NoteEncodingError() { saw_encoding_errors_ = true; }
   bool saw_encoding_errors() const { return saw_encoding_errors_; }
 
+  // The request header block has already been written to the output: skip
+  // the headers it covers.
+  void SkipRequestHeaderBlock() { skip_request_header_block_ = true; }
+
   HPackEncoderTable& hpack_table();
 
  private:
   const bool use_true_binary_metadata_;
   bool saw_encoding_errors_ = false;
+  bool skip_request_header_block_ = false;
   HPackCompressor* const compressor_;
   SliceBuffer& output_;
 };
@@ -324,6 +343,37 @@ class Compressor<HttpSchemeMetadata, HttpSchemeCompressor> {
                   Encoder* encoder);
 };
 
+// Pre-encoded request header blocks, most recently used first.
+// A block holds only references to the dynamic table, and HPACK numbers
+// dynamic entries counting back from the newest, so a block can be reused
+// only while the table generation it was encoded at is current.
+class RequestHeaderBlockCache {
+ public:
+  // Returns the encoded block for headers, or nullptr if there is none valid
+  // at table_generation.
+  const Slice* Lookup(const grpc_metadata_batch& headers,
+                      uint32_t table_generation);
+  void Insert(const grpc_metadata_batch& headers, Slice encoded,
+              uint32_t table_generation, size_t max_entries);
+
+ private:
+  struct Entry {
+    explicit Entry(const grpc_metadata_batch& headers);
+    bool Matches(const grpc_metadata_batch& headers) const;
+
+    Slice path;
+    Slice authority;
+    std::optional<HttpMethodMetadata::ValueType> method;
+    std::optional<HttpSchemeMetadata::ValueType> scheme;
+    std::optional<ContentTypeMetadata::ValueType> content_type;
+    std::optional<TeMetadata::ValueType> te;
+    std::optional<Slice> user_agent;
+    Slice encoded;
+    uint32_t table_generation = 0;
+  };
+  std::vector<Entry> entries_;
+};
+
 }  // namespace hpack_encoder_detail
 
 class HPackCompressor {
@@ -340,9 +390,16 @@ class HPackCompressor {
 
   // Maximum table size we'll actually use.
   static constexpr uint32_t kMaxTableSize = 1024 * 1024;
+  // Default number of pre-encoded request header blocks to keep.
+  static constexpr size_t kDefaultRequestHeaderCacheSize = 16;
 
   void SetMaxTableSize(uint32_t max_table_size);
   void SetMaxUsableSize(uint32_t max_table_size);
+  // Set how many pre-encoded request header blocks to keep; 0 disables the
+  // cache.
+  void SetRequestHeaderCacheSize(size_t size) {
+    request_header_cache_size_ = size;
+  }
 
   uint32_t test_only_table_size() const {
     return table_.test_only_table_size();
@@ -363,6 +420,9 @@ class HPackCompressor {
     SliceBuffer raw;
     hpack_encoder_detail::Encoder encoder(
         this, options.use_true_binary_metadata, raw);
+    if constexpr (std::is_same_v<HeaderSet, grpc_metadata_batch>) {
+      EncodeRequestHeaderBlock(headers, encoder, raw);
+    }
     headers.Encode(&encoder);
     Frame(options, raw, output);
     return !encoder.saw_encoding_errors();
@@ -373,6 +433,9 @@ class HPackCompressor {
                         bool allow_true_binary_metadata) {
     hpack_encoder_detail::Encoder encoder(this, allow_true_binary_metadata,
                                           output);
+    if constexpr (std::is_same_v<HeaderSet, grpc_metadata_batch>) {
+      EncodeRequestHeaderBlock(headers, encoder, output);
+    }
     headers.Encode(&encoder);
     return !encoder.saw_encoding_errors();
   }
@@ -384,6 +447,12 @@ class HPackCompressor {
 
   void Frame(const EncodeHeaderOptions& options, SliceBuffer& raw,
              grpc_slice_buffer* output);
+  // If headers form a request, writes the headers covered by the request
+  // header block to output (from the cache if possible), and tells encoder to
+  // skip them.
+  void EncodeRequestHeaderBlock(const grpc_metadata_batch& headers,
+                                hpack_encoder_detail::Encoder& encoder,
+                                SliceBuffer& output);
 
   // maximum number of bytes we'll use for the decode table (to guard against
   // peers ooming us by setting decode table size high)
@@ -392,6 +461,8 @@ class HPackCompressor {
   // of this size
   bool advertise_table_size_change_ = false;
   HPackEncoderTable table_;
+  size_t request_header_cache_size_ = kDefaultRequestHeaderCacheSize;
+  hpack_encoder_detail::RequestHeaderBlockCache request_header_cache_;
 
   grpc_metadata_batch::StatefulCompressor<hpack_encoder_detail::Compressor>
       compression_state_;
@@ -402,6 +473,9 @@ namespace hpack_encoder_detail {
 template <typename MetadataTrait>
 void Encoder::Encode(MetadataTrait,
                      const typename MetadataTrait::ValueType& value) {
+  if constexpr (kInRequestHeaderBlock<MetadataTrait>) {
+    if (skip_request_header_block_) return;
+  }
   compressor_->compression_state_
       .Compressor<MetadataTrait, typename MetadataTrait::CompressionTraits>::
           EncodeWith(MetadataTrait(), value, this);
@@ -46,6 +46,7 @@ uint32_t HPackEncoderTable::AllocateIndex(size_t element_size) {
       static_cast<uint16_t>(element_size);
   table_size_ += element_size;
   table_elems_++;
+  generation_++;
 
   return new_index;
 }
@@ -76,6 +77,7 @@ void HPackEncoderTable::EvictOne() {
   GRPC_CHECK(table_size_ >= removing_size);
   table_size_ -= removing_size;
   table_elems_--;
+  generation_++;
 }
 
 void HPackEncoderTable::Rebuild(uint32_t capacity) {
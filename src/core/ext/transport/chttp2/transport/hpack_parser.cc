@@ -32,10 +32,11 @@
 
 #include "src/core/call/metadata_info.h"
 #include "src/core/call/parsed_metadata.h"
-#include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multi.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parse_result.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser_table.h"
+#include "src/core/ext/transport/chttp2/transport/varint.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_refcount.h"
@@ -81,6 +82,25 @@ struct Base64InverseTable {
 
 constexpr Base64InverseTable kBase64InverseTable;
 
+// kBase64InverseTable with each value pre-shifted to its place in the decoded
+// triplet, one table per position in a group of four characters. Invalid
+// characters set bit 24, so that a group can be checked with a single branch.
+struct Base64GroupTables {
+  uint32_t table[4][256]{};
+  constexpr Base64GroupTables() {
+    for (int position = 0; position < 4; position++) {
+      for (int i = 0; i < 256; i++) {
+        const uint8_t value = kBase64InverseTable.table[i];
+        table[position][i] = value > 63 ? 1u << 24
+                                        : static_cast<uint32_t>(value)
+                                              << (18 - 6 * position);
+      }
+    }
+  }
+};
+
+constexpr Base64GroupTables kBase64GroupTables;
+
 }  // namespace
 
 // Input tracks the current byte through the input data and provides it
@@ -135,8 +155,19 @@ class HPackParser::Input {
   // Helper to parse a varint delta on top of value, return nullopt on failure
   // (setting error)
   std::optional<uint32_t> ParseVarint(uint32_t value) {
-    // TODO(ctiller): break out a variant of this when we know there are at
-    // least 5 bytes in input_
+    if (remaining() >= 4) {
+      // Nearly all integers end within four bytes: with that many in this
+      // slice, read them at once.
+      const VarintTail tail = ReadVarintTail(begin_);
+      value += tail.value;
+      if (tail.length != 0) {
+        begin_ += tail.length;
+        return value;
+      }
+      begin_ += 4;
+      return ParseVarintFifthByte(value);
+    }
+
     auto cur = Next();
     if (!cur) return {};
     value += *cur & 0x7f;
@@ -157,7 +188,12 @@ class HPackParser::Input {
     value += (*cur & 0x7f) << 21;
     if ((*cur & 0x80) == 0) return value;
 
-    cur = Next();
+    return ParseVarintFifthByte(value);
+  }
+
+  // The rest of ParseVarint, once four bytes of the integer have been read.
+  std::optional<uint32_t> ParseVarintFifthByte(uint32_t value) {
+    auto cur = Next();
     if (!cur) return {};
     uint32_t c = (*cur) & 0x7f;
     // We might overflow here, so we need to be a little careful about the
@@ -351,20 +387,25 @@ absl::string_view HPackParser::String::string_view() const {
   GPR_UNREACHABLE_CODE(return absl::string_view());
 }
 
-template <typename Out>
 HpackParseStatus HPackParser::String::ParseHuff(Input* input, uint32_t length,
-                                                Out output) {
+                                                std::vector<uint8_t>* output) {
   // If there's insufficient bytes remaining, return now.
   if (input->remaining() < length) {
     input->UnexpectedEOF(/*min_progress_size=*/length);
     return HpackParseStatus::kEof;
   }
-  // Grab the byte range, and iterate through it.
+  // Grab the byte range, and decode it straight into output.
   const uint8_t* p = input->cur_ptr();
   input->Advance(length);
-  return HuffDecoder<Out>(output, p, p + length).Run()
-             ? HpackParseStatus::kOk
-             : HpackParseStatus::kParseHuffFailed;
+  output->resize(HuffDecodeMultiSymbolBufferSize(length));
+  std::optional<size_t> decoded =
+      HuffDecodeMultiSymbol(p, p + length, output->data());
+  if (!decoded.has_value()) {
+    output->clear();
+    return HpackParseStatus::kParseHuffFailed;
+  }
+  output->resize(*decoded);
+  return HpackParseStatus::kOk;
 }
 
 struct HPackParser::String::StringResult {
@@ -402,35 +443,23 @@ std::optional<std::vector<uint8_t>> HPackParser::String::Unbase64Loop(
     --end;
   }
 
-  std::vector<uint8_t> out;
-  out.reserve((3 * (end - cur) / 4) + 3);
+  std::vector<uint8_t> out((3 * (end - cur) / 4) + 3);
+  uint8_t* out_cur = out.data();
 
   // Decode 4 bytes at a time while we can
   while (end - cur >= 4) {
-    uint32_t bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    uint32_t buffer = bits << 18;
-    ++cur;
-
-    bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    buffer |= bits << 12;
-    ++cur;
-
-    bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    buffer |= bits << 6;
-    ++cur;
-
-    bits = kBase64InverseTable.table[*cur];
-    if (bits > 63) return {};
-    buffer |= bits;
-    ++cur;
-
-    out.insert(out.end(), {static_cast<uint8_t>(buffer >> 16),
-                           static_cast<uint8_t>(buffer >> 8),
-                           static_cast<uint8_t>(buffer)});
+    const uint32_t buffer = kBase64GroupTables.table[0][cur[0]] |
+                            kBase64GroupTables.table[1][cur[1]] |
+                            kBase64GroupTables.table[2][cur[2]] |
+                            kBase64GroupTables.table[3][cur[3]];
+    if (buffer >> 24 != 0) return {};
+    cur += 4;
+    out_cur[0] = static_cast<uint8_t>(buffer >> 16);
+    out_cur[1] = static_cast<uint8_t>(buffer >> 8);
+    out_cur[2] = static_cast<uint8_t>(buffer);
+    out_cur += 3;
   }
+  out.resize(out_cur - out.data());
   // Deal with the last 0, 1, 2, or 3 bytes.
   switch (end - cur) {
     case 0:
@@ -502,8 +531,7 @@ HPackParser::String::StringResult HPackParser::String::Parse(Input* input,
   if (is_huff) {
     // Huffman coded
     std::vector<uint8_t> output;
-    HpackParseStatus sts =
-        ParseHuff(input, length, [&output](uint8_t c) { output.push_back(c); });
+    HpackParseStatus sts = ParseHuff(input, length, &output);
     size_t wire_len = output.size();
     return StringResult{sts, wire_len, String(std::move(output))};
   }
@@ -525,45 +553,24 @@ HPackParser::String::StringResult HPackParser::String::ParseBinary(
   } else {
     // Huffman encoded...
     std::vector<uint8_t> decompressed;
-    // State here says either we don't know if it's base64 or binary, or we do
-    // and what is it.
-    enum class State { kUnsure, kBinary, kBase64 };
-    State state = State::kUnsure;
-    auto sts = ParseHuff(input, length, [&state, &decompressed](uint8_t c) {
-      if (state == State::kUnsure) {
-        // First byte... if it's zero it's binary
-        if (c == 0) {
-          // Save the type, and skip the zero
-          state = State::kBinary;
-          return;
-        } else {
-          // Flag base64, store this value
-          state = State::kBase64;
-        }
-      }
-      // Non-first byte, or base64 first byte
-      decompressed.push_back(c);
-    });
+    auto sts = ParseHuff(input, length, &decompressed);
     if (sts != HpackParseStatus::kOk) {
       return StringResult{sts, 0, String{}};
     }
-    switch (state) {
-      case State::kUnsure:
-        // No bytes, empty span
-        return StringResult{HpackParseStatus::kOk, 0,
-                            String(absl::Span<const uint8_t>())};
-      case State::kBinary:
-        // Binary, we're done
-        {
-          size_t wire_len = decompressed.size();
-          return StringResult{HpackParseStatus::kOk, wire_len,
-                              String(std::move(decompressed))};
-        }
-      case State::kBase64:
-        // Base64 - unpack it
-        return Unbase64(String(std::move(decompressed)));
+    if (decompressed.empty()) {
+      // No bytes, empty span
+      return StringResult{HpackParseStatus::kOk, 0,
+                          String(absl::Span<const uint8_t>())};
+    }
+    if (decompressed[0] == 0) {
+      // 'true-binary': skip the zero, and we're done
+      decompressed.erase(decompressed.begin());
+      size_t wire_len = decompressed.size();
+      return StringResult{HpackParseStatus::kOk, wire_len,
+                          String(std::move(decompressed))};
     }
-    GPR_UNREACHABLE_CODE(abort(););
+    // Base64 - unpack it
+    return Unbase64(String(std::move(decompressed)));
   }
 }
 
@@ -738,7 +745,8 @@ class HPackParser::Parser {
     }
   }
 
-  bool FinishHeaderAndAddToTable(HPackTable::Memento md) {
+  bool FinishHeaderAndAddToTable(HPackTable::Memento md, absl::string_view key,
+                                 absl::string_view value) {
     // Log if desired
     if (GRPC_TRACE_FLAG_ENABLED(chttp2_hpack_parser)) {
       LogHeader(md);
@@ -746,7 +754,7 @@ class HPackParser::Parser {
     // Emit whilst we own the metadata.
     EmitHeader(md);
     // Add to the hpack table
-    if (GPR_UNLIKELY(!state_.hpack_table.Add(std::move(md)))) {
+    if (GPR_UNLIKELY(!state_.hpack_table.Add(std::move(md), key, value))) {
       input_->SetErrorAndStopParsing(
           HpackParseResult::AddBeforeTableSizeUpdated(
               state_.hpack_table.current_table_bytes(),
@@ -997,8 +1005,14 @@ class HPackParser::Parser {
     auto value_slice = value.value.Take();
     const auto transport_size =
         key_string.size() + value.wire_size + hpack_constants::kEntryOverhead;
+    // A compact table keeps the value's bytes rather than what they parse to.
+    const bool compact_table_entry =
+        state_.add_to_table && state_.hpack_table.compact_storage();
+    Slice table_value;
+    if (compact_table_entry) table_value = value_slice.Ref();
     auto md = grpc_metadata_batch::Parse(
-        key_string, std::move(value_slice), state_.add_to_table, transport_size,
+        key_string, std::move(value_slice),
+        state_.add_to_table && !compact_table_entry, transport_size,
         [key_string, this](absl::string_view message, const Slice&) {
           if (!state_.field_error.ok()) return;
           input_->SetErrorAndContinueParsing(
@@ -1011,7 +1025,8 @@ class HPackParser::Parser {
     input_->UpdateFrontier();
     state_.parse_state = ParseState::kTop;
     if (state_.add_to_table) {
-      return FinishHeaderAndAddToTable(std::move(memento));
+      return FinishHeaderAndAddToTable(std::move(memento), key_string,
+                                       table_value.as_string_view());
     } else {
       FinishHeaderOmitFromTable(memento);
       return true;
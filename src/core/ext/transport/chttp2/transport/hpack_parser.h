@@ -161,11 +161,10 @@ class HPackParser {
     String(grpc_slice_refcount* r, const uint8_t* begin, const uint8_t* end)
         : value_(Slice::FromRefcountAndBytes(r, begin, end)) {}
 
-    // Parse some huffman encoded bytes, using output(uint8_t b) to emit each
-    // decoded byte.
-    template <typename Out>
+    // Parse some huffman encoded bytes, replacing the contents of output with
+    // the decoded bytes.
     static HpackParseStatus ParseHuff(Input* input, uint32_t length,
-                                      Out output);
+                                      std::vector<uint8_t>* output);
 
     // Parse some uncompressed string bytes.
     static StringResult ParseUncompressed(Input* input, uint32_t length,
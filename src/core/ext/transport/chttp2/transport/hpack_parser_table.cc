@@ -24,6 +24,8 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
+#include <memory>
+#include <string>
 #include <utility>
 
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
@@ -33,6 +35,7 @@
 #include "src/core/lib/slice/slice.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/util/grpc_check.h"
+#include "src/core/util/useful.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
@@ -40,7 +43,8 @@
 
 namespace grpc_core {
 
-void HPackTable::MementoRingBuffer::Put(Memento m) {
+template <typename Entry>
+void HPackTable::RingBuffer<Entry>::Put(Entry m) {
   GRPC_CHECK_LT(num_entries_, max_entries_);
   if (entries_.size() < max_entries_) {
     ++num_entries_;
@@ -55,7 +59,8 @@ void HPackTable::MementoRingBuffer::Put(Memento m) {
   ++num_entries_;
 }
 
-auto HPackTable::MementoRingBuffer::PopOne() -> Memento {
+template <typename Entry>
+Entry HPackTable::RingBuffer<Entry>::PopOne() {
   GRPC_CHECK_GT(num_entries_, 0u);
   size_t index = first_entry_ % max_entries_;
   if (index == timestamp_index_) {
@@ -72,7 +77,8 @@ auto HPackTable::MementoRingBuffer::PopOne() -> Memento {
   return std::move(entry);
 }
 
-auto HPackTable::MementoRingBuffer::Lookup(uint32_t index) -> const Memento* {
+template <typename Entry>
+const Entry* HPackTable::RingBuffer<Entry>::Lookup(uint32_t index) {
   if (index >= num_entries_) return nullptr;
   uint32_t offset = (num_entries_ - 1u - index + first_entry_) % max_entries_;
   auto& entry = entries_[offset];
@@ -82,17 +88,18 @@ auto HPackTable::MementoRingBuffer::Lookup(uint32_t index) -> const Memento* {
   return &entry;
 }
 
-auto HPackTable::MementoRingBuffer::Peek(uint32_t index) const
-    -> const Memento* {
+template <typename Entry>
+const Entry* HPackTable::RingBuffer<Entry>::Peek(uint32_t index) const {
   if (index >= num_entries_) return nullptr;
   uint32_t offset = (num_entries_ - 1u - index + first_entry_) % max_entries_;
   return &entries_[offset];
 }
 
-void HPackTable::MementoRingBuffer::Rebuild(uint32_t max_entries) {
+template <typename Entry>
+void HPackTable::RingBuffer<Entry>::Rebuild(uint32_t max_entries) {
   if (max_entries == max_entries_) return;
   max_entries_ = max_entries;
-  std::vector<Memento> entries;
+  std::vector<Entry> entries;
   entries.reserve(num_entries_);
   for (size_t i = 0; i < num_entries_; i++) {
     entries.push_back(
@@ -102,32 +109,115 @@ void HPackTable::MementoRingBuffer::Rebuild(uint32_t max_entries) {
   entries_.swap(entries);
 }
 
+template <typename Entry>
 template <typename F>
-void HPackTable::MementoRingBuffer::ForEach(F f) const {
+void HPackTable::RingBuffer<Entry>::ForEach(F f) const {
   uint32_t index = 0;
   while (auto* m = Peek(index++)) {
     f(index, *m);
   }
 }
 
-HPackTable::MementoRingBuffer::~MementoRingBuffer() {
-  ForEach([this](uint32_t, const Memento& m) {
+template <typename Entry>
+HPackTable::RingBuffer<Entry>::~RingBuffer() {
+  ForEach([this](uint32_t, const Entry& m) {
     if (!m.parse_status.TestBit(Memento::kUsedBit)) {
       http2_stats_collector_->IncrementHttp2HpackMisses();
     }
   });
 }
 
+template class HPackTable::RingBuffer<HPackTable::Memento>;
+template class HPackTable::RingBuffer<HPackTable::CompactEntry>;
+
+uint32_t HPackTable::ByteRing::Append(absl::string_view key,
+                                      absl::string_view value) {
+  const uint32_t length = key.size() + value.size();
+  if (size() + length > capacity_) {
+    Reallocate(RoundUpToPowerOf2(std::max(size() + length, 2 * capacity_)));
+  }
+  const uint32_t offset = head_;
+  Write(head_, key);
+  Write(head_ + key.size(), value);
+  head_ += length;
+  return offset;
+}
+
+void HPackTable::ByteRing::Write(uint32_t offset, absl::string_view bytes) {
+  if (bytes.empty()) return;
+  const uint32_t start = offset & (capacity_ - 1);
+  const size_t first = std::min<size_t>(bytes.size(), capacity_ - start);
+  memcpy(bytes_.get() + start, bytes.data(), first);
+  memcpy(bytes_.get(), bytes.data() + first, bytes.size() - first);
+}
+
+absl::string_view HPackTable::ByteRing::Read(uint32_t offset, uint32_t length,
+                                             std::string* backing) const {
+  if (length == 0) return absl::string_view();
+  const uint32_t start = offset & (capacity_ - 1);
+  if (start + length <= capacity_) {
+    return absl::string_view(bytes_.get() + start, length);
+  }
+  const uint32_t first = capacity_ - start;
+  backing->assign(bytes_.get() + start, first);
+  backing->append(bytes_.get(), length - first);
+  return *backing;
+}
+
+void HPackTable::ByteRing::ShrinkTo(uint32_t max_bytes) {
+  const uint32_t needed = std::max(size(), max_bytes);
+  if (needed == 0) {
+    bytes_.reset();
+    capacity_ = 0;
+    return;
+  }
+  const uint32_t capacity = RoundUpToPowerOf2(needed);
+  if (capacity < capacity_) Reallocate(capacity);
+}
+
+void HPackTable::ByteRing::Reallocate(uint32_t capacity) {
+  GRPC_DCHECK_GE(capacity, size());
+  ByteRing grown;
+  grown.bytes_ = std::make_unique<char[]>(capacity);
+  grown.capacity_ = capacity;
+  // Keep every byte at its offset.
+  grown.tail_ = grown.head_ = tail_;
+  std::string backing;
+  grown.Write(tail_, Read(tail_, size(), &backing));
+  grown.head_ = head_;
+  *this = std::move(grown);
+}
+
 // Evict one element from the table
 void HPackTable::EvictOne() {
-  auto first_entry = entries_.PopOne();
-  GRPC_CHECK(first_entry.md.transport_size() <= mem_used_);
-  mem_used_ -= first_entry.md.transport_size();
+  uint32_t transport_size;
+  if (compact_) {
+    auto first_entry = compact_entries_.PopOne();
+    compact_bytes_.Consume(first_entry.key_length + first_entry.value_length);
+    transport_size = first_entry.transport_size;
+  } else {
+    transport_size = entries_.PopOne().md.transport_size();
+  }
+  GRPC_CHECK(transport_size <= mem_used_);
+  mem_used_ -= transport_size;
 }
 
 void HPackTable::SetHttp2StatsCollector(
     std::shared_ptr<Http2StatsCollector> http2_stats_collector) {
   entries_.SetHttp2StatsCollector(http2_stats_collector);
+  compact_entries_.SetHttp2StatsCollector(http2_stats_collector);
+}
+
+void HPackTable::SetCompactStorage(bool compact) {
+  GRPC_CHECK_EQ(num_entries(), 0u);
+  if (compact_ == compact) return;
+  compact_ = compact;
+  if (compact_) {
+    compact_entries_.Rebuild(entries_.max_entries());
+  } else {
+    entries_.Rebuild(compact_entries_.max_entries());
+    compact_bytes_.ShrinkTo(0);
+  }
 }
 
 void HPackTable::SetMaxBytes(uint32_t max_bytes) {
@@ -151,24 +241,37 @@ bool HPackTable::SetCurrentTableSize(uint32_t bytes) {
   current_table_bytes_ = bytes;
   uint32_t new_cap = std::max(hpack_constants::EntriesForBytes(bytes),
                               hpack_constants::kInitialTableEntries);
-  entries_.Rebuild(new_cap);
+  if (compact_) {
+    compact_entries_.Rebuild(new_cap);
+    compact_bytes_.ShrinkTo(bytes);
+  } else {
+    entries_.Rebuild(new_cap);
+  }
   return true;
 }
 
-bool HPackTable::Add(Memento md) {
-  if (current_table_bytes_ > max_bytes_) return false;
-
+// Evicts entries until there is room for an entry of transport_size, and
+// returns true, or empties the table and returns false if the entry can never
+// fit.
+bool HPackTable::MakeRoomFor(uint32_t transport_size) {
   // we can't add elements bigger than the max table size
-  if (md.md.transport_size() > current_table_bytes_) {
+  if (transport_size > current_table_bytes_) {
     AddLargerThanCurrentTableSize();
-    return true;
+    return false;
   }
 
   // evict entries to ensure no overflow
-  while (md.md.transport_size() >
+  while (transport_size >
          static_cast<size_t>(current_table_bytes_) - mem_used_) {
     EvictOne();
   }
+  return true;
+}
+
+bool HPackTable::Add(Memento md) {
+  GRPC_DCHECK(!compact_);
+  if (current_table_bytes_ > max_bytes_) return false;
+  if (!MakeRoomFor(md.md.transport_size())) return true;
 
   // copy the finalized entry in
   mem_used_ += md.md.transport_size();
@@ -176,6 +279,51 @@ bool HPackTable::Add(Memento md) {
   return true;
 }
 
+bool HPackTable::Add(Memento md, absl::string_view key,
+                     absl::string_view value) {
+  if (!compact_) return Add(std::move(md));
+  if (current_table_bytes_ > max_bytes_) return false;
+  const uint32_t transport_size = md.md.transport_size();
+  if (!MakeRoomFor(transport_size)) return true;
+
+  // Keep the bytes the entry was parsed from, and the one thing parsing them
+  // again would not recover: any error from the first time.
+  mem_used_ += transport_size;
+  const uint32_t offset = compact_bytes_.Append(key, value);
+  compact_entries_.Put(
+      CompactEntry{offset, static_cast<uint32_t>(key.size()),
+                   static_cast<uint32_t>(value.size()), transport_size,
+                   std::move(md.parse_status)});
+  return true;
+}
+
+auto HPackTable::Materialize(const CompactEntry& entry) const -> Memento {
+  std::string key_backing;
+  std::string value_backing;
+  const absl::string_view key =
+      compact_bytes_.Read(entry.offset, entry.key_length, &key_backing);
+  const absl::string_view value = compact_bytes_.Read(
+      entry.offset + entry.key_length, entry.value_length, &value_backing);
+  // Any error parsing this was recorded in parse_status when it was added.
+  Memento memento{grpc_metadata_batch::Parse(
+                      key, Slice::FromCopiedBuffer(value.data(), value.size()),
+                      false, entry.transport_size,
+                      [](absl::string_view, const Slice&) {}),
+                  nullptr};
+  if (entry.parse_status.get() != nullptr) {
+    memento.parse_status =
+        std::make_unique<HpackParseResult>(*entry.parse_status);
+  }
+  return memento;
+}
+
+auto HPackTable::LookupCompact(uint32_t tbl_index) -> const Memento* {
+  const CompactEntry* entry = compact_entries_.Lookup(tbl_index);
+  if (entry == nullptr) return nullptr;
+  materialized_.emplace(Materialize(*entry));
+  return &*materialized_;
+}
+
 void HPackTable::AddLargerThanCurrentTableSize() {
   // HPACK draft 10 section 4.4 states:
   // If the size of the new entry is less than or equal to the maximum
@@ -184,21 +332,28 @@ void HPackTable::AddLargerThanCurrentTableSize() {
   // attempt to add an entry larger than the entire table causes
   // the table to be emptied of all existing entries, and results in an
   // empty table.
-  while (entries_.num_entries()) {
+  while (num_entries()) {
     EvictOne();
   }
 }
 
 std::string HPackTable::TestOnlyDynamicTableAsString() const {
   std::string out;
-  entries_.ForEach([&out](uint32_t i, const Memento& m) {
+  auto append = [&out](uint32_t i, const Memento& m) {
     if (m.parse_status == nullptr) {
       absl::StrAppend(&out, i, ": ", m.md.DebugString(), "\n");
     } else {
       absl::StrAppend(&out, i, ": ", m.parse_status->Materialize().ToString(),
                       "\n");
     }
-  });
+  };
+  if (compact_) {
+    compact_entries_.ForEach([this, &append](uint32_t i, const CompactEntry& e) {
+      append(i, Materialize(e));
+    });
+  } else {
+    entries_.ForEach(append);
+  }
   return out;
 }
 
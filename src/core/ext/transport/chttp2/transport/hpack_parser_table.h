@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -33,9 +34,16 @@
 #include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parse_result.h"
 #include "src/core/ext/transport/chttp2/transport/http2_stats_collector.h"
+#include "src/core/util/grpc_check.h"
 #include "src/core/util/no_destruct.h"
 #include "src/core/util/unique_ptr_with_bitset.h"
 #include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+
+// Keep the HPACK decoder's dynamic table compactly: see
+// HPackTable::SetCompactStorage(). Off by default.
+#define GRPC_ARG_HTTP2_HPACK_COMPACT_DECODER_TABLE \
+  "grpc.http2.hpack_compact_decoder_table"
 
 namespace grpc_core {
 
@@ -52,6 +60,13 @@ class HPackTable {
 
   void SetHttp2StatsCollector(
       std::shared_ptr<Http2StatsCollector> http2_stats_collector);
+  // Keep dynamic table entries as the bytes of their keys and values, packed
+  // into one buffer per table, rather than as parsed Mementos. This takes a
+  // fraction of the memory with large tables, at the cost of parsing an entry
+  // again each time it is looked up.
+  // REQUIRES: the dynamic table is empty.
+  void SetCompactStorage(bool compact);
+  bool compact_storage() const { return compact_; }
   void SetMaxBytes(uint32_t max_bytes);
   bool SetCurrentTableSize(uint32_t bytes);
   uint32_t current_table_size() { return current_table_bytes_; }
@@ -65,6 +80,8 @@ class HPackTable {
   };
 
   // Lookup, but don't ref.
+  // With compact storage, the result is only valid until the next call to
+  // Lookup() or Add().
   const Memento* Lookup(uint32_t index) {
     // Static table comes first, just return an entry from it.
     // NB: This imposes the constraint that the first
@@ -80,11 +97,18 @@ class HPackTable {
   }
 
   // add a table entry to the index
+  // REQUIRES: !compact_storage()
   GRPC_MUST_USE_RESULT bool Add(Memento md);
+  // add a table entry to the index, given the key and value it was parsed
+  // from: with compact storage, these are kept in place of md.
+  GRPC_MUST_USE_RESULT bool Add(Memento md, absl::string_view key,
+                                absl::string_view value);
   void AddLargerThanCurrentTableSize();
 
   // Current entry count in the table.
-  uint32_t num_entries() const { return entries_.num_entries(); }
+  uint32_t num_entries() const {
+    return compact_ ? compact_entries_.num_entries() : entries_.num_entries();
+  }
 
   // Current size of the table.
   uint32_t test_only_table_size() const { return mem_used_; }
@@ -102,16 +126,28 @@ class HPackTable {
     Memento memento[hpack_constants::kLastStaticEntry];
   };
 
-  class MementoRingBuffer {
+  // A compactly stored entry: its key and value are the key_length +
+  // value_length bytes of compact_bytes_ from offset on.
+  struct CompactEntry {
+    uint32_t offset;
+    uint32_t key_length;
+    uint32_t value_length;
+    uint32_t transport_size;
+    // As for Memento.
+    UniquePtrWithBitset<HpackParseResult, 1> parse_status;
+  };
+
+  // A ring buffer of table entries: Entry is Memento or CompactEntry.
+  template <typename Entry>
+  class RingBuffer {
    public:
-    MementoRingBuffer()
-        : http2_stats_collector_(CreateHttp2StatsCollector(nullptr)) {}
-    ~MementoRingBuffer();
+    RingBuffer() : http2_stats_collector_(CreateHttp2StatsCollector(nullptr)) {}
+    ~RingBuffer();
 
-    MementoRingBuffer(const MementoRingBuffer&) = delete;
-    MementoRingBuffer& operator=(const MementoRingBuffer&) = delete;
-    MementoRingBuffer(MementoRingBuffer&&) = default;
-    MementoRingBuffer& operator=(MementoRingBuffer&&) = default;
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+    RingBuffer(RingBuffer&&) = default;
+    RingBuffer& operator=(RingBuffer&&) = default;
 
     void SetHttp2StatsCollector(
         std::shared_ptr<Http2StatsCollector> http2_stats_collector) {
@@ -121,17 +157,17 @@ class HPackTable {
     // Rebuild this buffer with a new max_entries_ size.
     void Rebuild(uint32_t max_entries);
 
-    // Put a new memento.
+    // Put a new entry.
     // REQUIRES: num_entries < max_entries
-    void Put(Memento m);
+    void Put(Entry m);
 
-    // Pop the oldest memento.
+    // Pop the oldest entry.
     // REQUIRES: num_entries > 0
-    Memento PopOne();
+    Entry PopOne();
 
     // Lookup the entry at index, or return nullptr if none exists.
-    const Memento* Lookup(uint32_t index);
-    const Memento* Peek(uint32_t index) const;
+    const Entry* Lookup(uint32_t index);
+    const Entry* Peek(uint32_t index) const;
 
     template <typename F>
     void ForEach(F f) const;
@@ -157,15 +193,56 @@ class HPackTable {
 
     std::shared_ptr<Http2StatsCollector> http2_stats_collector_ = nullptr;
 
-    std::vector<Memento> entries_;
+    std::vector<Entry> entries_;
+  };
+  using MementoRingBuffer = RingBuffer<Memento>;
+
+  // The key and value bytes of compactly stored entries, in the order they
+  // were added. Bytes are addressed by a running offset, which wraps around
+  // at 2^32: since the capacity is a power of two, offset & (capacity - 1)
+  // locates a byte whatever the capacity was when it was added.
+  class ByteRing {
+   public:
+    // Append `key` then `value`, growing as needed; returns the offset of the
+    // first byte of `key`.
+    uint32_t Append(absl::string_view key, absl::string_view value);
+    // Drop the oldest `length` bytes.
+    void Consume(uint32_t length) {
+      GRPC_DCHECK_LE(length, size());
+      tail_ += length;
+    }
+    // The `length` bytes from `offset` on: a view of the ring if they are
+    // contiguous, otherwise copied into `backing`.
+    absl::string_view Read(uint32_t offset, uint32_t length,
+                           std::string* backing) const;
+    // Release what capacity is not needed to hold max_bytes.
+    void ShrinkTo(uint32_t max_bytes);
+
+    uint32_t size() const { return head_ - tail_; }
+
+   private:
+    void Write(uint32_t offset, absl::string_view bytes);
+    void Reallocate(uint32_t capacity);
+
+    std::unique_ptr<char[]> bytes_;
+    // Zero or a power of two.
+    uint32_t capacity_ = 0;
+    // Offset of the oldest byte.
+    uint32_t tail_ = 0;
+    // Offset one past the newest byte.
+    uint32_t head_ = 0;
   };
 
   const Memento* LookupDynamic(uint32_t index) {
     // Not static - find the value in the list of valid entries
     const uint32_t tbl_index = index - (hpack_constants::kLastStaticEntry + 1);
+    if (GPR_UNLIKELY(compact_)) return LookupCompact(tbl_index);
     return entries_.Lookup(tbl_index);
   }
 
+  const Memento* LookupCompact(uint32_t tbl_index);
+  Memento Materialize(const CompactEntry& entry) const;
+  bool MakeRoomFor(uint32_t transport_size);
   void EvictOne();
 
   static const StaticMementos* GetStaticMementos() {
@@ -180,8 +257,15 @@ class HPackTable {
   uint32_t max_bytes_ = hpack_constants::kInitialTableSize;
   // The currently agreed size of the table, according to the hpack algorithm.
   uint32_t current_table_bytes_ = hpack_constants::kInitialTableSize;
+  // Whether entries are kept in compact_entries_ and compact_bytes_ rather
+  // than entries_.
+  bool compact_ = false;
   // HPack table entries
   MementoRingBuffer entries_;
+  RingBuffer<CompactEntry> compact_entries_;
+  ByteRing compact_bytes_;
+  // The last compact entry looked up.
+  std::optional<Memento> materialized_;
   // Static mementos
   const StaticMementos* static_mementos_ = GetStaticMementos();
 };
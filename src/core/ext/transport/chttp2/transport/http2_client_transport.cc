@@ -43,6 +43,7 @@
 #include "src/core/ext/transport/chttp2/transport/frame.h"
 #include "src/core/ext/transport/chttp2/transport/goaway.h"
 #include "src/core/ext/transport/chttp2/transport/header_assembler.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_parser_table.h"
 #include "src/core/ext/transport/chttp2/transport/http2_settings.h"
 #include "src/core/ext/transport/chttp2/transport/http2_settings_promises.h"
 #include "src/core/ext/transport/chttp2/transport/http2_status.h"
@@ -1170,9 +1171,15 @@ Http2ClientTransport::DequeueStreamFrames(
   // data frames when write_bytes_remaining_ is very low. As the
   // available transport tokens can only range from 0 to 2^31 - 1,
   // we are clamping the write_bytes_remaining_ to that range.
-  const uint32_t tokens = GetMaxPermittedDequeue(
+  uint32_t tokens = GetMaxPermittedDequeue(
       flow_control_, stream->flow_control, write_quota.GetWriteBytesRemaining(),
       settings_->peer());
+  // Under fair scheduling the stream sends no more than its share before the
+  // next stream gets a turn: see Chttp2DataSchedulingPolicy.
+  const uint64_t turn_bytes =
+      stream->data_share.BeginTurn(data_scheduling_policy_);
+  const bool turn_limited = turn_bytes < tokens;
+  if (turn_limited) tokens = static_cast<uint32_t>(turn_bytes);
   const uint32_t stream_flow_control_tokens = static_cast<uint32_t>(
       GetStreamFlowControlTokens(stream->flow_control, settings_->peer()));
   stream->flow_control.ReportIfStalled(
@@ -1182,11 +1189,18 @@ Http2ClientTransport::DequeueStreamFrames(
                             settings_->peer().max_frame_size(), encoder_);
   ProcessOutgoingDataFrameFlowControl(stream->flow_control,
                                       result.flow_control_tokens_consumed);
+  stream->data_share.Sent(result.flow_control_tokens_consumed);
+  stream->data_share.EndTurn(/*drained=*/!result.is_writable);
   if (result.is_writable) {
     // Stream is still writable. Enqueue it back to the writable
     // stream list.
-    absl::Status status = writable_stream_list_.EnqueueWrapper(
-        stream, result.priority, AreTransportFlowControlTokensAvailable());
+    absl::Status status =
+        turn_limited ? writable_stream_list_.RequeueAfterTurn(
+                           stream, result.priority,
+                           AreTransportFlowControlTokensAvailable())
+                     : writable_stream_list_.EnqueueWrapper(
+                           stream, result.priority,
+                           AreTransportFlowControlTokensAvailable());
 
     if (GPR_UNLIKELY(!status.ok())) {
       GRPC_HTTP2_CLIENT_DLOG
@@ -1485,7 +1499,8 @@ Http2ClientTransport::Http2ClientTransport(
           "PH2_Client",
           channel_args.GetBool(GRPC_ARG_HTTP2_BDP_PROBE).value_or(true),
           &memory_owner_),
-      ztrace_collector_(std::make_shared<PromiseHttp2ZTraceCollector>()) {
+      ztrace_collector_(std::make_shared<PromiseHttp2ZTraceCollector>()),
+      data_scheduling_policy_(channel_args) {
   GRPC_HTTP2_CLIENT_DLOG << "Http2ClientTransport Constructor Begin";
   // Initialize the general party and write party.
   RefCountedPtr<Arena> party_arena = SimpleArenaAllocator(0)->MakeArena();
@@ -1495,6 +1510,9 @@ Http2ClientTransport::Http2ClientTransport(
   InitLocalSettings(settings_->mutable_local(), /*is_client=*/true);
   TransportChannelArgs args;
   ReadChannelArgs(channel_args, args);
+  parser_.hpack_table()->SetCompactStorage(
+      channel_args.GetBool(GRPC_ARG_HTTP2_HPACK_COMPACT_DECODER_TABLE)
+          .value_or(false));
 
   ping_manager_.emplace(channel_args, args.ping_timeout,
                         PingSystemInterfaceImpl::Make(this), event_engine_);
@@ -2064,7 +2082,9 @@ std::optional<RefCountedPtr<Stream>> Http2ClientTransport::MakeStream(
     // TODO(akshitpatel) : [PH2][P3] : Remove this mutex once settings is in
     // place.
     MutexLock lock(&transport_mutex_);
-    stream = MakeRefCounted<Stream>(call_handler, flow_control_);
+    stream = MakeRefCounted<Stream>(
+        call_handler, flow_control_,
+        data_scheduling_policy_.small_message_lane_bytes());
   }
   const bool on_done_added = SetOnDone(call_handler, stream);
   if (!on_done_added) return std::nullopt;
@@ -2196,6 +2216,11 @@ void Http2ClientTransport::StartCall(CallHandler call_handler) {
                // whether or not we should fail is debatable.
                std::optional<RefCountedPtr<Stream>> stream =
                    self->MakeStream(call_handler);
+               if (stream.has_value() &&
+                   self->data_scheduling_policy_.fair()) {
+                 (*stream)->data_share.set_weight(
+                     Chttp2StreamWeightFromMetadata(*metadata));
+               }
                return If(
                    stream.has_value(),
                    [self, call_handler, stream,
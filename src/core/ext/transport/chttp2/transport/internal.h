@@ -37,6 +37,7 @@
 #include "src/core/call/metadata_batch.h"
 #include "src/core/channelz/channelz.h"
 #include "src/core/ext/transport/chttp2/transport/call_tracer_wrapper.h"
+#include "src/core/ext/transport/chttp2/transport/data_scheduling_policy.h"
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
 #include "src/core/ext/transport/chttp2/transport/frame_goaway.h"
 #include "src/core/ext/transport/chttp2/transport/frame_ping.h"
@@ -54,6 +55,7 @@
 #include "src/core/ext/transport/chttp2/transport/ping_callbacks.h"
 #include "src/core/ext/transport/chttp2/transport/ping_rate_policy.h"
 #include "src/core/ext/transport/chttp2/transport/transport_common.h"
+#include "src/core/ext/transport/chttp2/transport/write_coalescing_policy.h"
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
@@ -370,6 +372,7 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   grpc_closure write_action_begin_locked;
   grpc_closure write_action_end_locked;
+  grpc_closure write_coalescing_timer_fired_locked;
 
   grpc_closure read_action_locked;
 
@@ -564,6 +567,15 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   /// policy for how much data we're willing to put into one http2 write
   grpc_core::Chttp2WriteSizePolicy write_size_policy;
+  /// policy for holding back writes so that more streams can join them
+  grpc_core::Chttp2WriteCoalescingPolicy write_coalescing_policy;
+  /// policy for sharing writes between the DATA frames of different streams
+  grpc_core::Chttp2DataSchedulingPolicy data_scheduling_policy;
+  /// pending timer to release a write held by write_coalescing_policy;
+  /// kInvalid when no write is being held
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      write_coalescing_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
 
   bool reading_paused_on_pending_induced_frames = false;
   /// Based on channel args, preferred_rx_crypto_frame_sizes are advertised to
@@ -712,6 +724,8 @@ struct grpc_chttp2_stream {
   grpc_core::chttp2::StreamFlowControl flow_control;
 
   grpc_slice_buffer flow_controlled_buffer;
+  /// this stream's share of writes, per t->data_scheduling_policy
+  grpc_core::Chttp2StreamDataShare data_share;
 
   grpc_chttp2_write_cb* on_flow_controlled_cbs = nullptr;
   grpc_chttp2_write_cb* on_write_finished_cbs = nullptr;
@@ -35,6 +35,7 @@
 #include "src/core/channelz/channelz.h"
 #include "src/core/ext/transport/chttp2/transport/call_tracer_wrapper.h"
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
+#include "src/core/ext/transport/chttp2/transport/frame.h"
 #include "src/core/ext/transport/chttp2/transport/frame_data.h"
 #include "src/core/ext/transport/chttp2/transport/frame_goaway.h"
 #include "src/core/ext/transport/chttp2/transport/frame_ping.h"
@@ -275,6 +276,18 @@ std::variant<size_t, absl::Status> grpc_chttp2_perform_read(
       [[fallthrough]];
     case GRPC_DTS_FH_0:
       GRPC_DCHECK_LT(cur, end);
+      if (static_cast<size_t>(end - cur) >= grpc_core::kFrameHeaderSize) {
+        // The whole header is in this slice: read it at once, and leave the
+        // byte at a time states below for headers split across slices.
+        const grpc_core::Http2FrameHeader header =
+            grpc_core::Http2FrameHeader::Parse(cur);
+        t->incoming_frame_size = header.length;
+        t->incoming_frame_type = header.type;
+        t->incoming_frame_flags = header.flags;
+        t->incoming_stream_id = header.stream_id;
+        cur += grpc_core::kFrameHeaderSize - 1;
+        goto dts_fh_parsed;
+      }
       t->incoming_frame_size = (static_cast<uint32_t>(*cur)) << 16;
       if (++cur == end) {
         t->deframe_state = GRPC_DTS_FH_1;
@@ -340,6 +353,7 @@ std::variant<size_t, absl::Status> grpc_chttp2_perform_read(
     case GRPC_DTS_FH_8:
       GRPC_DCHECK_LT(cur, end);
       t->incoming_stream_id |= (static_cast<uint32_t>(*cur));
+    dts_fh_parsed:
       GRPC_TRACE_LOG(http, INFO)
           << "INCOMING[" << t << "]: "
           << FrameTypeString(t->incoming_frame_type, t->incoming_frame_flags)
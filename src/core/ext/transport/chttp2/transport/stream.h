@@ -29,6 +29,7 @@
 #include "src/core/call/call_spine.h"
 #include "src/core/call/message.h"
 #include "src/core/call/metadata.h"
+#include "src/core/ext/transport/chttp2/transport/data_scheduling_policy.h"
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
 #include "src/core/ext/transport/chttp2/transport/frame.h"
 #include "src/core/ext/transport/chttp2/transport/header_assembler.h"
@@ -62,7 +63,8 @@ enum class HttpStreamState : uint8_t {
 // Managing the streams
 struct Stream : public RefCounted<Stream> {
   explicit Stream(CallHandler call,
-                  chttp2::TransportFlowControl& transport_flow_control)
+                  chttp2::TransportFlowControl& transport_flow_control,
+                  const uint32_t small_message_lane_bytes = 0)
       : call(std::move(call)),
         is_write_closed(false),
         stream_state(HttpStreamState::kIdle),
@@ -72,7 +74,7 @@ struct Stream : public RefCounted<Stream> {
         did_push_server_trailing_metadata(false),
         data_queue(MakeRefCounted<StreamDataQueue<ClientMetadataHandle>>(
             /*is_client*/ true,
-            /*queue_size*/ kStreamQueueSize)),
+            /*queue_size*/ kStreamQueueSize, small_message_lane_bytes)),
         flow_control(&transport_flow_control) {}
 
   // TODO(akshitpatel) : [PH2][P4] : SetStreamId can be avoided if we pass the
@@ -279,6 +281,8 @@ struct Stream : public RefCounted<Stream> {
   // accomodate ServerMetadataHandle for the server side.
   RefCountedPtr<StreamDataQueue<ClientMetadataHandle>> data_queue;
   chttp2::StreamFlowControl flow_control;
+  // Accessed only from the transport party.
+  Chttp2StreamDataShare data_share;
 };
 
 }  // namespace http2
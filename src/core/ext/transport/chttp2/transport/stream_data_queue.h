@@ -202,9 +202,13 @@ class SimpleQueue {
 template <typename MetadataHandle>
 class StreamDataQueue : public RefCounted<StreamDataQueue<MetadataHandle>> {
  public:
-  explicit StreamDataQueue(const bool is_client, const uint32_t queue_size)
+  // Streams whose messages are no larger than small_message_lane_bytes are
+  // given WritableStreamPriority::kSmallMessage; zero disables this.
+  explicit StreamDataQueue(const bool is_client, const uint32_t queue_size,
+                           const uint32_t small_message_lane_bytes = 0)
       : stream_id_(0),
         is_client_(is_client),
+        small_message_lane_bytes_(small_message_lane_bytes),
         queue_(queue_size),
         initial_metadata_disassembler_(/*is_trailing_metadata=*/false),
         trailing_metadata_disassembler_(/*is_trailing_metadata=*/true) {};
@@ -271,7 +275,7 @@ class StreamDataQueue : public RefCounted<StreamDataQueue<MetadataHandle>> {
       return result.status();
     }
     return UpdateWritableStateAndPriorityEnqueueLocked(
-        /*became_non_empty*/ result.value(), WritableStreamPriority::kDefault);
+        /*became_non_empty*/ result.value(), DataPriority(/*tokens=*/0));
   }
 
   // Enqueue Trailing Metadata.
@@ -335,8 +339,7 @@ class StreamDataQueue : public RefCounted<StreamDataQueue<MetadataHandle>> {
             << "became_non_empty: " << result.value();
 
         return self->UpdateWritableStateAndPriorityEnqueueLocked(
-            /*became_non_empty=*/result.value(),
-            WritableStreamPriority::kDefault);
+            /*became_non_empty=*/result.value(), self->DataPriority(tokens));
       }
       return Pending{};
     };
@@ -690,6 +693,14 @@ class StreamDataQueue : public RefCounted<StreamDataQueue<MetadataHandle>> {
     uint8_t dequeue_flags_ = 0u;
   };
 
+  // The priority of a stream whose latest enqueue was `tokens` long.
+  WritableStreamPriority DataPriority(const uint32_t tokens) const {
+    return (small_message_lane_bytes_ != 0 &&
+            tokens <= small_message_lane_bytes_)
+               ? WritableStreamPriority::kSmallMessage
+               : WritableStreamPriority::kDefault;
+  }
+
   // Updates the writable state and priority of the stream. MUST only be called
   // from the enqueue functions.
   // became_non_empty: True if the queue was empty and became non-empty as a
@@ -837,6 +848,7 @@ class StreamDataQueue : public RefCounted<StreamDataQueue<MetadataHandle>> {
 
   // This is only used for DCHECKs. Not actually used for any business logic.
   const bool is_client_;
+  const uint32_t small_message_lane_bytes_;
 
   enum class RstStreamState : uint8_t {
     kNotQueued = 0,
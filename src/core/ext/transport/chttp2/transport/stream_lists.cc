@@ -175,6 +175,10 @@ bool grpc_chttp2_list_add_writable_stream(grpc_chttp2_transport* t,
       s->send_trailing_metadata != nullptr) {
     return stream_list_prepend(t, s, GRPC_CHTTP2_LIST_WRITABLE);
   }
+  // Streams with little to send jump the queue.
+  if (t->data_scheduling_policy.IsSmall(s->flow_controlled_buffer.length)) {
+    return stream_list_prepend(t, s, GRPC_CHTTP2_LIST_WRITABLE);
+  }
   return stream_list_add(t, s, GRPC_CHTTP2_LIST_WRITABLE);
 }
 
@@ -58,6 +58,9 @@ enum class WritableStreamPriority : uint8_t {
   // Highest priority
   kStreamClosed = 0,
   kWaitForTransportFlowControl,
+  // Streams with only a small message waiting: see
+  // GRPC_ARG_HTTP2_SMALL_MESSAGE_LANE_BYTES.
+  kSmallMessage,
   // Lowest Priority
   kDefault,
   kLastPriority
@@ -71,6 +74,8 @@ inline std::string GetWritableStreamPriorityString(
       return "StreamClosed";
     case WritableStreamPriority::kWaitForTransportFlowControl:
       return "WaitForTransportFlowControl";
+    case WritableStreamPriority::kSmallMessage:
+      return "SmallMessage";
     case WritableStreamPriority::kDefault:
       return "Default";
     default:
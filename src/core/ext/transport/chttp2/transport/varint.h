@@ -24,8 +24,9 @@
 #include <stdlib.h>
 
 #include "src/core/util/grpc_check.h"
+#include "absl/numeric/bits.h"
 
-// Helpers for hpack varint encoding
+// Helpers for hpack varint encoding and decoding
 
 namespace grpc_core {
 
@@ -41,6 +42,41 @@ constexpr uint32_t MaxInVarintPrefix(uint8_t prefix_bits) {
 size_t VarintLength(size_t tail_value);
 void VarintWriteTail(size_t tail_value, uint8_t* target, size_t tail_length);
 
+// The bytes that follow an integer's prefix (RFC 7541 section 5.1) as far as
+// can be read in one go: see ReadVarintTail.
+struct VarintTail {
+  // What the bytes read add to the prefix.
+  uint32_t value;
+  // How many bytes ended the integer (1 to 4), or 0 if none of the four did.
+  uint32_t length;
+};
+
+// Reads up to the first four bytes after an integer's prefix all at once,
+// rather than testing each for the end of the integer in turn. `input` must
+// have at least four readable bytes. If the integer goes on past them,
+// returns a length of 0 and what all four add, and the caller carries on a
+// byte at a time from input + 4.
+inline VarintTail ReadVarintTail(const uint8_t* input) {
+  // Little endian, so that the first byte is the least significant: compilers
+  // turn this into a single load.
+  const uint32_t word = static_cast<uint32_t>(input[0]) |
+                        static_cast<uint32_t>(input[1]) << 8 |
+                        static_cast<uint32_t>(input[2]) << 16 |
+                        static_cast<uint32_t>(input[3]) << 24;
+  // Bytes with their top bit clear end the integer.
+  const uint32_t ends = ~word & 0x80808080u;
+  uint32_t bits = word & 0x7f7f7f7fu;
+  uint32_t length = 0;
+  if (ends != 0) {
+    length = absl::countr_zero(ends) / 8 + 1;
+    bits &= 0xffffffffu >> (32 - 8 * length);
+  }
+  // Close the gaps the top bits leave between the seven bit groups.
+  return VarintTail{(bits & 0x7fu) | ((bits >> 1) & 0x3f80u) |
+                        ((bits >> 2) & 0x1fc000u) | ((bits >> 3) & 0xfe00000u),
+                    length};
+}
+
 template <uint8_t kPrefixBits>
 class VarintWriter {
  public:
@@ -117,6 +117,23 @@ class WritableStreams {
     return absl::OkStatus();
   }
 
+  // Re-adds a stream that is still writable after using up its share of a
+  // write (see Chttp2DataSchedulingPolicy) straight to the prioritized queue,
+  // behind the streams already waiting there, rather than through the mpsc
+  // queue: that way it can take another turn in the same write if there is
+  // room once every other stream has had its turn.
+  absl::Status RequeueAfterTurn(const StreamPtr stream,
+                                const WritableStreamPriority priority,
+                                const bool transport_tokens_available) {
+    if (!transport_tokens_available) {
+      return BlockedOnTransportFlowControl(stream);
+    }
+    GRPC_DCHECK(priority !=
+                WritableStreamPriority::kWaitForTransportFlowControl);
+    prioritized_queue_.Push(stream, priority);
+    return absl::OkStatus();
+  }
+
   // Dequeues a single stream id from the queue.
   // Returns a promise that resolves to the next stream id or an error if the
   // dequeue fails. High level flow:
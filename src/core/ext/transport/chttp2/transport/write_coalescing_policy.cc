@@ -0,0 +1,50 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/write_coalescing_policy.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+
+#include "src/core/util/useful.h"
+
+namespace grpc_core {
+
+Chttp2WriteCoalescingPolicy::Chttp2WriteCoalescingPolicy(
+    const ChannelArgs& args)
+    : max_delay_(Clamp(
+          std::chrono::microseconds(
+              args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_MAX_DELAY_US)
+                  .value_or(0)),
+          std::chrono::microseconds::zero(), kMaxDelay)),
+      target_bytes_(std::max(
+          1, args.GetInt(GRPC_ARG_HTTP2_WRITE_COALESCING_TARGET_BYTES)
+                 .value_or(kDefaultTargetBytes))) {}
+
+void Chttp2WriteCoalescingPolicy::Hold(Clock::time_point now) {
+  if (!held_since_.has_value()) held_since_ = now;
+}
+
+std::optional<std::chrono::microseconds>
+Chttp2WriteCoalescingPolicy::BeginWrite(Clock::time_point now) {
+  queued_bytes_ = 0;
+  if (!held_since_.has_value()) return std::nullopt;
+  const auto held =
+      std::chrono::duration_cast<std::chrono::microseconds>(now - *held_since_);
+  held_since_.reset();
+  return held;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,83 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_COALESCING_POLICY_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_COALESCING_POLICY_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <chrono>
+#include <optional>
+
+#include "src/core/lib/channel/channel_args.h"
+
+namespace grpc_core {
+
+// How long may a write be held back so that frames from other streams can
+// join it? Zero (the default) never holds writes.
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_MAX_DELAY_US \
+  "grpc.http2.write_coalescing_max_delay_us"
+// A held write is released as soon as this many bytes of messages are queued
+// for it.
+#define GRPC_ARG_HTTP2_WRITE_COALESCING_TARGET_BYTES \
+  "grpc.http2.write_coalescing_target_bytes"
+
+// Decides whether a write that is about to begin on an idle transport should
+// instead wait, for at most max_delay(), for more streams to add frames to
+// it: at high QPS with many small streams this turns many small endpoint
+// writes into fewer larger ones, for a bounded latency cost.
+//
+// The delays involved are well below the millisecond resolution of
+// grpc_core::Timestamp, so this works in std::chrono steady clock time.
+class Chttp2WriteCoalescingPolicy {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr int kDefaultTargetBytes = 16 * 1024;
+  // Holding a write for longer than this would cost more latency than any
+  // syscalls saved are worth.
+  static constexpr std::chrono::microseconds kMaxDelay{100000};
+
+  explicit Chttp2WriteCoalescingPolicy(const ChannelArgs& args);
+
+  bool enabled() const { return max_delay_.count() > 0; }
+  std::chrono::microseconds max_delay() const { return max_delay_; }
+
+  // Notify the policy that `bytes` of message data were queued for the next
+  // write.
+  void QueuedBytes(size_t bytes) { queued_bytes_ += bytes; }
+
+  // Should a write asked for now wait? `may_wait` is false for writes that
+  // carry something that must not be delayed (pings, settings, resets, flow
+  // control and the like).
+  bool ShouldHold(bool may_wait) const {
+    return may_wait && enabled() && queued_bytes_ < target_bytes_;
+  }
+  // Notify the policy that a write is being held.
+  void Hold(Clock::time_point now);
+  // Notify the policy that a write is beginning; returns how long it was
+  // held, or nullopt if it was not.
+  std::optional<std::chrono::microseconds> BeginWrite(Clock::time_point now);
+
+ private:
+  const std::chrono::microseconds max_delay_;
+  const size_t target_bytes_;
+  size_t queued_bytes_ = 0;
+  std::optional<Clock::time_point> held_since_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_COALESCING_POLICY_H
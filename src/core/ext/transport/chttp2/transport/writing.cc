@@ -286,12 +286,14 @@ class WriteContext {
       }
       t_->flow_control.FlushedSettings();
       t_->http2_stats->IncrementHttp2SettingsWrites();
+      ++frames_;
     }
   }
 
   void FlushQueuedBuffers() {
     // simple writes are queued to qbuf, and flushed here
     grpc_slice_buffer_move_into(&t_->qbuf, t_->outbuf.c_slice_buffer());
+    frames_ += t_->num_pending_induced_frames;
     t_->num_pending_induced_frames = 0;
     GRPC_CHECK_EQ(t_->qbuf.count, 0u);
   }
@@ -306,6 +308,7 @@ class WriteContext {
           t_->outbuf.c_slice_buffer(),
           grpc_chttp2_window_update_create(0, transport_announce, nullptr));
       grpc_chttp2_reset_ping_clock(t_);
+      ++frames_;
     }
   }
 
@@ -320,6 +323,7 @@ class WriteContext {
       grpc_slice_buffer_add(t_->outbuf.c_slice_buffer(),
                             grpc_chttp2_ping_create(true, t_->ping_acks[i]));
     }
+    frames_ += t_->ping_ack_count;
     t_->ping_ack_count = 0;
   }
 
@@ -364,10 +368,22 @@ class WriteContext {
     return s;
   }
 
-  void IncInitialMetadataWrites() { ++initial_metadata_writes_; }
-  void IncWindowUpdateWrites() { ++flow_control_writes_; }
+  void IncInitialMetadataWrites() {
+    ++initial_metadata_writes_;
+    ++frames_;
+  }
+  void IncWindowUpdateWrites() {
+    ++flow_control_writes_;
+    ++frames_;
+  }
   void IncMessageWrites() { ++message_writes_; }
-  void IncTrailingMetadataWrites() { ++trailing_metadata_writes_; }
+  void IncTrailingMetadataWrites() {
+    ++trailing_metadata_writes_;
+    ++frames_;
+  }
+  // A header block counts as one frame, however many CONTINUATION frames it
+  // needs.
+  void IncFrames() { ++frames_; }
 
   void NoteScheduledResults() { result_.early_results_scheduled = true; }
 
@@ -382,6 +398,10 @@ class WriteContext {
 
   grpc_chttp2_begin_write_result Result() {
     result_.writing = t_->outbuf.c_slice_buffer()->count > 0;
+    if (result_.writing) {
+      t_->http2_stats->IncrementHttp2FramesPerWrite(frames_);
+      t_->http2_stats->IncrementHttp2WriteSize(t_->outbuf.Length());
+    }
     return result_;
   }
 
@@ -397,6 +417,8 @@ class WriteContext {
   int initial_metadata_writes_ = 0;
   int trailing_metadata_writes_ = 0;
   int message_writes_ = 0;
+  // frames of any kind gathered into outbuf
+  int frames_ = 0;
   grpc_chttp2_begin_write_result result_ = {false, false, false, {}};
 };
 
@@ -424,10 +446,23 @@ class DataSendContext {
              static_cast<int64_t>(write_context_->target_write_size()) -
                  (grpc_core::IsChttp2BoundWriteSizeEnabled()
                       ? static_cast<int64_t>(t_->outbuf.Length())
-                      : static_cast<int64_t>(0))}),
+                      : static_cast<int64_t>(0)),
+             turn_bytes_remaining_}),
         0, std::numeric_limits<uint32_t>::max());
   }
 
+  // Begin this stream's turn under t->data_scheduling_policy: from here on
+  // max_outgoing() is also bounded by the stream's share.
+  void BeginTurn() {
+    turn_bytes_remaining_ = static_cast<int64_t>(std::min<uint64_t>(
+        s_->data_share.BeginTurn(t_->data_scheduling_policy),
+        std::numeric_limits<int64_t>::max()));
+  }
+
+  void EndTurn() {
+    s_->data_share.EndTurn(s_->flow_controlled_buffer.length == 0);
+  }
+
   bool AnyOutgoing() const { return max_outgoing() > 0; }
 
   void FlushBytes() {
@@ -443,6 +478,9 @@ class DataSendContext {
                             t_->outbuf.c_slice_buffer());
     sfc_upd_.SentData(send_bytes);
     s_->sending_bytes += send_bytes;
+    s_->data_share.Sent(send_bytes);
+    turn_bytes_remaining_ -= send_bytes;
+    write_context_->IncFrames();
   }
 
   bool is_last_frame() const { return is_last_frame_; }
@@ -464,6 +502,7 @@ class DataSendContext {
       &s_->flow_control};
   const size_t sending_bytes_before_;
   bool is_last_frame_ = false;
+  int64_t turn_bytes_remaining_ = std::numeric_limits<int64_t>::max();
 };
 
 class StreamWriteContext {
@@ -572,10 +611,12 @@ class StreamWriteContext {
       return;  // early out: nothing to do
     }
 
+    data_send_context.BeginTurn();
     while (s_->flow_controlled_buffer.length > 0 &&
            data_send_context.max_outgoing() > 0) {
       data_send_context.FlushBytes();
     }
+    data_send_context.EndTurn();
     grpc_chttp2_reset_ping_clock(t_);
     if (data_send_context.is_last_frame()) {
       SentLastFrame();
@@ -672,6 +713,7 @@ class StreamWriteContext {
           grpc_chttp2_rst_stream_create(
               s_->id, static_cast<uint32_t>(Http2ErrorCode::kNoError),
               &s_->call_tracer_wrapper, &t_->http2_ztrace_collector));
+      write_context_->IncFrames();
     }
     grpc_chttp2_mark_stream_closed(t_, s_, !t_->is_client, true,
                                    absl::OkStatus());
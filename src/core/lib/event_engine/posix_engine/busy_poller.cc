@@ -0,0 +1,143 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/busy_poller.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "src/core/util/grpc_check.h"
+#include "absl/functional/any_invocable.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+struct ReadyClosure {
+  absl::AnyInvocable<void()> callback;
+  int depth;
+};
+
+// The closures waiting to run on this thread, if it is a polling thread.
+thread_local std::vector<ReadyClosure>* g_ready = nullptr;
+// How deep the closure this polling thread is running is; 0 while polling.
+thread_local int g_depth = 0;
+
+bool RunsInline() {
+  return g_ready != nullptr && g_depth < BusyPoller::kMaxInlineDepth;
+}
+
+}  // namespace
+
+class BusyPoller::Executor final : public ThreadPool {
+ public:
+  explicit Executor(std::shared_ptr<ThreadPool> thread_pool)
+      : thread_pool_(std::move(thread_pool)) {}
+  // The engine quiesces the thread pool itself.
+  void Quiesce() override {}
+  void Run(absl::AnyInvocable<void()> callback) override {
+    if (RunsInline()) {
+      g_ready->push_back({std::move(callback), g_depth + 1});
+      return;
+    }
+    thread_pool_->Run(std::move(callback));
+  }
+  void Run(EventEngine::Closure* closure) override {
+    if (RunsInline()) {
+      g_ready->push_back({[closure]() { closure->Run(); }, g_depth + 1});
+      return;
+    }
+    thread_pool_->Run(closure);
+  }
+#if GRPC_ENABLE_FORK_SUPPORT
+  void PrepareFork() override {}
+  void PostFork() override {}
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+
+ private:
+  const std::shared_ptr<ThreadPool> thread_pool_;
+};
+
+std::shared_ptr<ThreadPool> BusyPoller::MakeExecutor(
+    std::shared_ptr<ThreadPool> thread_pool) {
+  return std::make_shared<Executor>(std::move(thread_pool));
+}
+
+BusyPoller::BusyPoller(std::shared_ptr<PosixEventPoller> poller,
+                       int num_threads)
+    : poller_(std::move(poller)) {
+  GRPC_CHECK_NE(poller_, nullptr);
+  GRPC_CHECK_GT(num_threads, 0);
+  threads_.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    threads_.emplace_back(
+        "busy_poller", [this]() { ThreadBody(); }, nullptr,
+        grpc_core::Thread::Options().set_tracked(false));
+    threads_.back().Start();
+  }
+}
+
+BusyPoller::~BusyPoller() {
+  done_.store(true, std::memory_order_release);
+  for (auto& thread : threads_) thread.Join();
+}
+
+void BusyPoller::ThreadBody() {
+  std::vector<ReadyClosure> ready;
+  std::vector<ReadyClosure> running;
+  g_ready = &ready;
+  bool done = false;
+  while (!done) {
+    // Read before polling, so that what the last poll made ready still runs.
+    done = done_.load(std::memory_order_acquire);
+    if (!polling_.load(std::memory_order_relaxed) &&
+        !polling_.exchange(true, std::memory_order_acquire)) {
+      // The poller runs the callback once it has taken its events, and before
+      // it processes them. Pollers allow Work() to be called again from then
+      // on, so another thread takes over polling while this one processes
+      // the events and runs what they made ready.
+      bool handed_over = false;
+      poller_->Work(EventEngine::Duration::zero(), [&]() {
+        polling_.store(false, std::memory_order_release);
+        handed_over = true;
+      });
+      if (!handed_over) polling_.store(false, std::memory_order_release);
+    }
+    // Closures scheduled by these ones go to `ready`, and run next time.
+    while (!ready.empty()) {
+      running.swap(ready);
+      for (auto& closure : running) {
+        g_depth = closure.depth;
+        closure.callback();
+      }
+      g_depth = 0;
+      running.clear();
+      if (!done) break;
+    }
+  }
+  g_ready = nullptr;
+}
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_POSIX_SOCKET_TCP
@@ -0,0 +1,83 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_BUSY_POLLER_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_BUSY_POLLER_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/util/thd.h"
+
+namespace grpc_event_engine::experimental {
+
+// Drives a poller from dedicated threads that never sleep: each spins calling
+// Work() with a zero timeout instead of blocking in it. One thread at a time
+// is in Work(); once it has collected events it hands polling over to the
+// next thread, and runs the closures those events made ready itself.
+// Closures that a polling thread schedules on the poller's executor (see
+// MakeExecutor) also run on that thread, after the one it is running,
+// instead of waiting for a thread pool thread to wake up, up to
+// kMaxInlineDepth closures deep. Each thread keeps a core busy, trading CPU
+// for latency.
+//
+// Closures that run inline must not block: nothing else runs on their
+// thread meanwhile, and a closure waiting on one it scheduled itself would
+// wait forever unless it is kMaxInlineDepth deep.
+class BusyPoller {
+ public:
+  // The closures a poll makes ready are one deep, those that they schedule
+  // two deep, and so on. Closures scheduled from kMaxInlineDepth deep go to
+  // the thread pool, so that a chain of them cannot hold a polling thread.
+  static constexpr int kMaxInlineDepth = 4;
+
+  // The executor the poller must be created with: closures run from one of
+  // the polling threads stay on it, and the rest go to `thread_pool`.
+  static std::shared_ptr<ThreadPool> MakeExecutor(
+      std::shared_ptr<ThreadPool> thread_pool);
+
+  // Starts `num_threads` threads polling `poller`.
+  BusyPoller(std::shared_ptr<PosixEventPoller> poller, int num_threads);
+  // Stops the threads once they have run the closures they hold.
+  ~BusyPoller();
+
+  BusyPoller(const BusyPoller&) = delete;
+  BusyPoller& operator=(const BusyPoller&) = delete;
+
+ private:
+  class Executor;
+
+  void ThreadBody();
+
+  const std::shared_ptr<PosixEventPoller> poller_;
+  std::atomic<bool> done_{false};
+  // Whether one of the threads is in Work().
+  std::atomic<bool> polling_{false};
+  std::vector<grpc_core::Thread> threads_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_POSIX_SOCKET_TCP
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_BUSY_POLLER_H
@@ -0,0 +1,879 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <utility>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/crash.h"
+#include "src/core/util/grpc_check.h"
+#include "absl/log/log.h"
+#include "absl/memory/memory.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+
+#ifdef GRPC_LINUX_IO_URING
+#include <linux/io_uring.h>
+// The poller relies on multishot poll requests and on passing the wait timeout
+// through IORING_ENTER_EXT_ARG; both need Linux 5.13+ uapi headers.
+#if defined(IORING_POLL_ADD_MULTI) && defined(IORING_FEAT_EXT_ARG)
+#define GRPC_IO_URING_POLLER_SUPPORTED 1
+#endif
+#endif  // GRPC_LINUX_IO_URING
+
+#ifdef GRPC_IO_URING_POLLER_SUPPORTED
+#include <endian.h>
+#include <errno.h>
+#include <limits.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix.h"
+#include "src/core/lib/event_engine/posix_engine/wakeup_fd_posix_default.h"
+#include "src/core/util/status_helper.h"
+#include "src/core/util/strerror.h"
+#include "src/core/util/sync.h"
+
+#define MAX_IO_URING_EVENTS_HANDLED_PER_ITERATION 1
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// Number of submission queue entries. Poll requests are submitted as soon as
+// they are queued, so this only needs to cover concurrent submitters. The
+// kernel sizes the completion queue at twice this value and, with
+// IORING_FEAT_NODROP, buffers any overflow internally.
+constexpr unsigned kRingEntries = 256;
+
+// Multishot poll mask used for every handle. This mirrors the edge-triggered
+// registration used by the epoll1 poller.
+constexpr uint32_t kPollMask = EPOLLIN | EPOLLOUT | EPOLLET;
+
+// user_data values with special meaning. Handle ids start at 1, so handle
+// user_data is always at least 1 << kHandleIdShift and can never collide with
+// these.
+constexpr uint64_t kPollRemoveUserData = 0;
+constexpr uint64_t kWakeupUserData = 1;
+
+// A handle's user_data carries the handle's id in the high 32 bits, and a
+// generation number and a track_err flag in the low ones. The generation
+// changes every time a handle is recycled, which lets the poller drop
+// completions that belong to a poll request armed for a previous incarnation
+// of the handle. It is 31 bits wide, so a stale completion could only be
+// mistaken for a current one after 2^31 recycles of the same handle.
+constexpr uint64_t kTrackErrBit = 1;
+constexpr int kGenerationShift = 1;
+constexpr uint64_t kGenerationMask = 0x7fffffff;
+constexpr int kHandleIdShift = 32;
+
+constexpr uint32_t kRequiredFeatures = IORING_FEAT_SINGLE_MMAP |
+                                       IORING_FEAT_NODROP |
+                                       IORING_FEAT_EXT_ARG |
+                                       IORING_FEAT_POLL_32BITS;
+
+int IoUringSetup(unsigned entries, struct io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags, void* arg, size_t arg_size) {
+  return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit,
+                                  min_complete, flags, arg, arg_size));
+}
+
+unsigned LoadAcquire(const unsigned* p) {
+  return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+void StoreRelease(unsigned* p, unsigned v) {
+  __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+
+}  // namespace
+
+// Owns an io_uring instance and its memory mapped submission and completion
+// rings. Submission is not thread safe and must be externally synchronized.
+// Reaping completions must only be done by one thread at a time.
+class IoUringRing {
+ public:
+  // Returns nullptr if io_uring is unavailable or lacks a required feature.
+  static std::unique_ptr<IoUringRing> Create(unsigned entries);
+
+  IoUringRing(const IoUringRing&) = delete;
+  IoUringRing& operator=(const IoUringRing&) = delete;
+  ~IoUringRing();
+
+  // Queue and immediately submit a multishot poll request for fd.
+  // Returns 0 on success or a negative errno value.
+  int PollAdd(int fd, uint32_t events, uint64_t user_data);
+  // Queue and immediately submit the removal of the poll request armed with
+  // target_user_data. Returns 0 on success or a negative errno value.
+  int PollRemove(uint64_t target_user_data);
+  // Block until at least one completion is available or timeout expires.
+  // Returns 0, or a negative errno value (-ETIME if the timeout expired).
+  int Wait(EventEngine::Duration timeout);
+  // Copy up to max_completions completions out of the completion ring and
+  // hand their slots back to the kernel. Returns the number copied.
+  template <typename Completion>
+  int Reap(Completion* completions, int max_completions);
+
+ private:
+  explicit IoUringRing(int fd) : fd_(fd) {}
+  struct io_uring_sqe* GetSqe();
+  int Submit();
+
+  int fd_;
+  void* ring_ptr_ = MAP_FAILED;
+  size_t ring_size_ = 0;
+  struct io_uring_sqe* sqes_ = static_cast<struct io_uring_sqe*>(MAP_FAILED);
+  size_t sqes_size_ = 0;
+  // Submission ring.
+  unsigned* sq_head_ = nullptr;
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned sq_entries_ = 0;
+  // Completion ring.
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  struct io_uring_cqe* cqes_ = nullptr;
+  unsigned cq_mask_ = 0;
+};
+
+std::unique_ptr<IoUringRing> IoUringRing::Create(unsigned entries) {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  int fd = IoUringSetup(entries, &params);
+  if (fd < 0) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring_setup failed: " << grpc_core::StrError(errno);
+    return nullptr;
+  }
+  auto ring = absl::WrapUnique(new IoUringRing(fd));
+  if ((params.features & kRequiredFeatures) != kRequiredFeatures) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring lacks required features: " << params.features;
+    return nullptr;
+  }
+  // With IORING_FEAT_SINGLE_MMAP the submission and completion rings share
+  // one mapping.
+  ring->ring_size_ =
+      std::max(params.sq_off.array + params.sq_entries * sizeof(unsigned),
+               params.cq_off.cqes +
+                   params.cq_entries * sizeof(struct io_uring_cqe));
+  ring->ring_ptr_ = mmap(nullptr, ring->ring_size_, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  if (ring->ring_ptr_ == MAP_FAILED) {
+    LOG(ERROR) << "io_uring ring mmap failed: " << grpc_core::StrError(errno);
+    return nullptr;
+  }
+  ring->sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+  ring->sqes_ = static_cast<struct io_uring_sqe*>(
+      mmap(nullptr, ring->sqes_size_, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+  if (ring->sqes_ == MAP_FAILED) {
+    LOG(ERROR) << "io_uring sqe mmap failed: " << grpc_core::StrError(errno);
+    return nullptr;
+  }
+  char* base = static_cast<char*>(ring->ring_ptr_);
+  ring->sq_head_ = reinterpret_cast<unsigned*>(base + params.sq_off.head);
+  ring->sq_tail_ = reinterpret_cast<unsigned*>(base + params.sq_off.tail);
+  ring->sq_array_ = reinterpret_cast<unsigned*>(base + params.sq_off.array);
+  ring->sq_mask_ = *reinterpret_cast<unsigned*>(base + params.sq_off.ring_mask);
+  ring->sq_entries_ = params.sq_entries;
+  ring->cq_head_ = reinterpret_cast<unsigned*>(base + params.cq_off.head);
+  ring->cq_tail_ = reinterpret_cast<unsigned*>(base + params.cq_off.tail);
+  ring->cqes_ =
+      reinterpret_cast<struct io_uring_cqe*>(base + params.cq_off.cqes);
+  ring->cq_mask_ = *reinterpret_cast<unsigned*>(base + params.cq_off.ring_mask);
+  return ring;
+}
+
+IoUringRing::~IoUringRing() {
+  if (sqes_ != MAP_FAILED) munmap(sqes_, sqes_size_);
+  if (ring_ptr_ != MAP_FAILED) munmap(ring_ptr_, ring_size_);
+  close(fd_);
+}
+
+struct io_uring_sqe* IoUringRing::GetSqe() {
+  unsigned tail = *sq_tail_;
+  if (tail - LoadAcquire(sq_head_) >= sq_entries_) return nullptr;
+  unsigned index = tail & sq_mask_;
+  struct io_uring_sqe* sqe = &sqes_[index];
+  memset(sqe, 0, sizeof(*sqe));
+  sq_array_[index] = index;
+  return sqe;
+}
+
+int IoUringRing::Submit() {
+  // Publish the new entry before handing it to the kernel.
+  StoreRelease(sq_tail_, *sq_tail_ + 1);
+  int r;
+  do {
+    // Anything the kernel has not yet consumed (e.g. left behind by an earlier
+    // failed submit) goes out together with the new entry.
+    unsigned to_submit = *sq_tail_ - LoadAcquire(sq_head_);
+    r = IoUringEnter(fd_, to_submit, 0, 0, nullptr, 0);
+  } while (r < 0 && errno == EINTR);
+  return r < 0 ? -errno : 0;
+}
+
+int IoUringRing::PollAdd(int fd, uint32_t events, uint64_t user_data) {
+  struct io_uring_sqe* sqe = GetSqe();
+  if (sqe == nullptr) return -EBUSY;
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd;
+  sqe->len = IORING_POLL_ADD_MULTI;
+#if __BYTE_ORDER == __BIG_ENDIAN
+  events = (events << 16) | (events >> 16);
+#endif
+  sqe->poll32_events = events;
+  sqe->user_data = user_data;
+  return Submit();
+}
+
+int IoUringRing::PollRemove(uint64_t target_user_data) {
+  struct io_uring_sqe* sqe = GetSqe();
+  if (sqe == nullptr) return -EBUSY;
+  sqe->opcode = IORING_OP_POLL_REMOVE;
+  sqe->fd = -1;
+  sqe->addr = target_user_data;
+  sqe->user_data = kPollRemoveUserData;
+  return Submit();
+}
+
+int IoUringRing::Wait(EventEngine::Duration timeout) {
+  struct __kernel_timespec ts;
+  struct io_uring_getevents_arg arg;
+  memset(&arg, 0, sizeof(arg));
+  arg.sigmask_sz = _NSIG / 8;
+  if (timeout >= EventEngine::Duration::zero()) {
+    auto secs = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+    ts.tv_sec = secs.count();
+    ts.tv_nsec =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(timeout - secs)
+            .count();
+    arg.ts = reinterpret_cast<uintptr_t>(&ts);
+  }
+  int r;
+  do {
+    r = IoUringEnter(fd_, 0, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                     &arg, sizeof(arg));
+  } while (r < 0 && errno == EINTR);
+  return r < 0 ? -errno : 0;
+}
+
+template <typename Completion>
+int IoUringRing::Reap(Completion* completions, int max_completions) {
+  unsigned head = *cq_head_;
+  unsigned tail = LoadAcquire(cq_tail_);
+  int n = 0;
+  while (head != tail && n < max_completions) {
+    const struct io_uring_cqe* cqe = &cqes_[head & cq_mask_];
+    completions[n].user_data = cqe->user_data;
+    completions[n].res = cqe->res;
+    completions[n].flags = cqe->flags;
+    ++n;
+    ++head;
+  }
+  StoreRelease(cq_head_, head);
+  return n;
+}
+
+class alignas(64) IoUringEventHandle : public EventHandle {
+ public:
+  IoUringEventHandle(const FileDescriptor& fd, IoUringPoller* poller,
+                     uint32_t id)
+      : fd_(fd),
+        id_(id),
+        poller_(poller),
+        read_closure_(poller->GetThreadPool()),
+        write_closure_(poller->GetThreadPool()),
+        error_closure_(poller->GetThreadPool()) {
+    read_closure_.InitEvent();
+    write_closure_.InitEvent();
+    error_closure_.InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+  }
+  void ReInit(FileDescriptor fd) {
+    fd_ = fd;
+    generation_ = (generation_ + 1) & kGenerationMask;
+    read_closure_.InitEvent();
+    write_closure_.InitEvent();
+    error_closure_.InitEvent();
+    pending_read_.store(false, std::memory_order_relaxed);
+    pending_write_.store(false, std::memory_order_relaxed);
+    pending_error_.store(false, std::memory_order_relaxed);
+  }
+  IoUringPoller* Poller() override { return poller_; }
+  bool SetPendingActions(bool pending_read, bool pending_write,
+                         bool pending_error) {
+    // See Epoll1EventHandle::SetPendingActions for why these are atomics.
+    if (pending_read) {
+      pending_read_.store(true, std::memory_order_release);
+    }
+    if (pending_write) {
+      pending_write_.store(true, std::memory_order_release);
+    }
+    if (pending_error) {
+      pending_error_.store(true, std::memory_order_release);
+    }
+    return pending_read || pending_write || pending_error;
+  }
+  FileDescriptor WrappedFd() override { return fd_; }
+  void OrphanHandle(PosixEngineClosure* on_done, FileDescriptor* release_fd,
+                    absl::string_view reason) override;
+  void ShutdownHandle(absl::Status why) override;
+  void NotifyOnRead(PosixEngineClosure* on_read) override;
+  void NotifyOnWrite(PosixEngineClosure* on_write) override;
+  void NotifyOnError(PosixEngineClosure* on_error) override;
+  void SetReadable() override;
+  void SetWritable() override;
+  void SetHasError() override;
+  bool IsHandleShutdown() override;
+  inline void ExecutePendingActions() {
+    if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
+      read_closure_.SetReady();
+    }
+    if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
+      write_closure_.SetReady();
+    }
+    if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
+      error_closure_.SetReady();
+    }
+  }
+  // Arms the multishot poll request for this incarnation of the handle.
+  void ArmPoll(bool track_err);
+  // Re-arms the poll request identified by user_data after the kernel
+  // terminated it, unless the handle has since been orphaned or recycled.
+  void MaybeRearmPoll(uint64_t user_data);
+  // The user_data of the currently armed poll request. Completions carrying
+  // any other value are stale.
+  uint64_t poll_user_data() const {
+    return poll_user_data_.load(std::memory_order_acquire);
+  }
+  ~IoUringEventHandle() override = default;
+
+ private:
+  void HandleShutdownInternal(absl::Status why);
+  // Cancels the poll request, if armed. io_uring poll requests hold a
+  // reference to the file, so this must happen before the fd is closed or
+  // released: otherwise the socket would outlive close().
+  void RemovePoll();
+  // See Epoll1EventHandle::ShutdownHandle for why a mutex is required. It also
+  // serializes arming, re-arming and removal of the poll request.
+  grpc_core::Mutex mu_;
+  FileDescriptor fd_;
+  // Index of the handle in IoUringPoller::handles_, plus one.
+  const uint32_t id_;
+  uint64_t generation_ = 0;
+  bool poll_armed_ ABSL_GUARDED_BY(mu_) = false;
+  std::atomic<uint64_t> poll_user_data_{kPollRemoveUserData};
+  std::atomic<bool> pending_read_{false};
+  std::atomic<bool> pending_write_{false};
+  std::atomic<bool> pending_error_{false};
+  IoUringPoller* poller_;
+  LockfreeEvent read_closure_;
+  LockfreeEvent write_closure_;
+  LockfreeEvent error_closure_;
+};
+
+namespace {
+
+// It is possible that the kernel headers know about io_uring but the running
+// kernel does not, or that io_uring is disabled (e.g. via
+// kernel.io_uring_disabled or a seccomp policy). Create a ring and make sure
+// a multishot edge-triggered poll actually delivers events before committing
+// to this poller.
+bool InitIoUringPollerLinux() {
+  if (!grpc_event_engine::experimental::SupportsWakeupFd()) {
+    return false;
+  }
+  auto ring = IoUringRing::Create(4);
+  if (ring == nullptr) return false;
+  int efd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (efd < 0) return false;
+  struct {
+    uint64_t user_data;
+    int32_t res;
+    uint32_t flags;
+  } completion{};
+  bool supported = false;
+  if (ring->PollAdd(efd, EPOLLIN | EPOLLET, kWakeupUserData) == 0 &&
+      eventfd_write(efd, 1) == 0 &&
+      ring->Wait(std::chrono::seconds(1)) == 0 &&
+      ring->Reap(&completion, 1) == 1) {
+    supported = completion.res > 0 && (completion.flags & IORING_CQE_F_MORE);
+  }
+  close(efd);
+  if (!supported) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring multishot poll unsupported: res=" << completion.res;
+  }
+  return supported;
+}
+
+}  // namespace
+
+void IoUringEventHandle::ArmPoll(bool track_err) {
+  uint64_t user_data = (static_cast<uint64_t>(id_) << kHandleIdShift) |
+                       (generation_ << kGenerationShift) |
+                       (track_err ? kTrackErrBit : 0);
+  grpc_core::MutexLock lock(&mu_);
+  poll_user_data_.store(user_data, std::memory_order_release);
+  poll_armed_ = poller_->SubmitPollAdd(fd_, user_data);
+  if (!poll_armed_) {
+    // Nothing would ever make the handle's closures ready.
+    HandleShutdownInternal(absl::InternalError("io_uring poll add failed"));
+  }
+}
+
+void IoUringEventHandle::MaybeRearmPoll(uint64_t user_data) {
+  grpc_core::MutexLock lock(&mu_);
+  if (!poll_armed_ || poll_user_data() != user_data) return;
+  poll_armed_ = poller_->SubmitPollAdd(fd_, user_data);
+  if (!poll_armed_) {
+    HandleShutdownInternal(absl::InternalError("io_uring poll re-arm failed"));
+  }
+}
+
+void IoUringEventHandle::RemovePoll() {
+  grpc_core::MutexLock lock(&mu_);
+  if (poll_armed_) {
+    poll_armed_ = false;
+    poller_->SubmitPollRemove(poll_user_data());
+  }
+  // Completions that the poll request delivers before the kernel processes
+  // its removal must not reach the orphaned handle.
+  poll_user_data_.store(kPollRemoveUserData, std::memory_order_release);
+}
+
+void IoUringEventHandle::OrphanHandle(PosixEngineClosure* on_done,
+                                      FileDescriptor* release_fd,
+                                      absl::string_view reason) {
+  bool is_release_fd = (release_fd != nullptr);
+  if (!read_closure_.IsShutdown()) {
+    HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason));
+  }
+  RemovePoll();
+  auto& posix_interface = poller_->posix_interface();
+  // If release_fd is not NULL, we should be relinquishing control of the file
+  // descriptor fd->fd (but we still own the grpc_fd structure).
+  if (is_release_fd) {
+    *release_fd = fd_;
+  } else {
+    posix_interface.Shutdown(fd_, SHUT_RDWR);
+    posix_interface.Close(fd_);
+  }
+
+  {
+    // See Epoll1Poller::ShutdownHandle for explanation on why a mutex is
+    // required here.
+    grpc_core::MutexLock lock(&mu_);
+    read_closure_.DestroyEvent();
+    write_closure_.DestroyEvent();
+    error_closure_.DestroyEvent();
+  }
+  pending_read_.store(false, std::memory_order_release);
+  pending_write_.store(false, std::memory_order_release);
+  pending_error_.store(false, std::memory_order_release);
+  {
+    grpc_core::MutexLock lock(&poller_->mu_);
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+    poller_->fork_handles_set_.erase(this);
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+    poller_->free_io_uring_handles_list_.push_back(this);
+  }
+  if (on_done != nullptr) {
+    on_done->SetStatus(absl::OkStatus());
+    poller_->GetThreadPool()->Run(on_done);
+  }
+}
+
+void IoUringEventHandle::HandleShutdownInternal(absl::Status why) {
+  grpc_core::StatusSetInt(
+      &why, grpc_core::StatusIntProperty::kRpcStatus,
+      absl::IsCancelled(why) ? GRPC_STATUS_CANCELLED : GRPC_STATUS_UNAVAILABLE);
+  if (read_closure_.SetShutdown(why)) {
+    write_closure_.SetShutdown(why);
+    error_closure_.SetShutdown(why);
+  }
+}
+
+IoUringPoller::IoUringPoller(std::shared_ptr<ThreadPool> thread_pool,
+                             std::unique_ptr<IoUringRing> ring)
+    : thread_pool_(std::move(thread_pool)),
+      ring_(std::move(ring)),
+      was_kicked_(false),
+      closed_(false) {
+  GRPC_CHECK(ring_ != nullptr);
+  wakeup_fd_ = CreateWakeupFd(&posix_interface()).value();
+  GRPC_CHECK(wakeup_fd_ != nullptr);
+  GRPC_CHECK(SubmitPollAdd(wakeup_fd_->ReadFd(), kWakeupUserData));
+}
+
+void IoUringPoller::Close() {
+  grpc_core::MutexLock lock(&mu_);
+  if (closed_) return;
+  while (!free_io_uring_handles_list_.empty()) {
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        free_io_uring_handles_list_.front());
+    free_io_uring_handles_list_.pop_front();
+    delete handle;
+  }
+  handles_.clear();
+  closed_ = true;
+}
+
+IoUringPoller::~IoUringPoller() { Close(); }
+
+bool IoUringPoller::SubmitPollAdd(const FileDescriptor& fd,
+                                  uint64_t user_data) {
+  auto raw_fd = posix_interface().GetFd(fd);
+  if (!raw_fd.ok()) {
+    LOG(ERROR) << "io_uring poll add failed: " << raw_fd.StrError();
+    return false;
+  }
+  int r;
+  {
+    grpc_core::MutexLock lock(&submit_mu_);
+    r = ring_->PollAdd(*raw_fd, kPollMask, user_data);
+  }
+  if (r < 0) {
+    LOG(ERROR) << "io_uring poll add failed: " << grpc_core::StrError(-r);
+    return false;
+  }
+  return true;
+}
+
+void IoUringPoller::SubmitPollRemove(uint64_t user_data) {
+  int r;
+  {
+    grpc_core::MutexLock lock(&submit_mu_);
+    r = ring_->PollRemove(user_data);
+  }
+  if (r < 0) {
+    LOG(ERROR) << "io_uring poll remove failed: " << grpc_core::StrError(-r);
+  }
+}
+
+EventHandle* IoUringPoller::CreateHandle(FileDescriptor fd,
+                                         absl::string_view /*name*/,
+                                         bool track_err) {
+  IoUringEventHandle* new_handle = nullptr;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (free_io_uring_handles_list_.empty()) {
+      new_handle = new IoUringEventHandle(
+          fd, this, static_cast<uint32_t>(handles_.size() + 1));
+      handles_.push_back(new_handle);
+    } else {
+      new_handle = reinterpret_cast<IoUringEventHandle*>(
+          free_io_uring_handles_list_.front());
+      free_io_uring_handles_list_.pop_front();
+      new_handle->ReInit(fd);
+    }
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+    fork_handles_set_.emplace(new_handle);
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+  }
+  new_handle->ArmPoll(track_err);
+  return new_handle;
+}
+
+// Process the completions found by DoRingWait().
+// - completion_set_.cursor points to the index of the first completion to be
+//   processed.
+// - This function then processes up-to max_events_to_handle completions that
+//   carry events for live handles and updates completion_set_.cursor.
+// It returns true, if there was a Kick that forced invocation of this
+// function. Poll requests terminated by the kernel are appended to rearms.
+bool IoUringPoller::ProcessCompletions(int max_events_to_handle,
+                                       Events& pending_events,
+                                       Rearms& rearms) {
+  int num_completions = completion_set_.num_completions;
+  int cursor = completion_set_.cursor;
+  bool was_kicked = false;
+  int handled = 0;
+  while (handled < max_events_to_handle && cursor != num_completions) {
+    const Completion& c = completion_set_.completions[cursor++];
+    bool more = (c.flags & IORING_CQE_F_MORE) != 0;
+    if (c.user_data == kPollRemoveUserData) continue;
+    if (c.user_data == kWakeupUserData) {
+      if (c.res > 0) {
+        GRPC_CHECK(wakeup_fd_->ConsumeWakeup().ok());
+        was_kicked = true;
+        ++handled;
+      }
+      if (!more && c.res != -ECANCELED) {
+        GRPC_CHECK(SubmitPollAdd(wakeup_fd_->ReadFd(), kWakeupUserData));
+      }
+      continue;
+    }
+    const uint64_t id = c.user_data >> kHandleIdShift;
+    GRPC_CHECK(id != 0 && id <= handles_.size());
+    IoUringEventHandle* handle = handles_[id - 1];
+    // Handles are only freed when the poller is closed, so it is safe to look
+    // at a handle that has been orphaned or recycled since the poll request
+    // completed: the user_data comparison weeds out those completions.
+    if (handle->poll_user_data() != c.user_data) continue;
+    if (!more && c.res != -ECANCELED) {
+      rearms.emplace_back(handle, c.user_data);
+    }
+    if (c.res <= 0) continue;
+    uint32_t events = static_cast<uint32_t>(c.res);
+    bool track_err = (c.user_data & kTrackErrBit) != 0;
+    bool cancel = (events & EPOLLHUP) != 0;
+    bool error = (events & EPOLLERR) != 0;
+    bool read_ev = (events & (EPOLLIN | EPOLLPRI)) != 0;
+    bool write_ev = (events & EPOLLOUT) != 0;
+    bool err_fallback = error && !track_err;
+    if (handle->SetPendingActions(read_ev || cancel || err_fallback,
+                                  write_ev || cancel || err_fallback,
+                                  error && !err_fallback)) {
+      pending_events.push_back(handle);
+    }
+    ++handled;
+  }
+  completion_set_.cursor = cursor;
+  return was_kicked;
+}
+
+// Reap completions into completion_set_. The completion ring is shared with
+// the kernel, so completions that are already available are collected without
+// a syscall; io_uring_enter() is only called to wait when the ring is empty.
+// It returns the number of completions reaped.
+int IoUringPoller::DoRingWait(EventEngine::Duration timeout) {
+  int n = ring_->Reap(completion_set_.completions, kMaxCompletions);
+  if (n == 0) {
+    int r = ring_->Wait(timeout);
+    // -ETIME: the timeout expired. -EBUSY: completions overflowed and are
+    // pending in the kernel; they are flushed to the ring on the next wait.
+    if (r < 0 && r != -ETIME && r != -EBUSY) {
+      grpc_core::Crash(absl::StrFormat(
+          "(event_engine) IoUringPoller:%p encountered io_uring_enter error: "
+          "%s",
+          this, grpc_core::StrError(-r).c_str()));
+    }
+    n = ring_->Reap(completion_set_.completions, kMaxCompletions);
+  }
+  completion_set_.num_completions = n;
+  completion_set_.cursor = 0;
+  return n;
+}
+
+// Might be called multiple times
+void IoUringEventHandle::ShutdownHandle(absl::Status why) {
+  grpc_core::MutexLock lock(&mu_);
+  HandleShutdownInternal(why);
+}
+
+bool IoUringEventHandle::IsHandleShutdown() {
+  return read_closure_.IsShutdown();
+}
+
+void IoUringEventHandle::NotifyOnRead(PosixEngineClosure* on_read) {
+  read_closure_.NotifyOn(on_read);
+}
+
+void IoUringEventHandle::NotifyOnWrite(PosixEngineClosure* on_write) {
+  write_closure_.NotifyOn(on_write);
+}
+
+void IoUringEventHandle::NotifyOnError(PosixEngineClosure* on_error) {
+  error_closure_.NotifyOn(on_error);
+}
+
+void IoUringEventHandle::SetReadable() { read_closure_.SetReady(); }
+
+void IoUringEventHandle::SetWritable() { write_closure_.SetReady(); }
+
+void IoUringEventHandle::SetHasError() { error_closure_.SetReady(); }
+
+// Polls the registered Fds for events until timeout is reached or there is a
+// Kick(). If there is a Kick(), it collects and processes any previously
+// un-processed events. If there are no un-processed events, it returns
+// Poller::WorkResult::Kicked{}
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  Events pending_events;
+  Rearms rearms;
+  bool was_kicked_ext = false;
+  const auto start = std::chrono::steady_clock::now();
+  EventEngine::Duration remaining = timeout;
+  while (true) {
+    if (completion_set_.cursor == completion_set_.num_completions) {
+      if (DoRingWait(remaining) == 0) {
+        return Poller::WorkResult::kDeadlineExceeded;
+      }
+    }
+    {
+      grpc_core::MutexLock lock(&mu_);
+      // If was_kicked_ is true, collect all pending events in this iteration.
+      if (ProcessCompletions(was_kicked_
+                                 ? INT_MAX
+                                 : MAX_IO_URING_EVENTS_HANDLED_PER_ITERATION,
+                             pending_events, rearms)) {
+        was_kicked_ = false;
+        was_kicked_ext = true;
+      }
+    }
+    for (auto& rearm : rearms) {
+      rearm.first->MaybeRearmPoll(rearm.second);
+    }
+    rearms.clear();
+    if (!pending_events.empty()) break;
+    if (was_kicked_ext) return Poller::WorkResult::kKicked;
+    // Only bookkeeping completions (poll removals, stale events) were reaped.
+    // Unlike epoll, these are not a sign of a Kick, so keep polling.
+    if (timeout >= EventEngine::Duration::zero()) {
+      remaining = std::max(
+          EventEngine::Duration::zero(),
+          timeout - std::chrono::duration_cast<EventEngine::Duration>(
+                        std::chrono::steady_clock::now() - start));
+    }
+  }
+  // Run the provided callback.
+  schedule_poll_again();
+  // Process all pending events inline.
+  for (auto& it : pending_events) {
+    it->ExecutePendingActions();
+  }
+  return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
+}
+
+void IoUringPoller::Kick() {
+  grpc_core::MutexLock lock(&mu_);
+  if (was_kicked_ || closed_) {
+    return;
+  }
+  was_kicked_ = true;
+  GRPC_CHECK(wakeup_fd_->Wakeup().ok());
+}
+
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+
+void IoUringPoller::HandleForkInChild() {
+  if (grpc_core::IsEventEngineForkEnabled()) {
+    posix_interface().AdvanceGeneration();
+  }
+  {
+    grpc_core::MutexLock lock(&mu_);
+    for (EventHandle* handle : fork_handles_set_) {
+      handle->ShutdownHandle(absl::CancelledError("Closed on fork"));
+    }
+  }
+  // The ring and its mappings are shared with the parent: build a new one.
+  ring_ = IoUringRing::Create(kRingEntries);
+  GRPC_CHECK(ring_ != nullptr);
+  completion_set_.num_completions = 0;
+  completion_set_.cursor = 0;
+}
+
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+
+void IoUringPoller::ResetKickState() {
+  // Wakeup fd is always recreated to ensure FD state is reset. Removing the
+  // old poll request is ok to fail in the fork child.
+  SubmitPollRemove(kWakeupUserData);
+  wakeup_fd_ = *CreateWakeupFd(&posix_interface());
+  GRPC_CHECK(SubmitPollAdd(wakeup_fd_->ReadFd(), kWakeupUserData));
+  grpc_core::MutexLock lock(&mu_);
+  was_kicked_ = false;
+}
+
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(
+    std::shared_ptr<ThreadPool> thread_pool) {
+  static bool kIoUringPollerSupported = InitIoUringPollerLinux();
+  if (!kIoUringPollerSupported) return nullptr;
+  auto ring = IoUringRing::Create(kRingEntries);
+  if (ring == nullptr) return nullptr;
+  return std::make_shared<IoUringPoller>(std::move(thread_pool),
+                                         std::move(ring));
+}
+
+}  // namespace grpc_event_engine::experimental
+
+#else  // defined(GRPC_IO_URING_POLLER_SUPPORTED)
+#if defined(GRPC_POSIX_SOCKET_EV)
+
+namespace grpc_event_engine::experimental {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Poller;
+
+class IoUringRing {};
+
+IoUringPoller::IoUringPoller(std::shared_ptr<ThreadPool> /* thread_pool */,
+                             std::unique_ptr<IoUringRing> /* ring */) {
+  grpc_core::Crash("unimplemented");
+}
+
+IoUringPoller::~IoUringPoller() { grpc_core::Crash("unimplemented"); }
+
+EventHandle* IoUringPoller::CreateHandle(FileDescriptor /*fd*/,
+                                         absl::string_view /*name*/,
+                                         bool /*track_err*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration /*timeout*/,
+    absl::FunctionRef<void()> /*schedule_poll_again*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::Kick() { grpc_core::Crash("unimplemented"); }
+
+#if GRPC_ENABLE_FORK_SUPPORT
+void IoUringPoller::HandleForkInChild() { grpc_core::Crash("unimplemented"); }
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+
+void IoUringPoller::ResetKickState() { grpc_core::Crash("unimplemented"); }
+
+// If io_uring is not available at build time, return nullptr so that callers
+// fall back to another poller.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(
+    std::shared_ptr<ThreadPool> /*thread_pool*/) {
+  return nullptr;
+}
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // defined(GRPC_POSIX_SOCKET_EV)
+#endif  // !defined(GRPC_IO_URING_POLLER_SUPPORTED)
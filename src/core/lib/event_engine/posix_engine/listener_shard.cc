@@ -0,0 +1,211 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/listener_shard.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/cpu.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
+#include "src/core/util/no_destruct.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/thd.h"
+#include "absl/algorithm/container.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/log/log.h"
+
+#if GPR_LINUX == 1
+#include <pthread.h>
+#include <sched.h>
+#endif  // GPR_LINUX == 1
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+using namespace std::chrono_literals;
+
+// The shard running on this thread, if any.
+thread_local ListenerShard* g_current_shard = nullptr;
+
+// The shards of each engine, by engine and number of shards. Entries only
+// keep track of the shards: the listeners and the shard threads own them.
+using ShardGroups = std::map<std::pair<const EventEngine*, int>,
+                             std::vector<std::weak_ptr<ListenerShard>>>;
+grpc_core::NoDestruct<grpc_core::Mutex> g_mu;
+grpc_core::NoDestruct<ShardGroups> g_shard_groups ABSL_GUARDED_BY(*g_mu);
+
+}  // namespace
+
+// The thread pool of the shard's poller: runs everything on the shard's
+// thread.
+class ListenerShard::Executor final : public ThreadPool {
+ public:
+  explicit Executor(ListenerShard* shard) : shard_(shard) {}
+  // The thread exits by itself once the shard has no users.
+  void Quiesce() override {}
+  void Run(absl::AnyInvocable<void()> callback) override {
+    shard_->Schedule(std::move(callback));
+  }
+  void Run(EventEngine::Closure* closure) override {
+    shard_->Schedule([closure]() { closure->Run(); });
+  }
+#if GRPC_ENABLE_FORK_SUPPORT
+  void PrepareFork() override {}
+  void PostFork() override {}
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+
+ private:
+  ListenerShard* const shard_;
+};
+
+std::vector<std::shared_ptr<ListenerShard>> ListenerShard::GetShards(
+    const EventEngine* engine, int num_shards) {
+  grpc_core::MutexLock lock(g_mu.get());
+  // Forget the groups whose shards have all exited. An engine destroyed since
+  // then may have left its address to a new one.
+  for (auto it = g_shard_groups->begin(); it != g_shard_groups->end();) {
+    if (absl::c_all_of(it->second, [](const std::weak_ptr<ListenerShard>& s) {
+          return s.expired();
+        })) {
+      it = g_shard_groups->erase(it);
+    } else {
+      ++it;
+    }
+  }
+  auto& group = (*g_shard_groups)[{engine, num_shards}];
+  group.resize(num_shards);
+  std::vector<std::shared_ptr<ListenerShard>> shards;
+  for (int i = 0; i < num_shards; ++i) {
+    std::shared_ptr<ListenerShard> shard = group[i].lock();
+    if (shard == nullptr || !shard->TryAddUser()) {
+      shard = Create(i, num_shards);
+      if (shard == nullptr) {
+        for (auto& created : shards) created->RemoveUser();
+        return {};
+      }
+      group[i] = shard;
+    }
+    shards.push_back(std::move(shard));
+  }
+  return shards;
+}
+
+std::shared_ptr<ListenerShard> ListenerShard::Create(int index,
+                                                     int num_shards) {
+  std::shared_ptr<ListenerShard> shard(new ListenerShard(index, num_shards));
+  shard->poller_ = MakeDefaultPoller(shard->executor_);
+  if (shard->poller_ == nullptr) return nullptr;
+  // The thread holds a ref to the shard until it exits.
+  grpc_core::Thread(
+      "listener_shard",
+      [](void* arg) {
+        auto* shard = static_cast<std::shared_ptr<ListenerShard>*>(arg);
+        (*shard)->ThreadBody();
+        delete shard;
+      },
+      new std::shared_ptr<ListenerShard>(shard), nullptr,
+      grpc_core::Thread::Options().set_tracked(false).set_joinable(false))
+      .Start();
+  return shard;
+}
+
+ListenerShard::ListenerShard(int index, int num_shards)
+    : index_(index),
+      num_shards_(num_shards),
+      executor_(std::make_shared<Executor>(this)) {}
+
+ListenerShard::~ListenerShard() = default;
+
+bool ListenerShard::TryAddUser() {
+  int users = users_.load(std::memory_order_relaxed);
+  do {
+    if (users == 0) return false;
+  } while (!users_.compare_exchange_weak(users, users + 1,
+                                         std::memory_order_relaxed));
+  return true;
+}
+
+void ListenerShard::RemoveUser() {
+  if (users_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    poller_->Kick();
+  }
+}
+
+void ListenerShard::Schedule(absl::AnyInvocable<void()> callback) {
+  {
+    grpc_core::MutexLock lock(&mu_);
+    callbacks_.push_back(std::move(callback));
+  }
+  // The shard's own thread drains the queue before it polls again.
+  if (g_current_shard != this) poller_->Kick();
+}
+
+void ListenerShard::PinToCpus() {
+#if GPR_LINUX == 1
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  const int num_cores = static_cast<int>(gpr_cpu_num_cores());
+  for (int cpu = index_; cpu < num_cores && cpu < CPU_SETSIZE;
+       cpu += num_shards_) {
+    CPU_SET(cpu, &cpus);
+  }
+  if (CPU_COUNT(&cpus) == 0) return;
+  int err = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+  if (err != 0) {
+    LOG(ERROR) << "Listener shard " << index_
+               << " could not be pinned to its CPUs: error " << err;
+  }
+#endif  // GPR_LINUX == 1
+}
+
+void ListenerShard::ThreadBody() {
+  PinToCpus();
+  g_current_shard = this;
+  std::vector<absl::AnyInvocable<void()>> callbacks;
+  while (users_.load(std::memory_order_acquire) > 0) {
+    bool idle;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      callbacks.swap(callbacks_);
+    }
+    for (auto& callback : callbacks) callback();
+    callbacks.clear();
+    {
+      grpc_core::MutexLock lock(&mu_);
+      idle = callbacks_.empty();
+    }
+    // Anything scheduled from another thread after this check kicks the
+    // poller, so sleeping here cannot miss it.
+    poller_->Work(idle ? EventEngine::Duration(24h) : EventEngine::Duration(0),
+                  []() {});
+  }
+  g_current_shard = nullptr;
+}
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_POSIX_SOCKET_TCP
@@ -0,0 +1,101 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_LISTENER_SHARD_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_LISTENER_SHARD_H
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/util/sync.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+
+namespace grpc_event_engine::experimental {
+
+// One of the CPU shards of a listener bound with GRPC_ARG_TCP_LISTENER_SHARDS.
+// Each address the listener binds gets one SO_REUSEPORT socket per shard, and
+// the kernel hands a new connection to the socket of the shard whose CPUs
+// received its packets. The shard's sockets, and the connections accepted on
+// them, are polled by a single thread pinned to those CPUs, so that a
+// connection is accepted, read and written where its packets arrive.
+//
+// The shard's thread runs only I/O: accept(), and the reads and writes of its
+// connections. Their callbacks, and on_accept, are handed to the engine's
+// thread pool, so that one busy call does not hold up every other connection
+// of the shard. Timers and other EventEngine callbacks run there too.
+//
+// All the listeners of an engine that ask for the same number of shards share
+// their threads: -1 costs one thread per CPU per engine, however many
+// listeners use it. Shard pollers take no part in fork handling.
+class ListenerShard {
+ public:
+  // Returns the `num_shards` shards of `engine`, starting the threads of those
+  // not already running. Shard `index` is pinned to the CPUs whose number is
+  // `index` modulo `num_shards`. The caller holds a user of each. Returns an
+  // empty vector if a poller could not be created.
+  static std::vector<std::shared_ptr<ListenerShard>> GetShards(
+      const EventEngine* engine, int num_shards);
+
+  ~ListenerShard();
+
+  PosixEventPoller* poller() { return poller_.get(); }
+  int index() const { return index_; }
+
+  // The thread keeps polling until every user has been removed: each listener
+  // sharing the shard is one, and each connection accepted on it is another.
+  // Only called while holding a user.
+  void AddUser() { users_.fetch_add(1, std::memory_order_relaxed); }
+  void RemoveUser();
+
+ private:
+  class Executor;
+
+  ListenerShard(int index, int num_shards);
+
+  // Starts the thread of a new shard, which holds the caller's user.
+  static std::shared_ptr<ListenerShard> Create(int index, int num_shards);
+  // Adds a user, unless the shard has none left and its thread is exiting.
+  bool TryAddUser();
+
+  // Queues `callback` to run on the shard's thread.
+  void Schedule(absl::AnyInvocable<void()> callback);
+  void PinToCpus();
+  void ThreadBody();
+
+  const int index_;
+  const int num_shards_;
+  std::atomic<int> users_{1};
+  grpc_core::Mutex mu_;
+  std::vector<absl::AnyInvocable<void()>> callbacks_ ABSL_GUARDED_BY(mu_);
+  std::shared_ptr<Executor> executor_;
+  std::shared_ptr<PosixEventPoller> poller_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_POSIX_SOCKET_TCP
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_LISTENER_SHARD_H
@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
@@ -34,6 +35,7 @@
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+#include "src/core/lib/event_engine/posix_engine/tcp_zerocopy_send_policy.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
@@ -466,6 +468,112 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
   return true;
 }
 
+// Copies `length` bytes off the socket into a new slice appended to
+// `received`. Returns false if fewer could be read.
+bool PosixEndpointImpl::TcpCopyReceive(size_t length, SliceBuffer& received) {
+  MutableSlice slice(memory_owner_.MakeSlice(length));
+  struct iovec iov;
+  iov.iov_base = slice.begin();
+  iov.iov_len = length;
+  struct msghdr msg = {};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  PosixErrorOr<int64_t> res;
+  EventEnginePosixInterface& posix_interface = poller_->posix_interface();
+  do {
+    grpc_core::global_stats().IncrementSyscallRead();
+    res = posix_interface.RecvMsg(handle_->WrappedFd(), &msg, 0);
+  } while (res.IsPosixError(EINTR));
+  const int64_t read_bytes = res.value_or(-1);
+  if (read_bytes <= 0) {
+    return false;
+  }
+  received.Append(Slice(std::move(slice)));
+  if (static_cast<size_t>(read_bytes) < length) {
+    received.RemoveLastNBytes(length - read_bytes);
+    return false;
+  }
+  return true;
+}
+
+// The endpoint's socket, as rx_zerocopy_ receives from it.
+class PosixEndpointImpl::ZerocopyReceiveSocket final
+    : public TcpZerocopyReceiver::Socket {
+ public:
+  explicit ZerocopyReceiveSocket(PosixEndpointImpl* endpoint)
+      : endpoint_(endpoint) {}
+
+  PosixErrorOr<EventEnginePosixInterface::ZerocopyReceiveResult>
+  ZerocopyReceive(size_t length) override {
+    grpc_core::global_stats().IncrementSyscallRead();
+    return endpoint_->poller_->posix_interface().ZerocopyReceive(
+        endpoint_->handle_->WrappedFd(), length);
+  }
+
+  // Only called from TcpDoZerocopyRead(), which holds read_mu_.
+  bool CopyReceive(size_t length, SliceBuffer& received) override
+      ABSL_NO_THREAD_SAFETY_ANALYSIS;
+
+ private:
+  PosixEndpointImpl* const endpoint_;
+};
+
+bool PosixEndpointImpl::ZerocopyReceiveSocket::CopyReceive(
+    size_t length, SliceBuffer& received) {
+  return endpoint_->TcpCopyReceive(length, received);
+}
+
+// Receives the data pending on the socket with rx_zerocopy_, if this read
+// expects enough of it. Returns true if that completed the read. Otherwise
+// anything received is staged in last_read_buffer_ the way TcpDoRead()
+// stages a partial read, and the rest is left for TcpDoRead() to copy.
+bool PosixEndpointImpl::TcpDoZerocopyRead() {
+  const size_t wanted = std::max(min_progress_size_, inq_);
+  if (!rx_zerocopy_.ShouldReceive(wanted)) {
+    return false;
+  }
+  GRPC_LATENT_SEE_ALWAYS_ON_SCOPE("TcpDoZerocopyRead");
+  SliceBuffer received;
+  ZerocopyReceiveSocket socket(this);
+  rx_zerocopy_.Receive(wanted, socket, memory_owner_, received);
+  const size_t received_bytes = received.Length();
+  if (received_bytes == 0) {
+    return false;
+  }
+  grpc_core::global_stats().IncrementTcpReadSize(received_bytes);
+  AddToEstimate(received_bytes);
+  // Nothing here consumed the edge, so the next read must not wait for one.
+  inq_ = 1;
+  if (grpc_core::IsTcpFrameSizeTuningEnabled()) {
+    min_progress_size_ -= static_cast<int>(received_bytes);
+    received.MoveFirstNBytesIntoSliceBuffer(received_bytes, last_read_buffer_);
+    if (min_progress_size_ > 0) {
+      return false;
+    }
+    min_progress_size_ = 1;
+    incoming_buffer_->Swap(last_read_buffer_);
+    return true;
+  }
+  // Keep the space allocated for the read for the next one.
+  if (incoming_buffer_->Length() > 0) {
+    incoming_buffer_->MoveLastNBytesIntoSliceBuffer(incoming_buffer_->Length(),
+                                                    last_read_buffer_);
+  }
+  received.MoveFirstNBytesIntoSliceBuffer(received_bytes, *incoming_buffer_);
+  return true;
+}
+
+// Reads into incoming_buffer_, mapping what TcpDoZerocopyRead() can and
+// copying the rest. Returns as TcpDoRead() does.
+bool PosixEndpointImpl::DoRead(absl::Status& status) {
+  if (TcpDoZerocopyRead()) {
+    status = absl::OkStatus();
+    return true;
+  }
+  MaybeMakeReadSlices();
+  return TcpDoRead(status);
+}
+
 void PosixEndpointImpl::PerformReclamation() {
   read_mu_.Lock();
   if (incoming_buffer_ != nullptr) {
@@ -570,8 +678,7 @@ void PosixEndpointImpl::MaybeMakeReadSlices() {
 
 bool PosixEndpointImpl::HandleReadLocked(absl::Status& status) {
   if (status.ok() && memory_owner_.is_valid()) {
-    MaybeMakeReadSlices();
-    if (!TcpDoRead(status)) {
+    if (!DoRead(status)) {
       UpdateRcvLowat();
       // We've consumed the edge, request a new one.
       return false;
@@ -604,10 +711,21 @@ void PosixEndpointImpl::HandleRead(absl::Status status) {
     handle_->NotifyOnRead(on_read_);
     return;
   }
-  cb(status);
+  RunCallback(std::move(cb), std::move(status));
   Unref();
 }
 
+void PosixEndpointImpl::RunCallback(absl::AnyInvocable<void(absl::Status)> cb,
+                                    absl::Status status) {
+  if (!run_callbacks_on_engine_) {
+    cb(std::move(status));
+    return;
+  }
+  engine_->Run([cb = std::move(cb), status = std::move(status)]() mutable {
+    cb(std::move(status));
+  });
+}
+
 bool PosixEndpointImpl::Read(absl::AnyInvocable<void(absl::Status)> on_read,
                              SliceBuffer* buffer,
                              EventEngine::Endpoint::ReadArgs args) {
@@ -641,8 +759,7 @@ bool PosixEndpointImpl::Read(absl::AnyInvocable<void(absl::Status)> on_read,
     handle_->NotifyOnRead(on_read_);
   } else {
     absl::Status status;
-    MaybeMakeReadSlices();
-    if (!TcpDoRead(status)) {
+    if (!DoRead(status)) {
       UpdateRcvLowat();
       read_cb_ = std::move(on_read);
       // We've consumed the edge, request a new one.
@@ -679,14 +796,18 @@ TcpZerocopySendRecord* PosixEndpointImpl::TcpGetSendZerocopyRecord(
   TcpZerocopySendRecord* zerocopy_send_record = nullptr;
   const bool use_zerocopy =
       tcp_zerocopy_send_ctx_->Enabled() &&
-      tcp_zerocopy_send_ctx_->ThresholdBytes() < buf.Length();
+      tcp_zerocopy_send_ctx_->ShouldZerocopy(buf.Length());
   if (use_zerocopy) {
     zerocopy_send_record = tcp_zerocopy_send_ctx_->GetSendRecord();
     if (zerocopy_send_record == nullptr) {
       ProcessErrors();
       zerocopy_send_record = tcp_zerocopy_send_ctx_->GetSendRecord();
     }
-    if (zerocopy_send_record != nullptr) {
+    if (zerocopy_send_record == nullptr) {
+      grpc_core::global_stats().IncrementTcpZerocopyWritesNoRecord();
+      tcp_zerocopy_send_ctx_->NoteSendsExhausted();
+    } else {
+      grpc_core::global_stats().IncrementTcpZerocopyWrites();
       zerocopy_send_record->PrepareForSends(buf);
       GRPC_DCHECK_EQ(buf.Count(), 0u);
       GRPC_DCHECK_EQ(buf.Length(), 0u);
@@ -724,8 +845,11 @@ bool PosixEndpointImpl::ProcessErrors() {
   msg.msg_control = aligned_buf.rbuf;
   PosixErrorOr<int64_t> r;
   EventEnginePosixInterface& posix_interface = poller_->posix_interface();
+  const bool timed = tcp_zerocopy_send_ctx_->policy() != nullptr;
   while (true) {
     msg.msg_controllen = sizeof(aligned_buf.rbuf);
+    const auto read_start = timed ? std::chrono::steady_clock::now()
+                                  : std::chrono::steady_clock::time_point();
     do {
       r = posix_interface.RecvMsg(handle_->WrappedFd(), &msg, MSG_ERRQUEUE);
     } while (r.IsPosixError(EINTR));
@@ -747,7 +871,7 @@ bool PosixEndpointImpl::ProcessErrors() {
     for (auto cmsg = CMSG_FIRSTHDR(&msg); cmsg && cmsg->cmsg_len;
          cmsg = CMSG_NXTHDR(&msg, cmsg)) {
       if (CmsgIsZeroCopy(*cmsg)) {
-        ProcessZerocopy(cmsg);
+        ProcessZerocopy(cmsg, read_start);
         seen = true;
         processed_err = true;
       } else if (cmsg->cmsg_level == SOL_SOCKET &&
@@ -775,22 +899,35 @@ void PosixEndpointImpl::ZerocopyDisableAndWaitForRemaining() {
 }
 
 // Reads \a cmsg to process zerocopy control messages.
-void PosixEndpointImpl::ProcessZerocopy(struct cmsghdr* cmsg) {
+void PosixEndpointImpl::ProcessZerocopy(
+    struct cmsghdr* cmsg, std::chrono::steady_clock::time_point read_start) {
   GRPC_DCHECK(cmsg);
   auto serr = reinterpret_cast<struct sock_extended_err*>(CMSG_DATA(cmsg));
   GRPC_DCHECK_EQ(serr->ee_errno, 0u);
   GRPC_DCHECK(serr->ee_origin == SO_EE_ORIGIN_ZEROCOPY);
   const uint32_t lo = serr->ee_info;
   const uint32_t hi = serr->ee_data;
+  // The kernel sets this when it had to copy the data of the sends after all,
+  // e.g. because the route's device cannot send from user pages.
+  const bool copied = (serr->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
   for (uint32_t seq = lo; seq <= hi; ++seq) {
     // TODO(arjunroy): It's likely that lo and hi refer to zerocopy sequence
     // numbers that are generated by a single call to grpc_endpoint_write; ie.
     // we can batch the unref operation. So, check if record is the same for
     // both; if so, batch the unref/put.
-    TcpZerocopySendRecord* record =
-        tcp_zerocopy_send_ctx_->ReleaseSendRecord(seq);
+    TcpZerocopySendRecord* record = tcp_zerocopy_send_ctx_->CompleteSend(seq);
     GRPC_DCHECK(record);
     UnrefMaybePutZerocopySendRecord(record);
+    grpc_core::global_stats().IncrementTcpZerocopyCompletions();
+    if (copied) {
+      grpc_core::global_stats().IncrementTcpZerocopyCompletionsCopied();
+    }
+  }
+  if (TcpZerocopySendPolicy* policy = tcp_zerocopy_send_ctx_->policy();
+      policy != nullptr) {
+    const uint32_t sends = hi - lo + 1;
+    policy->RecordCompletions(sends, copied ? sends : 0,
+                              std::chrono::steady_clock::now() - read_start);
   }
   if (tcp_zerocopy_send_ctx_->UpdateZeroCopyOptMemStateAfterFree()) {
     handle_->SetWritable();
@@ -955,6 +1092,8 @@ bool PosixEndpointImpl::DoFlushZerocopy(TcpZerocopySendRecord* record,
   msghdr msg;
   bool constrained;
   status = absl::OkStatus();
+  // Sends are only timed for the policy.
+  TcpZerocopySendPolicy* const policy = tcp_zerocopy_send_ctx_->policy();
   // iov consumes a large space. Keep it as the last item on the stack to
   // improve locality. After all, we expect only the first elements of it
   // being populated in most cases.
@@ -974,6 +1113,9 @@ bool PosixEndpointImpl::DoFlushZerocopy(TcpZerocopySendRecord* record,
     // Before calling sendmsg (with or without timestamps): we
     // take a single ref on the zerocopy send record.
     tcp_zerocopy_send_ctx_->NoteSend(record);
+    const auto send_start = policy != nullptr
+                                ? std::chrono::steady_clock::now()
+                                : std::chrono::steady_clock::time_point();
     saved_errno = 0;
     if (outgoing_buffer_write_event_sink_.has_value()) {
       if (!ts_capable_ ||
@@ -1035,6 +1177,10 @@ bool PosixEndpointImpl::DoFlushZerocopy(TcpZerocopySendRecord* record,
         return true;
       }
     }
+    if (policy != nullptr) {
+      policy->RecordSend(/*zerocopy=*/true, write_bytes_, *send_status,
+                         std::chrono::steady_clock::now() - send_start);
+    }
     bytes_counter_ += *send_status;
     record->UpdateOffsetForBytesSent(sending_length,
                                      static_cast<size_t>(*send_status));
@@ -1065,6 +1211,8 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
   size_t unwind_byte_idx;
   int saved_errno;
   status = absl::OkStatus();
+  // Copied sends are timed too, for the policy to compare with zerocopy.
+  TcpZerocopySendPolicy* const policy = tcp_zerocopy_send_ctx_->policy();
 
   // We always start at zero, because we eagerly unref and trim the slice
   // buffer as we write
@@ -1095,6 +1243,9 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
     msg.msg_iovlen = iov_size;
     msg.msg_flags = 0;
     bool tried_sending_message = false;
+    const auto send_start = policy != nullptr
+                                ? std::chrono::steady_clock::now()
+                                : std::chrono::steady_clock::time_point();
     saved_errno = 0;
     if (outgoing_buffer_write_event_sink_.has_value()) {
       if (!ts_capable_ || !WriteWithTimestamps(&msg, sending_length,
@@ -1134,6 +1285,10 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
     }
 
     GRPC_CHECK_EQ(outgoing_byte_idx_, 0u);
+    if (policy != nullptr) {
+      policy->RecordSend(/*zerocopy=*/false, write_bytes_, *send_result,
+                         std::chrono::steady_clock::now() - send_start);
+    }
     bytes_counter_ += *send_result;
     trailing = sending_length - static_cast<size_t>(*send_result);
     while (trailing > 0) {
@@ -1164,7 +1319,7 @@ void PosixEndpointImpl::HandleWrite(absl::Status status) {
       UnrefMaybePutZerocopySendRecord(current_zerocopy_send_);
       current_zerocopy_send_ = nullptr;
     }
-    cb_(status);
+    RunCallback(std::move(cb_), std::move(status));
     Unref();
     return;
   }
@@ -1180,7 +1335,7 @@ void PosixEndpointImpl::HandleWrite(absl::Status status) {
     absl::AnyInvocable<void(absl::Status)> cb_ = std::move(write_cb_);
     write_cb_ = nullptr;
     current_zerocopy_send_ = nullptr;
-    cb_(status);
+    RunCallback(std::move(cb_), std::move(status));
     Unref();
   }
 }
@@ -1214,6 +1369,7 @@ bool PosixEndpointImpl::Write(
     return true;
   }
 
+  write_bytes_ = data->Length();
   zerocopy_send_record = TcpGetSendZerocopyRecord(*data);
   if (zerocopy_send_record == nullptr) {
     // Either not enough bytes, or couldn't allocate a zerocopy context.
@@ -1341,7 +1497,8 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
 #endif  // GRPC_LINUX_ERRQUEUE
   tcp_zerocopy_send_ctx_ = std::make_unique<TcpZerocopySendCtx>(
       zerocopy_enabled, options.tcp_tx_zerocopy_max_simultaneous_sends,
-      options.tcp_tx_zerocopy_send_bytes_threshold);
+      options.tcp_tx_zerocopy_send_bytes_threshold,
+      options.tcp_tx_zerocopy_adaptive);
 #ifdef GRPC_HAVE_TCP_INQ
   auto result = posix_interface.SetSockOpt(fd, SOL_TCP, TCP_INQ, 1);
   if (result.ok()) {
@@ -1353,6 +1510,10 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
 #else
   inq_capable_ = false;
 #endif  // GRPC_HAVE_TCP_INQ
+  rx_zerocopy_ =
+      TcpZerocopyReceiver(options.tcp_rx_zero_copy_enabled,
+                          options.tcp_rx_zerocopy_receive_bytes_threshold);
+  run_callbacks_on_engine_ = options.run_callbacks_on_engine;
 
   on_read_ = PosixEngineClosure::ToPermanentClosure(
       [this](absl::Status status) { HandleRead(std::move(status)); });
@@ -24,7 +24,9 @@
 #include <grpc/event_engine/slice_buffer.h>
 #include <grpc/support/alloc.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -33,6 +35,8 @@
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
+#include "src/core/lib/event_engine/posix_engine/tcp_zerocopy_receiver.h"
+#include "src/core/lib/event_engine/posix_engine/tcp_zerocopy_send_policy.h"
 #include "src/core/lib/event_engine/posix_engine/traced_buffer_list.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
@@ -164,17 +168,23 @@ class TcpZerocopySendCtx {
  public:
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;  // 16KB
+  // Send records allocated when the policy picks how many may be in flight.
+  static constexpr int kAdaptiveMaxSends = 32;
 
+  // If `adaptive`, max_sends and send_bytes_threshold are only where a
+  // TcpZerocopySendPolicy starts from.
   explicit TcpZerocopySendCtx(
       bool zerocopy_enabled, int max_sends = kDefaultMaxSends,
-      size_t send_bytes_threshold = kDefaultSendBytesThreshold)
-      : max_sends_(max_sends),
-        free_send_records_size_(max_sends),
+      size_t send_bytes_threshold = kDefaultSendBytesThreshold,
+      bool adaptive = false)
+      : max_sends_(adaptive ? std::max(max_sends, kAdaptiveMaxSends)
+                            : max_sends),
+        free_send_records_size_(max_sends_),
         threshold_bytes_(send_bytes_threshold) {
     send_records_ = static_cast<TcpZerocopySendRecord*>(
-        gpr_malloc(max_sends * sizeof(*send_records_)));
+        gpr_malloc(max_sends_ * sizeof(*send_records_)));
     free_send_records_ = static_cast<TcpZerocopySendRecord**>(
-        gpr_malloc(max_sends * sizeof(*free_send_records_)));
+        gpr_malloc(max_sends_ * sizeof(*free_send_records_)));
     if (send_records_ == nullptr || free_send_records_ == nullptr) {
       gpr_free(send_records_);
       gpr_free(free_send_records_);
@@ -187,6 +197,10 @@ class TcpZerocopySendCtx {
         free_send_records_[idx] = send_records_ + idx;
       }
       enabled_ = zerocopy_enabled;
+      if (enabled_ && adaptive) {
+        policy_ = std::make_unique<TcpZerocopySendPolicy>(
+            send_bytes_threshold, max_sends, max_sends_);
+      }
     }
   }
 
@@ -217,6 +231,9 @@ class TcpZerocopySendCtx {
       grpc_core::MutexLock lock(&mu_);
       is_in_write_ = true;
       AssociateSeqWithSendRecordLocked(last_send_, record);
+      if (policy_ != nullptr) {
+        send_times_.emplace(last_send_, std::chrono::steady_clock::now());
+      }
     }
     ++last_send_;
   }
@@ -264,6 +281,20 @@ class TcpZerocopySendCtx {
     return ReleaseSendRecordLocked(seq);
   }
 
+  // ReleaseSendRecord() for a send the kernel has reported complete on the
+  // error queue: also tells the policy how long that took.
+  TcpZerocopySendRecord* CompleteSend(uint32_t seq) {
+    grpc_core::MutexLock lock(&mu_);
+    if (policy_ != nullptr) {
+      auto iter = send_times_.find(seq);
+      if (iter != send_times_.end()) {
+        policy_->RecordCompletionLatency(std::chrono::steady_clock::now() -
+                                         iter->second);
+      }
+    }
+    return ReleaseSendRecordLocked(seq);
+  }
+
   // After all the references to a TcpZerocopySendRecord are released, we can
   // add it back to the pool (of size max_sends_). Note that we can only have
   // max_sends_ tcp_write() instances with zerocopy enabled in flight at the
@@ -292,6 +323,21 @@ class TcpZerocopySendCtx {
   // zerocopy is not useful for small transfers.
   size_t ThresholdBytes() const { return threshold_bytes_; }
 
+  // Whether a write of `bytes` should be sent with zerocopy: decided by the
+  // policy if there is one, else by ThresholdBytes().
+  bool ShouldZerocopy(size_t bytes) const {
+    return policy_ != nullptr ? policy_->ShouldZerocopy(bytes)
+                              : threshold_bytes_ < bytes;
+  }
+
+  // Called when a write that should have been zerocopy found no send record.
+  void NoteSendsExhausted() {
+    if (policy_ != nullptr) policy_->RecordSendsExhausted();
+  }
+
+  // Null unless the context was created adaptive and zerocopy is enabled.
+  TcpZerocopySendPolicy* policy() const { return policy_.get(); }
+
   // Expected to be called by handler reading messages from the err queue.
   // It is used to indicate that some optmem memory is now available. It returns
   // true to tell the caller to mark the file descriptor as immediately
@@ -366,6 +412,7 @@ class TcpZerocopySendCtx {
     is_in_write_ = false;
     constrained = false;
     if (seen_enobuf) {
+      if (policy_ != nullptr) policy_->RecordNoBufs();
       if (ctx_lookup_.size() == 1) {
         // There is no un-acked z-copy record. Set constrained to true to
         // indicate that we are re-source constrained because we're seeing
@@ -421,6 +468,7 @@ class TcpZerocopySendCtx {
     GRPC_DCHECK(iter != ctx_lookup_.end());
     TcpZerocopySendRecord* record = iter->second;
     ctx_lookup_.erase(iter);
+    if (policy_ != nullptr) send_times_.erase(seq);
     return record;
   }
 
@@ -432,6 +480,10 @@ class TcpZerocopySendCtx {
     if (free_send_records_size_ == 0) {
       return nullptr;
     }
+    if (policy_ != nullptr &&
+        max_sends_ - free_send_records_size_ >= policy_->max_sends()) {
+      return nullptr;
+    }
     free_send_records_size_--;
     return free_send_records_[free_send_records_size_];
   }
@@ -457,6 +509,10 @@ class TcpZerocopySendCtx {
   bool memory_limited_ = false;
   bool is_in_write_ ABSL_GUARDED_BY(mu_) = false;
   OptMemState zcopy_enobuf_state_ ABSL_GUARDED_BY(mu_) = OptMemState::kOpen;
+  std::unique_ptr<TcpZerocopySendPolicy> policy_;
+  // When each send in flight was made, if there is a policy.
+  absl::flat_hash_map<uint32_t, std::chrono::steady_clock::time_point>
+      send_times_ ABSL_GUARDED_BY(mu_);
 };
 
 class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
@@ -501,6 +557,16 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void MaybeMakeReadSlices() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   bool TcpDoRead(absl::Status& status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  bool DoRead(absl::Status& status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // Runs a completed read's or write's callback.
+  void RunCallback(absl::AnyInvocable<void(absl::Status)> cb,
+                   absl::Status status);
+  // Zero copy receive related helper methods.
+  class ZerocopyReceiveSocket;
+  bool TcpDoZerocopyRead() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  bool TcpCopyReceive(size_t length,
+                      grpc_event_engine::experimental::SliceBuffer& received)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void FinishEstimate();
   void AddToEstimate(size_t bytes);
   void MaybePostReclaimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
@@ -520,8 +586,10 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   absl::Status TcpAnnotateError(absl::Status src_error) const;
 #ifdef GRPC_LINUX_ERRQUEUE
   bool ProcessErrors();
-  // Reads a cmsg to process zerocopy control messages.
-  void ProcessZerocopy(struct cmsghdr* cmsg);
+  // Reads a cmsg to process zerocopy control messages. `read_start` is when
+  // the read of the error queue that returned it began.
+  void ProcessZerocopy(struct cmsghdr* cmsg,
+                       std::chrono::steady_clock::time_point read_start);
   // Reads a cmsg to derive timestamps from the control messages.
   struct cmsghdr* ProcessTimestamp(msghdr* msg, struct cmsghdr* cmsg);
 #endif  // GRPC_LINUX_ERRQUEUE
@@ -543,10 +611,15 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   int inq_ = 1;
   // cache whether kernel supports inq.
   bool inq_capable_ = false;
+  // Maps large reads with TCP_ZEROCOPY_RECEIVE, if enabled.
+  TcpZerocopyReceiver rx_zerocopy_ ABSL_GUARDED_BY(read_mu_);
 
   grpc_event_engine::experimental::SliceBuffer* outgoing_buffer_ = nullptr;
   // byte within outgoing_buffer's slices[0] to write next.
   size_t outgoing_byte_idx_ = 0;
+  // Length of the write being flushed, which the zerocopy policy sizes its
+  // sends by.
+  size_t write_bytes_ = 0;
 
   PosixEngineClosure* on_read_ = nullptr;
   PosixEngineClosure* on_write_ = nullptr;
@@ -554,6 +627,8 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   PosixEngineClosure* on_done_ = nullptr;
   absl::AnyInvocable<void(absl::Status)> read_cb_ ABSL_GUARDED_BY(read_mu_);
   absl::AnyInvocable<void(absl::Status)> write_cb_;
+  // Run read_cb_ and write_cb_ on engine_ rather than on the poller's thread.
+  bool run_callbacks_on_engine_ = false;
 
   grpc_event_engine::experimental::EventEngine::ResolvedAddress peer_address_;
   grpc_event_engine::experimental::EventEngine::ResolvedAddress local_address_;
@@ -29,6 +29,7 @@
 #include <utility>
 #include <vector>
 
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/ares_resolver.h"
 #include "src/core/lib/event_engine/poller.h"
@@ -53,6 +54,7 @@
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
 #include <errno.h>       // IWYU pragma: keep
@@ -83,6 +85,17 @@ bool ShouldUsePosixPoller() {
 #endif
 }
 
+TimerListKind ConfiguredTimerListKind() {
+  absl::string_view timer_list =
+      grpc_core::ConfigVars::Get().EventEngineTimerList();
+  if (timer_list == "wheel") return TimerListKind::kWheel;
+  if (timer_list != "heap") {
+    LOG(ERROR) << "Unknown GRPC_EVENT_ENGINE_TIMER_LIST '" << timer_list
+               << "', using heap";
+  }
+  return TimerListKind::kHeap;
+}
+
 #if GRPC_ENABLE_FORK_SUPPORT && GRPC_POSIX_FORK_ALLOW_PTHREAD_ATFORK
 
 // Thread pool can outlive EE but we need to ensure the ordering if both
@@ -425,14 +438,21 @@ PosixEventEngine::PosixEventEngine(std::shared_ptr<PosixEventPoller> poller)
     : connection_shards_(std::max(2 * gpr_cpu_num_cores(), 1u)),
       poller_(std::move(poller)),
       executor_(MakeThreadPool(grpc_core::Clamp(gpr_cpu_num_cores(), 4u, 16u))),
-      timer_manager_(std::make_shared<TimerManager>(executor_)) {}
+      timer_manager_(std::make_shared<TimerManager>(
+          executor_, ConfiguredTimerListKind())) {}
 
 PosixEventEngine::PosixEventEngine()
     : connection_shards_(std::max(2 * gpr_cpu_num_cores(), 1u)),
       executor_(MakeThreadPool(grpc_core::Clamp(gpr_cpu_num_cores(), 4u, 16u))),
-      timer_manager_(std::make_shared<TimerManager>(executor_)) {
+      timer_manager_(std::make_shared<TimerManager>(
+          executor_, ConfiguredTimerListKind())) {
   if (ShouldUsePosixPoller()) {
-    poller_ = grpc_event_engine::experimental::MakeDefaultPoller(executor_);
+    busy_poll_threads_ =
+        grpc_core::ConfigVars::Get().EventEngineBusyPollThreads();
+    // Closures made ready while busy-polling stay on the polling thread.
+    poller_ = grpc_event_engine::experimental::MakeDefaultPoller(
+        busy_poll_threads_ > 0 ? BusyPoller::MakeExecutor(executor_)
+                               : executor_);
     SchedulePoller();
   }
 }
@@ -471,6 +491,7 @@ PosixEventEngine::~PosixEventEngine() {
   }
 #if defined(GRPC_POSIX_SOCKET_TCP)
   polling_cycle_.reset();
+  busy_poller_.reset();
 #endif  // defined(GRPC_POSIX_SOCKET_TCP)
   timer_manager_->Shutdown();
   executor_->Quiesce();
@@ -856,12 +877,24 @@ void PosixEventEngine::SchedulePoller() {
   }
   grpc_core::MutexLock lock(&mu_);
   GRPC_CHECK(!polling_cycle_.has_value());
-  polling_cycle_.emplace(executor_, poller_);
+  GRPC_CHECK(busy_poller_ == nullptr);
+  if (busy_poll_threads_ > 0) {
+    busy_poller_ = std::make_unique<BusyPoller>(poller_, busy_poll_threads_);
+  } else {
+    polling_cycle_.emplace(executor_, poller_);
+  }
 }
 
 void PosixEventEngine::ResetPollCycle() {
-  grpc_core::MutexLock lock(&mu_);
-  polling_cycle_.reset();
+  std::unique_ptr<BusyPoller> busy_poller;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    polling_cycle_.reset();
+    busy_poller = std::move(busy_poller_);
+  }
+  // Stopped without holding mu_: the polling threads run closures, which may
+  // need it.
+  busy_poller.reset();
 }
 
 #else  // defined(GRPC_POSIX_SOCKET_TCP)
@@ -44,6 +44,7 @@
 #include "absl/strings/string_view.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
+#include "src/core/lib/event_engine/posix_engine/busy_poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
 #endif  // GRPC_POSIX_SOCKET_TCP
@@ -239,6 +240,10 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport {
 
   // Ensures there's ever only one of these.
   std::optional<PollingCycle> polling_cycle_ ABSL_GUARDED_BY(&mu_);
+  // Threads to busy-poll with instead of a PollingCycle, from
+  // GRPC_EVENT_ENGINE_BUSY_POLL_THREADS; 0 if not busy-polling.
+  int busy_poll_threads_ = 0;
+  std::unique_ptr<BusyPoller> busy_poller_ ABSL_GUARDED_BY(&mu_);
 #endif  // GRPC_POSIX_SOCKET_TCP
 
   EventEngine::TaskHandle RunAfterInternal(Duration when,
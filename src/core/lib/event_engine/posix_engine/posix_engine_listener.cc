@@ -23,6 +23,7 @@
 #include <errno.h>  // IWYU pragma: keep
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/event_engine/memory_allocator.h>
+#include <grpc/support/cpu.h>
 #include <sys/socket.h>  // IWYU pragma: keep
 #include <unistd.h>      // IWYU pragma: keep
 
@@ -31,9 +32,11 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/listener_shard.h"
 #include "src/core/lib/event_engine/posix_engine/posix_endpoint.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_listener.h"
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
@@ -41,6 +44,7 @@
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
 #include "src/core/lib/iomgr/socket_mutator.h"
 #include "src/core/net/socket_mutator.h"
+#include "src/core/util/fork.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/status_helper.h"
 #include "src/core/util/strerror.h"
@@ -65,7 +69,23 @@ PosixEngineListenerImpl::PosixEngineListenerImpl(
       acceptors_(this),
       on_accept_(std::move(on_accept)),
       on_shutdown_(std::move(on_shutdown)),
-      memory_allocator_factory_(std::move(memory_allocator_factory)) {}
+      memory_allocator_factory_(std::move(memory_allocator_factory)) {
+  const int num_shards = options_.listener_shards < 0
+                             ? static_cast<int>(gpr_cpu_num_cores())
+                             : options_.listener_shards;
+  if (num_shards <= 1) return;
+  if (!IsSocketReusePortSupported() || grpc_core::Fork::Enabled()) {
+    LOG(INFO) << "Listener sharding needs SO_REUSEPORT, and no fork support";
+    return;
+  }
+  shards_ = ListenerShard::GetShards(engine_.get(), num_shards);
+  if (shards_.empty()) {
+    LOG(ERROR) << "Could not create the pollers of " << num_shards
+               << " listener shards";
+    return;
+  }
+  options_.allow_reuse_port = true;
+}
 
 absl::StatusOr<int> PosixEngineListenerImpl::Bind(
     const EventEngine::ResolvedAddress& addr,
@@ -117,6 +137,66 @@ absl::StatusOr<int> PosixEngineListenerImpl::Bind(
   return result->port;
 }
 
+std::vector<ListenerSocketsContainer::ListenerSocket>
+PosixEngineListenerImpl::OpenShardSockets(
+    const ListenerSocketsContainer::ListenerSocket& socket) {
+  std::vector<ListenerSocketsContainer::ListenerSocket> group = {socket};
+  EventEnginePosixInterface& posix_interface = poller_->posix_interface();
+  EventEngine::ResolvedAddress addr = socket.addr;
+  ResolvedAddressSetPort(addr, socket.port);
+  absl::Status status;
+  while (group.size() < shards_.size()) {
+    auto shard_socket =
+        CreateAndPrepareListenerSocket(&posix_interface, options_, addr);
+    if (!shard_socket.ok()) {
+      status = shard_socket.status();
+      break;
+    }
+    group.push_back(*shard_socket);
+  }
+  if (status.ok()) {
+    status =
+        posix_interface.AttachReuseportCpuSteering(socket.sock, group.size());
+  }
+  if (status.ok()) return group;
+  auto addr_uri = ResolvedAddressToURI(addr);
+  LOG(ERROR) << "Not sharding listener on "
+             << (addr_uri.ok() ? *addr_uri : "<unknown>") << ": " << status;
+  for (size_t i = 1; i < group.size(); ++i) {
+    posix_interface.Close(group[i].sock);
+  }
+  group.resize(1);
+  return group;
+}
+
+void PosixEngineListenerImpl::ListenerAsyncAcceptors::Append(
+    ListenerSocket socket) {
+  // Unix domain sockets have no SO_REUSEPORT groups to shard.
+  if (listener_->shards_.empty() ||
+      socket.dsmode == EventEnginePosixInterface::DSMODE_NONE) {
+    AppendAcceptor(socket, nullptr);
+    return;
+  }
+  auto group = listener_->OpenShardSockets(socket);
+  if (group.size() == 1) {
+    AppendAcceptor(socket, nullptr);
+    return;
+  }
+  for (size_t i = 0; i < group.size(); ++i) {
+    AppendAcceptor(group[i], listener_->shards_[i]);
+  }
+}
+
+void PosixEngineListenerImpl::ListenerAsyncAcceptors::AppendAcceptor(
+    ListenerSocket socket, std::shared_ptr<ListenerShard> shard) {
+  acceptors_.push_back(new AsyncConnectionAcceptor(
+      listener_->engine_, listener_->shared_from_this(), std::move(shard),
+      socket));
+  if (on_append_) {
+    on_append_(socket.sock.fd());
+  }
+}
+
 void PosixEngineListenerImpl::AsyncConnectionAcceptor::Start() {
   Ref();
   handle_->NotifyOnRead(notify_on_accept_);
@@ -232,6 +312,10 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
       Unref();
       return;
     }
+    if (shard_ != nullptr) {
+      AcceptOnShard(fd.value(), std::move(*peer_name));
+      continue;
+    }
     auto endpoint = CreatePosixEndpoint(
         /*handle=*/listener_->poller_->CreateHandle(
             fd.value(), *peer_name, listener_->poller_->CanTrackErrors()),
@@ -258,6 +342,38 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
   GPR_UNREACHABLE_CODE(return);
 }
 
+void PosixEngineListenerImpl::AsyncConnectionAcceptor::AcceptOnShard(
+    const FileDescriptor& fd, std::string peer_name) {
+  // Keep the shard polling until the connection has been closed.
+  shard_->AddUser();
+  auto* on_shutdown = new PosixEngineClosure(
+      [shard = shard_](absl::Status) { shard->RemoveUser(); },
+      /*is_permanent=*/false);
+  // The shard's thread only does I/O: the endpoint's callbacks, and
+  // on_accept_, run on the engine's thread pool.
+  PosixTcpOptions options = listener_->options_;
+  options.run_callbacks_on_engine = true;
+  auto endpoint = CreatePosixEndpoint(
+      /*handle=*/shard_->poller()->CreateHandle(
+          fd, peer_name, shard_->poller()->CanTrackErrors()),
+      /*on_shutdown=*/on_shutdown, /*engine=*/listener_->engine_,
+      // allocator=
+      listener_->memory_allocator_factory_->CreateMemoryAllocator(
+          absl::StrCat("endpoint-tcp-server-connection: ", peer_name)),
+      /*options=*/options);
+  engine_->Run([listener = listener_, listener_fd = handle_->WrappedFd().fd(),
+                peer_name = std::move(peer_name),
+                endpoint = std::move(endpoint)]() mutable {
+    grpc_core::EnsureRunInExecCtx([&]() {
+      listener->on_accept_(
+          listener_fd, std::move(endpoint), /*is_external=*/false,
+          listener->memory_allocator_factory_->CreateMemoryAllocator(
+              absl::StrCat("on-accept-tcp-server-connection: ", peer_name)),
+          /*pending_data=*/nullptr);
+    });
+  });
+}
+
 absl::Status PosixEngineListenerImpl::HandleExternalConnection(
     int listener_fd, int fd, SliceBuffer* pending_data) {
   if (listener_fd < 0) {
@@ -336,6 +452,7 @@ PosixEngineListenerImpl::~PosixEngineListenerImpl() {
   // This should get invoked only after all the AsyncConnectionAcceptors have
   // been destroyed. This is because each AsyncConnectionAcceptor has a
   // shared_ptr ref to the parent PosixEngineListenerImpl.
+  for (auto& shard : shards_) shard->RemoveUser();
   if (on_shutdown_ != nullptr) {
     on_shutdown_(absl::OkStatus());
   }
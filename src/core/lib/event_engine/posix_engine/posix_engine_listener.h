@@ -24,7 +24,9 @@
 #include <atomic>
 #include <list>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "src/core/lib/event_engine/posix.h"
 #include "src/core/lib/event_engine/posix_engine/posix_interface.h"
@@ -37,6 +39,7 @@
 
 #ifdef GRPC_POSIX_SOCKET_TCP
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/listener_shard.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_listener_utils.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
@@ -75,20 +78,24 @@ class PosixEngineListenerImpl
   // This class represents accepting for one bind fd belonging to the listener.
   // Each AsyncConnectionAcceptor takes a ref to the parent
   // PosixEngineListenerImpl object. So the PosixEngineListenerImpl can be
-  // deleted only after all AsyncConnectionAcceptors get destroyed.
+  // deleted only after all AsyncConnectionAcceptors get destroyed. The socket,
+  // and the connections accepted on it, are polled by the shard's poller if
+  // the listener is sharded, and by the engine's poller otherwise.
   class AsyncConnectionAcceptor {
    public:
     AsyncConnectionAcceptor(std::shared_ptr<EventEngine> engine,
                             std::shared_ptr<PosixEngineListenerImpl> listener,
+                            std::shared_ptr<ListenerShard> shard,
                             ListenerSocketsContainer::ListenerSocket socket)
         : engine_(std::move(engine)),
           listener_(std::move(listener)),
+          shard_(std::move(shard)),
           socket_(socket),
-          handle_(listener_->poller_->CreateHandle(
+          handle_(poller()->CreateHandle(
               socket_.sock,
               *grpc_event_engine::experimental::
                   ResolvedAddressToNormalizedString(socket_.addr),
-              listener_->poller_->CanTrackErrors())),
+              poller()->CanTrackErrors())),
           notify_on_accept_(PosixEngineClosure::ToPermanentClosure(
               [this](absl::Status status) { NotifyOnAccept(status); })) {};
     // Start listening for incoming connections on the socket.
@@ -118,9 +125,17 @@ class PosixEngineListenerImpl
     }
 
    private:
+    PosixEventPoller* poller() {
+      return shard_ != nullptr ? shard_->poller() : listener_->poller_;
+    }
+    // Hands a connection accepted on the shard's socket to the shard's
+    // poller, and to on_accept_ on the engine's thread pool.
+    void AcceptOnShard(const FileDescriptor& fd, std::string peer_name);
+
     std::atomic<int> ref_count_{1};
     std::shared_ptr<EventEngine> engine_;
     std::shared_ptr<PosixEngineListenerImpl> listener_;
+    std::shared_ptr<ListenerShard> shard_;
     ListenerSocketsContainer::ListenerSocket socket_;
     EventHandle* handle_;
     PosixEngineClosure* notify_on_accept_;
@@ -138,13 +153,9 @@ class PosixEngineListenerImpl
       on_append_ = std::move(on_append);
     }
 
-    void Append(ListenerSocket socket) override {
-      acceptors_.push_back(new AsyncConnectionAcceptor(
-          listener_->engine_, listener_->shared_from_this(), socket));
-      if (on_append_) {
-        on_append_(socket.sock.fd());
-      }
-    }
+    // If the listener is sharded, opens the rest of the socket's
+    // SO_REUSEPORT group and adds an acceptor per shard.
+    void Append(ListenerSocket socket) override;
 
     absl::StatusOr<ListenerSocket> Find(
         const grpc_event_engine::experimental::EventEngine::ResolvedAddress&
@@ -169,18 +180,29 @@ class PosixEngineListenerImpl
     }
 
    private:
+    void AppendAcceptor(ListenerSocket socket,
+                        std::shared_ptr<ListenerShard> shard);
+
     PosixListenerWithFdSupport::OnPosixBindNewFdCallback on_append_;
     std::list<AsyncConnectionAcceptor*> acceptors_;
     PosixEngineListenerImpl* listener_;
   };
   friend class ListenerAsyncAcceptors;
   friend class AsyncConnectionAcceptor;
+  // Returns `socket` followed by one more socket per remaining shard, bound to
+  // the same address and port, with CPU steering attached to the group. Falls
+  // back to `socket` alone if the group cannot be set up.
+  std::vector<ListenerSocketsContainer::ListenerSocket> OpenShardSockets(
+      const ListenerSocketsContainer::ListenerSocket& socket);
   // The mutex ensures thread safety when multiple threads try to call Bind
   // and Start in parallel.
   grpc_core::Mutex mu_;
   PosixEventPoller* poller_;
   PosixTcpOptions options_;
   std::shared_ptr<EventEngine> engine_;
+  // One per CPU shard if GRPC_ARG_TCP_LISTENER_SHARDS asked for more than one
+  // and the platform supports it, and empty otherwise.
+  std::vector<std::shared_ptr<ListenerShard>> shards_;
   // Linked list of sockets. One is created upon each successful bind
   // operation.
   ListenerAsyncAcceptors acceptors_ ABSL_GUARDED_BY(mu_);
@@ -18,6 +18,7 @@
 #include <grpc/event_engine/event_engine.h>
 
 #include <cerrno>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string>
@@ -174,6 +175,25 @@ class EventEnginePosixInterface {
   // Sets a socket option value (setsockopt wrapper).
   PosixErrorOr<int64_t> SetSockOpt(const FileDescriptor& fd, int level,
                                    int optname, uint32_t optval);
+  // Attaches a classic BPF program to the SO_REUSEPORT group of a bound socket
+  // that hands each incoming connection to the group's socket at index
+  // (CPU that received it) % num_sockets.
+  absl::Status AttachReuseportCpuSteering(const FileDescriptor& fd,
+                                          uint32_t num_sockets);
+  // What ZerocopyReceive() took off a socket: `mapped` bytes of received data
+  // at `mapping` (nullptr if none), after which the next `copy_hint` bytes
+  // could not be mapped and have to be read with recvmsg().
+  struct ZerocopyReceiveResult {
+    void* mapping = nullptr;
+    size_t mapped = 0;
+    size_t copy_hint = 0;
+  };
+  // Maps up to `length` bytes, a multiple of the page size, of the data
+  // pending on a TCP socket into the process with TCP_ZEROCOPY_RECEIVE,
+  // consuming them from the socket. The caller owns the mapping and must
+  // munmap() it.
+  PosixErrorOr<ZerocopyReceiveResult> ZerocopyReceive(const FileDescriptor& fd,
+                                                      size_t length);
 
   // Epoll
 #ifdef GRPC_LINUX_EPOLL
@@ -67,12 +67,28 @@
 #include <sys/epoll.h>
 #endif  // GRPC_LINUX_EPOLL
 
+#if GPR_LINUX == 1
+#include <linux/filter.h>
+#include <sys/mman.h>
+#endif  // GPR_LINUX == 1
+
 #if GPR_LINUX == 1
 // For Linux, it will be detected to support TCP_USER_TIMEOUT
 #ifndef TCP_USER_TIMEOUT
 #define TCP_USER_TIMEOUT 18
 #endif
 #define SOCKET_SUPPORTS_TCP_USER_TIMEOUT_DEFAULT 0
+// Defined here for libc headers that predate it, like MSG_ZEROCOPY in
+// posix_endpoint.cc: the kernel constant never changes.
+#ifndef TCP_ZEROCOPY_RECEIVE
+#define TCP_ZEROCOPY_RECEIVE 35
+#endif
+#ifndef SO_BUSY_POLL
+#define SO_BUSY_POLL 46
+#endif
+#ifndef SO_PREFER_BUSY_POLL
+#define SO_PREFER_BUSY_POLL 69
+#endif
 #else
 // For non-Linux, TCP_USER_TIMEOUT will be used if TCP_USER_TIMEOUT is defined.
 #ifdef TCP_USER_TIMEOUT
@@ -321,6 +337,32 @@ absl::Status SetSocketZeroCopy(int fd) {
 #endif  // GRPC_LINUX_ERRQUEUE
 }
 
+// Set SO_BUSY_POLL and SO_PREFER_BUSY_POLL. Neither is fatal: raising
+// SO_BUSY_POLL above net.core.busy_read needs CAP_NET_ADMIN, and
+// SO_PREFER_BUSY_POLL needs Linux 5.11. Sockets accepted from a listener
+// inherit both.
+void TrySetSocketBusyPoll(int fd, const PosixTcpOptions& options) {
+#if GPR_LINUX == 1
+  if (options.busy_poll_us <= 0) return;
+  int busy_poll_us = options.busy_poll_us;
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_us,
+                      sizeof(busy_poll_us))) {
+    GRPC_TRACE_LOG(tcp, INFO)
+        << "setsockopt(SO_BUSY_POLL): " << grpc_core::StrError(errno);
+    return;
+  }
+  int prefer_busy_poll = 1;
+  if (0 != setsockopt(fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer_busy_poll,
+                      sizeof(prefer_busy_poll))) {
+    GRPC_TRACE_LOG(tcp, INFO)
+        << "setsockopt(SO_PREFER_BUSY_POLL): " << grpc_core::StrError(errno);
+  }
+#else   // GPR_LINUX == 1
+  (void)fd;
+  (void)options;
+#endif  // GPR_LINUX == 1
+}
+
 // Set TCP_USER_TIMEOUT
 void TrySetSocketTcpUserTimeout(int fd, const PosixTcpOptions& options,
                                 bool is_client) {
@@ -829,6 +871,7 @@ EventEnginePosixInterface::PrepareListenerSocket(
         SetSocketOption(f, SOL_SOCKET, SO_REUSEADDR, 1, "SO_REUSEADDR"));
     GRPC_RETURN_IF_ERROR(SetSocketDscp(f, options.dscp));
     TrySetSocketTcpUserTimeout(f, options, false);
+    TrySetSocketBusyPoll(f, options);
   }
   GRPC_RETURN_IF_ERROR(InternalSetSocketNoSigpipeIfPossible(f));
   GRPC_RETURN_IF_ERROR(InternalApplySocketMutatorInOptions(
@@ -897,6 +940,80 @@ PosixErrorOr<int64_t> EventEnginePosixInterface::SetSockOpt(
   return optval;
 }
 
+absl::Status EventEnginePosixInterface::AttachReuseportCpuSteering(
+    GRPC_UNUSED const FileDescriptor& fd, GRPC_UNUSED uint32_t num_sockets) {
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(SKF_AD_CPU)
+  if (!IsCorrectGeneration(fd)) {
+    return absl::InternalError(
+        "AttachReuseportCpuSteering: FD has a wrong generation");
+  }
+  // A = raw_smp_processor_id(); A %= num_sockets; return A.
+  struct sock_filter code[] = {
+      {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+       static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+      {BPF_ALU | BPF_MOD | BPF_K, 0, 0, num_sockets},
+      {BPF_RET | BPF_A, 0, 0, 0},
+  };
+  struct sock_fprog program = {sizeof(code) / sizeof(code[0]), code};
+  if (setsockopt(fd.fd(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program,
+                 sizeof(program)) < 0) {
+    return absl::InternalError(
+        absl::StrCat("setsockopt(SO_ATTACH_REUSEPORT_CBPF): ",
+                     grpc_core::StrError(errno)));
+  }
+  return absl::OkStatus();
+#else
+  return absl::UnimplementedError(
+      "SO_ATTACH_REUSEPORT_CBPF unavailable on compiling system");
+#endif
+}
+
+PosixErrorOr<EventEnginePosixInterface::ZerocopyReceiveResult>
+EventEnginePosixInterface::ZerocopyReceive(GRPC_UNUSED const FileDescriptor& fd,
+                                           GRPC_UNUSED size_t length) {
+#if GPR_LINUX == 1
+  if (!IsCorrectGeneration(fd)) {
+    return PosixError::WrongGeneration();
+  }
+  void* mapping = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd.fd(), 0);
+  if (mapping == MAP_FAILED) {
+    return PosixError::Error(errno);
+  }
+  // The leading fields of struct tcp_zerocopy_receive, which every kernel
+  // supporting the option accepts.
+  struct {
+    uint64_t address;
+    uint32_t length;
+    uint32_t recv_skip_hint;
+  } zc;
+  int err;
+  do {
+    zc = {reinterpret_cast<uintptr_t>(mapping), static_cast<uint32_t>(length),
+          0};
+    socklen_t zc_len = sizeof(zc);
+    err = getsockopt(fd.fd(), IPPROTO_TCP, TCP_ZEROCOPY_RECEIVE, &zc, &zc_len);
+  } while (err < 0 && errno == EINTR);
+  if (err < 0) {
+    int saved_errno = errno;
+    munmap(mapping, length);
+    return PosixError::Error(saved_errno);
+  }
+  ZerocopyReceiveResult result;
+  result.mapped = zc.length;
+  result.copy_hint = zc.recv_skip_hint;
+  if (result.mapped < length) {
+    munmap(static_cast<char*>(mapping) + result.mapped,
+           length - result.mapped);
+  }
+  if (result.mapped > 0) {
+    result.mapping = mapping;
+  }
+  return result;
+#else
+  return PosixError::Error(ENOSYS);
+#endif  // GPR_LINUX == 1
+}
+
 #ifdef GRPC_LINUX_EVENTFD
 
 PosixErrorOr<FileDescriptor> EventEnginePosixInterface::EventFd(int initval,
@@ -994,6 +1111,7 @@ absl::Status EventEnginePosixInterface::PrepareTcpClientSocket(
         SetSocketOption(fd, SOL_SOCKET, SO_REUSEADDR, 1, "SO_REUSEADDR"));
     GRPC_RETURN_IF_ERROR(SetSocketDscp(fd, options.dscp));
     TrySetSocketTcpUserTimeout(fd, options, true);
+    TrySetSocketBusyPoll(fd, options);
   }
   GRPC_RETURN_IF_ERROR(InternalSetSocketNoSigpipeIfPossible(fd));
   GRPC_RETURN_IF_ERROR(InternalApplySocketMutatorInOptions(
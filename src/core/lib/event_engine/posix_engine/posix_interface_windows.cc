@@ -90,6 +90,21 @@ PosixErrorOr<int64_t> EventEnginePosixInterface::SetSockOpt(
       "unimplemented on this platform: EventEnginePosixInterface::SetSockOpt");
 }
 
+absl::Status EventEnginePosixInterface::AttachReuseportCpuSteering(
+    const FileDescriptor& fd, uint32_t num_sockets) {
+  grpc_core::Crash(
+      "unimplemented on this platform: "
+      "EventEnginePosixInterface::AttachReuseportCpuSteering");
+}
+
+PosixErrorOr<EventEnginePosixInterface::ZerocopyReceiveResult>
+EventEnginePosixInterface::ZerocopyReceive(const FileDescriptor& fd,
+                                           size_t length) {
+  grpc_core::Crash(
+      "unimplemented on this platform: "
+      "EventEnginePosixInterface::ZerocopyReceive");
+}
+
 #ifndef GRPC_POSIX_WAKEUP_FD
 PosixErrorOr<int64_t> EventEnginePosixInterface::Read(const FileDescriptor& fd,
                                                       absl::Span<char> buf) {
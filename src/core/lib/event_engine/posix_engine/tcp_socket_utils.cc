@@ -22,6 +22,7 @@
 
 #include <optional>
 
+#include "src/core/config/config_vars.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/util/crash.h"  // IWYU pragma: keep
 #include "src/core/util/useful.h"
@@ -96,6 +97,15 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_tx_zerocopy_adaptive =
+      (AdjustValue(0, 0, 1, config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ADAPTIVE)) !=
+       0);
+  options.tcp_rx_zero_copy_enabled =
+      (AdjustValue(0, 0, 1, config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED)) !=
+       0);
+  options.tcp_rx_zerocopy_receive_bytes_threshold =
+      AdjustValue(PosixTcpOptions::kDefaultReceiveBytesThreshold, 0, INT_MAX,
+                  config.GetInt(GRPC_ARG_TCP_RX_ZEROCOPY_THRESHOLD));
   options.keep_alive_time_ms =
       AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
   options.keep_alive_timeout_ms =
@@ -112,6 +122,14 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
         (AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_ALLOW_REUSEPORT)) !=
          0);
   }
+  options.listener_shards =
+      AdjustValue(0, -1, INT_MAX, config.GetInt(GRPC_ARG_TCP_LISTENER_SHARDS));
+  const grpc_core::ConfigVars& config_vars = grpc_core::ConfigVars::Get();
+  options.busy_poll_us =
+      AdjustValue(config_vars.EventEngineBusyPollThreads() > 0
+                      ? config_vars.EventEngineBusyPollUs()
+                      : 0,
+                  0, INT_MAX, config.GetInt(GRPC_ARG_TCP_BUSY_POLL_US));
   if (options.tcp_min_read_chunk_size > options.tcp_max_read_chunk_size) {
     options.tcp_min_read_chunk_size = options.tcp_max_read_chunk_size;
   }
@@ -39,8 +39,39 @@
 #ifndef SO_EE_ORIGIN_ZEROCOPY
 #define SO_EE_ORIGIN_ZEROCOPY 5
 #endif
+#ifndef SO_EE_CODE_ZEROCOPY_COPIED
+#define SO_EE_CODE_ZEROCOPY_COPIED 1
+#endif
 #endif  // ifdef GRPC_LINUX_ERRQUEUE
 
+// Number of SO_REUSEPORT sockets a listener opens on each address it binds,
+// each polled by its own thread pinned to a subset of the CPUs: see
+// ListenerShard. The threads are shared by the listeners of an engine. -1
+// opens one per CPU; 0 and 1 use a single socket.
+#define GRPC_ARG_TCP_LISTENER_SHARDS "grpc.experimental.tcp_listener_shards"
+
+// Whether endpoints map large reads into the process with
+// TCP_ZEROCOPY_RECEIVE instead of copying them out of the socket.
+#define GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED \
+  "grpc.experimental.tcp_rx_zerocopy_enabled"
+// Fewest bytes a read must be expecting for the endpoint to try mapping them
+// rather than copying them.
+#define GRPC_ARG_TCP_RX_ZEROCOPY_THRESHOLD \
+  "grpc.experimental.tcp_rx_zerocopy_threshold"
+
+// Whether endpoints tune which writes they send with MSG_ZEROCOPY, and how
+// many of those they keep in flight, from what their sends cost: see
+// TcpZerocopySendPolicy. The configured threshold and maximum number of sends
+// are where the tuning starts.
+#define GRPC_ARG_TCP_TX_ZEROCOPY_ADAPTIVE \
+  "grpc.experimental.tcp_tx_zerocopy_adaptive"
+
+// SO_BUSY_POLL time in microseconds for the endpoint's socket, which then
+// also gets SO_PREFER_BUSY_POLL. 0 leaves both unset. Defaults to
+// GRPC_EVENT_ENGINE_BUSY_POLL_US when the engine busy-polls, and to 0
+// otherwise.
+#define GRPC_ARG_TCP_BUSY_POLL_US "grpc.experimental.tcp_busy_poll_us"
+
 namespace grpc_event_engine::experimental {
 
 struct PosixTcpOptions {
@@ -51,6 +82,7 @@ struct PosixTcpOptions {
   static constexpr int kMaxChunkSize = 32 * 1024 * 1024;
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;
+  static constexpr int kDefaultReceiveBytesThreshold = 256 * 1024;
   // Let the system decide the proper buffer size.
   static constexpr int kReadBufferSizeUnset = -1;
   static constexpr int kDscpNotSet = -1;
@@ -61,10 +93,19 @@ struct PosixTcpOptions {
   int tcp_tx_zerocopy_max_simultaneous_sends = kDefaultMaxSends;
   int tcp_receive_buffer_size = kReadBufferSizeUnset;
   bool tcp_tx_zero_copy_enabled = kZerocpTxEnabledDefault;
+  bool tcp_tx_zerocopy_adaptive = false;
+  bool tcp_rx_zero_copy_enabled = false;
+  int tcp_rx_zerocopy_receive_bytes_threshold = kDefaultReceiveBytesThreshold;
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
+  int listener_shards = 0;
+  // Not a channel arg: set by sharded listeners for the connections they
+  // accept, so that read and write callbacks leave the shard's thread for the
+  // engine's thread pool.
+  bool run_callbacks_on_engine = false;
+  int busy_poll_us = 0;
   int dscp = kDscpNotSet;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
@@ -132,10 +173,17 @@ struct PosixTcpOptions {
     tcp_tx_zerocopy_max_simultaneous_sends =
         other.tcp_tx_zerocopy_max_simultaneous_sends;
     tcp_tx_zero_copy_enabled = other.tcp_tx_zero_copy_enabled;
+    tcp_tx_zerocopy_adaptive = other.tcp_tx_zerocopy_adaptive;
+    tcp_rx_zero_copy_enabled = other.tcp_rx_zero_copy_enabled;
+    tcp_rx_zerocopy_receive_bytes_threshold =
+        other.tcp_rx_zerocopy_receive_bytes_threshold;
     keep_alive_time_ms = other.keep_alive_time_ms;
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
+    listener_shards = other.listener_shards;
+    run_callbacks_on_engine = other.run_callbacks_on_engine;
+    busy_poll_us = other.busy_poll_us;
     dscp = other.dscp;
   }
 };
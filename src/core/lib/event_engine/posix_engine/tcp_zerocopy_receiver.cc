@@ -0,0 +1,132 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/tcp_zerocopy_receiver.h"
+
+#include <grpc/event_engine/slice.h>
+#include <grpc/slice.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <utility>
+
+#include "src/core/lib/slice/slice_refcount.h"
+#include "absl/log/log.h"
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+#include <sys/mman.h>  // IWYU pragma: keep
+#include <unistd.h>    // IWYU pragma: keep
+#endif  // GRPC_POSIX_SOCKET_TCP
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// Reference count for a slice of received data mapped by
+// TCP_ZEROCOPY_RECEIVE. Unmaps the pages when the slice is destroyed, which
+// lets the kernel reuse them for more packets, and only then gives their
+// bytes back to the memory quota.
+class ZerocopyReceiveSliceRefCount : public grpc_slice_refcount {
+ public:
+  ZerocopyReceiveSliceRefCount(void* mapping, size_t length,
+                               MemoryAllocator::Reservation reservation)
+      : grpc_slice_refcount(Destroy),
+        mapping_(mapping),
+        length_(length),
+        reservation_(std::move(reservation)) {}
+
+ private:
+  static void Destroy(grpc_slice_refcount* p) {
+    auto* rc = static_cast<ZerocopyReceiveSliceRefCount*>(p);
+#ifdef GRPC_POSIX_SOCKET_TCP
+    munmap(rc->mapping_, rc->length_);
+#endif  // GRPC_POSIX_SOCKET_TCP
+    // Releases the reservation.
+    delete rc;
+  }
+
+  void* const mapping_;
+  const size_t length_;
+  MemoryAllocator::Reservation reservation_;
+};
+
+Slice MakeZerocopyReceiveSlice(void* mapping, size_t length,
+                               MemoryAllocator& allocator) {
+  grpc_slice slice;
+  slice.refcount = new ZerocopyReceiveSliceRefCount(
+      mapping, length, allocator.MakeReservation(length));
+  slice.data.refcounted.bytes = static_cast<uint8_t*>(mapping);
+  slice.data.refcounted.length = length;
+  return Slice(slice);
+}
+
+}  // namespace
+
+void TcpZerocopyReceiver::Receive(size_t wanted, Socket& socket,
+                                  MemoryAllocator& allocator,
+                                  SliceBuffer& received) {
+#ifdef GRPC_POSIX_SOCKET_TCP
+  static const size_t kPageSize = sysconf(_SC_PAGESIZE);
+#else
+  constexpr size_t kPageSize = 4096;
+#endif  // GRPC_POSIX_SOCKET_TCP
+  const size_t start = received.Length();
+  size_t mapped = 0;
+  while (received.Length() - start < wanted) {
+    const size_t remaining = wanted - (received.Length() - start);
+    size_t length = std::min(remaining, kMaxReceiveBytes);
+    length -= length % kPageSize;
+    if (length == 0) {
+      // Less than a page to go: copy it.
+      break;
+    }
+    auto result = socket.ZerocopyReceive(length);
+    if (!result.ok()) {
+      // EIO means the peer closed the stream, which the caller reports.
+      if (result.IsPosixError() && !result.IsPosixError(EIO)) {
+        LOG(ERROR) << "Rx zero-copy will not be used by gRPC on this "
+                   << "endpoint: " << result.StrError();
+        enabled_ = false;
+      }
+      break;
+    }
+    if (result->mapped > 0) {
+      received.Append(
+          MakeZerocopyReceiveSlice(result->mapping, result->mapped, allocator));
+      mapped += result->mapped;
+    }
+    if (result->copy_hint == 0) {
+      // Nothing more is queued once the kernel maps less than was asked for.
+      if (result->mapped < length) break;
+      continue;
+    }
+    // Copy the bytes ahead of the next page that can be mapped, unless they
+    // are all this read still wants.
+    if (result->copy_hint >= remaining - result->mapped ||
+        !socket.CopyReceive(result->copy_hint, received)) {
+      break;
+    }
+  }
+  if (mapped > 0) {
+    unmapped_reads_ = 0;
+  } else if (enabled_ && ++unmapped_reads_ >= kMaxUnmappedReads) {
+    VLOG(2) << "Rx zero-copy mapped nothing in " << unmapped_reads_
+            << " reads; it will not be used by gRPC on this endpoint";
+    enabled_ = false;
+  }
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,91 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TCP_ZEROCOPY_RECEIVER_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TCP_ZEROCOPY_RECEIVER_H
+
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/event_engine/slice_buffer.h>
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+
+#include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+
+namespace grpc_event_engine::experimental {
+
+// Receives, for one endpoint, the data pending on its socket with
+// TCP_ZEROCOPY_RECEIVE: whole pages are mapped into slices that hold them
+// until released, and the unaligned runs the kernel cannot map are copied in
+// between.
+//
+// Mapped pages are charged to the endpoint's memory allocator until their
+// slices are released: the kernel accounted for them as socket buffer only
+// until they were mapped, and the application may hold them for much longer.
+//
+// Zero copy receive is turned off for good once the option fails with
+// anything but EIO (end of stream), or once kMaxUnmappedReads reads in a row
+// mapped nothing: on loopback, or on a NIC that does not split headers from
+// payloads, no page is ever mappable, and each attempt costs an mmap() and a
+// getsockopt() on top of the copy.
+//
+// Only the endpoint's reader uses it, so it is not thread safe.
+class TcpZerocopyReceiver {
+ public:
+  // Most bytes mapped by one TCP_ZEROCOPY_RECEIVE call.
+  static constexpr size_t kMaxReceiveBytes = 16 * 1024 * 1024;
+  // Reads in a row that may map nothing before zero copy receive is turned
+  // off.
+  static constexpr int kMaxUnmappedReads = 8;
+
+  // The socket that data is received from.
+  class Socket {
+   public:
+    virtual ~Socket() = default;
+    // As EventEnginePosixInterface::ZerocopyReceive().
+    virtual PosixErrorOr<EventEnginePosixInterface::ZerocopyReceiveResult>
+    ZerocopyReceive(size_t length) = 0;
+    // Copies `length` bytes off the socket into a new slice appended to
+    // `received`. Returns false if fewer could be read.
+    virtual bool CopyReceive(size_t length, SliceBuffer& received) = 0;
+  };
+
+  TcpZerocopyReceiver() = default;
+  // Receives with zero copy, if `enabled`, for reads that expect at least
+  // `threshold_bytes`.
+  TcpZerocopyReceiver(bool enabled, size_t threshold_bytes)
+      : enabled_(enabled), threshold_bytes_(threshold_bytes) {}
+
+  bool enabled() const { return enabled_; }
+  // Whether a read that expects `wanted` bytes should call Receive().
+  bool ShouldReceive(size_t wanted) const {
+    return enabled_ && wanted >= threshold_bytes_;
+  }
+
+  // Appends to `received` up to `wanted` bytes, or less if not that many are
+  // pending or if the rest is less than a page. Bytes left pending are for
+  // the caller to copy, and to report EAGAIN or EOF for.
+  void Receive(size_t wanted, Socket& socket, MemoryAllocator& allocator,
+               SliceBuffer& received);
+
+ private:
+  bool enabled_ = false;
+  size_t threshold_bytes_ = 0;
+  // Reads in a row that mapped nothing.
+  int unmapped_reads_ = 0;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TCP_ZEROCOPY_RECEIVER_H
@@ -0,0 +1,166 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/tcp_zerocopy_send_policy.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// Weight of a new sample in the moving averages.
+constexpr double kAlpha = 1.0 / 8;
+
+void UpdateAverage(double& average, double sample, bool first) {
+  average = first ? sample : average + kAlpha * (sample - average);
+}
+
+}  // namespace
+
+TcpZerocopySendPolicy::TcpZerocopySendPolicy(size_t threshold_bytes,
+                                             int max_sends,
+                                             int max_sends_limit)
+    : max_sends_limit_(std::max(max_sends_limit, 1)),
+      threshold_bytes_(threshold_bytes),
+      max_sends_(std::clamp(max_sends, 1, max_sends_limit_)) {}
+
+int TcpZerocopySendPolicy::SizeClassFor(size_t bytes) {
+  if (bytes < kMinBytes) return -1;
+  int size_class = 0;
+  for (size_t b = bytes / kMinBytes; b > 1 && size_class < kSizeClasses - 1;
+       b >>= 1) {
+    ++size_class;
+  }
+  return size_class;
+}
+
+bool TcpZerocopySendPolicy::ShouldZerocopy(size_t bytes) {
+  const int size_class = SizeClassFor(bytes);
+  if (size_class < 0) return false;
+  bool zerocopy = bytes > threshold_bytes();
+  grpc_core::MutexLock lock(&mu_);
+  if (++size_classes_[size_class].writes % kExploreInterval == 0) {
+    zerocopy = !zerocopy;
+  }
+  return zerocopy;
+}
+
+void TcpZerocopySendPolicy::RecordSend(bool zerocopy, size_t write_bytes,
+                                       size_t sent_bytes,
+                                       std::chrono::nanoseconds cost) {
+  const int size_class = SizeClassFor(write_bytes);
+  if (size_class < 0 || sent_bytes == 0) return;
+  const double ns_per_byte = static_cast<double>(cost.count()) / sent_bytes;
+  grpc_core::MutexLock lock(&mu_);
+  SizeClass& c = size_classes_[size_class];
+  if (zerocopy) {
+    UpdateAverage(c.zerocopy_ns_per_byte, ns_per_byte, c.zerocopy_samples == 0);
+    UpdateAverage(c.zerocopy_bytes_per_send, sent_bytes,
+                  c.zerocopy_samples == 0);
+    ++c.zerocopy_samples;
+  } else {
+    UpdateAverage(c.copy_ns_per_byte, ns_per_byte, c.copy_samples == 0);
+    ++c.copy_samples;
+  }
+  UpdateThresholdLocked();
+}
+
+void TcpZerocopySendPolicy::RecordCompletions(uint32_t sends, uint32_t copied,
+                                              std::chrono::nanoseconds cost) {
+  if (sends == 0) return;
+  grpc_core::MutexLock lock(&mu_);
+  UpdateAverage(completion_ns_per_send_,
+                static_cast<double>(cost.count()) / sends, false);
+  UpdateAverage(copied_fraction_, static_cast<double>(copied) / sends, false);
+}
+
+void TcpZerocopySendPolicy::RecordCompletionLatency(
+    std::chrono::nanoseconds latency) {
+  grpc_core::global_stats().IncrementTcpZerocopyCompletionLatency(
+      std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+  grpc_core::MutexLock lock(&mu_);
+  const bool first = min_latency_ns_ == 0;
+  UpdateAverage(latency_ns_, latency.count(), first);
+  if (first || latency_ns_ < min_latency_ns_) {
+    min_latency_ns_ = std::max(latency_ns_, 1.0);
+  }
+  // Cut at most once per window of sends, to let the cut take effect.
+  if (++completions_since_cut_ >= max_sends() &&
+      latency_ns_ > kLatencyGrowth * min_latency_ns_) {
+    completions_since_cut_ = 0;
+    SetMaxSendsLocked(max_sends() / 2);
+  }
+}
+
+void TcpZerocopySendPolicy::RecordSendsExhausted() {
+  grpc_core::MutexLock lock(&mu_);
+  SetMaxSendsLocked(max_sends() + 1);
+}
+
+void TcpZerocopySendPolicy::RecordNoBufs() {
+  grpc_core::MutexLock lock(&mu_);
+  SetMaxSendsLocked(max_sends() / 2);
+}
+
+double TcpZerocopySendPolicy::ZerocopyCostLocked(
+    const SizeClass& size_class) const {
+  return size_class.zerocopy_ns_per_byte +
+         completion_ns_per_send_ / size_class.zerocopy_bytes_per_send +
+         copied_fraction_ * size_class.copy_ns_per_byte;
+}
+
+void TcpZerocopySendPolicy::UpdateThresholdLocked() {
+  const size_t threshold = threshold_bytes();
+  // Walk down from the largest writes for as long as zerocopy is cheaper.
+  // Classes that are not measured yet keep zerocopy if the threshold gave it
+  // to them, and otherwise go whichever way the classes below them go.
+  int lowest = kSizeClasses;
+  bool measured = false;
+  for (int i = kSizeClasses - 1; i >= 0; --i) {
+    const SizeClass& c = size_classes_[i];
+    if (c.copy_samples < kMinSamples || c.zerocopy_samples < kMinSamples) {
+      if (SizeClassMinBytes(i) >= threshold) lowest = i;
+      continue;
+    }
+    measured = true;
+    if (ZerocopyCostLocked(c) >= c.copy_ns_per_byte) break;
+    lowest = i;
+  }
+  if (!measured) return;
+  const size_t new_threshold =
+      lowest == kSizeClasses ? kNever : SizeClassMinBytes(lowest) - 1;
+  if (new_threshold == threshold) return;
+  threshold_bytes_.store(new_threshold, std::memory_order_relaxed);
+  grpc_core::global_stats().IncrementTcpZerocopyThreshold(
+      std::min<size_t>(new_threshold, INT_MAX));
+}
+
+void TcpZerocopySendPolicy::SetMaxSendsLocked(int max_sends) {
+  max_sends = std::clamp(max_sends, 1, max_sends_limit_);
+  if (max_sends == max_sends_.load(std::memory_order_relaxed)) return;
+  max_sends_.store(max_sends, std::memory_order_relaxed);
+  grpc_core::global_stats().IncrementTcpZerocopyMaxSends(max_sends);
+}
+
+}  // namespace grpc_event_engine::experimental
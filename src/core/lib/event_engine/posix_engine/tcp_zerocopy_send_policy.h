@@ -0,0 +1,139 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TCP_ZEROCOPY_SEND_POLICY_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TCP_ZEROCOPY_SEND_POLICY_H
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "src/core/util/sync.h"
+#include "absl/base/thread_annotations.h"
+
+namespace grpc_event_engine::experimental {
+
+// Decides, for one endpoint, which writes are sent with MSG_ZEROCOPY and how
+// many of those may be in flight at once, from what its sends actually cost.
+//
+// Writes are grouped into size classes, each twice as large as the one below,
+// starting at kMinBytes. For each class the policy keeps moving averages of
+// the sendmsg() time per byte of copied and of zerocopy sends. A zerocopy
+// send also costs reading its completion off the error queue and, when the
+// kernel reports that it copied the data after all, that copy: both are
+// added to its cost. The threshold is the lowest size class from which
+// zerocopy stays the cheaper way up to the largest class measured. One write
+// in kExploreInterval of each class is sent the other way, so that both
+// costs stay measured.
+//
+// The number of zerocopy sends allowed in flight grows by one each time a
+// write that should have been zerocopy finds them all taken. It halves when
+// sendmsg() runs out of optmem (ENOBUFS), or when completions take several
+// times longer than they used to: the sends are then queueing behind the
+// network, and more of them would only pin more memory.
+//
+// Sends are recorded by the writer and completions by whichever thread reads
+// the error queue, so every method is thread safe.
+class TcpZerocopySendPolicy {
+ public:
+  // Writes smaller than this are always copied.
+  static constexpr size_t kMinBytes = 4 * 1024;
+  // Size classes from kMinBytes up: the last one holds writes of 16MB and up.
+  static constexpr int kSizeClasses = 13;
+  static constexpr int kExploreInterval = 32;
+  // Samples of both ways of sending a class needs before it is compared.
+  static constexpr int kMinSamples = 4;
+  // How many times the lowest completion latency seen the latency must reach
+  // for the sends in flight to be halved.
+  static constexpr int kLatencyGrowth = 4;
+  // threshold_bytes() when no write size is worth sending with zerocopy.
+  static constexpr size_t kNever = std::numeric_limits<size_t>::max();
+
+  // Starts by sending writes larger than `threshold_bytes` with zerocopy, up
+  // to `max_sends` of them at once, and never lets more than
+  // `max_sends_limit` be in flight.
+  TcpZerocopySendPolicy(size_t threshold_bytes, int max_sends,
+                        int max_sends_limit);
+
+  // Whether to send a write of `bytes` with MSG_ZEROCOPY.
+  bool ShouldZerocopy(size_t bytes);
+  // Zerocopy is used for writes larger than this, except when exploring.
+  size_t threshold_bytes() const {
+    return threshold_bytes_.load(std::memory_order_relaxed);
+  }
+  // Most zerocopy writes to have in flight.
+  int max_sends() const { return max_sends_.load(std::memory_order_relaxed); }
+
+  // A sendmsg() that sent `sent_bytes` of a write of `write_bytes` in `cost`.
+  void RecordSend(bool zerocopy, size_t write_bytes, size_t sent_bytes,
+                  std::chrono::nanoseconds cost);
+  // One read of the error queue that took `cost` and completed `sends`
+  // zerocopy sends, `copied` of which the kernel copied anyway.
+  void RecordCompletions(uint32_t sends, uint32_t copied,
+                         std::chrono::nanoseconds cost);
+  // The time from a zerocopy send to its completion.
+  void RecordCompletionLatency(std::chrono::nanoseconds latency);
+  // A write that should have been zerocopy was copied: max_sends() were in
+  // flight.
+  void RecordSendsExhausted();
+  // sendmsg() failed with ENOBUFS.
+  void RecordNoBufs();
+
+ private:
+  struct SizeClass {
+    // Nanoseconds per byte of copied and of zerocopy sendmsg() calls.
+    double copy_ns_per_byte = 0;
+    double zerocopy_ns_per_byte = 0;
+    // Bytes sent per zerocopy sendmsg(), over which the cost of reading its
+    // completion is spread.
+    double zerocopy_bytes_per_send = 0;
+    int copy_samples = 0;
+    int zerocopy_samples = 0;
+    uint32_t writes = 0;
+  };
+
+  // The size class of a write of `bytes`, or -1 if it is below kMinBytes.
+  static int SizeClassFor(size_t bytes);
+  static size_t SizeClassMinBytes(int size_class) {
+    return kMinBytes << size_class;
+  }
+
+  double ZerocopyCostLocked(const SizeClass& size_class) const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void UpdateThresholdLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void SetMaxSendsLocked(int max_sends) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const int max_sends_limit_;
+  std::atomic<size_t> threshold_bytes_;
+  std::atomic<int> max_sends_;
+  grpc_core::Mutex mu_;
+  SizeClass size_classes_[kSizeClasses] ABSL_GUARDED_BY(mu_);
+  // Nanoseconds spent reading the error queue per completed send.
+  double completion_ns_per_send_ ABSL_GUARDED_BY(mu_) = 0;
+  // Fraction of zerocopy sends the kernel copied anyway.
+  double copied_fraction_ ABSL_GUARDED_BY(mu_) = 0;
+  // Moving average of completion latencies, and the lowest it has been.
+  double latency_ns_ ABSL_GUARDED_BY(mu_) = 0;
+  double min_latency_ns_ ABSL_GUARDED_BY(mu_) = 0;
+  // Completions since max_sends_ was last cut because of latency.
+  int completions_since_cut_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TCP_ZEROCOPY_SEND_POLICY_H
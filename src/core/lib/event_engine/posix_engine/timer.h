@@ -42,6 +42,9 @@ struct Timer {
   // kInvalidHeapIndex if not in heap.
   size_t heap_index;
   bool pending;
+  // The TimerWheel shard and list holding this timer. Unused by TimerList.
+  uint16_t wheel_shard;
+  uint16_t wheel_list;
   struct Timer* next;
   struct Timer* prev;
   experimental::EventEngine::Closure* closure;
@@ -66,26 +69,24 @@ class TimerListHost {
   ~TimerListHost() = default;
 };
 
-class TimerList {
+// The set of pending timers owned by a TimerManager.
+class TimerListInterface {
  public:
-  explicit TimerList(TimerListHost* host);
-
-  TimerList(const TimerList&) = delete;
-  TimerList& operator=(const TimerList&) = delete;
+  virtual ~TimerListInterface() = default;
 
   // Initialize a Timer.
   // When expired, the closure will be run. If the timer is canceled, the
   // closure will not be run. Behavior is undefined for a deadline of
   // grpc_core::Timestamp::InfFuture().
-  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
-                 experimental::EventEngine::Closure* closure);
+  virtual void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                         experimental::EventEngine::Closure* closure) = 0;
 
   // Cancel a Timer.
   // Returns false if the timer cannot be canceled. This will happen if the
   // timer has already fired, or if its closure is currently running. The
   // closure is guaranteed to run eventually if this method returns false.
   // Otherwise, this returns true, and the closure will not be run.
-  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer);
+  GRPC_MUST_USE_RESULT virtual bool TimerCancel(Timer* timer) = 0;
 
   // Check for timers to be run, and return them.
   // Return nullopt if timers could not be checked due to contention with
@@ -93,11 +94,29 @@ class TimerList {
   // Return a vector of closures that *must* be run otherwise.
   // If next is non-null, TRY to update *next with the next running timer
   // IF that timer occurs before *next current value.
+  virtual std::optional<std::vector<experimental::EventEngine::Closure*>>
+  TimerCheck(grpc_core::Timestamp* next) = 0;
+};
+
+// Timers sharded by address, with the near-term timers of each shard kept in a
+// binary heap.
+class TimerList final : public TimerListInterface {
+ public:
+  explicit TimerList(TimerListHost* host);
+
+  TimerList(const TimerList&) = delete;
+  TimerList& operator=(const TimerList&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+
+  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer) override;
+
   // *next is never guaranteed to be updated on any given execution; however,
   // with high probability at least one thread in the system will see an update
   // at any time slice.
   std::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
-      grpc_core::Timestamp* next);
+      grpc_core::Timestamp* next) override;
 
  private:
   // A "timer shard". Contains a 'heap' and a 'list' of timers. All timers with
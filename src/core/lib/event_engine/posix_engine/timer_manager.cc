@@ -26,6 +26,7 @@
 #include <utility>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
 #include "src/core/util/grpc_check.h"
 #include "absl/log/log.h"
 #include "absl/time/time.h"
@@ -83,9 +84,17 @@ void TimerManager::MainLoop() {
 bool TimerManager::IsTimerManagerThread() { return g_timer_thread; }
 
 TimerManager::TimerManager(
-    std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool)
+    std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool,
+    TimerListKind timer_list_kind)
     : host_(this), thread_pool_(std::move(thread_pool)) {
-  timer_list_ = std::make_unique<TimerList>(&host_);
+  switch (timer_list_kind) {
+    case TimerListKind::kHeap:
+      timer_list_ = std::make_unique<TimerList>(&host_);
+      break;
+    case TimerListKind::kWheel:
+      timer_list_ = std::make_unique<TimerWheel>(&host_);
+      break;
+  }
   main_loop_exit_signal_.emplace();
   thread_pool_->Run([this]() { MainLoop(); });
 }
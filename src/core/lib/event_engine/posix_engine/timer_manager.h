@@ -36,6 +36,14 @@
 
 namespace grpc_event_engine::experimental {
 
+// The data structure a TimerManager keeps its pending timers in.
+enum class TimerListKind {
+  // Sharded binary heaps, see TimerList.
+  kHeap,
+  // Hierarchical timing wheels, see TimerWheel.
+  kWheel,
+};
+
 // Timer Manager tries to keep only one thread waiting for the next timeout at
 // all times, and thus effectively preventing the thundering herd problem.
 // TODO(ctiller): consider unifying this thread pool and the one in
@@ -43,7 +51,8 @@ namespace grpc_event_engine::experimental {
 class TimerManager final {
  public:
   explicit TimerManager(
-      std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool);
+      std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool,
+      TimerListKind timer_list_kind = TimerListKind::kHeap);
   ~TimerManager();
 
   grpc_core::Timestamp Now() { return host_.Now(); }
@@ -98,7 +107,7 @@ class TimerManager final {
   State state_ ABSL_GUARDED_BY(mu_) = State::kRunning;
   bool kicked_ ABSL_GUARDED_BY(mu_) = false;
   uint64_t wakeups_ ABSL_GUARDED_BY(mu_) = false;
-  std::unique_ptr<TimerList> timer_list_;
+  std::unique_ptr<TimerListInterface> timer_list_;
   std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool_;
   std::optional<grpc_core::Notification> main_loop_exit_signal_;
 };
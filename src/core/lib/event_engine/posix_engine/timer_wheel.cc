@@ -0,0 +1,238 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "absl/numeric/bits.h"
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+constexpr uint64_t kNoDeadline = std::numeric_limits<uint64_t>::max();
+
+uint64_t ToTick(grpc_core::Timestamp timestamp) {
+  return std::max<int64_t>(timestamp.milliseconds_after_process_epoch(), 0);
+}
+
+grpc_core::Timestamp FromTick(uint64_t tick) {
+  return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+      std::min<uint64_t>(tick, std::numeric_limits<int64_t>::max()));
+}
+
+}  // namespace
+
+void TimerWheel::Shard::Add(Timer* timer) {
+  const uint64_t deadline = std::max<int64_t>(timer->deadline, 0);
+  uint16_t index;
+  if (deadline <= now) {
+    index = kExpiredSlot;
+  } else if (const uint64_t diff = deadline ^ now; diff >> kWheelBits != 0) {
+    index = kOverflowSlot;
+  } else {
+    // The highest digit in which the deadline differs from now selects the
+    // level, and the deadline's digit on that level selects the slot. Since
+    // the deadline is later than now that slot is always ahead of the level's
+    // current position.
+    const int level = (absl::bit_width(diff) - 1) / kLevelBits;
+    const size_t slot = (deadline >> (level * kLevelBits)) & (kSlots - 1);
+    occupied[level] |= uint64_t{1} << slot;
+    index = level * kSlots + slot;
+  }
+  timer->wheel_list = index;
+  timer->prev = nullptr;
+  timer->next = lists[index];
+  if (timer->next != nullptr) timer->next->prev = timer;
+  lists[index] = timer;
+}
+
+void TimerWheel::Shard::Remove(Timer* timer) {
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+    return;
+  }
+  const uint16_t index = timer->wheel_list;
+  lists[index] = timer->next;
+  if (timer->next == nullptr && index < kExpiredSlot) {
+    occupied[index / kSlots] &= ~(uint64_t{1} << (index % kSlots));
+  }
+}
+
+Timer* TimerWheel::Shard::TakeList(uint16_t index) {
+  Timer* head = lists[index];
+  lists[index] = nullptr;
+  if (index < kExpiredSlot) {
+    occupied[index / kSlots] &= ~(uint64_t{1} << (index % kSlots));
+  }
+  return head;
+}
+
+uint64_t TimerWheel::Shard::NextEventTick() const {
+  // Slots on lower levels are always reached before those on higher levels,
+  // so the first occupied slot found bottom up is the next one due.
+  for (int level = 0; level < kLevels; ++level) {
+    const int shift = level * kLevelBits;
+    const size_t position = (now >> shift) & (kSlots - 1);
+    if (position == kSlots - 1) continue;
+    const uint64_t ahead = occupied[level] & (~uint64_t{0} << (position + 1));
+    if (ahead == 0) continue;
+    const uint64_t base = now >> (shift + kLevelBits) << (shift + kLevelBits);
+    return base | (static_cast<uint64_t>(absl::countr_zero(ahead)) << shift);
+  }
+  if (lists[kOverflowSlot] != nullptr) {
+    return ((now >> kWheelBits) + 1) << kWheelBits;
+  }
+  return kNoDeadline;
+}
+
+void TimerWheel::Shard::AdvanceTo(
+    uint64_t target, std::vector<experimental::EventEngine::Closure*>* out) {
+  // Jump straight from one slot boundary to the next rather than ticking
+  // through every millisecond, so that an idle wheel costs nothing to advance.
+  for (uint64_t tick = NextEventTick(); tick <= target; tick = NextEventTick()) {
+    now = tick;
+    if ((now & ((uint64_t{1} << kWheelBits) - 1)) == 0) {
+      Timer* timer = TakeList(kOverflowSlot);
+      while (timer != nullptr) {
+        Timer* next = timer->next;
+        Add(timer);
+        timer = next;
+      }
+    }
+    for (int level = kLevels - 1; level > 0; --level) {
+      const int shift = level * kLevelBits;
+      if ((now & ((uint64_t{1} << shift) - 1)) != 0) continue;
+      Timer* timer =
+          TakeList(level * kSlots + ((now >> shift) & (kSlots - 1)));
+      while (timer != nullptr) {
+        Timer* next = timer->next;
+        Add(timer);
+        timer = next;
+      }
+    }
+    Timer* timer = TakeList(now & (kSlots - 1));
+    while (timer != nullptr) {
+      timer->pending = false;
+      out->push_back(timer->closure);
+      timer = timer->next;
+    }
+  }
+  now = std::max(now, target);
+  Timer* timer = TakeList(kExpiredSlot);
+  while (timer != nullptr) {
+    timer->pending = false;
+    out->push_back(timer->closure);
+    timer = timer->next;
+  }
+}
+
+TimerWheel::TimerWheel(TimerListHost* host)
+    : host_(host),
+      shards_(grpc_core::PerCpuOptions().SetMaxShards(32)),
+      min_timer_(kNoDeadline) {
+  const uint64_t now = ToTick(host_->Now());
+  for (Shard& shard : shards_) {
+    grpc_core::MutexLock lock(&shard.mu);
+    shard.now = now;
+    shard.min_deadline.store(kNoDeadline, std::memory_order_relaxed);
+  }
+}
+
+void TimerWheel::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                           experimental::EventEngine::Closure* closure) {
+  Shard& shard = shards_.this_cpu();
+  timer->closure = closure;
+  timer->deadline = deadline.milliseconds_after_process_epoch();
+  timer->wheel_shard = &shard - shards_.begin();
+
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+
+  uint64_t tick = ToTick(deadline);
+  bool is_first_timer;
+  {
+    grpc_core::MutexLock lock(&shard.mu);
+    timer->pending = true;
+    shard.Add(timer);
+    tick = std::max(tick, shard.now);
+    is_first_timer =
+        tick < shard.min_deadline.load(std::memory_order_relaxed);
+    if (is_first_timer) {
+      shard.min_deadline.store(tick, std::memory_order_relaxed);
+    }
+  }
+
+  // TimerCheck recomputes min_timer_ from the shards under mu_, so holding
+  // mu_ here guarantees that either it sees the lowered shard deadline or we
+  // see the value it stored.
+  if (is_first_timer) {
+    grpc_core::MutexLock lock(&mu_);
+    if (tick < min_timer_.load(std::memory_order_relaxed)) {
+      min_timer_.store(tick, std::memory_order_relaxed);
+      host_->Kick();
+    }
+  }
+}
+
+bool TimerWheel::TimerCancel(Timer* timer) {
+  Shard& shard = shards_.begin()[timer->wheel_shard];
+  grpc_core::MutexLock lock(&shard.mu);
+  if (!timer->pending) return false;
+  timer->pending = false;
+  shard.Remove(timer);
+  return true;
+}
+
+std::optional<std::vector<experimental::EventEngine::Closure*>>
+TimerWheel::TimerCheck(grpc_core::Timestamp* next) {
+  grpc_core::Timestamp now = host_->Now();
+  grpc_core::Timestamp min_timer =
+      FromTick(min_timer_.load(std::memory_order_relaxed));
+  if (now < min_timer) {
+    if (next != nullptr) *next = std::min(*next, min_timer);
+    return std::vector<experimental::EventEngine::Closure*>();
+  }
+
+  if (!checker_mu_.TryLock()) return std::nullopt;
+  std::vector<experimental::EventEngine::Closure*> done;
+  const uint64_t tick = ToTick(now);
+  for (Shard& shard : shards_) {
+    grpc_core::MutexLock lock(&shard.mu);
+    shard.AdvanceTo(tick, &done);
+    shard.min_deadline.store(shard.NextEventTick(), std::memory_order_relaxed);
+  }
+  uint64_t min_deadline = kNoDeadline;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    for (Shard& shard : shards_) {
+      min_deadline = std::min(
+          min_deadline, shard.min_deadline.load(std::memory_order_relaxed));
+    }
+    min_timer_.store(min_deadline, std::memory_order_relaxed);
+  }
+  checker_mu_.Unlock();
+
+  if (next != nullptr) *next = std::min(*next, FromTick(min_deadline));
+  return std::move(done);
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,122 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/util/per_cpu.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/time.h"
+#include "absl/base/thread_annotations.h"
+
+namespace grpc_event_engine::experimental {
+
+// A hierarchical timing wheel with a resolution of one millisecond.
+//
+// Each shard holds kLevels wheels of kSlots slots, level N slots being
+// kSlots^N milliseconds wide. A timer sits in an intrusive list on the lowest
+// level able to represent the distance to its deadline, which makes TimerInit
+// and TimerCancel O(1) no matter how many timers are pending. As time advances
+// the slots of the upper levels are cascaded into the lower ones; timers that
+// are further out than the top level can represent are parked on an overflow
+// list that is re-examined each time the top level wraps around.
+//
+// Workloads dominated by timers that are cancelled long before they expire
+// (deadlines, keepalives, retries) never pay for those cascades, whereas the
+// heap in TimerList pays O(log n) for every add and cancel.
+//
+// Timers are added to the shard of the calling cpu so that concurrent calls to
+// TimerInit rarely contend for the same mutex.
+class TimerWheel final : public TimerListInterface {
+ public:
+  explicit TimerWheel(TimerListHost* host);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+
+  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer) override;
+
+  // *next is updated with the next time the wheel needs to be checked, which
+  // may be earlier than the earliest deadline when slots need to be cascaded.
+  std::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
+      grpc_core::Timestamp* next) override;
+
+ private:
+  static constexpr int kLevelBits = 6;
+  static constexpr size_t kSlots = size_t{1} << kLevelBits;
+  static constexpr int kLevels = 4;
+  // Ticks covered by the wheels. Further deadlines go to the overflow list.
+  static constexpr int kWheelBits = kLevelBits * kLevels;
+  // Pseudo slots for timers that are not on a wheel.
+  static constexpr uint16_t kExpiredSlot = kLevels * kSlots;
+  static constexpr uint16_t kOverflowSlot = kExpiredSlot + 1;
+  static constexpr size_t kNumLists = kOverflowSlot + 1;
+
+  struct Shard {
+    // Links timer into the list matching its deadline: a wheel slot, the
+    // expired list if it is already due, or the overflow list.
+    void Add(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    void Remove(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Unlinks and returns the whole list stored at index.
+    Timer* TakeList(uint16_t index) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Moves the wheel forward to tick target, appending the closures of all
+    // timers due by then to out.
+    void AdvanceTo(uint64_t target,
+                   std::vector<experimental::EventEngine::Closure*>* out)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+    // Returns the first tick after now at which a level 0 slot expires, a
+    // slot needs to be cascaded or the overflow list must be re-examined, or
+    // UINT64_MAX if the wheel is empty.
+    uint64_t NextEventTick() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu);
+
+    grpc_core::Mutex mu;
+    // The last tick the wheel has been advanced to. Timers in the wheel all
+    // have deadlines later than this.
+    uint64_t now ABSL_GUARDED_BY(mu) = 0;
+    // Bit i of occupied[level] is set iff slot i of that level is non-empty.
+    uint64_t occupied[kLevels] ABSL_GUARDED_BY(mu) = {};
+    // Heads of the nullptr terminated, doubly linked timer lists.
+    Timer* lists[kNumLists] ABSL_GUARDED_BY(mu) = {};
+    // The tick before which this shard needs no attention. Written under mu,
+    // read by TimerCheck under TimerWheel::mu_.
+    std::atomic<uint64_t> min_deadline{0};
+  };
+
+  TimerListHost* const host_;
+  grpc_core::PerCpu<Shard> shards_;
+  // Serializes updates of min_timer_.
+  grpc_core::Mutex mu_;
+  // The tick before which no shard needs attention.
+  std::atomic<uint64_t> min_timer_;
+  // Allow only one TimerCheck at once (used as a TryLock, protects no fields
+  // but ensures limits on concurrency)
+  grpc_core::Mutex checker_mu_;
+};
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
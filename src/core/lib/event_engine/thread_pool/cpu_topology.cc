@@ -0,0 +1,212 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/no_destruct.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+
+#ifdef GPR_LINUX
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif  // GPR_LINUX
+
+namespace grpc_event_engine::experimental {
+
+namespace {
+
+// One domain holding every CPU.
+CpuTopology SingleDomain() {
+  CpuTopology::Domain domain;
+  const int num_cores = static_cast<int>(gpr_cpu_num_cores());
+  for (int cpu = 0; cpu < num_cores; ++cpu) domain.cpus.push_back(cpu);
+  return CpuTopology({std::move(domain)});
+}
+
+#ifdef GPR_LINUX
+std::optional<std::string> ReadFile(const std::string& path) {
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) return std::nullopt;
+  std::string contents;
+  char buf[256];
+  ssize_t n;
+  while ((n = read(fd, buf, sizeof(buf))) > 0) contents.append(buf, n);
+  close(fd);
+  if (n < 0) return std::nullopt;
+  return contents;
+}
+
+std::vector<int> ReadList(const std::string& path) {
+  auto contents = ReadFile(path);
+  if (!contents.has_value()) return {};
+  return ParseCpuList(*contents);
+}
+
+// The lowest-numbered CPU sharing `cpu`'s last-level cache, or -1 if the
+// caches cannot be read, so that such CPUs are grouped by node alone.
+int LastLevelCacheId(absl::string_view root, int cpu) {
+  int best_level = -1;
+  int id = -1;
+  for (int index = 0;; ++index) {
+    const std::string cache =
+        absl::StrCat(root, "/cpu/cpu", cpu, "/cache/index", index);
+    auto level_str = ReadFile(absl::StrCat(cache, "/level"));
+    if (!level_str.has_value()) break;
+    int level;
+    if (!absl::SimpleAtoi(absl::StripAsciiWhitespace(*level_str), &level) ||
+        level <= best_level) {
+      continue;
+    }
+    std::vector<int> shared = ReadList(absl::StrCat(cache, "/shared_cpu_list"));
+    if (shared.empty()) continue;
+    best_level = level;
+    id = shared.front();
+  }
+  return id;
+}
+#endif  // GPR_LINUX
+
+}  // namespace
+
+std::vector<int> ParseCpuList(absl::string_view list) {
+  std::vector<int> cpus;
+  for (absl::string_view part :
+       absl::StrSplit(absl::StripAsciiWhitespace(list), ',')) {
+    const size_t dash = part.find('-');
+    int first;
+    int last;
+    if (!absl::SimpleAtoi(part.substr(0, dash), &first) || first < 0) continue;
+    if (dash == absl::string_view::npos) {
+      last = first;
+    } else if (!absl::SimpleAtoi(part.substr(dash + 1), &last) ||
+               last < first) {
+      continue;
+    }
+    for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+  }
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  return cpus;
+}
+
+const CpuTopology& CpuTopology::Get() {
+  static const grpc_core::NoDestruct<CpuTopology> topology(
+      FromSysfs("/sys/devices/system"));
+  return *topology;
+}
+
+CpuTopology CpuTopology::FromSysfs(absl::string_view root) {
+#ifdef GPR_LINUX
+  const std::vector<int> cpus = ReadList(absl::StrCat(root, "/cpu/online"));
+  if (cpus.empty()) return SingleDomain();
+  std::map<int, int> node_of_cpu;
+  for (int node : ReadList(absl::StrCat(root, "/node/online"))) {
+    for (int cpu :
+         ReadList(absl::StrCat(root, "/node/node", node, "/cpulist"))) {
+      node_of_cpu[cpu] = node;
+    }
+  }
+  // Keyed by node and last-level cache, so domains come out in node order.
+  std::map<std::pair<int, int>, Domain> domains;
+  for (int cpu : cpus) {
+    auto it = node_of_cpu.find(cpu);
+    const int node = it == node_of_cpu.end() ? 0 : it->second;
+    Domain& domain = domains[{node, LastLevelCacheId(root, cpu)}];
+    domain.node = node;
+    domain.cpus.push_back(cpu);
+  }
+  std::vector<Domain> result;
+  result.reserve(domains.size());
+  for (auto& [key, domain] : domains) result.push_back(std::move(domain));
+  return CpuTopology(std::move(result));
+#else   // GPR_LINUX
+  (void)root;
+  return SingleDomain();
+#endif  // GPR_LINUX
+}
+
+CpuTopology::CpuTopology(std::vector<Domain> domains)
+    : domains_(std::move(domains)) {
+  GRPC_CHECK(!domains_.empty());
+  const size_t n = domains_.size();
+  neighbors_.resize(n);
+  for (size_t d = 0; d < n; ++d) {
+    neighbors_[d].push_back(d);
+    // Start each domain's search past itself, so that domains with nothing to
+    // do spread over the others rather than all trying the same one first.
+    for (size_t i = 1; i < n; ++i) {
+      const size_t other = (d + i) % n;
+      if (SameNode(d, other)) neighbors_[d].push_back(other);
+    }
+    for (size_t i = 1; i < n; ++i) {
+      const size_t other = (d + i) % n;
+      if (!SameNode(d, other)) neighbors_[d].push_back(other);
+    }
+    for (int cpu : domains_[d].cpus) {
+      if (cpu < 0) continue;
+      if (static_cast<size_t>(cpu) >= domain_of_cpu_.size()) {
+        domain_of_cpu_.resize(cpu + 1, 0);
+      }
+      domain_of_cpu_[cpu] = d;
+    }
+  }
+}
+
+size_t CpuTopology::DomainOfCpu(int cpu) const {
+  if (cpu < 0 || static_cast<size_t>(cpu) >= domain_of_cpu_.size()) return 0;
+  return domain_of_cpu_[cpu];
+}
+
+size_t CpuTopology::CurrentDomain() const {
+  if (domains_.size() == 1) return 0;
+#ifdef GPR_LINUX
+  return DomainOfCpu(sched_getcpu());
+#else   // GPR_LINUX
+  return 0;
+#endif  // GPR_LINUX
+}
+
+bool CpuTopology::PinCurrentThread(size_t domain) const {
+#ifdef GPR_LINUX
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  for (int cpu : domains_[domain].cpus) {
+    if (cpu < CPU_SETSIZE) CPU_SET(cpu, &cpus);
+  }
+  if (CPU_COUNT(&cpus) == 0) return false;
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#else   // GPR_LINUX
+  (void)domain;
+  return false;
+#endif  // GPR_LINUX
+}
+
+}  // namespace grpc_event_engine::experimental
@@ -0,0 +1,79 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_CPU_TOPOLOGY_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_CPU_TOPOLOGY_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+
+#include <vector>
+
+#include "absl/strings/string_view.h"
+
+namespace grpc_event_engine::experimental {
+
+// The CPUs of the machine, grouped into domains of CPUs that share a NUMA node
+// and a last-level cache. Moving work between two CPUs of a domain is cheap;
+// moving it to another node means pulling its memory across the interconnect.
+class CpuTopology {
+ public:
+  struct Domain {
+    int node = 0;
+    // Sorted CPU numbers.
+    std::vector<int> cpus;
+  };
+
+  // The topology of this machine, read from /sys/devices/system once. Where
+  // that cannot be read, all CPUs form a single domain.
+  static const CpuTopology& Get();
+  // Reads the topology from a sysfs tree laid out like /sys/devices/system.
+  static CpuTopology FromSysfs(absl::string_view root);
+
+  // `domains` must not be empty.
+  explicit CpuTopology(std::vector<Domain> domains);
+
+  const std::vector<Domain>& domains() const { return domains_; }
+  size_t num_domains() const { return domains_.size(); }
+  bool SameNode(size_t a, size_t b) const {
+    return domains_[a].node == domains_[b].node;
+  }
+  // All domains in the order to look for work from `domain`: itself first,
+  // then the others on its node, then those of other nodes.
+  const std::vector<size_t>& NeighborsOf(size_t domain) const {
+    return neighbors_[domain];
+  }
+  // The domain of `cpu`, or 0 if it is not known.
+  size_t DomainOfCpu(int cpu) const;
+  // The domain of the CPU the calling thread is running on, or 0 if that
+  // cannot be told.
+  size_t CurrentDomain() const;
+  // Restricts the calling thread to the CPUs of `domain`. Returns false if
+  // that is not supported or failed.
+  bool PinCurrentThread(size_t domain) const;
+
+ private:
+  std::vector<Domain> domains_;
+  std::vector<std::vector<size_t>> neighbors_;
+  // Indexed by CPU number.
+  std::vector<size_t> domain_of_cpu_;
+};
+
+// Parses a sysfs CPU or node list such as "0-3,8,10-11". Malformed parts are
+// skipped.
+std::vector<int> ParseCpuList(absl::string_view list);
+
+}  // namespace grpc_event_engine::experimental
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_THREAD_POOL_CPU_TOPOLOGY_H
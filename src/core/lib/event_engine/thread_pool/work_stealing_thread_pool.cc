@@ -31,8 +31,11 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_local.h"
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/backoff.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/env.h"
@@ -94,6 +97,19 @@
 // `lifeguard_thread_.Join()` leads to memory access errors. This implementation
 // uses Notifications to coordinate startup and shutdown states.
 //
+// ## CPU topology
+//
+// Threads are spread round-robin over the CPU domains of the pool's
+// CpuTopology: groups of CPUs that share a NUMA node and a last-level cache.
+// Each domain has its own queue for closures run from outside the pool, its
+// own group of stealable thread queues, and its own work signal. A thread
+// looks for work in its own domain, then in the others of its node, and only
+// then across nodes; a Run() from outside the pool wakes a thread of the
+// calling CPU's domain if one is idle. Set the environment variable
+// GRPC_THREAD_POOL_PIN_THREADS=anything to also restrict each thread to the
+// CPUs of its domain. On machines with a single domain this all reduces to
+// one global queue and one group of thread queues.
+//
 // ## Debugging
 //
 // Set the environment variable GRPC_THREAD_POOL_VERBOSE_FAILURES=anything to
@@ -148,6 +164,9 @@ constexpr bool g_log_verbose_failures = false;
 constexpr int kDumpStackSignal = -1;
 #endif
 
+const bool g_pin_threads =
+    grpc_core::GetEnv("GRPC_THREAD_POOL_PIN_THREADS").has_value();
+
 std::atomic<size_t> g_reported_dump_count{0};
 
 void DumpSignalHandler(int /* sig */) {
@@ -162,14 +181,32 @@ void DumpSignalHandler(int /* sig */) {
   grpc_core::Thread::Kill(gpr_thd_currentid());
 }
 
+// Counts a closure that a thread of `domain` took from another thread, or from
+// the queue of domain `from`.
+void CountSteal(const CpuTopology& topology, size_t domain, size_t from) {
+  grpc_core::global_stats().IncrementThreadPoolSteals();
+  if (!topology.SameNode(domain, from)) {
+    grpc_core::global_stats().IncrementThreadPoolCrossNodeSteals();
+  }
+}
+
 }  // namespace
 
 thread_local WorkQueue* g_local_queue = nullptr;
+// The CPU domain of the pool thread g_local_queue belongs to.
+thread_local size_t g_local_domain = 0;
 
 // -------- WorkStealingThreadPool --------
 
 WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads)
-    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(reserve_threads)} {
+    : WorkStealingThreadPool(reserve_threads, CpuTopology::Get(),
+                             g_pin_threads) {}
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads,
+                                               const CpuTopology& topology,
+                                               bool pin_threads)
+    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(
+          reserve_threads, topology, pin_threads)} {
   if (g_log_verbose_failures) {
     GRPC_TRACE_LOG(event_engine, INFO)
         << "WorkStealingThreadPool verbose failures are enabled";
@@ -193,22 +230,34 @@ void WorkStealingThreadPool::Run(EventEngine::Closure* closure) {
 
 // -------- WorkStealingThreadPool::TheftRegistry --------
 
-void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue) {
-  grpc_core::MutexLock lock(&mu_);
-  queues_.emplace(queue);
+WorkStealingThreadPool::TheftRegistry::TheftRegistry(
+    const CpuTopology* topology)
+    : topology_(topology), domains_(topology->num_domains()) {}
+
+void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue,
+                                                   size_t domain) {
+  grpc_core::MutexLock lock(&domains_[domain].mu);
+  domains_[domain].queues.emplace(queue);
 }
 
-void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue) {
-  grpc_core::MutexLock lock(&mu_);
-  queues_.erase(queue);
+void WorkStealingThreadPool::TheftRegistry::Unenroll(WorkQueue* queue,
+                                                     size_t domain) {
+  grpc_core::MutexLock lock(&domains_[domain].mu);
+  domains_[domain].queues.erase(queue);
 }
 
-EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne() {
-  grpc_core::MutexLock lock(&mu_);
+EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne(
+    size_t domain) {
   EventEngine::Closure* closure;
-  for (auto* queue : queues_) {
-    closure = queue->PopMostRecent();
-    if (closure != nullptr) return closure;
+  for (size_t from : topology_->NeighborsOf(domain)) {
+    grpc_core::MutexLock lock(&domains_[from].mu);
+    for (auto* queue : domains_[from].queues) {
+      closure = queue->PopMostRecent();
+      if (closure != nullptr) {
+        CountSteal(*topology_, domain, from);
+        return closure;
+      }
+    }
   }
   return nullptr;
 }
@@ -224,8 +273,16 @@ void WorkStealingThreadPool::PostFork() { pool_->Postfork(); }
 // -------- WorkStealingThreadPool::WorkStealingThreadPoolImpl --------
 
 WorkStealingThreadPool::WorkStealingThreadPoolImpl::WorkStealingThreadPoolImpl(
-    size_t reserve_threads)
-    : reserve_threads_(reserve_threads), queue_(this) {}
+    size_t reserve_threads, const CpuTopology& topology, bool pin_threads)
+    : reserve_threads_(reserve_threads),
+      topology_(topology),
+      pin_threads_(pin_threads),
+      theft_registry_(&topology_) {
+  domains_.reserve(topology_.num_domains());
+  for (size_t i = 0; i < topology_.num_domains(); ++i) {
+    domains_.push_back(std::make_unique<Domain>(this));
+  }
+}
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
   for (size_t i = 0; i < reserve_threads_; i++) {
@@ -238,14 +295,55 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Run(
     EventEngine::Closure* closure) {
   GRPC_CHECK(!IsQuiesced());
+  size_t domain;
   if (g_local_queue != nullptr && g_local_queue->owner() == this) {
     g_local_queue->Add(closure);
+    domain = g_local_domain;
   } else {
-    queue_.Add(closure);
+    domain = topology_.CurrentDomain();
+    domains_[domain]->queue.Add(closure);
   }
   // Signal a worker in any case, even if work was added to a local queue. This
   // improves performance on 32-core streaming benchmarks with small payloads.
-  work_signal_.Signal();
+  Signal(domain);
+}
+
+size_t WorkStealingThreadPool::WorkStealingThreadPoolImpl::NextThreadDomain() {
+  return next_thread_domain_.fetch_add(1, std::memory_order_relaxed) %
+         domains_.size();
+}
+
+EventEngine::Closure*
+WorkStealingThreadPool::WorkStealingThreadPoolImpl::PopQueued(size_t domain) {
+  for (size_t from : topology_.NeighborsOf(domain)) {
+    // TODO(hork): consider an empty check for performance wins. Depends on the
+    // queue implementation, the BasicWorkQueue takes two locks when you do an
+    // empty check then pop.
+    EventEngine::Closure* closure = domains_[from]->queue.PopMostRecent();
+    if (closure != nullptr) {
+      if (from != domain) CountSteal(topology_, domain, from);
+      return closure;
+    }
+  }
+  return nullptr;
+}
+
+bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::QueuesEmpty() {
+  for (const auto& domain : domains_) {
+    if (!domain->queue.Empty()) return false;
+  }
+  return true;
+}
+
+void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Signal(
+    size_t domain) {
+  for (size_t to : topology_.NeighborsOf(domain)) {
+    if (domains_[to]->work_signal.Signal()) return;
+  }
+}
+
+void WorkStealingThreadPool::WorkStealingThreadPoolImpl::SignalAll() {
+  for (const auto& domain : domains_) domain->work_signal.SignalAll();
 }
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::StartThread() {
@@ -271,7 +369,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Quiesce() {
   // until all other threads have exited, so we need to wait for just one thread
   // running instead of zero.
   bool is_threadpool_thread = g_local_queue != nullptr;
-  work_signal()->SignalAll();
+  SignalAll();
   auto threads_were_shut_down = living_thread_count_.BlockUntilThreadCount(
       is_threadpool_thread ? 1 : 0, "shutting down",
       g_log_verbose_failures ? kBlockUntilThreadCountTimeout
@@ -279,7 +377,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Quiesce() {
   if (!threads_were_shut_down.ok() && g_log_verbose_failures) {
     DumpStacksAndCrash();
   }
-  GRPC_CHECK(queue_.Empty());
+  GRPC_CHECK(QueuesEmpty());
   quiesced_.store(true, std::memory_order_relaxed);
   grpc_core::MutexLock lock(&lifeguard_ptr_mu_);
   lifeguard_.reset();
@@ -294,7 +392,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::SetShutdown(
     bool is_shutdown) {
   auto was_shutdown = shutdown_.exchange(is_shutdown);
   GRPC_CHECK(is_shutdown != was_shutdown);
-  work_signal_.SignalAll();
+  SignalAll();
 }
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::SetForking(
@@ -319,7 +417,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::PrepareFork() {
   GRPC_TRACE_LOG(event_engine, INFO)
       << "WorkStealingThreadPoolImpl::PrepareFork";
   SetForking(true);
-  work_signal_.SignalAll();
+  SignalAll();
   auto threads_were_shut_down = living_thread_count_.BlockUntilThreadCount(
       0, "forking", kBlockUntilThreadCountTimeout);
   if (!threads_were_shut_down.ok() && g_log_verbose_failures) {
@@ -403,7 +501,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
         backoff_.Reset();
       }
       // Sleep for a bit.
-      pool_->work_signal()->WaitWithTimeout(backoff_.NextAttemptDelay());
+      pool_->work_signal(0)->WaitWithTimeout(backoff_.NextAttemptDelay());
       continue;
     }
     lifeguard_should_shut_down_->WaitForNotificationWithTimeout(
@@ -439,9 +537,11 @@ bool WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
   const auto living_thread_count = pool_->living_thread_count()->count();
   // Wake an idle worker thread if there's global work to be had.
   if (pool_->busy_thread_count()->count() < living_thread_count) {
-    if (!pool_->queue_.Empty()) {
-      pool_->work_signal()->Signal();
-      backoff_.Reset();
+    for (size_t domain = 0; domain < pool_->domains_.size(); ++domain) {
+      if (!pool_->domains_[domain]->queue.Empty()) {
+        pool_->Signal(domain);
+        backoff_.Reset();
+      }
     }
     // Idle threads will eventually wake up for an attempt at work stealing.
     return false;
@@ -480,7 +580,8 @@ WorkStealingThreadPool::ThreadState::ThreadState(
                    .set_initial_backoff(kWorkerThreadMinSleepBetweenChecks)
                    .set_max_backoff(kWorkerThreadMaxSleepBetweenChecks)
                    .set_multiplier(1.3)),
-      busy_count_idx_(pool_->busy_thread_count()->NextIndex()) {}
+      busy_count_idx_(pool_->busy_thread_count()->NextIndex()),
+      domain_(pool_->NextThreadDomain()) {}
 
 void WorkStealingThreadPool::ThreadState::ThreadBody() {
   if (g_log_verbose_failures) {
@@ -491,8 +592,12 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
 #endif
     pool_->TrackThread(gpr_thd_currentid());
   }
+  if (pool_->pin_threads() && !pool_->topology().PinCurrentThread(domain_)) {
+    LOG_FIRST_N(ERROR, 1) << "Could not pin thread pool threads to CPUs";
+  }
   g_local_queue = new BasicWorkQueue(pool_.get());
-  pool_->theft_registry()->Enroll(g_local_queue);
+  g_local_domain = domain_;
+  pool_->theft_registry()->Enroll(g_local_queue, domain_);
   ThreadLocal::SetIsEventEngineThread(true);
   while (Step()) {
     // loop until the thread should no longer run
@@ -504,14 +609,14 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
     while (!g_local_queue->Empty()) {
       closure = g_local_queue->PopMostRecent();
       if (closure != nullptr) {
-        pool_->queue()->Add(closure);
+        pool_->queue(domain_)->Add(closure);
       }
     }
   } else if (pool_->IsShutdown()) {
     FinishDraining();
   }
   GRPC_CHECK(g_local_queue->Empty());
-  pool_->theft_registry()->Unenroll(g_local_queue);
+  pool_->theft_registry()->Unenroll(g_local_queue, domain_);
   delete g_local_queue;
   if (g_log_verbose_failures) {
     pool_->UntrackThread(gpr_thd_currentid());
@@ -543,17 +648,14 @@ bool WorkStealingThreadPool::ThreadState::Step() {
   auto start_time = std::chrono::steady_clock::now();
   // Wait until work is available or until shut down.
   while (!pool_->IsForking()) {
-    // Pull from the global queue next
-    // TODO(hork): consider an empty check for performance wins. Depends on the
-    // queue implementation, the BasicWorkQueue takes two locks when you do an
-    // empty check then pop.
-    closure = pool_->queue()->PopMostRecent();
+    // Pull from the domains' queues next, starting with this thread's.
+    closure = pool_->PopQueued(domain_);
     if (closure != nullptr) {
       should_run_again = true;
       break;
     };
-    // Try stealing if the queue is empty
-    closure = pool_->theft_registry()->StealOne();
+    // Try stealing if the queues are empty
+    closure = pool_->theft_registry()->StealOne(domain_);
     if (closure != nullptr) {
       should_run_again = true;
       break;
@@ -561,8 +663,8 @@ bool WorkStealingThreadPool::ThreadState::Step() {
     // No closures were retrieved from anywhere.
     // Quit the thread if the pool has been shut down.
     if (pool_->IsShutdown()) break;
-    bool timed_out =
-        pool_->work_signal()->WaitWithTimeout(backoff_.NextAttemptDelay());
+    bool timed_out = pool_->work_signal(domain_)->WaitWithTimeout(
+        backoff_.NextAttemptDelay());
     if (pool_->IsForking() || pool_->IsShutdown()) break;
     // Quit a thread if the pool has more than it requires, and this thread
     // has been idle long enough.
@@ -600,8 +702,8 @@ void WorkStealingThreadPool::ThreadState::FinishDraining() {
       }
       continue;
     }
-    if (!pool_->queue()->Empty()) {
-      auto* closure = pool_->queue()->PopMostRecent();
+    if (!pool_->QueuesEmpty()) {
+      auto* closure = pool_->PopQueued(domain_);
       if (closure != nullptr) {
         closure->Run();
       }
@@ -613,9 +715,10 @@ void WorkStealingThreadPool::ThreadState::FinishDraining() {
 
 // -------- WorkStealingThreadPool::WorkSignal --------
 
-void WorkStealingThreadPool::WorkSignal::Signal() {
+bool WorkStealingThreadPool::WorkSignal::Signal() {
   grpc_core::MutexLock lock(&mu_);
   cv_.Signal();
+  return waiters_ > 0;
 }
 
 void WorkStealingThreadPool::WorkSignal::SignalAll() {
@@ -626,7 +729,11 @@ void WorkStealingThreadPool::WorkSignal::SignalAll() {
 bool WorkStealingThreadPool::WorkSignal::WaitWithTimeout(
     grpc_core::Duration time) {
   grpc_core::MutexLock lock(&mu_);
-  return cv_.WaitWithTimeout(&mu_, absl::Milliseconds(time.millis()));
+  ++waiters_;
+  const bool timed_out =
+      cv_.WaitWithTimeout(&mu_, absl::Milliseconds(time.millis()));
+  --waiters_;
+  return timed_out;
 }
 
 }  // namespace grpc_event_engine::experimental
@@ -26,7 +26,9 @@
 
 #include <atomic>
 #include <memory>
+#include <vector>
 
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
@@ -41,9 +43,19 @@
 
 namespace grpc_event_engine::experimental {
 
+// Worker threads are spread over the CPU domains of `topology` (see
+// CpuTopology), and each looks for work in its own domain first, then in the
+// rest of its NUMA node, and only then on other nodes. Closures run from a
+// pool thread go to that thread's queue, and those run from other threads go
+// to the queue of the domain of the CPU they were run from, so work stays on
+// the node that produced it unless that node's threads are all busy.
 class WorkStealingThreadPool final : public ThreadPool {
  public:
+  // Uses the machine's topology, and pins threads to their domain's CPUs if
+  // the GRPC_THREAD_POOL_PIN_THREADS environment variable is set.
   explicit WorkStealingThreadPool(size_t reserve_threads);
+  WorkStealingThreadPool(size_t reserve_threads, const CpuTopology& topology,
+                         bool pin_threads);
   // Asserts Quiesce was called.
   ~WorkStealingThreadPool() override;
   // Shut down the pool, and wait for all threads to exit.
@@ -65,7 +77,8 @@ class WorkStealingThreadPool final : public ThreadPool {
   // available.
   class WorkSignal {
    public:
-    void Signal();
+    // Returns whether any thread was waiting.
+    bool Signal();
     void SignalAll();
     // Returns whether a timeout occurred.
     bool WaitWithTimeout(grpc_core::Duration time);
@@ -73,26 +86,34 @@ class WorkStealingThreadPool final : public ThreadPool {
    private:
     grpc_core::Mutex mu_;
     grpc_core::CondVar cv_ ABSL_GUARDED_BY(mu_);
+    int waiters_ ABSL_GUARDED_BY(mu_) = 0;
   };
 
   // A pool of WorkQueues that participate in work stealing.
   //
   // Every worker thread registers and unregisters its thread-local thread pool
-  // here, and steals closures from other threads when work is otherwise
-  // unavailable.
+  // here, under the CPU domain it runs in, and steals closures from other
+  // threads when work is otherwise unavailable.
   class TheftRegistry {
    public:
+    explicit TheftRegistry(const CpuTopology* topology);
     // Allow any member of the registry to steal from the provided queue.
-    void Enroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    void Enroll(WorkQueue* queue, size_t domain);
     // Disallow work stealing from the provided queue.
-    void Unenroll(WorkQueue* queue) ABSL_LOCKS_EXCLUDED(mu_);
+    void Unenroll(WorkQueue* queue, size_t domain);
     // Returns one closure from another thread, or nullptr if none are
-    // available.
-    EventEngine::Closure* StealOne() ABSL_LOCKS_EXCLUDED(mu_);
+    // available. Threads in the thief's `domain` are robbed first, then
+    // those of its NUMA node.
+    EventEngine::Closure* StealOne(size_t domain);
 
    private:
-    grpc_core::Mutex mu_;
-    absl::flat_hash_set<WorkQueue*> queues_ ABSL_GUARDED_BY(mu_);
+    struct Domain {
+      grpc_core::Mutex mu;
+      absl::flat_hash_set<WorkQueue*> queues ABSL_GUARDED_BY(mu);
+    };
+
+    const CpuTopology* const topology_;
+    std::vector<Domain> domains_;
   };
 
   // An implementation of the ThreadPool
@@ -102,11 +123,12 @@ class WorkStealingThreadPool final : public ThreadPool {
   class WorkStealingThreadPoolImpl
       : public std::enable_shared_from_this<WorkStealingThreadPoolImpl> {
    public:
-    explicit WorkStealingThreadPoolImpl(size_t reserve_threads);
+    WorkStealingThreadPoolImpl(size_t reserve_threads,
+                               const CpuTopology& topology, bool pin_threads);
     // Start all threads.
     void Start();
     // Add a closure to a work queue, preferably a thread-local queue if
-    // available, otherwise the global queue.
+    // available, otherwise the queue of the calling CPU's domain.
     void Run(EventEngine::Closure* closure);
     // Start a new thread.
     // The reason argument determines whether thread creation is rate-limited;
@@ -133,16 +155,30 @@ class WorkStealingThreadPool final : public ThreadPool {
     // Thread ID tracking
     void TrackThread(gpr_thd_id tid);
     void UntrackThread(gpr_thd_id tid);
+    // The domain the next thread started should run in.
+    size_t NextThreadDomain();
+    // Returns a closure from the domains' queues, looking in `domain`'s first,
+    // or nullptr if none are available.
+    EventEngine::Closure* PopQueued(size_t domain);
+    bool QueuesEmpty();
+    // Wakes a thread of `domain`, or failing that, one of the closest domain
+    // that has a thread waiting.
+    void Signal(size_t domain);
+    void SignalAll();
     // Accessor methods
     bool IsShutdown();
     bool IsForking();
     bool IsQuiesced();
     size_t reserve_threads() { return reserve_threads_; }
+    const CpuTopology& topology() { return topology_; }
+    bool pin_threads() { return pin_threads_; }
     BusyThreadCount* busy_thread_count() { return &busy_thread_count_; }
     LivingThreadCount* living_thread_count() { return &living_thread_count_; }
     TheftRegistry* theft_registry() { return &theft_registry_; }
-    WorkQueue* queue() { return &queue_; }
-    WorkSignal* work_signal() { return &work_signal_; }
+    WorkQueue* queue(size_t domain) { return &domains_[domain]->queue; }
+    WorkSignal* work_signal(size_t domain) {
+      return &domains_[domain]->work_signal;
+    }
 
    private:
     // Lifeguard monitors the pool and keeps it healthy.
@@ -170,13 +206,24 @@ class WorkStealingThreadPool final : public ThreadPool {
       std::atomic<bool> lifeguard_running_{false};
     };
 
+    // Closures run from threads outside the pool on a domain's CPUs, and the
+    // signal its threads wait on.
+    struct Domain {
+      explicit Domain(void* owner) : queue(owner) {}
+      BasicWorkQueue queue;
+      WorkSignal work_signal;
+    };
+
     void DumpStacksAndCrash();
 
     const size_t reserve_threads_;
+    const CpuTopology topology_;
+    const bool pin_threads_;
     BusyThreadCount busy_thread_count_;
     LivingThreadCount living_thread_count_;
     TheftRegistry theft_registry_;
-    BasicWorkQueue queue_;
+    std::vector<std::unique_ptr<Domain>> domains_;
+    std::atomic<size_t> next_thread_domain_{0};
     // Track shutdown and fork bits separately.
     // It's possible for a ThreadPool to initiate shut down while fork handlers
     // are running, and similarly possible for a fork event to occur during
@@ -188,7 +235,6 @@ class WorkStealingThreadPool final : public ThreadPool {
     // After pool creation we use this to rate limit creation of threads to one
     // at a time.
     std::atomic<bool> throttled_{false};
-    WorkSignal work_signal_;
     grpc_core::Mutex lifeguard_ptr_mu_;
     std::unique_ptr<Lifeguard> lifeguard_ ABSL_GUARDED_BY(lifeguard_ptr_mu_);
     // Set of threads for verbose failure debugging
@@ -216,6 +262,8 @@ class WorkStealingThreadPool final : public ThreadPool {
     LivingThreadCount::AutoThreadCounter auto_thread_counter_;
     grpc_core::BackOff backoff_;
     size_t busy_count_idx_;
+    // The CPU domain this thread belongs to.
+    const size_t domain_;
   };
 
   const std::shared_ptr<WorkStealingThreadPoolImpl> pool_;
@@ -102,6 +102,11 @@
 #ifndef GRPC_LINUX_EVENTFD
 #define GRPC_POSIX_NO_SPECIAL_WAKEUP_FD 1
 #endif
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define GRPC_LINUX_IO_URING 1
+#endif
+#endif
 #ifndef GRPC_LINUX_SOCKETUTILS
 #define GRPC_POSIX_SOCKETUTILS
 #endif
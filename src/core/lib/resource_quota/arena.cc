@@ -31,12 +31,7 @@ namespace grpc_core {
 
 namespace {
 
-void* ArenaStorage(size_t& initial_size) {
-  size_t base_size = Arena::ArenaOverhead() +
-                     GPR_ROUND_UP_TO_ALIGNMENT_SIZE(
-                         arena_detail::BaseArenaContextTraits::ContextSize());
-  initial_size =
-      std::max(GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size), base_size);
+void* ArenaStorage(size_t initial_size) {
   static constexpr size_t alignment =
       (GPR_CACHELINE_SIZE > GPR_MAX_ALIGNMENT &&
        GPR_CACHELINE_SIZE % GPR_MAX_ALIGNMENT == 0)
@@ -48,14 +43,6 @@ void* ArenaStorage(size_t& initial_size) {
 }  // namespace
 
 Arena::~Arena() {
-  for (size_t i = 0; i < arena_detail::BaseArenaContextTraits::NumContexts();
-       ++i) {
-    arena_detail::BaseArenaContextTraits::Destroy(i, contexts()[i]);
-  }
-  DestroyManagedNewObjects();
-  arena_factory_->FinalizeArena(this);
-  arena_factory_->allocator().Release(
-      total_allocated_.load(std::memory_order_relaxed));
   Zone* z = last_zone_;
   while (z) {
     Zone* prev_z = z->prev;
@@ -67,11 +54,30 @@ Arena::~Arena() {
 
 RefCountedPtr<Arena> Arena::Create(size_t initial_size,
                                    RefCountedPtr<ArenaFactory> arena_factory) {
+  initial_size = InitialZoneSize(initial_size);
   void* p = ArenaStorage(initial_size);
+  arena_factory->allocator().Reserve(initial_size);
   return RefCountedPtr<Arena>(
       new (p) Arena(initial_size, std::move(arena_factory)));
 }
 
+RefCountedPtr<Arena> Arena::CreateInRecycledStorage(
+    void* storage, size_t initial_size,
+    RefCountedPtr<ArenaFactory> arena_factory) {
+  DCHECK_EQ(initial_size, InitialZoneSize(initial_size));
+  return RefCountedPtr<Arena>(
+      new (storage) Arena(initial_size, std::move(arena_factory)));
+}
+
+size_t Arena::InitialZoneSize(size_t initial_size) {
+  size_t base_size = ArenaOverhead() +
+                     GPR_ROUND_UP_TO_ALIGNMENT_SIZE(
+                         arena_detail::BaseArenaContextTraits::ContextSize());
+  return std::max(GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size), base_size);
+}
+
+void Arena::FreeStorage(void* storage) { gpr_free_aligned(storage); }
+
 Arena::Arena(size_t initial_size, RefCountedPtr<ArenaFactory> arena_factory)
     : initial_zone_size_(initial_size),
       total_used_(ArenaOverhead() +
@@ -83,7 +89,6 @@ Arena::Arena(size_t initial_size, RefCountedPtr<ArenaFactory> arena_factory)
     contexts()[i] = nullptr;
   }
   CHECK_GE(initial_size, arena_detail::BaseArenaContextTraits::ContextSize());
-  arena_factory_->allocator().Reserve(initial_size);
 }
 
 void Arena::DestroyManagedNewObjects() {
@@ -100,8 +105,25 @@ void Arena::DestroyManagedNewObjects() {
 }
 
 void Arena::Destroy() const {
-  this->~Arena();
-  gpr_free_aligned(const_cast<Arena*>(this));
+  Arena* arena = const_cast<Arena*>(this);
+  for (size_t i = 0; i < arena_detail::BaseArenaContextTraits::NumContexts();
+       ++i) {
+    arena_detail::BaseArenaContextTraits::Destroy(i, arena->contexts()[i]);
+  }
+  arena->DestroyManagedNewObjects();
+  // Take over the arena's ref to its factory: the factory may keep our
+  // storage once we're destroyed.
+  RefCountedPtr<ArenaFactory> arena_factory = std::move(arena->arena_factory_);
+  arena_factory->FinalizeArena(arena);
+  const size_t initial_zone_size = initial_zone_size_;
+  size_t allocated = total_allocated_.load(std::memory_order_relaxed);
+  arena->~Arena();
+  if (arena_factory->RecycleArenaStorage(arena, initial_zone_size)) {
+    allocated -= initial_zone_size;
+  } else {
+    gpr_free_aligned(arena);
+  }
+  arena_factory->allocator().Release(allocated);
 }
 
 void* Arena::AllocZone(size_t size) {
@@ -136,6 +136,14 @@ class ArenaFactory : public RefCounted<ArenaFactory> {
  public:
   virtual RefCountedPtr<Arena> MakeArena() = 0;
   virtual void FinalizeArena(Arena* arena) = 0;
+  // Offered the storage (the initial zone) of each arena this factory made
+  // once the arena is destroyed. The storage is still reserved against
+  // allocator(). Return true to keep it for Arena::CreateInRecycledStorage(),
+  // in which case the factory becomes responsible for freeing it with
+  // Arena::FreeStorage() and releasing its reservation.
+  virtual bool RecycleArenaStorage(void* /*storage*/, size_t /*size*/) {
+    return false;
+  }
 
   MemoryAllocator& allocator() { return allocator_; }
 
@@ -159,6 +167,16 @@ class Arena final : public RefCounted<Arena, NonPolymorphicRefCount,
   // Create an arena, with \a initial_size bytes in the first allocated buffer.
   static RefCountedPtr<Arena> Create(size_t initial_size,
                                      RefCountedPtr<ArenaFactory> arena_factory);
+  // Create an arena in storage kept by arena_factory from an earlier arena.
+  // initial_size must be the size the storage was offered back with, and the
+  // storage must still be reserved against arena_factory's allocator.
+  static RefCountedPtr<Arena> CreateInRecycledStorage(
+      void* storage, size_t initial_size,
+      RefCountedPtr<ArenaFactory> arena_factory);
+  // The size of the initial zone of an arena created with initial_size.
+  static size_t InitialZoneSize(size_t initial_size);
+  // Free storage kept by ArenaFactory::RecycleArenaStorage().
+  static void FreeStorage(void* storage);
 
   // Destroy all `ManagedNew` allocated objects.
   // Allows safe destruction of these objects even if they need context held by
@@ -457,6 +457,11 @@ BasicMemoryQuota::BasicMemoryQuota(
     InstrumentStorageRefPtr<ResourceQuotaDomain> telemetry_storage)
     : channelz::DataSource(channelz_node),
       GaugeProvider(telemetry_storage),
+      // Caches hold at most about kMaxReservationCacheBytes each, so this
+      // keeps them to around a sixteenth of the quota.
+      min_quota_size_for_reservation_cache_(
+          (reservation_caches_.end() - reservation_caches_.begin()) *
+          kMaxReservationCacheBytes * 16),
       telemetry_storage_(std::move(telemetry_storage)) {
   ProviderConstructed();
   channelz::DataSource::SourceConstructed();
@@ -542,11 +547,12 @@ void BasicMemoryQuota::SetSize(size_t new_size) {
   size_t old_size = quota_size_.exchange(new_size, std::memory_order_relaxed);
   if (old_size < new_size) {
     // We're growing the quota.
-    Return(new_size - old_size);
-  } else {
+    free_bytes_.fetch_add(new_size - old_size, std::memory_order_relaxed);
+  } else if (old_size > new_size) {
     // We're shrinking the quota.
-    Take(/*allocator=*/nullptr, old_size - new_size);
+    TakeFromQuota(old_size - new_size);
   }
+  if (!ReservationCacheEnabled()) DrainReservationCaches();
 }
 
 void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
@@ -554,11 +560,7 @@ void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
   if (amount == 0) return;
   GRPC_DCHECK(amount <= std::numeric_limits<intptr_t>::max());
   // Grab memory from the quota.
-  auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
-  // If we push into overcommit, awake the reclaimer.
-  if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
-    if (reclaimer_activity_ != nullptr) reclaimer_activity_->ForceWakeup();
-  }
+  if (!TakeFromReservationCache(amount)) TakeFromQuota(amount);
 
   if (IsFreeLargeAllocatorEnabled()) {
     if (allocator == nullptr) return;
@@ -580,6 +582,68 @@ void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
   }
 }
 
+bool BasicMemoryQuota::TakeFromReservationCache(size_t amount) {
+  if (amount > static_cast<size_t>(kMaxReservationCacheBytes) ||
+      !ReservationCacheEnabled()) {
+    return false;
+  }
+  std::atomic<intptr_t>& cache = reservation_caches_.this_cpu().bytes;
+  intptr_t cached = cache.load(std::memory_order_relaxed);
+  while (cached >= static_cast<intptr_t>(amount)) {
+    if (cache.compare_exchange_weak(cached, cached - amount,
+                                    std::memory_order_relaxed,
+                                    std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  // The cache can't cover this: refill it, but never take the quota below half
+  // free that way, so caching alone can't push us into overcommit.
+  const intptr_t grab = amount + kReservationCacheRefillBytes;
+  const intptr_t floor = static_cast<intptr_t>(
+      std::min<size_t>(quota_size_.load(std::memory_order_relaxed),
+                       kInitialSize) /
+      2);
+  intptr_t prior = free_bytes_.load(std::memory_order_relaxed);
+  while (prior - grab >= floor) {
+    if (free_bytes_.compare_exchange_weak(prior, prior - grab,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_relaxed)) {
+      cache.fetch_add(kReservationCacheRefillBytes, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+void BasicMemoryQuota::TakeFromQuota(size_t amount) {
+  auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
+  // If we push into overcommit, first reclaim whatever the caches are
+  // holding, and if that isn't enough awake the reclaimer.
+  if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
+    DrainReservationCaches();
+    if (free_bytes_.load(std::memory_order_acquire) < 0 &&
+        reclaimer_activity_ != nullptr) {
+      reclaimer_activity_->ForceWakeup();
+    }
+  }
+}
+
+void BasicMemoryQuota::DrainReservationCaches() {
+  intptr_t drained = 0;
+  for (ReservationCache& cache : reservation_caches_) {
+    drained += cache.bytes.exchange(0, std::memory_order_relaxed);
+  }
+  if (drained != 0) free_bytes_.fetch_add(drained, std::memory_order_acq_rel);
+}
+
+intptr_t BasicMemoryQuota::ReservationCacheBytes() const {
+  intptr_t cached = 0;
+  for (const ReservationCache& cache : reservation_caches_) {
+    cached += cache.bytes.load(std::memory_order_relaxed);
+  }
+  return cached;
+}
+
 void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
   uint64_t current = reclamation_counter_.load(std::memory_order_relaxed);
   if (current != token) return;
@@ -598,7 +662,27 @@ void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
 }
 
 void BasicMemoryQuota::Return(size_t amount) {
-  free_bytes_.fetch_add(amount, std::memory_order_relaxed);
+  // While in overcommit, returns go straight to free_bytes_ where the
+  // reclaimer can see them.
+  if (amount > static_cast<size_t>(kMaxReservationCacheBytes) ||
+      !ReservationCacheEnabled() ||
+      free_bytes_.load(std::memory_order_relaxed) <= 0) {
+    free_bytes_.fetch_add(amount, std::memory_order_relaxed);
+    return;
+  }
+  std::atomic<intptr_t>& cache = reservation_caches_.this_cpu().bytes;
+  intptr_t cached =
+      cache.fetch_add(amount, std::memory_order_relaxed) + amount;
+  // If the cache has grown too big, give back all but a refill's worth.
+  while (cached > kMaxReservationCacheBytes) {
+    if (cache.compare_exchange_weak(cached, kReservationCacheRefillBytes,
+                                    std::memory_order_relaxed,
+                                    std::memory_order_relaxed)) {
+      free_bytes_.fetch_add(cached - kReservationCacheRefillBytes,
+                            std::memory_order_relaxed);
+      return;
+    }
+  }
 }
 
 void BasicMemoryQuota::AddNewAllocator(GrpcMemoryAllocatorImpl* allocator) {
@@ -697,7 +781,7 @@ void BasicMemoryQuota::MaybeMoveAllocatorSmallToBig(
 }
 
 BasicMemoryQuota::PressureInfo BasicMemoryQuota::GetPressureInfo() {
-  double free = free_bytes_.load();
+  double free = free_bytes_.load() + ReservationCacheBytes();
   if (free < 0) free = 0;
   size_t quota_size = quota_size_.load();
   double size = quota_size;
@@ -726,6 +810,7 @@ void BasicMemoryQuota::AddData(channelz::DataSink sink) {
       channelz::PropertyList()
           .Set("free_bytes", free_bytes_.load(std::memory_order_relaxed))
           .Set("quota_size", quota_size_.load(std::memory_order_relaxed))
+          .Set("reservation_cache_bytes", ReservationCacheBytes())
           .Set("container_memory_pressure", ContainerMemoryPressure())
           .Merge(pressure_tracker_.ChannelzProperties())
           .Set("allocators",
@@ -43,6 +43,7 @@
 #include "src/core/telemetry/instrument.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/orphanable.h"
+#include "src/core/util/per_cpu.h"
 #include "src/core/util/ref_counted_ptr.h"
 #include "src/core/util/sync.h"
 #include "src/core/util/time.h"
@@ -373,7 +374,37 @@ class BasicMemoryQuota final
     std::array<Shard, 16> shards;
   };
 
+  // Quota grabs and returns of up to kMaxReservationCacheBytes go through a
+  // per-cpu cache of reserved bytes, so that allocators on different cpus do
+  // not all contend on free_bytes_. A cache that runs dry takes
+  // kReservationCacheRefillBytes more than it needs from free_bytes_, and one
+  // that grows past kMaxReservationCacheBytes gives back all but
+  // kReservationCacheRefillBytes.
+  struct alignas(GPR_CACHELINE_SIZE) ReservationCache {
+    std::atomic<intptr_t> bytes{0};
+  };
+
   static constexpr intptr_t kInitialSize = std::numeric_limits<intptr_t>::max();
+  static constexpr intptr_t kReservationCacheRefillBytes = 256 * 1024;
+  static constexpr intptr_t kMaxReservationCacheBytes = 1024 * 1024;
+
+  // Caching is only enabled on quotas big enough that the bytes sitting in
+  // the caches are a small fraction of the quota.
+  bool ReservationCacheEnabled() const {
+    return quota_size_.load(std::memory_order_relaxed) >=
+           min_quota_size_for_reservation_cache_;
+  }
+  // Try to satisfy a Take() from this cpu's cache, refilling it from
+  // free_bytes_ if that leaves at least half the quota free. Returns false if
+  // the caller must take amount from free_bytes_ instead.
+  bool TakeFromReservationCache(size_t amount);
+  // Take amount from free_bytes_, draining the caches and waking the
+  // reclaimer if that pushes the quota into overcommit.
+  void TakeFromQuota(size_t amount);
+  // Move all cached bytes back to free_bytes_.
+  void DrainReservationCaches();
+  // Total bytes sitting in the caches.
+  intptr_t ReservationCacheBytes() const;
 
   // Move allocator from big bucket to small bucket.
   void MaybeMoveAllocatorBigToSmall(GrpcMemoryAllocatorImpl* allocator);
@@ -386,6 +417,11 @@ class BasicMemoryQuota final
   std::atomic<intptr_t> free_bytes_{kInitialSize};
   // The total number of bytes in this quota.
   std::atomic<size_t> quota_size_{kInitialSize};
+  // Bytes taken from free_bytes_ but not yet handed out to an allocator.
+  // These still count as free when computing memory pressure.
+  PerCpu<ReservationCache> reservation_caches_{
+      PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
+  const size_t min_quota_size_for_reservation_cache_;
 
   // Reclaimer queues.
   ReclaimerQueue reclaimers_[kNumReclamationPasses];
@@ -0,0 +1,619 @@
+//
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/port_platform.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "src/core/config/core_configuration.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/load_balancing/endpoint_list.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_factory.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/debug_location.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "src/core/util/shared_bit_gen.h"
+#include "src/core/util/sync.h"
+#include "src/core/util/validation_errors.h"
+#include "src/core/util/work_serializer.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/log/log.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kLeastRequest = "least_request_experimental";
+
+// Config for least_request policy.
+class LeastRequestConfig final : public LoadBalancingPolicy::Config {
+ public:
+  // As in Envoy, larger choice counts are clamped rather than rejected.
+  static constexpr uint32_t kMaxChoiceCount = 10;
+
+  LeastRequestConfig() = default;
+
+  LeastRequestConfig(const LeastRequestConfig&) = delete;
+  LeastRequestConfig& operator=(const LeastRequestConfig&) = delete;
+
+  LeastRequestConfig(LeastRequestConfig&&) = delete;
+  LeastRequestConfig& operator=(LeastRequestConfig&&) = delete;
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  uint32_t choice_count() const { return choice_count_; }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<LeastRequestConfig>()
+            .OptionalField("choiceCount", &LeastRequestConfig::choice_count_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    if (choice_count_ < 2) {
+      ValidationErrors::ScopedField field(errors, ".choiceCount");
+      errors->AddError("must be at least 2");
+    }
+    choice_count_ = std::min(choice_count_, kMaxChoiceCount);
+  }
+
+ private:
+  uint32_t choice_count_ = 2;
+};
+
+// Picks the endpoint with the fewest outstanding requests out of a few
+// chosen at random (by default two, the "power of two choices").  Unlike
+// picking the least loaded of all endpoints, this needs no coordination
+// between pickers and does not herd every channel onto the same endpoint.
+class LeastRequest final : public LoadBalancingPolicy {
+ public:
+  explicit LeastRequest(Args args);
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  absl::Status UpdateLocked(UpdateArgs args) override;
+  void ResetBackoffLocked() override;
+
+ private:
+  // The number of calls in flight to a given endpoint.  Shared between
+  // endpoint lists via the policy's map, so that counts are not lost
+  // when the resolver returns an update that still contains the endpoint.
+  class OutstandingRequests final : public RefCounted<OutstandingRequests> {
+   public:
+    OutstandingRequests(RefCountedPtr<LeastRequest> least_request,
+                        EndpointAddressSet key)
+        : least_request_(std::move(least_request)), key_(std::move(key)) {}
+    ~OutstandingRequests() override;
+
+    uint64_t Get() const { return count_.load(std::memory_order_relaxed); }
+    void Increment() { count_.fetch_add(1, std::memory_order_relaxed); }
+    void Decrement() { count_.fetch_sub(1, std::memory_order_relaxed); }
+
+   private:
+    RefCountedPtr<LeastRequest> least_request_;
+    const EndpointAddressSet key_;
+
+    std::atomic<uint64_t> count_{0};
+  };
+
+  class LeastRequestEndpointList final : public EndpointList {
+   public:
+    class LeastRequestEndpoint final : public Endpoint {
+     public:
+      LeastRequestEndpoint(RefCountedPtr<EndpointList> endpoint_list,
+                           const EndpointAddresses& addresses,
+                           const ChannelArgs& args,
+                           std::shared_ptr<WorkSerializer> work_serializer,
+                           std::vector<std::string>* errors)
+          : Endpoint(std::move(endpoint_list)),
+            outstanding_requests_(
+                policy<LeastRequest>()->GetOrCreateOutstandingRequests(
+                    addresses.addresses())) {
+        absl::Status status = Init(addresses, args, std::move(work_serializer));
+        if (!status.ok()) {
+          errors->emplace_back(absl::StrCat("endpoint ", addresses.ToString(),
+                                            ": ", status.ToString()));
+        }
+      }
+
+      RefCountedPtr<OutstandingRequests> outstanding_requests() const {
+        return outstanding_requests_;
+      }
+
+     private:
+      // Called when the child policy reports a connectivity state update.
+      void OnStateUpdate(std::optional<grpc_connectivity_state> old_state,
+                         grpc_connectivity_state new_state,
+                         const absl::Status& status) override;
+
+      RefCountedPtr<OutstandingRequests> outstanding_requests_;
+    };
+
+    LeastRequestEndpointList(RefCountedPtr<LeastRequest> least_request,
+                             EndpointAddressesIterator* endpoints,
+                             const ChannelArgs& args,
+                             std::string resolution_note,
+                             std::vector<std::string>* errors)
+        : EndpointList(std::move(least_request), std::move(resolution_note),
+                       GRPC_TRACE_FLAG_ENABLED(least_request_lb)
+                           ? "LeastRequestEndpointList"
+                           : nullptr) {
+      Init(endpoints, args,
+           [&](RefCountedPtr<EndpointList> endpoint_list,
+               const EndpointAddresses& addresses, const ChannelArgs& args) {
+             return MakeOrphanable<LeastRequestEndpoint>(
+                 std::move(endpoint_list), addresses, args,
+                 policy<LeastRequest>()->work_serializer(), errors);
+           });
+    }
+
+   private:
+    LoadBalancingPolicy::ChannelControlHelper* channel_control_helper()
+        const override {
+      return policy<LeastRequest>()->channel_control_helper();
+    }
+
+    // Updates the counters of endpoints in each state when a
+    // endpoint transitions from old_state to new_state.
+    void UpdateStateCountersLocked(
+        std::optional<grpc_connectivity_state> old_state,
+        grpc_connectivity_state new_state);
+
+    // Ensures that the right endpoint list is used and then updates
+    // the aggregate connectivity state based on the endpoint list's
+    // state counters.
+    void MaybeUpdateAggregatedConnectivityStateLocked(
+        absl::Status status_for_tf);
+
+    std::string CountersString() const {
+      return absl::StrCat("num_children=", size(), " num_ready=", num_ready_,
+                          " num_connecting=", num_connecting_,
+                          " num_transient_failure=", num_transient_failure_);
+    }
+
+    size_t num_ready_ = 0;
+    size_t num_connecting_ = 0;
+    size_t num_transient_failure_ = 0;
+
+    absl::Status last_failure_;
+  };
+
+  class Picker final : public SubchannelPicker {
+   public:
+    Picker(LeastRequest* parent, uint32_t choice_count,
+           LeastRequestEndpointList* endpoint_list);
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    // Counts a call against its endpoint from the time it is picked until
+    // the tracker is destroyed.  The channel may destroy the tracker
+    // without calling Finish() if the subchannel turns out to be
+    // disconnected, so the count is released in the destructor rather
+    // than in Finish().
+    class SubchannelCallTracker final : public SubchannelCallTrackerInterface {
+     public:
+      SubchannelCallTracker(
+          RefCountedPtr<OutstandingRequests> outstanding_requests,
+          std::unique_ptr<SubchannelCallTrackerInterface> child_tracker)
+          : outstanding_requests_(std::move(outstanding_requests)),
+            child_tracker_(std::move(child_tracker)) {
+        outstanding_requests_->Increment();
+      }
+      ~SubchannelCallTracker() override { outstanding_requests_->Decrement(); }
+
+      void Finish(FinishArgs args) override {
+        if (child_tracker_ != nullptr) child_tracker_->Finish(args);
+      }
+
+     private:
+      RefCountedPtr<OutstandingRequests> outstanding_requests_;
+      std::unique_ptr<SubchannelCallTrackerInterface> child_tracker_;
+    };
+
+    // Info stored about each endpoint.
+    struct EndpointInfo {
+      EndpointInfo(RefCountedPtr<SubchannelPicker> picker,
+                   RefCountedPtr<OutstandingRequests> outstanding_requests)
+          : picker(std::move(picker)),
+            outstanding_requests(std::move(outstanding_requests)) {}
+
+      RefCountedPtr<SubchannelPicker> picker;
+      RefCountedPtr<OutstandingRequests> outstanding_requests;
+    };
+
+    // Returns the index into endpoints_ to be picked.
+    size_t PickIndex();
+
+    // Using pointer value only, no ref held -- do not dereference!
+    LeastRequest* parent_;
+
+    const uint32_t choice_count_;
+    std::vector<EndpointInfo> endpoints_;
+  };
+
+  ~LeastRequest() override;
+
+  void ShutdownLocked() override;
+
+  RefCountedPtr<OutstandingRequests> GetOrCreateOutstandingRequests(
+      const std::vector<grpc_resolved_address>& addresses);
+
+  RefCountedPtr<LeastRequestConfig> config_;
+
+  // Current endpoint list.
+  OrphanablePtr<LeastRequestEndpointList> endpoint_list_;
+  // Latest pending endpoint list.
+  // When we get an updated address list, we create a new endpoint list
+  // for it here, and we wait to swap it into endpoint_list_ until the new
+  // list becomes READY.
+  OrphanablePtr<LeastRequestEndpointList> latest_pending_endpoint_list_;
+
+  Mutex outstanding_requests_map_mu_;
+  std::map<EndpointAddressSet, OutstandingRequests*> outstanding_requests_map_
+      ABSL_GUARDED_BY(&outstanding_requests_map_mu_);
+
+  bool shutdown_ = false;
+};
+
+//
+// LeastRequest::OutstandingRequests
+//
+
+LeastRequest::OutstandingRequests::~OutstandingRequests() {
+  MutexLock lock(&least_request_->outstanding_requests_map_mu_);
+  auto it = least_request_->outstanding_requests_map_.find(key_);
+  if (it != least_request_->outstanding_requests_map_.end() &&
+      it->second == this) {
+    least_request_->outstanding_requests_map_.erase(it);
+  }
+}
+
+//
+// LeastRequest::Picker
+//
+
+LeastRequest::Picker::Picker(LeastRequest* parent, uint32_t choice_count,
+                             LeastRequestEndpointList* endpoint_list)
+    : parent_(parent), choice_count_(choice_count) {
+  for (const auto& endpoint : endpoint_list->endpoints()) {
+    auto* ep = static_cast<LeastRequestEndpointList::LeastRequestEndpoint*>(
+        endpoint.get());
+    if (ep->connectivity_state() == GRPC_CHANNEL_READY) {
+      endpoints_.emplace_back(ep->picker(), ep->outstanding_requests());
+    }
+  }
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[LR " << parent_ << " picker " << this
+      << "] created picker from endpoint_list=" << endpoint_list << " with "
+      << endpoints_.size() << " READY endpoints, choice_count="
+      << choice_count_;
+}
+
+size_t LeastRequest::Picker::PickIndex() {
+  if (endpoints_.size() == 1) return 0;
+  // Sample with replacement: drawing the same endpoint twice just means
+  // one fewer real comparison, which is cheaper than tracking duplicates.
+  size_t best_index =
+      absl::Uniform<size_t>(SharedBitGen(), 0, endpoints_.size());
+  uint64_t best_count = endpoints_[best_index].outstanding_requests->Get();
+  for (uint32_t i = 1; i < choice_count_; ++i) {
+    const size_t index =
+        absl::Uniform<size_t>(SharedBitGen(), 0, endpoints_.size());
+    const uint64_t count = endpoints_[index].outstanding_requests->Get();
+    if (count < best_count) {
+      best_index = index;
+      best_count = count;
+    }
+  }
+  return best_index;
+}
+
+LeastRequest::PickResult LeastRequest::Picker::Pick(PickArgs args) {
+  const size_t index = PickIndex();
+  GRPC_CHECK_LT(index, endpoints_.size());
+  auto& endpoint_info = endpoints_[index];
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[LR " << parent_ << " picker " << this << "] returning index "
+      << index << " with " << endpoint_info.outstanding_requests->Get()
+      << " outstanding requests, picker=" << endpoint_info.picker.get();
+  auto result = endpoint_info.picker->Pick(args);
+  auto* complete = std::get_if<PickResult::Complete>(&result.result);
+  if (complete != nullptr) {
+    complete->subchannel_call_tracker =
+        std::make_unique<SubchannelCallTracker>(
+            endpoint_info.outstanding_requests,
+            std::move(complete->subchannel_call_tracker));
+  }
+  return result;
+}
+
+//
+// LeastRequest
+//
+
+LeastRequest::LeastRequest(Args args) : LoadBalancingPolicy(std::move(args)) {
+  GRPC_TRACE_LOG(least_request_lb, INFO) << "[LR " << this << "] Created";
+}
+
+LeastRequest::~LeastRequest() {
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[LR " << this << "] Destroying Least Request policy";
+  GRPC_CHECK(endpoint_list_ == nullptr);
+  GRPC_CHECK(latest_pending_endpoint_list_ == nullptr);
+}
+
+void LeastRequest::ShutdownLocked() {
+  GRPC_TRACE_LOG(least_request_lb, INFO) << "[LR " << this << "] Shutting down";
+  shutdown_ = true;
+  endpoint_list_.reset();
+  latest_pending_endpoint_list_.reset();
+}
+
+void LeastRequest::ResetBackoffLocked() {
+  endpoint_list_->ResetBackoffLocked();
+  if (latest_pending_endpoint_list_ != nullptr) {
+    latest_pending_endpoint_list_->ResetBackoffLocked();
+  }
+}
+
+absl::Status LeastRequest::UpdateLocked(UpdateArgs args) {
+  config_ = args.config.TakeAsSubclass<LeastRequestConfig>();
+  EndpointAddressesIterator* addresses = nullptr;
+  if (args.addresses.ok()) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[LR " << this << "] received update";
+    addresses = args.addresses->get();
+  } else {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[LR " << this
+        << "] received update with address error: " << args.addresses.status();
+    // If we already have an endpoint list, then keep using the existing
+    // list, but still report back that the update was not accepted.
+    if (endpoint_list_ != nullptr) return args.addresses.status();
+  }
+  // Create new endpoint list, replacing the previous pending list, if any.
+  if (GRPC_TRACE_FLAG_ENABLED(least_request_lb) &&
+      latest_pending_endpoint_list_ != nullptr) {
+    LOG(INFO) << "[LR " << this << "] replacing previous pending endpoint list "
+              << latest_pending_endpoint_list_.get();
+  }
+  std::vector<std::string> errors;
+  latest_pending_endpoint_list_ = MakeOrphanable<LeastRequestEndpointList>(
+      RefAsSubclass<LeastRequest>(DEBUG_LOCATION, "LeastRequestEndpointList"),
+      addresses, args.args, std::move(args.resolution_note), &errors);
+  // If the new list is empty, immediately promote it to
+  // endpoint_list_ and report TRANSIENT_FAILURE.
+  if (latest_pending_endpoint_list_->size() == 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(least_request_lb) &&
+        endpoint_list_ != nullptr) {
+      LOG(INFO) << "[LR " << this << "] replacing previous endpoint list "
+                << endpoint_list_.get();
+    }
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+    absl::Status status = args.addresses.ok()
+                              ? absl::UnavailableError("empty address list")
+                              : args.addresses.status();
+    endpoint_list_->ReportTransientFailure(status);
+    return status;
+  }
+  // Otherwise, if this is the initial update, immediately promote it to
+  // endpoint_list_.
+  if (endpoint_list_ == nullptr) {
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+  }
+  if (!errors.empty()) {
+    return absl::UnavailableError(absl::StrCat(
+        "errors from children: [", absl::StrJoin(errors, "; "), "]"));
+  }
+  return absl::OkStatus();
+}
+
+RefCountedPtr<LeastRequest::OutstandingRequests>
+LeastRequest::GetOrCreateOutstandingRequests(
+    const std::vector<grpc_resolved_address>& addresses) {
+  EndpointAddressSet key(addresses);
+  MutexLock lock(&outstanding_requests_map_mu_);
+  auto it = outstanding_requests_map_.find(key);
+  if (it != outstanding_requests_map_.end()) {
+    auto outstanding_requests = it->second->RefIfNonZero();
+    if (outstanding_requests != nullptr) return outstanding_requests;
+  }
+  auto outstanding_requests = MakeRefCounted<OutstandingRequests>(
+      RefAsSubclass<LeastRequest>(DEBUG_LOCATION, "OutstandingRequests"), key);
+  outstanding_requests_map_[key] = outstanding_requests.get();
+  return outstanding_requests;
+}
+
+//
+// LeastRequest::LeastRequestEndpointList::LeastRequestEndpoint
+//
+
+void LeastRequest::LeastRequestEndpointList::LeastRequestEndpoint::
+    OnStateUpdate(std::optional<grpc_connectivity_state> old_state,
+                  grpc_connectivity_state new_state,
+                  const absl::Status& status) {
+  auto* lr_endpoint_list = endpoint_list<LeastRequestEndpointList>();
+  auto* least_request = policy<LeastRequest>();
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[LR " << least_request << "] connectivity changed for endpoint "
+      << this << ", endpoint_list " << lr_endpoint_list << " (index "
+      << Index() << " of " << lr_endpoint_list->size() << "): prev_state="
+      << (old_state.has_value() ? ConnectivityStateName(*old_state) : "N/A")
+      << " new_state=" << ConnectivityStateName(new_state) << " (" << status
+      << ")";
+  if (new_state == GRPC_CHANNEL_IDLE) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[LR " << least_request << "] endpoint " << this
+        << " reported IDLE; requesting connection";
+    ExitIdleLocked();
+  }
+  // If state changed, update state counters.
+  if (!old_state.has_value() || *old_state != new_state) {
+    lr_endpoint_list->UpdateStateCountersLocked(old_state, new_state);
+  }
+  // Update the policy state.
+  lr_endpoint_list->MaybeUpdateAggregatedConnectivityStateLocked(status);
+}
+
+//
+// LeastRequest::LeastRequestEndpointList
+//
+
+void LeastRequest::LeastRequestEndpointList::UpdateStateCountersLocked(
+    std::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  // We treat IDLE the same as CONNECTING, since it will immediately
+  // transition into that state anyway.
+  if (old_state.has_value()) {
+    GRPC_CHECK(*old_state != GRPC_CHANNEL_SHUTDOWN);
+    if (*old_state == GRPC_CHANNEL_READY) {
+      GRPC_CHECK_GT(num_ready_, 0u);
+      --num_ready_;
+    } else if (*old_state == GRPC_CHANNEL_CONNECTING ||
+               *old_state == GRPC_CHANNEL_IDLE) {
+      GRPC_CHECK_GT(num_connecting_, 0u);
+      --num_connecting_;
+    } else if (*old_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      GRPC_CHECK_GT(num_transient_failure_, 0u);
+      --num_transient_failure_;
+    }
+  }
+  GRPC_CHECK(new_state != GRPC_CHANNEL_SHUTDOWN);
+  if (new_state == GRPC_CHANNEL_READY) {
+    ++num_ready_;
+  } else if (new_state == GRPC_CHANNEL_CONNECTING ||
+             new_state == GRPC_CHANNEL_IDLE) {
+    ++num_connecting_;
+  } else if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++num_transient_failure_;
+  }
+}
+
+void LeastRequest::LeastRequestEndpointList::
+    MaybeUpdateAggregatedConnectivityStateLocked(absl::Status status_for_tf) {
+  auto* least_request = policy<LeastRequest>();
+  // If this is latest_pending_endpoint_list_, then swap it into
+  // endpoint_list_ in the following cases:
+  // - endpoint_list_ has no READY endpoints.
+  // - This list has at least one READY endpoint and we have seen the
+  //   initial connectivity state notification for all endpoints.
+  // - All of the endpoints in this list are in TRANSIENT_FAILURE.
+  //   (This may cause the channel to go from READY to TRANSIENT_FAILURE,
+  //   but we're doing what the control plane told us to do.)
+  if (least_request->latest_pending_endpoint_list_.get() == this &&
+      (least_request->endpoint_list_->num_ready_ == 0 ||
+       (num_ready_ > 0 && AllEndpointsSeenInitialState()) ||
+       num_transient_failure_ == size())) {
+    if (GRPC_TRACE_FLAG_ENABLED(least_request_lb)) {
+      LOG(INFO) << "[LR " << least_request << "] swapping out endpoint list "
+                << least_request->endpoint_list_.get() << " ("
+                << least_request->endpoint_list_->CountersString()
+                << ") in favor of " << this << " (" << CountersString() << ")";
+    }
+    least_request->endpoint_list_ =
+        std::move(least_request->latest_pending_endpoint_list_);
+  }
+  // Only set connectivity state if this is the current endpoint list.
+  if (least_request->endpoint_list_.get() != this) return;
+  // First matching rule wins:
+  // 1) ANY endpoint is READY => policy is READY.
+  // 2) ANY endpoint is CONNECTING => policy is CONNECTING.
+  // 3) ALL endpoints are TRANSIENT_FAILURE => policy is TRANSIENT_FAILURE.
+  if (num_ready_ > 0) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[LR " << least_request << "] reporting READY with endpoint list "
+        << this;
+    least_request->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_READY, absl::OkStatus(),
+        MakeRefCounted<Picker>(least_request,
+                               least_request->config_->choice_count(), this));
+  } else if (num_connecting_ > 0) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[LR " << least_request
+        << "] reporting CONNECTING with endpoint list " << this;
+    least_request->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::OkStatus(),
+        MakeRefCounted<QueuePicker>(nullptr));
+  } else if (num_transient_failure_ == size()) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[LR " << least_request
+        << "] reporting TRANSIENT_FAILURE with endpoint list " << this << ": "
+        << status_for_tf;
+    if (!status_for_tf.ok()) {
+      last_failure_ = absl::UnavailableError(
+          absl::StrCat("connections to all backends failing; last error: ",
+                       status_for_tf.message()));
+    }
+    ReportTransientFailure(last_failure_);
+  }
+}
+
+//
+// factory
+//
+
+class LeastRequestFactory final : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<LeastRequest>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadFromJson<RefCountedPtr<LeastRequestConfig>>(
+        json, JsonArgs(), "errors validating least_request LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterLeastRequestLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<LeastRequestFactory>());
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,209 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/load_balancing/ring_hash/lookup_table.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "src/core/util/xxhash_inline.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+
+//
+// HashRing
+//
+
+HashRing::HashRing(absl::Span<const HashLookupEndpoint> endpoints,
+                   size_t min_ring_size, size_t max_ring_size) {
+  size_t sum = 0;
+  for (const auto& endpoint : endpoints) sum += endpoint.weight;
+  // Calculating normalized weights and find min and max.
+  std::vector<double> normalized_weights;
+  normalized_weights.reserve(endpoints.size());
+  double min_normalized_weight = 1.0;
+  for (const auto& endpoint : endpoints) {
+    const double normalized_weight =
+        static_cast<double>(endpoint.weight) / sum;
+    normalized_weights.push_back(normalized_weight);
+    min_normalized_weight = std::min(normalized_weight, min_normalized_weight);
+  }
+  // Scale up the number of hashes per host such that the least-weighted host
+  // gets a whole number of hashes on the ring. Other hosts might not end up
+  // with whole numbers, and that's fine (the ring-building algorithm below can
+  // handle this). This preserves the original implementation's behavior: when
+  // weights aren't provided, all hosts should get an equal number of hashes. In
+  // the case where this number exceeds the max_ring_size, it's scaled back down
+  // to fit.
+  const double scale = std::min(
+      std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
+      static_cast<double>(max_ring_size));
+  // Reserve memory for the entire ring up front.
+  const uint64_t ring_size = std::ceil(scale);
+  ring_.reserve(ring_size);
+  // Populate the hash ring by walking through the (host, weight) pairs in
+  // normalized_host_weights, and generating (scale * weight) hashes for each
+  // host. Since these aren't necessarily whole numbers, we maintain running
+  // sums -- current_hashes and target_hashes -- which allows us to populate the
+  // ring in a mostly stable way.
+  absl::InlinedVector<char, 196> hash_key_buffer;
+  double current_hashes = 0.0;
+  double target_hashes = 0.0;
+  for (size_t i = 0; i < endpoints.size(); ++i) {
+    const std::string& hash_key = endpoints[i].hash_key;
+    hash_key_buffer.assign(hash_key.begin(), hash_key.end());
+    hash_key_buffer.emplace_back('_');
+    auto offset_start = hash_key_buffer.end();
+    target_hashes += scale * normalized_weights[i];
+    size_t count = 0;
+    while (current_hashes < target_hashes) {
+      const std::string count_str = absl::StrCat(count);
+      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
+      absl::string_view hash_key(hash_key_buffer.data(),
+                                 hash_key_buffer.size());
+      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
+      ring_.push_back({hash, i});
+      ++count;
+      ++current_hashes;
+      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
+    }
+  }
+  std::sort(ring_.begin(), ring_.end(),
+            [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
+              return lhs.hash < rhs.hash;
+            });
+}
+
+size_t HashRing::FindIndex(uint64_t request_hash) const {
+  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
+  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
+  // for lowp, highp, and index. Do not change them!
+  int64_t lowp = 0;
+  int64_t highp = ring_.size();
+  int64_t index = 0;
+  while (true) {
+    index = (lowp + highp) / 2;
+    if (index == static_cast<int64_t>(ring_.size())) {
+      return 0;
+    }
+    uint64_t midval = ring_[index].hash;
+    uint64_t midval1 = index == 0 ? 0 : ring_[index - 1].hash;
+    if (request_hash <= midval && request_hash > midval1) {
+      return index;
+    }
+    if (midval < request_hash) {
+      lowp = index + 1;
+    } else {
+      highp = index - 1;
+    }
+    if (lowp > highp) {
+      return 0;
+    }
+  }
+}
+
+//
+// MaglevTable
+//
+
+MaglevTable::MaglevTable(absl::Span<const HashLookupEndpoint> endpoints,
+                         size_t table_size) {
+  GRPC_CHECK(IsValidTableSize(table_size));
+  GRPC_CHECK_LE(endpoints.size(), std::numeric_limits<uint32_t>::max());
+  if (endpoints.empty()) return;
+  // Each endpoint's permutation of the slots is offset, offset + skip,
+  // offset + 2 * skip, ... (mod table_size); since table_size is prime and
+  // skip is not a multiple of it, that visits every slot.
+  struct Permutation {
+    uint64_t next;
+    uint64_t skip;
+    // Weight accumulated and not yet spent on turns.
+    uint64_t credit;
+  };
+  std::vector<Permutation> permutations;
+  permutations.reserve(endpoints.size());
+  uint64_t total_weight = 0;
+  for (const auto& endpoint : endpoints) {
+    const uint64_t offset =
+        XXH64(endpoint.hash_key.data(), endpoint.hash_key.size(), 0) %
+        table_size;
+    const uint64_t skip =
+        XXH64(endpoint.hash_key.data(), endpoint.hash_key.size(), 1) %
+            (table_size - 1) +
+        1;
+    permutations.push_back({offset, skip, 0});
+    total_weight += endpoint.weight;
+  }
+  // Each round, every endpoint is credited its weight and takes a turn for
+  // each whole turn_cost it has been credited, carrying the remainder over.
+  // With turn_cost the mean weight, a round hands out about one turn per
+  // endpoint however skewed the weights are, so filling the table takes
+  // O(table_size) steps rather than one round per turn of the heaviest
+  // endpoint.
+  const uint64_t turn_cost =
+      std::max<uint64_t>(1, total_weight / endpoints.size());
+  constexpr uint32_t kEmpty = std::numeric_limits<uint32_t>::max();
+  table_.assign(table_size, kEmpty);
+  size_t filled = 0;
+  while (filled < table_size) {
+    for (size_t i = 0; i < endpoints.size() && filled < table_size; ++i) {
+      Permutation& permutation = permutations[i];
+      permutation.credit += endpoints[i].weight;
+      for (; permutation.credit >= turn_cost && filled < table_size;
+           permutation.credit -= turn_cost) {
+        while (table_[permutation.next] != kEmpty) {
+          permutation.next += permutation.skip;
+          if (permutation.next >= table_size) permutation.next -= table_size;
+        }
+        table_[permutation.next] = static_cast<uint32_t>(i);
+        ++filled;
+      }
+    }
+  }
+}
+
+bool MaglevTable::IsValidTableSize(uint64_t size) {
+  if (size < 2 || size > kMaxTableSize) return false;
+  for (uint64_t divisor = 2; divisor * divisor <= size; ++divisor) {
+    if (size % divisor == 0) return false;
+  }
+  return true;
+}
+
+size_t MaglevTable::LargestValidTableSize(uint64_t limit) {
+  for (uint64_t size = std::min<uint64_t>(limit, kMaxTableSize); size > 2;
+       --size) {
+    if (IsValidTableSize(size)) return size;
+  }
+  return 2;
+}
+
+size_t MaglevTable::TableSizeFor(size_t num_endpoints, uint64_t min_size,
+                                 uint64_t cap) {
+  const uint64_t limit = std::min<uint64_t>(cap, kMaxTableSize);
+  const uint64_t wanted = std::max<uint64_t>(
+      min_size, static_cast<uint64_t>(num_endpoints) * kMinSlotsPerEndpoint);
+  for (uint64_t size = wanted; size <= limit; ++size) {
+    if (IsValidTableSize(size)) return size;
+  }
+  return LargestValidTableSize(limit);
+}
+
+}  // namespace grpc_core
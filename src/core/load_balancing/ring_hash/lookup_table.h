@@ -0,0 +1,116 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_LOOKUP_TABLE_H
+#define GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_LOOKUP_TABLE_H
+
+#include <grpc/support/port_platform.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "src/core/util/grpc_check.h"
+#include "absl/types/span.h"
+
+namespace grpc_core {
+
+// An endpoint as seen by the consistent hashing lookup tables.
+struct HashLookupEndpoint {
+  // By default, the endpoint's first address.
+  std::string hash_key;
+  // Must be non-zero.
+  uint32_t weight = 1;
+};
+
+// Both lookup tables map a request hash to an index, and each index to an
+// endpoint (an index into the endpoint list they were built from). If the
+// endpoint at the index a request hashes to is unusable, the ones at the
+// following indices, wrapping around, are tried in turn.
+
+// A ketama style hash ring: each endpoint is hashed onto the ring a number of
+// times proportional to its weight, and a request goes to the next entry on
+// the ring at or after its hash.
+//
+// Construction is O(ring_size log ring_size), and picking is
+// O(log ring_size).
+class HashRing final {
+ public:
+  // Builds a ring of between min_ring_size and max_ring_size entries, scaled
+  // so that the lowest weighted endpoint gets a whole number of entries.
+  HashRing(absl::Span<const HashLookupEndpoint> endpoints, size_t min_ring_size,
+           size_t max_ring_size);
+
+  size_t size() const { return ring_.size(); }
+  size_t FindIndex(uint64_t request_hash) const;
+  size_t endpoint_index(size_t index) const {
+    return ring_[index].endpoint_index;
+  }
+
+ private:
+  struct RingEntry {
+    uint64_t hash;
+    size_t endpoint_index;
+  };
+
+  std::vector<RingEntry> ring_;
+};
+
+// A Maglev lookup table (Eisenbud et al., "Maglev: A Fast and Reliable
+// Software Network Load Balancer", NSDI 2016): every endpoint walks its own
+// permutation of the table's slots, and endpoints take turns, in proportion
+// to their weights, claiming the next free slot on their permutation until
+// the table is full. Adding or removing an endpoint moves few of the other
+// endpoints' slots.
+//
+// Construction is O(table_size log table_size) and picking is O(1), with four
+// bytes per slot no matter how many endpoints there are.
+class MaglevTable final {
+ public:
+  // The paper suggests at least 100 slots per endpoint for good balance.
+  static constexpr size_t kMinSlotsPerEndpoint = 100;
+  // Prime, and big enough for kMinSlotsPerEndpoint with up to 655 endpoints.
+  // TableSizeFor() grows tables past it for more endpoints.
+  static constexpr size_t kDefaultTableSize = 65537;
+  static constexpr size_t kMaxTableSize = 5000011;
+
+  // table_size must be prime.
+  MaglevTable(absl::Span<const HashLookupEndpoint> endpoints,
+              size_t table_size);
+
+  // Whether size is a valid table size: a prime no larger than kMaxTableSize.
+  static bool IsValidTableSize(uint64_t size);
+  // The largest valid table size no larger than limit, or 2 if there is none.
+  static size_t LargestValidTableSize(uint64_t limit);
+  // The table size to use for num_endpoints endpoints: the smallest valid
+  // size of at least min_size and kMinSlotsPerEndpoint slots per endpoint,
+  // or, if there is none within it, the largest valid size within cap.
+  static size_t TableSizeFor(size_t num_endpoints, uint64_t min_size,
+                             uint64_t cap);
+
+  size_t size() const { return table_.size(); }
+  size_t FindIndex(uint64_t request_hash) const {
+    GRPC_DCHECK(!table_.empty());
+    return request_hash % table_.size();
+  }
+  size_t endpoint_index(size_t index) const { return table_[index]; }
+
+ private:
+  std::vector<uint32_t> table_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_LOOKUP_TABLE_H
@@ -24,12 +24,12 @@
 #include <stdlib.h>
 
 #include <algorithm>
-#include <cmath>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "src/core/client_channel/client_channel_internal.h"
@@ -48,6 +48,7 @@
 #include "src/core/load_balancing/lb_policy_factory.h"
 #include "src/core/load_balancing/lb_policy_registry.h"
 #include "src/core/load_balancing/pick_first/pick_first.h"
+#include "src/core/load_balancing/ring_hash/lookup_table.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/debug_location.h"
@@ -62,7 +63,6 @@
 #include "src/core/util/work_serializer.h"
 #include "src/core/util/xxhash_inline.h"
 #include "absl/base/attributes.h"
-#include "absl/container/inlined_vector.h"
 #include "absl/log/log.h"
 #include "absl/random/random.h"
 #include "absl/status/status.h"
@@ -112,6 +112,8 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
   absl::string_view name() const override { return kRingHash; }
   size_t min_ring_size() const { return min_ring_size_; }
   size_t max_ring_size() const { return max_ring_size_; }
+  bool use_maglev() const { return lookup_table_ == "maglev"; }
+  size_t maglev_table_size() const { return maglev_table_size_; }
   absl::string_view request_hash_header() const { return request_hash_header_; }
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
@@ -119,6 +121,9 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
         JsonObjectLoader<RingHashLbConfig>()
             .OptionalField("minRingSize", &RingHashLbConfig::min_ring_size_)
             .OptionalField("maxRingSize", &RingHashLbConfig::max_ring_size_)
+            .OptionalField("lookupTable", &RingHashLbConfig::lookup_table_)
+            .OptionalField("maglevTableSize",
+                           &RingHashLbConfig::maglev_table_size_)
             .OptionalField("requestHashHeader",
                            &RingHashLbConfig::request_hash_header_,
                            "request_hash_header")
@@ -144,11 +149,28 @@ class RingHashLbConfig final : public LoadBalancingPolicy::Config {
     if (min_ring_size_ > max_ring_size_) {
       errors->AddError("maxRingSize cannot be smaller than minRingSize");
     }
+    {
+      ValidationErrors::ScopedField field(errors, ".lookupTable");
+      if (!errors->FieldHasErrors() && lookup_table_ != "ring" &&
+          lookup_table_ != "maglev") {
+        errors->AddError("must be \"ring\" or \"maglev\"");
+      }
+    }
+    {
+      ValidationErrors::ScopedField field(errors, ".maglevTableSize");
+      if (!errors->FieldHasErrors() &&
+          !MaglevTable::IsValidTableSize(maglev_table_size_)) {
+        errors->AddError(absl::StrCat("must be a prime no larger than ",
+                                      MaglevTable::kMaxTableSize));
+      }
+    }
   }
 
  private:
   uint64_t min_ring_size_ = 1024;
   uint64_t max_ring_size_ = 4096;
+  std::string lookup_table_ = "ring";
+  uint64_t maglev_table_size_ = MaglevTable::kDefaultTableSize;
   std::string request_hash_header_;
 };
 
@@ -168,20 +190,34 @@ class RingHash final : public LoadBalancingPolicy {
   void ResetBackoffLocked() override;
 
  private:
-  // A ring computed based on a config and address list.
+  // A ring (or Maglev table) computed based on a config and address list.
   class Ring final : public RefCounted<Ring> {
    public:
-    struct RingEntry {
-      uint64_t hash;
-      size_t endpoint_index;  // Index into RingHash::endpoints_.
-    };
-
     Ring(RingHash* ring_hash, RingHashLbConfig* config);
 
-    const std::vector<RingEntry>& ring() const { return ring_; }
+    size_t size() const {
+      return std::visit([](const auto& table) { return table.size(); },
+                        table_);
+    }
+    size_t FindIndex(uint64_t request_hash) const {
+      return std::visit(
+          [request_hash](const auto& table) {
+            return table.FindIndex(request_hash);
+          },
+          table_);
+    }
+    // Index into RingHash::endpoints_.
+    size_t endpoint_index(size_t index) const {
+      return std::visit(
+          [index](const auto& table) { return table.endpoint_index(index); },
+          table_);
+    }
 
    private:
-    std::vector<RingEntry> ring_;
+    static std::variant<HashRing, MaglevTable> Build(RingHash* ring_hash,
+                                                     RingHashLbConfig* config);
+
+    std::variant<HashRing, MaglevTable> table_;
   };
 
   // State for a particular endpoint.  Delegates to a pick_first child policy.
@@ -289,6 +325,34 @@ class RingHash final : public LoadBalancingPolicy {
       grpc_closure closure_;
     };
 
+    // Walks the ring from an index, yielding each endpoint the first time
+    // one of its entries comes up. Endpoints hold many entries each (a
+    // Maglev table has tens of thousands of slots), so looking past unusable
+    // endpoints stops once all of them have been seen rather than walking
+    // the whole ring.
+    class EndpointWalk final {
+     public:
+      EndpointWalk(const Ring& ring, size_t index, size_t num_endpoints)
+          : ring_(ring),
+            index_(index),
+            num_endpoints_(num_endpoints),
+            remaining_(num_endpoints) {}
+
+      // Returns the index into endpoints_ of the next endpoint, or nullopt
+      // once every endpoint has been yielded.
+      std::optional<size_t> Next();
+
+     private:
+      const Ring& ring_;
+      const size_t index_;
+      const size_t num_endpoints_;
+      size_t step_ = 0;
+      size_t remaining_;
+      // Allocated on the second call: most picks stop at the first endpoint.
+      std::vector<bool> seen_;
+      size_t first_ = 0;
+    };
+
     RefCountedPtr<RingHash> ring_hash_;
     RefCountedPtr<Ring> ring_;
     std::vector<RingHashEndpoint::EndpointInfo> endpoints_;
@@ -330,6 +394,27 @@ class RingHash final : public LoadBalancingPolicy {
 // RingHash::Picker
 //
 
+std::optional<size_t> RingHash::Picker::EndpointWalk::Next() {
+  while (remaining_ > 0 && step_ < ring_.size()) {
+    const size_t endpoint_index =
+        ring_.endpoint_index((index_ + step_) % ring_.size());
+    ++step_;
+    if (step_ == 1) {
+      first_ = endpoint_index;
+    } else {
+      if (seen_.empty()) {
+        seen_.resize(num_endpoints_);
+        seen_[first_] = true;
+      }
+      if (seen_[endpoint_index]) continue;
+      seen_[endpoint_index] = true;
+    }
+    --remaining_;
+    return endpoint_index;
+  }
+  return std::nullopt;
+}
+
 RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   // Determine request hash.
   bool using_random_hash = false;
@@ -355,39 +440,13 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
     }
   }
   // Find the index in the ring to use for this RPC.
-  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
-  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
-  // for lowp, highp, and index. Do not change them!
-  const auto& ring = ring_->ring();
-  int64_t lowp = 0;
-  int64_t highp = ring.size();
-  int64_t index = 0;
-  while (true) {
-    index = (lowp + highp) / 2;
-    if (index == static_cast<int64_t>(ring.size())) {
-      index = 0;
-      break;
-    }
-    uint64_t midval = ring[index].hash;
-    uint64_t midval1 = index == 0 ? 0 : ring[index - 1].hash;
-    if (request_hash <= midval && request_hash > midval1) {
-      break;
-    }
-    if (midval < request_hash) {
-      lowp = index + 1;
-    } else {
-      highp = index - 1;
-    }
-    if (lowp > highp) {
-      index = 0;
-      break;
-    }
-  }
+  const Ring& ring = *ring_;
+  const size_t index = ring.FindIndex(request_hash);
   // Find the first endpoint we can use from the selected index.
+  EndpointWalk walk(ring, index, endpoints_.size());
   if (!using_random_hash) {
-    for (size_t i = 0; i < ring.size(); ++i) {
-      const auto& entry = ring[(index + i) % ring.size()];
-      const auto& endpoint_info = endpoints_[entry.endpoint_index];
+    while (const std::optional<size_t> endpoint_index = walk.Next()) {
+      const auto& endpoint_info = endpoints_[*endpoint_index];
       switch (endpoint_info.state) {
         case GRPC_CHANNEL_READY:
           return endpoint_info.picker->Pick(args);
@@ -406,9 +465,8 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
     // Using a random hash.  We will use the first READY endpoint we
     // find, triggering at most one endpoint to attempt connecting.
     bool requested_connection = has_endpoint_in_connecting_state_;
-    for (size_t i = 0; i < ring.size(); ++i) {
-      const auto& entry = ring[(index + i) % ring.size()];
-      const auto& endpoint_info = endpoints_[entry.endpoint_index];
+    while (const std::optional<size_t> endpoint_index = walk.Next()) {
+      const auto& endpoint_info = endpoints_[*endpoint_index];
       if (endpoint_info.state == GRPC_CHANNEL_READY) {
         return endpoint_info.picker->Pick(args);
       }
@@ -423,7 +481,7 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   }
   std::string message = absl::StrCat(
       "ring hash cannot find a connected endpoint; first failure: ",
-      endpoints_[ring[index].endpoint_index].status.message());
+      endpoints_[ring.endpoint_index(index)].status.message());
   if (!resolution_note_.empty()) {
     absl::StrAppend(&message, " (", resolution_note_, ")");
   }
@@ -434,104 +492,48 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
 // RingHash::Ring
 //
 
-RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
-  // Store the weights while finding the sum.
-  struct EndpointWeight {
-    std::string hash_key;  // By default, endpoint's first address.
-    // Default weight is 1 for the cases where a weight is not provided,
-    // each occurrence of the address will be counted a weight value of 1.
-    uint32_t weight = 1;
-    double normalized_weight;
-  };
-  std::vector<EndpointWeight> endpoint_weights;
-  size_t sum = 0;
+RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config)
+    : table_(Build(ring_hash, config)) {}
+
+std::variant<HashRing, MaglevTable> RingHash::Ring::Build(
+    RingHash* ring_hash, RingHashLbConfig* config) {
   const EndpointAddressesList& endpoints = ring_hash->endpoints_;
-  endpoint_weights.reserve(endpoints.size());
+  std::vector<HashLookupEndpoint> lookup_endpoints;
+  lookup_endpoints.reserve(endpoints.size());
   for (const auto& endpoint : endpoints) {
-    EndpointWeight endpoint_weight;
+    HashLookupEndpoint lookup_endpoint;
     auto hash_key =
         endpoint.args().GetString(GRPC_ARG_RING_HASH_ENDPOINT_HASH_KEY);
     if (hash_key.has_value()) {
-      endpoint_weight.hash_key = std::string(*hash_key);
+      lookup_endpoint.hash_key = std::string(*hash_key);
     } else {
-      endpoint_weight.hash_key =
+      lookup_endpoint.hash_key =
           grpc_sockaddr_to_string(&endpoint.addresses().front(), false).value();
     }
+    // Default weight is 1 for the cases where a weight is not provided.
     // Weight should never be zero, but ignore it just in case, since
     // that value would screw up the ring-building algorithm.
     auto weight_arg = endpoint.args().GetInt(GRPC_ARG_ADDRESS_WEIGHT);
     if (weight_arg.value_or(0) > 0) {
-      endpoint_weight.weight = *weight_arg;
+      lookup_endpoint.weight = *weight_arg;
     }
-    sum += endpoint_weight.weight;
-    endpoint_weights.push_back(std::move(endpoint_weight));
+    lookup_endpoints.push_back(std::move(lookup_endpoint));
   }
-  // Calculating normalized weights and find min and max.
-  double min_normalized_weight = 1.0;
-  double max_normalized_weight = 0.0;
-  for (auto& endpoint_weight : endpoint_weights) {
-    endpoint_weight.normalized_weight =
-        static_cast<double>(endpoint_weight.weight) / sum;
-    min_normalized_weight =
-        std::min(endpoint_weight.normalized_weight, min_normalized_weight);
-    max_normalized_weight =
-        std::max(endpoint_weight.normalized_weight, max_normalized_weight);
+  if (config->use_maglev()) {
+    const size_t table_size_cap =
+        ring_hash->args_.GetInt(GRPC_ARG_RING_HASH_LB_MAGLEV_TABLE_SIZE_CAP)
+            .value_or(MaglevTable::kMaxTableSize);
+    return MaglevTable(lookup_endpoints,
+                       MaglevTable::TableSizeFor(lookup_endpoints.size(),
+                                                 config->maglev_table_size(),
+                                                 table_size_cap));
   }
-  // Scale up the number of hashes per host such that the least-weighted host
-  // gets a whole number of hashes on the ring. Other hosts might not end up
-  // with whole numbers, and that's fine (the ring-building algorithm below can
-  // handle this). This preserves the original implementation's behavior: when
-  // weights aren't provided, all hosts should get an equal number of hashes. In
-  // the case where this number exceeds the max_ring_size, it's scaled back down
-  // to fit.
   const size_t ring_size_cap =
       ring_hash->args_.GetInt(GRPC_ARG_RING_HASH_LB_RING_SIZE_CAP)
           .value_or(kRingSizeCapDefault);
-  const size_t min_ring_size = std::min(config->min_ring_size(), ring_size_cap);
-  const size_t max_ring_size = std::min(config->max_ring_size(), ring_size_cap);
-  const double scale = std::min(
-      std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
-      static_cast<double>(max_ring_size));
-  // Reserve memory for the entire ring up front.
-  const uint64_t ring_size = std::ceil(scale);
-  ring_.reserve(ring_size);
-  // Populate the hash ring by walking through the (host, weight) pairs in
-  // normalized_host_weights, and generating (scale * weight) hashes for each
-  // host. Since these aren't necessarily whole numbers, we maintain running
-  // sums -- current_hashes and target_hashes -- which allows us to populate the
-  // ring in a mostly stable way.
-  absl::InlinedVector<char, 196> hash_key_buffer;
-  double current_hashes = 0.0;
-  double target_hashes = 0.0;
-  uint64_t min_hashes_per_host = ring_size;
-  uint64_t max_hashes_per_host = 0;
-  for (size_t i = 0; i < endpoints.size(); ++i) {
-    const std::string& hash_key = endpoint_weights[i].hash_key;
-    hash_key_buffer.assign(hash_key.begin(), hash_key.end());
-    hash_key_buffer.emplace_back('_');
-    auto offset_start = hash_key_buffer.end();
-    target_hashes += scale * endpoint_weights[i].normalized_weight;
-    size_t count = 0;
-    while (current_hashes < target_hashes) {
-      const std::string count_str = absl::StrCat(count);
-      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
-      absl::string_view hash_key(hash_key_buffer.data(),
-                                 hash_key_buffer.size());
-      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
-      ring_.push_back({hash, i});
-      ++count;
-      ++current_hashes;
-      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
-    }
-    min_hashes_per_host =
-        std::min(static_cast<uint64_t>(i), min_hashes_per_host);
-    max_hashes_per_host =
-        std::max(static_cast<uint64_t>(i), max_hashes_per_host);
-  }
-  std::sort(ring_.begin(), ring_.end(),
-            [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
-              return lhs.hash < rhs.hash;
-            });
+  return HashRing(lookup_endpoints,
+                  std::min(config->min_ring_size(), ring_size_cap),
+                  std::min(config->max_ring_size(), ring_size_cap));
 }
 
 //
@@ -62,6 +62,7 @@ extern void RegisterOutlierDetectionLbPolicy(
     CoreConfiguration::Builder* builder);
 extern void RegisterWeightedTargetLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterPickFirstLbPolicy(CoreConfiguration::Builder* builder);
+extern void RegisterLeastRequestLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterRingHashLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterRoundRobinLbPolicy(CoreConfiguration::Builder* builder);
 extern void RegisterWeightedRoundRobinLbPolicy(
@@ -111,6 +112,7 @@ void BuildCoreConfiguration(CoreConfiguration::Builder* builder) {
   RegisterRoundRobinLbPolicy(builder);
   RegisterRingHashLbPolicy(builder);
   RegisterWeightedRoundRobinLbPolicy(builder);
+  RegisterLeastRequestLbPolicy(builder);
 #endif
   BuildClientChannelConfiguration(builder);
   SecurityRegisterHandshakerFactories(builder);
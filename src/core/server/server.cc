@@ -34,7 +34,6 @@
 #include <memory>
 #include <new>
 #include <optional>
-#include <queue>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -572,33 +571,34 @@ struct Server::RequestedCall {
 // The RealRequestMatcher is an implementation of RequestMatcherInterface that
 // actually uses all the features of RequestMatcherInterface: expecting the
 // application to explicitly request RPCs and then matching those to incoming
-// RPCs, along with a slow path by which incoming RPCs are put on a locked
-// pending list if they aren't able to be matched to an application request.
+// RPCs, along with a slow path by which incoming RPCs are put on a pending
+// queue if they aren't able to be matched to an application request.
+//
+// Requests and pending calls are both kept in per-cq queues, and neither side
+// takes a server-wide lock. Each side queues its item and then looks for a
+// counterpart in every cq's queue, starting at its own. Whoever ends up
+// holding a request or a call without a counterpart puts it back and looks
+// again, so that anything queued concurrently is never missed: of any request
+// and call queued at the same time, the one queued last will see the other.
 class Server::RealRequestMatcher : public RequestMatcherInterface {
  public:
   explicit RealRequestMatcher(Server* server)
-      : server_(server), requests_per_cq_(server->cqs_.size()) {}
+      : server_(server),
+        requests_per_cq_(server->cqs_.size()),
+        pending_per_cq_(server->cqs_.size()) {}
 
   ~RealRequestMatcher() override {
     for (LockedMultiProducerSingleConsumerQueue& queue : requests_per_cq_) {
       GRPC_CHECK_EQ(queue.Pop(), nullptr);
     }
-    GRPC_CHECK(pending_filter_stack_.empty());
-    GRPC_CHECK(pending_promises_.empty());
+    for (PendingQueue& queue : pending_per_cq_) {
+      GRPC_CHECK_EQ(queue.Pop(), nullptr);
+    }
   }
 
   void ZombifyPending() override {
-    while (!pending_filter_stack_.empty()) {
-      pending_filter_stack_.front().calld->SetState(
-          CallData::CallState::ZOMBIED);
-      pending_filter_stack_.front().calld->KillZombie();
-      pending_filter_stack_.pop();
-    }
-    while (!pending_promises_.empty()) {
-      pending_promises_.front()->Finish(absl::InternalError("Server closed"));
-      pending_promises_.pop();
-    }
-    zombified_ = true;
+    zombified_.store(true, std::memory_order_seq_cst);
+    DrainPending(absl::InternalError("Server closed"));
   }
 
   void KillRequests(grpc_error_handle error) override {
@@ -617,173 +617,68 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
 
   void RequestCallWithPossiblePublish(size_t request_queue_index,
                                       RequestedCall* call) override {
-    if (requests_per_cq_[request_queue_index].Push(&call->mpscq_node)) {
-      // this was the first queued request: we need to lock and start
-      // matching calls
-      struct NextPendingCall {
-        RequestedCall* rc = nullptr;
-        CallData* pending_filter_stack = nullptr;
-        PendingCallPromises pending_promise;
-      };
-      while (true) {
-        NextPendingCall pending_call;
-        {
-          MutexLock lock(&server_->mu_call_);
-          while (!pending_filter_stack_.empty() &&
-                 pending_filter_stack_.front().Age() >
-                     server_->max_time_in_pending_queue_) {
-            pending_filter_stack_.front().calld->SetState(
-                CallData::CallState::ZOMBIED);
-            pending_filter_stack_.front().calld->KillZombie();
-            pending_filter_stack_.pop();
-          }
-          if (!pending_promises_.empty()) {
-            pending_call.rc = reinterpret_cast<RequestedCall*>(
-                requests_per_cq_[request_queue_index].Pop());
-            if (pending_call.rc != nullptr) {
-              pending_call.pending_promise =
-                  std::move(pending_promises_.front());
-              pending_promises_.pop();
-            }
-          } else if (!pending_filter_stack_.empty()) {
-            pending_call.rc = reinterpret_cast<RequestedCall*>(
-                requests_per_cq_[request_queue_index].Pop());
-            if (pending_call.rc != nullptr) {
-              pending_call.pending_filter_stack =
-                  pending_filter_stack_.front().calld;
-              pending_filter_stack_.pop();
-            }
-          }
-        }
-        if (pending_call.rc == nullptr) break;
-        if (pending_call.pending_filter_stack != nullptr) {
-          if (!pending_call.pending_filter_stack->MaybeActivate()) {
-            // Zombied Call
-            pending_call.pending_filter_stack->KillZombie();
-            requests_per_cq_[request_queue_index].Push(
-                &pending_call.rc->mpscq_node);
-          } else {
-            pending_call.pending_filter_stack->Publish(request_queue_index,
-                                                       pending_call.rc);
-          }
-        } else {
-          if (!pending_call.pending_promise->Finish(
-                  server(), request_queue_index, pending_call.rc)) {
-            requests_per_cq_[request_queue_index].Push(
-                &pending_call.rc->mpscq_node);
-          }
-        }
-      }
+    QueueRequest(request_queue_index, call);
+    if (num_pending_.load(std::memory_order_relaxed) != 0) {
+      MatchPending(request_queue_index);
     }
   }
 
   void MatchOrQueue(size_t start_request_queue_index,
                     CallData* calld) override {
-    for (size_t i = 0; i < requests_per_cq_.size(); i++) {
-      size_t cq_idx = (start_request_queue_index + i) % requests_per_cq_.size();
-      RequestedCall* rc =
-          reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].TryPop());
-      if (rc != nullptr) {
-        calld->SetState(CallData::CallState::ACTIVATED);
-        calld->Publish(cq_idx, rc);
-        return;
-      }
-    }
-    // No cq to take the request found; queue it on the slow list.
-    // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
-    // an empty request queue, it will block until the call is actually
-    // added to the pending list.
-    RequestedCall* rc = nullptr;
-    size_t cq_idx = 0;
-    size_t loop_count;
-    {
-      MutexLock lock(&server_->mu_call_);
-      for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
-        cq_idx =
-            (start_request_queue_index + loop_count) % requests_per_cq_.size();
-        rc = reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].Pop());
-        if (rc != nullptr) {
-          break;
-        }
-      }
-      if (rc == nullptr) {
-        calld->SetState(CallData::CallState::PENDING);
-        pending_filter_stack_.push(PendingCallFilterStack{calld});
-        return;
-      }
+    size_t cq_idx;
+    RequestedCall* rc =
+        TryPopRequest(start_request_queue_index, /*blocking=*/false, &cq_idx);
+    if (rc != nullptr) {
+      calld->SetState(CallData::CallState::ACTIVATED);
+      calld->Publish(cq_idx, rc);
+      return;
     }
-    calld->SetState(CallData::CallState::ACTIVATED);
-    calld->Publish(cq_idx, rc);
+    // No cq to take the request found; queue it as pending, and match
+    // whatever requests were queued meanwhile.
+    calld->SetState(CallData::CallState::PENDING);
+    auto* pending = new PendingCall();
+    pending->calld = calld;
+    QueuePending(start_request_queue_index, pending);
+    MatchOrDrainPending(start_request_queue_index);
   }
 
   ArenaPromise<absl::StatusOr<MatchResult>> MatchRequest(
       size_t start_request_queue_index) override {
-    for (size_t i = 0; i < requests_per_cq_.size(); i++) {
-      size_t cq_idx = (start_request_queue_index + i) % requests_per_cq_.size();
-      RequestedCall* rc =
-          reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].TryPop());
-      if (rc != nullptr) {
-        return Immediate(MatchResult(server(), cq_idx, rc));
-      }
+    size_t cq_idx;
+    RequestedCall* rc =
+        TryPopRequest(start_request_queue_index, /*blocking=*/false, &cq_idx);
+    if (rc != nullptr) {
+      return Immediate(MatchResult(server(), cq_idx, rc));
     }
-    // No cq to take the request found; queue it on the slow list.
-    // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
-    // an empty request queue, it will block until the call is actually
-    // added to the pending list.
-    RequestedCall* rc = nullptr;
-    size_t cq_idx = 0;
-    size_t loop_count;
-    {
-      std::vector<std::shared_ptr<ActivityWaiter>> removed_pending;
-      MutexLock lock(&server_->mu_call_);
-      while (!pending_promises_.empty() &&
-             pending_promises_.front()->Age() >
-                 server_->max_time_in_pending_queue_) {
-        removed_pending.push_back(std::move(pending_promises_.front()));
-        pending_promises_.pop();
-      }
-      for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
-        cq_idx =
-            (start_request_queue_index + loop_count) % requests_per_cq_.size();
-        rc = reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].Pop());
-        if (rc != nullptr) break;
-      }
-      if (rc == nullptr) {
-        if (server_->pending_backlog_protector_.Reject(pending_promises_.size(),
-                                                       SharedBitGen())) {
-          return Immediate(absl::ResourceExhaustedError(
-              "Too many pending requests for this server"));
-        }
-        if (zombified_) {
-          return Immediate(absl::InternalError("Server closed"));
-        }
-        auto w = std::make_shared<ActivityWaiter>(
-            GetContext<Activity>()->MakeOwningWaker());
-        pending_promises_.push(w);
-        return OnCancel(
-            [w]() -> Poll<absl::StatusOr<MatchResult>> {
-              std::unique_ptr<absl::StatusOr<MatchResult>> r(
-                  w->result.exchange(nullptr, std::memory_order_acq_rel));
-              if (r == nullptr) return Pending{};
-              return std::move(*r);
-            },
-            [w]() { w->Finish(absl::CancelledError()); });
-      }
+    // No cq to take the request found; queue it as pending, and match
+    // whatever requests were queued meanwhile.
+    if (server_->pending_backlog_protector_.Reject(
+            num_pending_.load(std::memory_order_relaxed), SharedBitGen())) {
+      return Immediate(absl::ResourceExhaustedError(
+          "Too many pending requests for this server"));
     }
-    return Immediate(MatchResult(server(), cq_idx, rc));
+    if (zombified_.load(std::memory_order_relaxed)) {
+      return Immediate(absl::InternalError("Server closed"));
+    }
+    auto w = std::make_shared<ActivityWaiter>(
+        GetContext<Activity>()->MakeOwningWaker());
+    auto* pending = new PendingCall();
+    pending->promise = w;
+    QueuePending(start_request_queue_index, pending);
+    MatchOrDrainPending(start_request_queue_index);
+    return OnCancel(
+        [w]() -> Poll<absl::StatusOr<MatchResult>> {
+          std::unique_ptr<absl::StatusOr<MatchResult>> r(
+              w->result.exchange(nullptr, std::memory_order_acq_rel));
+          if (r == nullptr) return Pending{};
+          return std::move(*r);
+        },
+        [w]() { w->Finish(absl::CancelledError()); });
   }
 
   Server* server() const final { return server_; }
 
  private:
-  Server* const server_;
-  struct PendingCallFilterStack {
-    CallData* calld;
-    Timestamp created = Timestamp::Now();
-    Duration Age() { return Timestamp::Now() - created; }
-  };
   struct ActivityWaiter {
     using ResultType = absl::StatusOr<MatchResult>;
     explicit ActivityWaiter(Waker waker) : waker(std::move(waker)) {}
@@ -815,16 +710,199 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       waker.WakeupAsync();
       return true;
     }
-    Duration Age() { return Timestamp::Now() - created; }
     Waker waker;
     std::atomic<ResultType*> result{nullptr};
+  };
+  // An incoming call waiting for a request: either a filter stack call or a
+  // promise based one.
+  struct PendingCall {
+    MultiProducerSingleConsumerQueue::Node mpscq_node;
+    CallData* calld = nullptr;
+    std::shared_ptr<ActivityWaiter> promise;
+    // Index into pending_per_cq_ of the queue the call waits in.
+    size_t queue_index = 0;
     const Timestamp created = Timestamp::Now();
+    Duration Age() { return Timestamp::Now() - created; }
+  };
+
+  // A cq's pending calls, oldest first. Calls that MatchPending() took but
+  // could not match are put back at the head, so that they keep their place
+  // ahead of the calls queued after them.
+  class PendingQueue {
+   public:
+    void Push(PendingCall* pending) { queue_.Push(&pending->mpscq_node); }
+    void PushFront(PendingCall* pending) {
+      MutexLock lock(&mu_);
+      front_.push_back(pending);
+      front_size_.store(front_.size(), std::memory_order_relaxed);
+    }
+    // Returns nullptr only if the queue was empty at some point during the
+    // call.
+    PendingCall* Pop() {
+      if (front_size_.load(std::memory_order_relaxed) != 0) {
+        MutexLock lock(&mu_);
+        if (!front_.empty()) {
+          PendingCall* pending = front_.back();
+          front_.pop_back();
+          front_size_.store(front_.size(), std::memory_order_relaxed);
+          return pending;
+        }
+      }
+      return reinterpret_cast<PendingCall*>(queue_.Pop());
+    }
+
+   private:
+    LockedMultiProducerSingleConsumerQueue queue_;
+    Mutex mu_;
+    // Calls put back, the most recently put back (the oldest) last.
+    std::vector<PendingCall*> front_ ABSL_GUARDED_BY(mu_);
+    std::atomic<size_t> front_size_{0};
   };
-  using PendingCallPromises = std::shared_ptr<ActivityWaiter>;
-  std::queue<PendingCallFilterStack> pending_filter_stack_;
-  std::queue<PendingCallPromises> pending_promises_;
+
+  // Both sides publish their item before looking for the other side's: the
+  // fences order the two, so that at least one of a racing request and call
+  // sees the other.
+  void QueueRequest(size_t cq_idx, RequestedCall* rc) {
+    requests_per_cq_[cq_idx].Push(&rc->mpscq_node);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+
+  void QueuePending(size_t start_request_queue_index, PendingCall* pending) {
+    num_pending_.fetch_add(1, std::memory_order_relaxed);
+    pending->queue_index = start_request_queue_index % pending_per_cq_.size();
+    pending_per_cq_[pending->queue_index].Push(pending);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+
+  // Puts a call taken by MatchPending() back at the head of its queue.
+  void RequeuePending(PendingCall* pending) {
+    num_pending_.fetch_add(1, std::memory_order_relaxed);
+    pending_per_cq_[pending->queue_index].PushFront(pending);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+
+  // To be called after queueing a call. If the server closed while we were
+  // queueing, nothing else may be left to fail the call, so fail it along
+  // with any other pending call; otherwise match whatever requests were
+  // queued meanwhile.
+  void MatchOrDrainPending(size_t start_request_queue_index) {
+    if (zombified_.load(std::memory_order_seq_cst)) {
+      DrainPending(absl::InternalError("Server closed"));
+    } else {
+      MatchPending(start_request_queue_index);
+    }
+  }
+
+  // Pops a request from the first cq, starting at start_request_queue_index,
+  // that has one. With blocking set, only returns nullptr if every queue was
+  // empty at some point during the call.
+  RequestedCall* TryPopRequest(size_t start_request_queue_index, bool blocking,
+                               size_t* cq_idx) {
+    for (size_t i = 0; i < requests_per_cq_.size(); i++) {
+      *cq_idx = (start_request_queue_index + i) % requests_per_cq_.size();
+      LockedMultiProducerSingleConsumerQueue& queue = requests_per_cq_[*cq_idx];
+      auto* rc = reinterpret_cast<RequestedCall*>(blocking ? queue.Pop()
+                                                           : queue.TryPop());
+      if (rc != nullptr) return rc;
+    }
+    return nullptr;
+  }
+
+  // Pops the first pending call, starting at start_request_queue_index, that
+  // has not waited too long; calls that have are failed.
+  std::unique_ptr<PendingCall> PopPending(size_t start_request_queue_index) {
+    for (size_t i = 0; i < pending_per_cq_.size(); i++) {
+      PendingQueue& queue = pending_per_cq_[(start_request_queue_index + i) %
+                                            pending_per_cq_.size()];
+      while (true) {
+        std::unique_ptr<PendingCall> pending(queue.Pop());
+        if (pending == nullptr) break;
+        num_pending_.fetch_sub(1, std::memory_order_relaxed);
+        if (pending->Age() <= server_->max_time_in_pending_queue_) {
+          return pending;
+        }
+        Fail(*pending, absl::ResourceExhaustedError(
+                           "Timed out waiting for a request"));
+      }
+    }
+    return nullptr;
+  }
+
+  void Fail(PendingCall& pending, absl::Status status) {
+    if (pending.calld != nullptr) {
+      pending.calld->SetState(CallData::CallState::ZOMBIED);
+      pending.calld->KillZombie();
+    } else {
+      pending.promise->Finish(std::move(status));
+    }
+  }
+
+  // Returns true if rc was consumed: false if the call went away while
+  // pending.
+  bool Publish(PendingCall& pending, size_t cq_idx, RequestedCall* rc) {
+    if (pending.calld != nullptr) {
+      if (!pending.calld->MaybeActivate()) {
+        // Zombied call
+        pending.calld->KillZombie();
+        return false;
+      }
+      pending.calld->Publish(cq_idx, rc);
+      return true;
+    }
+    return pending.promise->Finish(server(), cq_idx, rc);
+  }
+
+  // Matches pending calls with requests until we run out of one or the other.
+  void MatchPending(size_t start_request_queue_index) {
+    while (true) {
+      std::unique_ptr<PendingCall> pending =
+          PopPending(start_request_queue_index);
+      if (pending == nullptr) return;
+      size_t cq_idx;
+      RequestedCall* rc =
+          TryPopRequest(start_request_queue_index, /*blocking=*/true, &cq_idx);
+      if (rc == nullptr) {
+        // Put the call back, then look again for a request that was queued
+        // while we held it, and so could not have seen it. If the server
+        // closed while we held it, ZombifyPending() could not have seen it
+        // either.
+        RequeuePending(pending.release());
+        if (zombified_.load(std::memory_order_seq_cst)) {
+          DrainPending(absl::InternalError("Server closed"));
+          return;
+        }
+        rc = TryPopRequest(start_request_queue_index, /*blocking=*/true,
+                           &cq_idx);
+        if (rc == nullptr) return;
+        pending = PopPending(start_request_queue_index);
+        if (pending == nullptr) {
+          // Someone else took the call: they'll look for requests again after
+          // we put this one back.
+          QueueRequest(cq_idx, rc);
+          continue;
+        }
+      }
+      if (!Publish(*pending, cq_idx, rc)) QueueRequest(cq_idx, rc);
+    }
+  }
+
+  // Fails every pending call.
+  void DrainPending(absl::Status status) {
+    for (PendingQueue& queue : pending_per_cq_) {
+      PendingCall* pending;
+      while ((pending = queue.Pop()) != nullptr) {
+        num_pending_.fetch_sub(1, std::memory_order_relaxed);
+        Fail(*pending, status);
+        delete pending;
+      }
+    }
+  }
+
+  Server* const server_;
   std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
-  bool zombified_ = false;
+  std::vector<PendingQueue> pending_per_cq_;
+  std::atomic<size_t> num_pending_{0};
+  std::atomic<bool> zombified_{false};
 };
 
 // AllocatingRequestMatchers don't allow the application to request an RPC in
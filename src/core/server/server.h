@@ -707,7 +707,7 @@ class Server : public ServerInterface,
   bool shutdown_published_ ABSL_GUARDED_BY(mu_global_) = false;
   std::vector<ShutdownTag> shutdown_tags_ ABSL_GUARDED_BY(mu_global_);
 
-  RandomEarlyDetection pending_backlog_protector_ ABSL_GUARDED_BY(mu_call_){
+  const RandomEarlyDetection pending_backlog_protector_{
       static_cast<uint64_t>(
           std::max(0, channel_args_.GetInt(GRPC_ARG_SERVER_MAX_PENDING_REQUESTS)
                           .value_or(1000))),
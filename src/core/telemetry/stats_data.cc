@@ -395,12 +395,18 @@ const absl::string_view
         "syscall_read",
         "tcp_read_alloc_8k",
         "tcp_read_alloc_64k",
+        "tcp_zerocopy_writes",
+        "tcp_zerocopy_writes_no_record",
+        "tcp_zerocopy_completions",
+        "tcp_zerocopy_completions_copied",
         "cq_pluck_creates",
         "cq_next_creates",
         "cq_callback_creates",
         "wrr_updates",
         "work_serializer_items_enqueued",
         "work_serializer_items_dequeued",
+        "thread_pool_steals",
+        "thread_pool_cross_node_steals",
         "econnaborted_count",
         "econnreset_count",
         "epipe_count",
@@ -426,6 +432,12 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of read syscalls (or equivalent - eg recvmsg) made by this process",
     "Number of 8k allocations by the TCP subsystem for reading",
     "Number of 64k allocations by the TCP subsystem for reading",
+    "Number of writes sent with MSG_ZEROCOPY",
+    "Number of writes that qualified for MSG_ZEROCOPY but were copied because "
+    "their endpoint already had its maximum of zerocopy sends in flight",
+    "Number of MSG_ZEROCOPY sends the kernel reported complete",
+    "Number of MSG_ZEROCOPY sends the kernel reported complete after copying "
+    "their data anyway",
     "Number of completion queues created for cq_pluck (indicates sync api "
     "usage)",
     "Number of completion queues created for cq_next (indicates cq async api "
@@ -435,6 +447,9 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of wrr updates that have been received",
     "Number of items enqueued onto work serializers",
     "Number of items dequeued from work serializers",
+    "Number of closures an EventEngine thread pool worker took from another "
+    "thread's queue or from another cache domain's queue",
+    "Number of thread pool steals that took a closure from another NUMA node",
     "Number of ECONNABORTED errors",
     "Number of ECONNRESET errors",
     "Number of EPIPE errors",
@@ -455,6 +470,9 @@ const absl::string_view
         "tcp_read_size",
         "tcp_read_offer",
         "tcp_read_offer_iov_size",
+        "tcp_zerocopy_threshold",
+        "tcp_zerocopy_max_sends",
+        "tcp_zerocopy_completion_latency",
         "wrr_subchannel_list_size",
         "wrr_subchannel_ready_size",
         "work_serializer_run_time_ms",
@@ -484,6 +502,11 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Number of bytes received by each syscall_read",
     "Number of bytes offered to each syscall_read",
     "Number of byte segments offered to each syscall_read",
+    "Write size from which the adaptive MSG_ZEROCOPY policy of an endpoint "
+    "sends with zerocopy, recorded each time it changes",
+    "Number of MSG_ZEROCOPY writes the adaptive policy of an endpoint allows "
+    "in flight, recorded each time it changes",
+    "Microseconds from a MSG_ZEROCOPY send to its completion notification",
     "Number of subchannels in a subchannel list at picker creation time",
     "Number of READY subchannels in a subchannel list at picker creation time",
     "Number of milliseconds work serializers run for",
@@ -517,12 +540,18 @@ GlobalStats::GlobalStats()
       syscall_read{0},
       tcp_read_alloc_8k{0},
       tcp_read_alloc_64k{0},
+      tcp_zerocopy_writes{0},
+      tcp_zerocopy_writes_no_record{0},
+      tcp_zerocopy_completions{0},
+      tcp_zerocopy_completions_copied{0},
       cq_pluck_creates{0},
       cq_next_creates{0},
       cq_callback_creates{0},
       wrr_updates{0},
       work_serializer_items_enqueued{0},
       work_serializer_items_dequeued{0},
+      thread_pool_steals{0},
+      thread_pool_cross_node_steals{0},
       econnaborted_count{0},
       econnreset_count{0},
       epipe_count{0},
@@ -556,6 +585,15 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kTcpReadOfferIovSize:
       return HistogramView{&Histogram_80_10_64::BucketFor, kStatsTable0, 10,
                            tcp_read_offer_iov_size.buckets()};
+    case Histogram::kTcpZerocopyThreshold:
+      return HistogramView{&Histogram_16777216_20_64::BucketFor, kStatsTable14,
+                           20, tcp_zerocopy_threshold.buckets()};
+    case Histogram::kTcpZerocopyMaxSends:
+      return HistogramView{&Histogram_80_10_64::BucketFor, kStatsTable0, 10,
+                           tcp_zerocopy_max_sends.buckets()};
+    case Histogram::kTcpZerocopyCompletionLatency:
+      return HistogramView{&Histogram_100000_20_64::BucketFor, kStatsTable8, 20,
+                           tcp_zerocopy_completion_latency.buckets()};
     case Histogram::kWrrSubchannelListSize:
       return HistogramView{&Histogram_10000_20_64::BucketFor, kStatsTable4, 20,
                            wrr_subchannel_list_size.buckets()};
@@ -640,6 +678,14 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.tcp_read_alloc_8k.load(std::memory_order_relaxed);
     result->tcp_read_alloc_64k +=
         data.tcp_read_alloc_64k.load(std::memory_order_relaxed);
+    result->tcp_zerocopy_writes +=
+        data.tcp_zerocopy_writes.load(std::memory_order_relaxed);
+    result->tcp_zerocopy_writes_no_record +=
+        data.tcp_zerocopy_writes_no_record.load(std::memory_order_relaxed);
+    result->tcp_zerocopy_completions +=
+        data.tcp_zerocopy_completions.load(std::memory_order_relaxed);
+    result->tcp_zerocopy_completions_copied +=
+        data.tcp_zerocopy_completions_copied.load(std::memory_order_relaxed);
     result->cq_pluck_creates +=
         data.cq_pluck_creates.load(std::memory_order_relaxed);
     result->cq_next_creates +=
@@ -651,6 +697,10 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.work_serializer_items_enqueued.load(std::memory_order_relaxed);
     result->work_serializer_items_dequeued +=
         data.work_serializer_items_dequeued.load(std::memory_order_relaxed);
+    result->thread_pool_steals +=
+        data.thread_pool_steals.load(std::memory_order_relaxed);
+    result->thread_pool_cross_node_steals +=
+        data.thread_pool_cross_node_steals.load(std::memory_order_relaxed);
     result->econnaborted_count +=
         data.econnaborted_count.load(std::memory_order_relaxed);
     result->econnreset_count +=
@@ -676,6 +726,10 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
     data.tcp_read_size.Collect(&result->tcp_read_size);
     data.tcp_read_offer.Collect(&result->tcp_read_offer);
     data.tcp_read_offer_iov_size.Collect(&result->tcp_read_offer_iov_size);
+    data.tcp_zerocopy_threshold.Collect(&result->tcp_zerocopy_threshold);
+    data.tcp_zerocopy_max_sends.Collect(&result->tcp_zerocopy_max_sends);
+    data.tcp_zerocopy_completion_latency.Collect(
+        &result->tcp_zerocopy_completion_latency);
     data.wrr_subchannel_list_size.Collect(&result->wrr_subchannel_list_size);
     data.wrr_subchannel_ready_size.Collect(&result->wrr_subchannel_ready_size);
     data.work_serializer_run_time_ms.Collect(
@@ -735,6 +789,13 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->syscall_read = syscall_read - other.syscall_read;
   result->tcp_read_alloc_8k = tcp_read_alloc_8k - other.tcp_read_alloc_8k;
   result->tcp_read_alloc_64k = tcp_read_alloc_64k - other.tcp_read_alloc_64k;
+  result->tcp_zerocopy_writes = tcp_zerocopy_writes - other.tcp_zerocopy_writes;
+  result->tcp_zerocopy_writes_no_record =
+      tcp_zerocopy_writes_no_record - other.tcp_zerocopy_writes_no_record;
+  result->tcp_zerocopy_completions =
+      tcp_zerocopy_completions - other.tcp_zerocopy_completions;
+  result->tcp_zerocopy_completions_copied =
+      tcp_zerocopy_completions_copied - other.tcp_zerocopy_completions_copied;
   result->cq_pluck_creates = cq_pluck_creates - other.cq_pluck_creates;
   result->cq_next_creates = cq_next_creates - other.cq_next_creates;
   result->cq_callback_creates = cq_callback_creates - other.cq_callback_creates;
@@ -743,6 +804,9 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       work_serializer_items_enqueued - other.work_serializer_items_enqueued;
   result->work_serializer_items_dequeued =
       work_serializer_items_dequeued - other.work_serializer_items_dequeued;
+  result->thread_pool_steals = thread_pool_steals - other.thread_pool_steals;
+  result->thread_pool_cross_node_steals =
+      thread_pool_cross_node_steals - other.thread_pool_cross_node_steals;
   result->econnaborted_count = econnaborted_count - other.econnaborted_count;
   result->econnreset_count = econnreset_count - other.econnreset_count;
   result->epipe_count = epipe_count - other.epipe_count;
@@ -763,6 +827,12 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->tcp_read_offer = tcp_read_offer - other.tcp_read_offer;
   result->tcp_read_offer_iov_size =
       tcp_read_offer_iov_size - other.tcp_read_offer_iov_size;
+  result->tcp_zerocopy_threshold =
+      tcp_zerocopy_threshold - other.tcp_zerocopy_threshold;
+  result->tcp_zerocopy_max_sends =
+      tcp_zerocopy_max_sends - other.tcp_zerocopy_max_sends;
+  result->tcp_zerocopy_completion_latency =
+      tcp_zerocopy_completion_latency - other.tcp_zerocopy_completion_latency;
   result->wrr_subchannel_list_size =
       wrr_subchannel_list_size - other.wrr_subchannel_list_size;
   result->wrr_subchannel_ready_size =
@@ -852,6 +922,9 @@ const absl::string_view
         "http2_stream_window_update_period",
         "http2_write_data_frame_size",
         "http2_read_data_frame_size",
+        "http2_frames_per_write",
+        "http2_write_size",
+        "http2_write_coalescing_delay",
         "http2_write_target_size",
 };
 const absl::string_view Http2GlobalStats::histogram_doc[static_cast<int>(
@@ -872,6 +945,10 @@ const absl::string_view Http2GlobalStats::histogram_doc[static_cast<int>(
     "Period in milliseconds at which peer sends stream window update",
     "Number of bytes for each data frame written",
     "Number of bytes for each data frame read",
+    "Number of frames gathered into each HTTP2 write",
+    "Number of bytes handed to the endpoint by each HTTP2 write",
+    "Microseconds that an HTTP2 write was held back to coalesce it with later "
+    "frames",
     "Number of bytes targeted for http2 writes",
 };
 Http2GlobalStats::Http2GlobalStats()
@@ -932,6 +1009,15 @@ HistogramView Http2GlobalStats::histogram(Histogram which) const {
     case Histogram::kHttp2ReadDataFrameSize:
       return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable16,
                            50, http2_read_data_frame_size.buckets()};
+    case Histogram::kHttp2FramesPerWrite:
+      return HistogramView{&Histogram_10000_20_64::BucketFor, kStatsTable4, 20,
+                           http2_frames_per_write.buckets()};
+    case Histogram::kHttp2WriteSize:
+      return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable16,
+                           50, http2_write_size.buckets()};
+    case Histogram::kHttp2WriteCoalescingDelay:
+      return HistogramView{&Histogram_100000_20_64::BucketFor, kStatsTable8, 20,
+                           http2_write_coalescing_delay.buckets()};
     case Histogram::kHttp2WriteTargetSize:
       return HistogramView{&Histogram_16777216_50_64::BucketFor, kStatsTable16,
                            50, http2_write_target_size.buckets()};
@@ -979,6 +1065,10 @@ std::unique_ptr<Http2GlobalStats> Http2GlobalStatsCollector::Collect() const {
         &result->http2_write_data_frame_size);
     data.http2_read_data_frame_size.Collect(
         &result->http2_read_data_frame_size);
+    data.http2_frames_per_write.Collect(&result->http2_frames_per_write);
+    data.http2_write_size.Collect(&result->http2_write_size);
+    data.http2_write_coalescing_delay.Collect(
+        &result->http2_write_coalescing_delay);
     data.http2_write_target_size.Collect(&result->http2_write_target_size);
   }
   return result;
@@ -1029,6 +1119,11 @@ std::unique_ptr<Http2GlobalStats> Http2GlobalStats::Diff(
       http2_write_data_frame_size - other.http2_write_data_frame_size;
   result->http2_read_data_frame_size =
       http2_read_data_frame_size - other.http2_read_data_frame_size;
+  result->http2_frames_per_write =
+      http2_frames_per_write - other.http2_frames_per_write;
+  result->http2_write_size = http2_write_size - other.http2_write_size;
+  result->http2_write_coalescing_delay =
+      http2_write_coalescing_delay - other.http2_write_coalescing_delay;
   result->http2_write_target_size =
       http2_write_target_size - other.http2_write_target_size;
   return result;
@@ -281,12 +281,18 @@ struct GlobalStats {
     kSyscallRead,
     kTcpReadAlloc8k,
     kTcpReadAlloc64k,
+    kTcpZerocopyWrites,
+    kTcpZerocopyWritesNoRecord,
+    kTcpZerocopyCompletions,
+    kTcpZerocopyCompletionsCopied,
     kCqPluckCreates,
     kCqNextCreates,
     kCqCallbackCreates,
     kWrrUpdates,
     kWorkSerializerItemsEnqueued,
     kWorkSerializerItemsDequeued,
+    kThreadPoolSteals,
+    kThreadPoolCrossNodeSteals,
     kEconnabortedCount,
     kEconnresetCount,
     kEpipeCount,
@@ -307,6 +313,9 @@ struct GlobalStats {
     kTcpReadSize,
     kTcpReadOffer,
     kTcpReadOfferIovSize,
+    kTcpZerocopyThreshold,
+    kTcpZerocopyMaxSends,
+    kTcpZerocopyCompletionLatency,
     kWrrSubchannelListSize,
     kWrrSubchannelReadySize,
     kWorkSerializerRunTimeMs,
@@ -348,12 +357,18 @@ struct GlobalStats {
       uint64_t syscall_read;
       uint64_t tcp_read_alloc_8k;
       uint64_t tcp_read_alloc_64k;
+      uint64_t tcp_zerocopy_writes;
+      uint64_t tcp_zerocopy_writes_no_record;
+      uint64_t tcp_zerocopy_completions;
+      uint64_t tcp_zerocopy_completions_copied;
       uint64_t cq_pluck_creates;
       uint64_t cq_next_creates;
       uint64_t cq_callback_creates;
       uint64_t wrr_updates;
       uint64_t work_serializer_items_enqueued;
       uint64_t work_serializer_items_dequeued;
+      uint64_t thread_pool_steals;
+      uint64_t thread_pool_cross_node_steals;
       uint64_t econnaborted_count;
       uint64_t econnreset_count;
       uint64_t epipe_count;
@@ -374,6 +389,9 @@ struct GlobalStats {
   Histogram_16777216_20_64 tcp_read_size;
   Histogram_16777216_20_64 tcp_read_offer;
   Histogram_80_10_64 tcp_read_offer_iov_size;
+  Histogram_16777216_20_64 tcp_zerocopy_threshold;
+  Histogram_80_10_64 tcp_zerocopy_max_sends;
+  Histogram_100000_20_64 tcp_zerocopy_completion_latency;
   Histogram_10000_20_64 wrr_subchannel_list_size;
   Histogram_10000_20_64 wrr_subchannel_ready_size;
   Histogram_100000_20_64 work_serializer_run_time_ms;
@@ -436,6 +454,22 @@ class GlobalStatsCollector {
   void IncrementTcpReadAlloc64k() {
     data_.this_cpu().tcp_read_alloc_64k.fetch_add(1, std::memory_order_relaxed);
   }
+  void IncrementTcpZerocopyWrites() {
+    data_.this_cpu().tcp_zerocopy_writes.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTcpZerocopyWritesNoRecord() {
+    data_.this_cpu().tcp_zerocopy_writes_no_record.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTcpZerocopyCompletions() {
+    data_.this_cpu().tcp_zerocopy_completions.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTcpZerocopyCompletionsCopied() {
+    data_.this_cpu().tcp_zerocopy_completions_copied.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementCqPluckCreates() {
     data_.this_cpu().cq_pluck_creates.fetch_add(1, std::memory_order_relaxed);
   }
@@ -457,6 +491,13 @@ class GlobalStatsCollector {
     data_.this_cpu().work_serializer_items_dequeued.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementThreadPoolSteals() {
+    data_.this_cpu().thread_pool_steals.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementThreadPoolCrossNodeSteals() {
+    data_.this_cpu().thread_pool_cross_node_steals.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementEconnabortedCount() {
     data_.this_cpu().econnaborted_count.fetch_add(1, std::memory_order_relaxed);
   }
@@ -510,6 +551,15 @@ class GlobalStatsCollector {
   void IncrementTcpReadOfferIovSize(int value) {
     data_.this_cpu().tcp_read_offer_iov_size.Increment(value);
   }
+  void IncrementTcpZerocopyThreshold(int value) {
+    data_.this_cpu().tcp_zerocopy_threshold.Increment(value);
+  }
+  void IncrementTcpZerocopyMaxSends(int value) {
+    data_.this_cpu().tcp_zerocopy_max_sends.Increment(value);
+  }
+  void IncrementTcpZerocopyCompletionLatency(int value) {
+    data_.this_cpu().tcp_zerocopy_completion_latency.Increment(value);
+  }
   void IncrementWrrSubchannelListSize(int value) {
     data_.this_cpu().wrr_subchannel_list_size.Increment(value);
   }
@@ -586,12 +636,18 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> syscall_read{0};
     std::atomic<uint64_t> tcp_read_alloc_8k{0};
     std::atomic<uint64_t> tcp_read_alloc_64k{0};
+    std::atomic<uint64_t> tcp_zerocopy_writes{0};
+    std::atomic<uint64_t> tcp_zerocopy_writes_no_record{0};
+    std::atomic<uint64_t> tcp_zerocopy_completions{0};
+    std::atomic<uint64_t> tcp_zerocopy_completions_copied{0};
     std::atomic<uint64_t> cq_pluck_creates{0};
     std::atomic<uint64_t> cq_next_creates{0};
     std::atomic<uint64_t> cq_callback_creates{0};
     std::atomic<uint64_t> wrr_updates{0};
     std::atomic<uint64_t> work_serializer_items_enqueued{0};
     std::atomic<uint64_t> work_serializer_items_dequeued{0};
+    std::atomic<uint64_t> thread_pool_steals{0};
+    std::atomic<uint64_t> thread_pool_cross_node_steals{0};
     std::atomic<uint64_t> econnaborted_count{0};
     std::atomic<uint64_t> econnreset_count{0};
     std::atomic<uint64_t> epipe_count{0};
@@ -609,6 +665,9 @@ class GlobalStatsCollector {
     HistogramCollector_16777216_20_64 tcp_read_size;
     HistogramCollector_16777216_20_64 tcp_read_offer;
     HistogramCollector_80_10_64 tcp_read_offer_iov_size;
+    HistogramCollector_16777216_20_64 tcp_zerocopy_threshold;
+    HistogramCollector_80_10_64 tcp_zerocopy_max_sends;
+    HistogramCollector_100000_20_64 tcp_zerocopy_completion_latency;
     HistogramCollector_10000_20_64 wrr_subchannel_list_size;
     HistogramCollector_10000_20_64 wrr_subchannel_ready_size;
     HistogramCollector_100000_20_64 work_serializer_run_time_ms;
@@ -662,6 +721,9 @@ struct Http2GlobalStats {
     kHttp2StreamWindowUpdatePeriod,
     kHttp2WriteDataFrameSize,
     kHttp2ReadDataFrameSize,
+    kHttp2FramesPerWrite,
+    kHttp2WriteSize,
+    kHttp2WriteCoalescingDelay,
     kHttp2WriteTargetSize,
     COUNT
   };
@@ -699,6 +761,9 @@ struct Http2GlobalStats {
   Histogram_100000_20_64 http2_stream_window_update_period;
   Histogram_16777216_50_64 http2_write_data_frame_size;
   Histogram_16777216_50_64 http2_read_data_frame_size;
+  Histogram_10000_20_64 http2_frames_per_write;
+  Histogram_16777216_50_64 http2_write_size;
+  Histogram_100000_20_64 http2_write_coalescing_delay;
   Histogram_16777216_50_64 http2_write_target_size;
   HistogramView histogram(Histogram which) const;
   std::unique_ptr<Http2GlobalStats> Diff(const Http2GlobalStats& other) const;
@@ -780,6 +845,15 @@ class Http2GlobalStatsCollector {
   void IncrementHttp2ReadDataFrameSize(int value) {
     data_.this_cpu().http2_read_data_frame_size.Increment(value);
   }
+  void IncrementHttp2FramesPerWrite(int value) {
+    data_.this_cpu().http2_frames_per_write.Increment(value);
+  }
+  void IncrementHttp2WriteSize(int value) {
+    data_.this_cpu().http2_write_size.Increment(value);
+  }
+  void IncrementHttp2WriteCoalescingDelay(int value) {
+    data_.this_cpu().http2_write_coalescing_delay.Increment(value);
+  }
 
  private:
   void IncrementHttp2WriteTargetSize(int value) {
@@ -811,6 +885,9 @@ class Http2GlobalStatsCollector {
     HistogramCollector_100000_20_64 http2_stream_window_update_period;
     HistogramCollector_16777216_50_64 http2_write_data_frame_size;
     HistogramCollector_16777216_50_64 http2_read_data_frame_size;
+    HistogramCollector_10000_20_64 http2_frames_per_write;
+    HistogramCollector_16777216_50_64 http2_write_size;
+    HistogramCollector_100000_20_64 http2_write_coalescing_delay;
     HistogramCollector_16777216_50_64 http2_write_target_size;
   };
   PerCpu<Data> data_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
@@ -906,6 +983,15 @@ class Http2StatsCollector {
   void IncrementHttp2ReadDataFrameSize(int value) {
     http2_global_stats().IncrementHttp2ReadDataFrameSize(value);
   }
+  void IncrementHttp2FramesPerWrite(int value) {
+    http2_global_stats().IncrementHttp2FramesPerWrite(value);
+  }
+  void IncrementHttp2WriteSize(int value) {
+    http2_global_stats().IncrementHttp2WriteSize(value);
+  }
+  void IncrementHttp2WriteCoalescingDelay(int value) {
+    http2_global_stats().IncrementHttp2WriteCoalescingDelay(value);
+  }
   void IncrementHttp2WriteTargetSize(int value) {
     data_.http2_write_target_size.Increment(value);
     http2_global_stats().IncrementHttp2WriteTargetSize(value);
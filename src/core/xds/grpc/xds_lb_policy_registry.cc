@@ -26,6 +26,7 @@
 #include <utility>
 #include <variant>
 
+#include "envoy/config/cluster/v3/cluster.upb.h"
 #include "envoy/config/core/v3/extension.upb.h"
 #include "envoy/extensions/load_balancing_policies/client_side_weighted_round_robin/v3/client_side_weighted_round_robin.upb.h"
 #include "envoy/extensions/load_balancing_policies/pick_first/v3/pick_first.upb.h"
@@ -210,6 +211,50 @@ class RingHashLbPolicyConfigFactory final
   }
 };
 
+class LeastRequestLbPolicyConfigFactory final
+    : public XdsLbPolicyRegistry::ConfigFactory {
+ public:
+  Json::Object ConvertXdsLbPolicyConfig(
+      const XdsLbPolicyRegistry* /*registry*/,
+      const XdsResourceType::DecodeContext& context,
+      absl::string_view configuration, ValidationErrors* errors,
+      int /*recursion_depth*/) override {
+    // The LeastRequest extension was split out of the Cluster proto with
+    // its field numbers and types unchanged, so it is decoded with the
+    // legacy Cluster.LeastRequestLbConfig message.  Fields added to the
+    // extension since then are left as unknown fields.
+    const auto* resource =
+        envoy_config_cluster_v3_Cluster_LeastRequestLbConfig_parse(
+            configuration.data(), configuration.size(), context.arena);
+    if (resource == nullptr) {
+      errors->AddError("can't decode LeastRequest LB policy config");
+      return {};
+    }
+    uint32_t choice_count =
+        ParseUInt32Value(
+            envoy_config_cluster_v3_Cluster_LeastRequestLbConfig_choice_count(
+                resource))
+            .value_or(2);
+    if (choice_count < 2) {
+      ValidationErrors::ScopedField field(errors, ".choice_count");
+      errors->AddError("must be at least 2");
+    }
+    return Json::Object{
+        {"least_request_experimental",
+         Json::FromObject({
+             {"choiceCount", Json::FromNumber(choice_count)},
+         })},
+    };
+  }
+
+  absl::string_view type() override { return Type(); }
+
+  static absl::string_view Type() {
+    return "envoy.extensions.load_balancing_policies.least_request.v3."
+           "LeastRequest";
+  }
+};
+
 class WrrLocalityLbPolicyConfigFactory final
     : public XdsLbPolicyRegistry::ConfigFactory {
  public:
@@ -303,6 +348,9 @@ XdsLbPolicyRegistry::XdsLbPolicyRegistry() {
   policy_config_factories_.emplace(
       PickFirstLbPolicyConfigFactory::Type(),
       std::make_unique<PickFirstLbPolicyConfigFactory>());
+  policy_config_factories_.emplace(
+      LeastRequestLbPolicyConfigFactory::Type(),
+      std::make_unique<LeastRequestLbPolicyConfigFactory>());
 }
 
 Json::Array XdsLbPolicyRegistry::ConvertXdsLbPolicyConfig(
@@ -28,6 +28,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -71,6 +72,43 @@ TEST(CallArenaAllocatorTest, SettlesWithAllocation) {
   LOG(INFO) << estimate;
 }
 
+TEST(CallArenaAllocatorTest, ReusesArenaStorage) {
+  auto allocator = MakeRefCounted<CallArenaAllocator>(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+          "test-allocator"),
+      1024);
+  int reused = 0;
+  for (int i = 0; i < 100; i++) {
+    auto arena = allocator->MakeArena();
+    Arena* first = arena.get();
+    arena.reset();
+    arena = allocator->MakeArena();
+    if (arena.get() == first) ++reused;
+  }
+  // Allow for the occasional move to another cpu between the two arenas.
+  EXPECT_GE(reused, 90);
+}
+
+TEST(CallArenaAllocatorTest, ChangingCallSizesAcrossThreads) {
+  // Destroying the allocator checks that all the memory reserved for pooled
+  // arenas was given back.
+  MemoryQuota memory_quota(MakeRefCounted<channelz::ResourceQuotaNode>("foo"));
+  auto allocator = MakeRefCounted<CallArenaAllocator>(
+      memory_quota.CreateMemoryAllocator("test-allocator"), 1);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; i++) {
+    threads.emplace_back([allocator, i]() {
+      for (int j = 0; j < 2000; j++) {
+        auto arena = allocator->MakeArena();
+        // Drift the call size up and down so that the arena size changes.
+        const size_t size = 64 + 64 * ((i + j / 100) % 32);
+        memset(arena->Alloc(size), 0, size);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char* argv[]) {
@@ -0,0 +1,164 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
+
+#include <grpc/support/port_platform.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#ifdef GPR_LINUX
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#endif  // GPR_LINUX
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+// Two nodes, each with two last-level caches of two CPUs.
+CpuTopology TwoNodes() {
+  return CpuTopology({{0, {0, 1}}, {0, {2, 3}}, {1, {4, 5}}, {1, {6, 7}}});
+}
+
+TEST(CpuTopologyTest, ParseCpuList) {
+  EXPECT_THAT(ParseCpuList("0"), ElementsAre(0));
+  EXPECT_THAT(ParseCpuList("0-3\n"), ElementsAre(0, 1, 2, 3));
+  EXPECT_THAT(ParseCpuList("8,0-1,10-11"), ElementsAre(0, 1, 8, 10, 11));
+  EXPECT_THAT(ParseCpuList("1,1,0-1"), ElementsAre(0, 1));
+}
+
+TEST(CpuTopologyTest, ParseCpuListSkipsMalformedParts) {
+  EXPECT_THAT(ParseCpuList(""), IsEmpty());
+  EXPECT_THAT(ParseCpuList("x,3-1,2"), ElementsAre(2));
+  EXPECT_THAT(ParseCpuList("-1,4-"), IsEmpty());
+}
+
+TEST(CpuTopologyTest, NeighborsPreferTheSameNode) {
+  CpuTopology topology = TwoNodes();
+  EXPECT_THAT(topology.NeighborsOf(0), ElementsAre(0, 1, 2, 3));
+  EXPECT_THAT(topology.NeighborsOf(1), ElementsAre(1, 0, 2, 3));
+  EXPECT_THAT(topology.NeighborsOf(2), ElementsAre(2, 3, 0, 1));
+  EXPECT_THAT(topology.NeighborsOf(3), ElementsAre(3, 2, 0, 1));
+  EXPECT_TRUE(topology.SameNode(0, 1));
+  EXPECT_FALSE(topology.SameNode(1, 2));
+}
+
+TEST(CpuTopologyTest, DomainOfCpu) {
+  CpuTopology topology = TwoNodes();
+  EXPECT_EQ(topology.DomainOfCpu(0), 0);
+  EXPECT_EQ(topology.DomainOfCpu(3), 1);
+  EXPECT_EQ(topology.DomainOfCpu(4), 2);
+  EXPECT_EQ(topology.DomainOfCpu(7), 3);
+  // Unknown CPUs fall back to the first domain.
+  EXPECT_EQ(topology.DomainOfCpu(-1), 0);
+  EXPECT_EQ(topology.DomainOfCpu(64), 0);
+}
+
+TEST(CpuTopologyTest, MachineTopologyIsUsable) {
+  const CpuTopology& topology = CpuTopology::Get();
+  ASSERT_GE(topology.num_domains(), 1);
+  for (size_t d = 0; d < topology.num_domains(); ++d) {
+    EXPECT_THAT(topology.domains()[d].cpus, ::testing::Not(IsEmpty()));
+    EXPECT_EQ(topology.NeighborsOf(d).size(), topology.num_domains());
+    EXPECT_EQ(topology.NeighborsOf(d).front(), d);
+  }
+  EXPECT_LT(topology.CurrentDomain(), topology.num_domains());
+}
+
+#ifdef GPR_LINUX
+class FakeSysfs {
+ public:
+  FakeSysfs() {
+    char dir[] = "/tmp/cpu_topology_test_XXXXXX";
+    root_ = mkdtemp(dir);
+  }
+
+  const std::string& root() const { return root_; }
+
+  void Write(const std::string& path, const std::string& contents) {
+    std::string dir = root_;
+    std::vector<std::string> parts = absl::StrSplit(path, '/');
+    for (size_t i = 0; i + 1 < parts.size(); ++i) {
+      absl::StrAppend(&dir, "/", parts[i]);
+      mkdir(dir.c_str(), 0700);
+    }
+    FILE* f = fopen(absl::StrCat(root_, "/", path).c_str(), "w");
+    ASSERT_NE(f, nullptr);
+    fputs(contents.c_str(), f);
+    fclose(f);
+  }
+
+ private:
+  std::string root_;
+};
+
+TEST(CpuTopologyTest, FromSysfs) {
+  FakeSysfs sysfs;
+  sysfs.Write("cpu/online", "0-5\n");
+  sysfs.Write("node/online", "0-1\n");
+  sysfs.Write("node/node0/cpulist", "0-1,4\n");
+  sysfs.Write("node/node1/cpulist", "2-3,5\n");
+  for (int cpu = 0; cpu < 6; ++cpu) {
+    const std::string cache = absl::StrCat("cpu/cpu", cpu, "/cache/");
+    sysfs.Write(cache + "index0/level", "1\n");
+    sysfs.Write(cache + "index0/shared_cpu_list", absl::StrCat(cpu, "\n"));
+    // Node 0 has one shared cache; node 1 has two.
+    sysfs.Write(cache + "index1/level", "3\n");
+    sysfs.Write(cache + "index1/shared_cpu_list",
+                cpu == 5 ? "5\n" : cpu < 2 || cpu == 4 ? "0-1,4\n" : "2-3\n");
+  }
+  CpuTopology topology = CpuTopology::FromSysfs(sysfs.root());
+  ASSERT_EQ(topology.num_domains(), 3);
+  EXPECT_EQ(topology.domains()[0].node, 0);
+  EXPECT_THAT(topology.domains()[0].cpus, ElementsAre(0, 1, 4));
+  EXPECT_EQ(topology.domains()[1].node, 1);
+  EXPECT_THAT(topology.domains()[1].cpus, ElementsAre(2, 3));
+  EXPECT_EQ(topology.domains()[2].node, 1);
+  EXPECT_THAT(topology.domains()[2].cpus, ElementsAre(5));
+}
+
+TEST(CpuTopologyTest, FromSysfsWithoutNodesOrCaches) {
+  FakeSysfs sysfs;
+  sysfs.Write("cpu/online", "0-3\n");
+  CpuTopology topology = CpuTopology::FromSysfs(sysfs.root());
+  // Without node or cache information all CPUs share one domain.
+  ASSERT_EQ(topology.num_domains(), 1);
+  EXPECT_EQ(topology.domains()[0].node, 0);
+  EXPECT_THAT(topology.domains()[0].cpus, ElementsAre(0, 1, 2, 3));
+}
+#endif  // GPR_LINUX
+
+}  // namespace
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
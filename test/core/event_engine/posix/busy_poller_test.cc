@@ -0,0 +1,271 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/busy_poller.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "src/core/config/config_vars.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/util/notification.h"
+#include "src/core/util/sync.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/functional/function_ref.h"
+#include "absl/time/time.h"
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/util/wait_for_single_owner.h"
+#include "test/core/event_engine/event_engine_test_utils.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+// Stands in for a poller: each poll makes ready what MakeReady() was given
+// since the last one, as if fds had become readable.
+class FakePoller final : public PosixEventPoller {
+ public:
+  explicit FakePoller(ThreadPool* executor) : executor_(executor) {}
+
+  void MakeReady(absl::AnyInvocable<void()> closure) {
+    grpc_core::MutexLock lock(&mu_);
+    pending_.push_back(std::move(closure));
+  }
+
+  WorkResult Work(EventEngine::Duration /*timeout*/,
+                  absl::FunctionRef<void()> schedule_poll_again) override {
+    std::vector<absl::AnyInvocable<void()>> ready;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      ready.swap(pending_);
+    }
+    if (ready.empty()) return WorkResult::kDeadlineExceeded;
+    schedule_poll_again();
+    for (auto& closure : ready) executor_->Run(std::move(closure));
+    return WorkResult::kOk;
+  }
+  void Kick() override {}
+  EventHandle* CreateHandle(FileDescriptor /*fd*/, absl::string_view /*name*/,
+                            bool /*track_err*/) override {
+    return nullptr;
+  }
+  bool CanTrackErrors() const override { return false; }
+  std::string Name() override { return "fake"; }
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+  void HandleForkInChild() override {}
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+  void ResetKickState() override {}
+
+ private:
+  ThreadPool* const executor_;
+  grpc_core::Mutex mu_;
+  std::vector<absl::AnyInvocable<void()>> pending_ ABSL_GUARDED_BY(mu_);
+};
+
+class BusyPollerTest : public ::testing::Test {
+ protected:
+  BusyPollerTest()
+      : thread_pool_(MakeThreadPool(2)),
+        executor_(BusyPoller::MakeExecutor(thread_pool_)),
+        poller_(std::make_shared<FakePoller>(executor_.get())) {}
+  ~BusyPollerTest() override { thread_pool_->Quiesce(); }
+
+  // Makes ready a chain of `length` closures, each scheduling the next on the
+  // poller's executor, and returns the thread each ran on.
+  std::vector<std::thread::id> RunChain(size_t length) {
+    std::vector<std::thread::id> threads;
+    grpc_core::Notification done;
+    std::function<void()> link = [&]() {
+      threads.push_back(std::this_thread::get_id());
+      if (threads.size() == length) {
+        done.Notify();
+      } else {
+        executor_->Run(link);
+      }
+    };
+    poller_->MakeReady(link);
+    done.WaitForNotification();
+    return threads;
+  }
+
+  // Makes ready a closure that runs `closure` `depth` closures deep.
+  void MakeReadyAtDepth(int depth, absl::AnyInvocable<void()> closure) {
+    poller_->MakeReady(Nest(depth, std::move(closure)));
+  }
+
+  std::shared_ptr<ThreadPool> thread_pool_;
+  std::shared_ptr<ThreadPool> executor_;
+  std::shared_ptr<FakePoller> poller_;
+
+ private:
+  absl::AnyInvocable<void()> Nest(int depth,
+                                  absl::AnyInvocable<void()> closure) {
+    if (depth == 1) return closure;
+    return [this, depth, closure = std::move(closure)]() mutable {
+      executor_->Run(Nest(depth - 1, std::move(closure)));
+    };
+  }
+};
+
+TEST_F(BusyPollerTest, RunsScheduledClosuresInlineUpToMaxDepth) {
+  BusyPoller busy_poller(poller_, 2);
+  const std::vector<std::thread::id> threads =
+      RunChain(BusyPoller::kMaxInlineDepth + 2);
+  EXPECT_NE(threads[0], std::this_thread::get_id());
+  for (int i = 1; i < BusyPoller::kMaxInlineDepth; ++i) {
+    EXPECT_EQ(threads[i], threads[0]) << i;
+  }
+  // Past the limit, closures go to the thread pool.
+  EXPECT_NE(threads[BusyPoller::kMaxInlineDepth], threads[0]);
+  EXPECT_NE(threads[BusyPoller::kMaxInlineDepth + 1], threads[0]);
+}
+
+TEST_F(BusyPollerTest, ClosureAtMaxDepthMayWaitOnOnesItSchedules) {
+  BusyPoller busy_poller(poller_, 1);
+  grpc_core::Notification done;
+  MakeReadyAtDepth(BusyPoller::kMaxInlineDepth, [&]() {
+    grpc_core::Notification scheduled;
+    executor_->Run([&]() { scheduled.Notify(); });
+    scheduled.WaitForNotification();
+    done.Notify();
+  });
+  done.WaitForNotification();
+}
+
+TEST_F(BusyPollerTest, ClosuresOfOneThreadDoNotHoldUpPolling) {
+  BusyPoller busy_poller(poller_, 2);
+  grpc_core::Notification started;
+  grpc_core::Notification release;
+  poller_->MakeReady([&]() {
+    started.Notify();
+    release.WaitForNotification();
+  });
+  started.WaitForNotification();
+  // The other thread polls while the first one runs the closure.
+  RunChain(1);
+  release.Notify();
+}
+
+TEST_F(BusyPollerTest, DestructionWaitsForHeldClosures) {
+  auto busy_poller = std::make_unique<BusyPoller>(poller_, 2);
+  std::atomic<int> ran{0};
+  grpc_core::Notification started;
+  poller_->MakeReady([&]() {
+    started.Notify();
+    absl::SleepFor(absl::Milliseconds(100));
+    executor_->Run([&]() { ran.fetch_add(1); });
+    ran.fetch_add(1);
+  });
+  started.WaitForNotification();
+  busy_poller.reset();
+  // Both the closure and the one it scheduled inline ran before the threads
+  // were joined.
+  EXPECT_EQ(ran.load(), 2);
+}
+
+// What the engine does around a fork: the old threads are joined, and new
+// ones take over the same poller.
+TEST_F(BusyPollerTest, ReplacementThreadsTakeOverThePoller) {
+  auto busy_poller = std::make_unique<BusyPoller>(poller_, 2);
+  RunChain(1);
+  busy_poller.reset();
+  grpc_core::Notification ran;
+  poller_->MakeReady([&]() { ran.Notify(); });
+  EXPECT_FALSE(ran.WaitForNotificationWithTimeout(absl::Milliseconds(50)));
+  busy_poller = std::make_unique<BusyPoller>(poller_, 2);
+  ran.WaitForNotification();
+  RunChain(BusyPoller::kMaxInlineDepth + 1);
+}
+
+#ifdef GRPC_ENABLE_FORK_SUPPORT
+
+// The engine stops its polling threads before a fork and starts new ones
+// after it; endpoints created before keep working.
+TEST(BusyPollingEngineTest, EndpointsWorkAcrossForkReset) {
+  ASSERT_EQ(grpc_core::ConfigVars::Get().EventEngineBusyPollThreads(), 2);
+  auto engine = PosixEventEngine::MakePosixEventEngine();
+  int fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds), 0);
+  grpc_core::MemoryQuota memory_quota(
+      grpc_core::MakeRefCounted<grpc_core::channelz::ResourceQuotaNode>(
+          "busy_poller_test"));
+  ChannelArgsEndpointConfig config;
+  auto client = engine->CreatePosixEndpointFromFd(
+      fds[0], config, memory_quota.CreateMemoryAllocator("client"));
+  if (absl::IsFailedPrecondition(client.status())) {
+    close(fds[0]);
+    close(fds[1]);
+    GTEST_SKIP() << client.status();
+  }
+  ASSERT_TRUE(client.ok()) << client.status();
+  auto server = engine->CreatePosixEndpointFromFd(
+      fds[1], config, memory_quota.CreateMemoryAllocator("server"));
+  ASSERT_TRUE(server.ok()) << server.status();
+  EXPECT_TRUE(SendValidatePayload(GetNextSendMessage(), client->get(),
+                                  server->get())
+                  .ok());
+  engine->BeforeFork();
+  engine->AfterFork(PosixEventEngine::OnForkRole::kParent);
+  EXPECT_TRUE(SendValidatePayload(GetNextSendMessage(), client->get(),
+                                  server->get())
+                  .ok());
+  EXPECT_TRUE(SendValidatePayload(GetNextSendMessage(), server->get(),
+                                  client->get())
+                  .ok());
+  client->reset();
+  server->reset();
+  grpc_core::WaitForSingleOwner(std::move(engine));
+}
+
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+
+}  // namespace
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_POSIX_SOCKET_TCP
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.event_engine_busy_poll_threads = 2;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
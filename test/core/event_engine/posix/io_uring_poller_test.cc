@@ -0,0 +1,168 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <chrono>
+#include <memory>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/iomgr/port.h"
+#include "test/core/event_engine/posix/posix_engine_test_utils.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+
+#ifdef GRPC_LINUX_IO_URING
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace grpc_event_engine {
+namespace experimental {
+namespace {
+
+using namespace std::chrono_literals;
+
+class IoUringPollerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    poller_ = MakeIoUringPoller(thread_pool_);
+    if (poller_ == nullptr) {
+      GTEST_SKIP() << "io_uring is not supported by the running kernel";
+    }
+  }
+
+  void TearDown() override {
+    if (poller_ != nullptr) poller_->Close();
+  }
+
+  // Creates a non-blocking socket pair, returning the handle wrapping the first
+  // end and the raw fd of the second.
+  EventHandle* CreateSocketPairHandle(int* peer_fd) {
+    int sv[2];
+    EXPECT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+    for (int fd : sv) {
+      EXPECT_EQ(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK), 0);
+    }
+    *peer_fd = sv[1];
+    return poller_->CreateHandle(poller_->posix_interface().Adopt(sv[0]),
+                                 "io_uring_poller_test", false);
+  }
+
+  // Drives the poller until done is set.
+  void WorkUntil(const bool& done) {
+    while (!done) {
+      ASSERT_NE(poller_->Work(10s, []() {}),
+                Poller::WorkResult::kDeadlineExceeded);
+    }
+  }
+
+  std::shared_ptr<TestThreadPool> thread_pool_ =
+      std::make_shared<TestThreadPool>();
+  std::shared_ptr<IoUringPoller> poller_;
+};
+
+TEST_F(IoUringPollerTest, NotifyOnReadRunsWhenDataArrives) {
+  int peer_fd;
+  EventHandle* handle = CreateSocketPairHandle(&peer_fd);
+  bool done = false;
+  handle->NotifyOnRead(PosixEngineClosure::TestOnlyToClosure(
+      [&done](absl::Status status) {
+        EXPECT_TRUE(status.ok());
+        done = true;
+      }));
+  char data = 0;
+  ASSERT_EQ(write(peer_fd, &data, 1), 1);
+  WorkUntil(done);
+  handle->OrphanHandle(nullptr, nullptr, "test");
+  close(peer_fd);
+}
+
+TEST_F(IoUringPollerTest, NotifyOnWriteRunsForWritableSocket) {
+  int peer_fd;
+  EventHandle* handle = CreateSocketPairHandle(&peer_fd);
+  bool done = false;
+  handle->NotifyOnWrite(PosixEngineClosure::TestOnlyToClosure(
+      [&done](absl::Status status) {
+        EXPECT_TRUE(status.ok());
+        done = true;
+      }));
+  WorkUntil(done);
+  handle->OrphanHandle(nullptr, nullptr, "test");
+  close(peer_fd);
+}
+
+TEST_F(IoUringPollerTest, KickInterruptsWork) {
+  poller_->Kick();
+  EXPECT_EQ(poller_->Work(24h, []() {}), Poller::WorkResult::kKicked);
+}
+
+TEST_F(IoUringPollerTest, WorkTimesOut) {
+  EXPECT_EQ(poller_->Work(10ms, []() {}),
+            Poller::WorkResult::kDeadlineExceeded);
+}
+
+// io_uring poll requests hold a reference to the polled file. Make sure that
+// orphaning a handle drops that reference, i.e. closing the released fd
+// actually closes the socket.
+TEST_F(IoUringPollerTest, ReleasedFdIsNotKeptOpenByPoll) {
+  int peer_fd;
+  EventHandle* handle = CreateSocketPairHandle(&peer_fd);
+  FileDescriptor release_fd;
+  handle->OrphanHandle(nullptr, &release_fd, "test");
+  ASSERT_TRUE(release_fd.ready());
+  close(release_fd.fd());
+  // Let the poller reap the cancellation.
+  poller_->Work(10ms, []() {});
+  char data;
+  EXPECT_EQ(read(peer_fd, &data, 1), 0);
+  close(peer_fd);
+}
+
+// A recycled handle must not observe events armed for its previous
+// incarnation.
+TEST_F(IoUringPollerTest, RecycledHandleReceivesOwnEvents) {
+  int first_peer_fd;
+  EventHandle* first = CreateSocketPairHandle(&first_peer_fd);
+  first->OrphanHandle(nullptr, nullptr, "test");
+  close(first_peer_fd);
+  int peer_fd;
+  EventHandle* handle = CreateSocketPairHandle(&peer_fd);
+  EXPECT_EQ(handle, first);
+  bool done = false;
+  handle->NotifyOnRead(PosixEngineClosure::TestOnlyToClosure(
+      [&done](absl::Status status) {
+        EXPECT_TRUE(status.ok());
+        done = true;
+      }));
+  char data = 0;
+  ASSERT_EQ(write(peer_fd, &data, 1), 1);
+  WorkUntil(done);
+  handle->OrphanHandle(nullptr, nullptr, "test");
+  close(peer_fd);
+}
+
+}  // namespace
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_LINUX_IO_URING
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,98 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/listener_shard.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+
+#include <memory>
+#include <vector>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/port.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+using Shards = std::vector<std::shared_ptr<ListenerShard>>;
+
+void RemoveUsers(const Shards& shards) {
+  for (const auto& shard : shards) shard->RemoveUser();
+}
+
+TEST(ListenerShardTest, ListenersOfAnEngineShareShards) {
+  auto engine = GetDefaultEventEngine();
+  Shards first = ListenerShard::GetShards(engine.get(), 2);
+  Shards second = ListenerShard::GetShards(engine.get(), 2);
+  ASSERT_EQ(first.size(), 2u);
+  ASSERT_EQ(second.size(), 2u);
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_EQ(first[i], second[i]);
+    EXPECT_EQ(first[i]->index(), i);
+  }
+  // Another shard count gets shards of its own.
+  Shards third = ListenerShard::GetShards(engine.get(), 3);
+  ASSERT_EQ(third.size(), 3u);
+  EXPECT_NE(third[0], first[0]);
+  RemoveUsers(first);
+  RemoveUsers(second);
+  RemoveUsers(third);
+}
+
+TEST(ListenerShardTest, ShardsStayWhileAnyListenerUsesThem) {
+  auto engine = GetDefaultEventEngine();
+  Shards first = ListenerShard::GetShards(engine.get(), 2);
+  Shards second = ListenerShard::GetShards(engine.get(), 2);
+  RemoveUsers(first);
+  Shards third = ListenerShard::GetShards(engine.get(), 2);
+  EXPECT_EQ(third[0], second[0]);
+  RemoveUsers(second);
+  RemoveUsers(third);
+}
+
+TEST(ListenerShardTest, ShardsWithoutUsersAreReplaced) {
+  auto engine = GetDefaultEventEngine();
+  Shards first = ListenerShard::GetShards(engine.get(), 2);
+  // The threads exit once the shards have no users, even though the shards
+  // themselves are still referenced here.
+  RemoveUsers(first);
+  Shards second = ListenerShard::GetShards(engine.get(), 2);
+  ASSERT_EQ(second.size(), 2u);
+  EXPECT_NE(second[0], first[0]);
+  EXPECT_NE(second[1], first[1]);
+  RemoveUsers(second);
+}
+
+}  // namespace
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_POSIX_SOCKET_TCP
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <list>
 #include <string>
+#include <vector>
 
 #include "src/core/lib/iomgr/port.h"
 #include "gtest/gtest.h"
@@ -30,8 +31,13 @@
 // This test won't work except with posix sockets enabled
 #ifdef GRPC_POSIX_SOCKET_UTILS_COMMON
 
+#include <fcntl.h>
 #include <ifaddrs.h>
 
+#if GPR_LINUX == 1
+#include <sched.h>
+#endif  // GPR_LINUX == 1
+
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_listener_utils.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
@@ -100,6 +106,68 @@ TEST(PosixEngineListenerUtils, ListenerContainerAddWildcardAddressesTest) {
   }
 }
 
+#if GPR_LINUX == 1 && defined(SO_INCOMING_CPU)
+TEST(PosixEngineListenerUtils, ReuseportCpuSteeringTest) {
+  constexpr uint32_t kGroupSize = 4;
+  constexpr int kConnections = 16;
+  if (!IsSocketReusePortSupported()) {
+    GTEST_SKIP() << "SO_REUSEPORT is not supported";
+  }
+  // Keep the handshake of each connection on one CPU, so that the CPU the
+  // kernel steered it by is the one the accepted socket reports.
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(sched_getcpu(), &cpus);
+  ASSERT_EQ(sched_setaffinity(0, sizeof(cpus), &cpus), 0);
+  EventEnginePosixInterface posix_interface;
+  ChannelArgsEndpointConfig config;
+  PosixTcpOptions options = TcpOptionsFromEndpointConfig(config);
+  options.allow_reuse_port = true;
+  auto addr = URIToResolvedAddress("ipv4:127.0.0.1:0");
+  ASSERT_TRUE(addr.ok());
+  std::vector<ListenerSocketsContainer::ListenerSocket> group;
+  while (group.size() < kGroupSize) {
+    auto socket =
+        CreateAndPrepareListenerSocket(&posix_interface, options, *addr);
+    ASSERT_TRUE(socket.ok()) << socket.status();
+    ResolvedAddressSetPort(*addr, socket->port);
+    group.push_back(*socket);
+  }
+  absl::Status status =
+      posix_interface.AttachReuseportCpuSteering(group[0].sock, kGroupSize);
+  if (absl::IsUnimplemented(status)) {
+    GTEST_SKIP() << status;
+  }
+  ASSERT_TRUE(status.ok()) << status;
+  std::vector<int> clients;
+  for (int i = 0; i < kConnections; ++i) {
+    int client = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(client, 0);
+    ASSERT_EQ(connect(client, addr->address(), addr->size()), 0);
+    clients.push_back(client);
+  }
+  // Each connection waits on the socket at its CPU modulo the group size.
+  int accepted = 0;
+  for (uint32_t i = 0; i < kGroupSize; ++i) {
+    int fd = posix_interface.GetFd(group[i].sock).value();
+    ASSERT_EQ(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK), 0);
+    int server;
+    while ((server = accept(fd, nullptr, nullptr)) >= 0) {
+      int cpu = -1;
+      socklen_t len = sizeof(cpu);
+      ASSERT_EQ(
+          getsockopt(server, SOL_SOCKET, SO_INCOMING_CPU, &cpu, &len), 0);
+      EXPECT_EQ(cpu % kGroupSize, i);
+      close(server);
+      ++accepted;
+    }
+  }
+  EXPECT_EQ(accepted, kConnections);
+  for (int client : clients) close(client);
+  for (auto& socket : group) posix_interface.Close(socket.sock);
+}
+#endif  // GPR_LINUX == 1 && defined(SO_INCOMING_CPU)
+
 TEST(PosixEngineListenerUtils, ListenerContainerIpv4LinkLocalTest) {
   sockaddr_in addr4;
   memset(&addr4, 0, sizeof(addr4));
@@ -0,0 +1,241 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/tcp_zerocopy_receiver.h"
+
+#include <grpc/event_engine/internal/memory_allocator_impl.h>
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
+#include <grpc/slice.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/core/lib/event_engine/posix_engine/file_descriptor_collection.h"
+#include "src/core/lib/event_engine/posix_engine/posix_interface.h"
+#include "gtest/gtest.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+using ZerocopyReceiveResult = EventEnginePosixInterface::ZerocopyReceiveResult;
+
+const size_t kPageSize = sysconf(_SC_PAGESIZE);
+
+// Counts the bytes reserved and not yet released.
+class CountingMemoryAllocatorImpl : public internal::MemoryAllocatorImpl {
+ public:
+  size_t Reserve(MemoryRequest request) override {
+    reserved_ += request.min();
+    return request.min();
+  }
+  grpc_slice MakeSlice(MemoryRequest request) override {
+    return grpc_slice_malloc(Reserve(request));
+  }
+  void Release(size_t n) override { reserved_ -= n; }
+  void Shutdown() override {}
+
+  size_t reserved() const { return reserved_; }
+
+ private:
+  size_t reserved_ = 0;
+};
+
+// One scripted answer to TCP_ZEROCOPY_RECEIVE: `mapped` bytes of 'm' are
+// mapped, then `copy_hint` bytes of 'c' are ready to be copied. A non zero
+// `error` fails the call with that errno instead.
+struct Step {
+  size_t mapped = 0;
+  size_t copy_hint = 0;
+  int error = 0;
+};
+
+class FakeSocket : public TcpZerocopyReceiver::Socket {
+ public:
+  explicit FakeSocket(std::vector<Step> steps)
+      : steps_(steps.begin(), steps.end()) {}
+
+  PosixErrorOr<ZerocopyReceiveResult> ZerocopyReceive(size_t length) override {
+    EXPECT_EQ(length % kPageSize, 0u);
+    requested_.push_back(length);
+    if (steps_.empty()) return ZerocopyReceiveResult();
+    Step step = steps_.front();
+    steps_.pop_front();
+    if (step.error != 0) return PosixError::Error(step.error);
+    EXPECT_LE(step.mapped, length);
+    ZerocopyReceiveResult result;
+    result.copy_hint = step.copy_hint;
+    if (step.mapped > 0) {
+      result.mapping = mmap(nullptr, step.mapped, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      EXPECT_NE(result.mapping, MAP_FAILED);
+      memset(result.mapping, 'm', step.mapped);
+      result.mapped = step.mapped;
+    }
+    return result;
+  }
+
+  bool CopyReceive(size_t length, SliceBuffer& received) override {
+    copied_.push_back(length);
+    received.Append(Slice::FromCopiedString(std::string(length, 'c')));
+    return true;
+  }
+
+  // Lengths asked of ZerocopyReceive() and CopyReceive().
+  const std::vector<size_t>& requested() const { return requested_; }
+  const std::vector<size_t>& copied() const { return copied_; }
+
+ private:
+  std::deque<Step> steps_;
+  std::vector<size_t> requested_;
+  std::vector<size_t> copied_;
+};
+
+std::string Contents(SliceBuffer& buffer) {
+  std::string contents;
+  for (size_t i = 0; i < buffer.Count(); ++i) {
+    contents.append(buffer.RefSlice(i).as_string_view());
+  }
+  return contents;
+}
+
+class TcpZerocopyReceiverTest : public ::testing::Test {
+ protected:
+  TcpZerocopyReceiverTest()
+      : impl_(std::make_shared<CountingMemoryAllocatorImpl>()),
+        allocator_(impl_) {}
+
+  size_t reserved() const { return impl_->reserved(); }
+
+  std::shared_ptr<CountingMemoryAllocatorImpl> impl_;
+  MemoryAllocator allocator_;
+  TcpZerocopyReceiver receiver_{true, 0};
+  SliceBuffer received_;
+};
+
+TEST_F(TcpZerocopyReceiverTest, ChargesMappedPagesUntilReleased) {
+  FakeSocket socket({{4 * kPageSize, 0}});
+  receiver_.Receive(4 * kPageSize, socket, allocator_, received_);
+  EXPECT_EQ(Contents(received_), std::string(4 * kPageSize, 'm'));
+  EXPECT_EQ(reserved(), 4 * kPageSize);
+  SliceBuffer moved;
+  received_.Swap(moved);
+  EXPECT_EQ(reserved(), 4 * kPageSize);
+  moved.Clear();
+  EXPECT_EQ(reserved(), 0u);
+}
+
+TEST_F(TcpZerocopyReceiverTest, StopsAfterPartialMap) {
+  FakeSocket socket({{2 * kPageSize, 0}, {2 * kPageSize, 0}});
+  receiver_.Receive(4 * kPageSize, socket, allocator_, received_);
+  EXPECT_EQ(socket.requested(), std::vector<size_t>{4 * kPageSize});
+  EXPECT_EQ(received_.Length(), 2 * kPageSize);
+  EXPECT_EQ(reserved(), 2 * kPageSize);
+  EXPECT_TRUE(receiver_.enabled());
+}
+
+TEST_F(TcpZerocopyReceiverTest, LeavesTrailingPartialPageToCaller) {
+  FakeSocket socket({{2 * kPageSize, 0}});
+  receiver_.Receive(2 * kPageSize + 100, socket, allocator_, received_);
+  EXPECT_EQ(socket.requested(), std::vector<size_t>{2 * kPageSize});
+  EXPECT_EQ(received_.Length(), 2 * kPageSize);
+}
+
+TEST_F(TcpZerocopyReceiverTest, CopiesSkipHintAndMapsTheRest) {
+  FakeSocket socket({{0, 100}, {3 * kPageSize, 0}});
+  receiver_.Receive(3 * kPageSize + 100, socket, allocator_, received_);
+  EXPECT_EQ(socket.requested(),
+            (std::vector<size_t>{3 * kPageSize, 3 * kPageSize}));
+  EXPECT_EQ(socket.copied(), std::vector<size_t>{100});
+  EXPECT_EQ(Contents(received_),
+            std::string(100, 'c') + std::string(3 * kPageSize, 'm'));
+  // Only the mapped pages are charged here; copies are charged by the
+  // caller's own allocation.
+  EXPECT_EQ(reserved(), 3 * kPageSize);
+}
+
+TEST_F(TcpZerocopyReceiverTest, LeavesHintCoveringTheRestToCaller) {
+  FakeSocket socket({{kPageSize, kPageSize}});
+  receiver_.Receive(2 * kPageSize, socket, allocator_, received_);
+  EXPECT_TRUE(socket.copied().empty());
+  EXPECT_EQ(received_.Length(), kPageSize);
+}
+
+TEST_F(TcpZerocopyReceiverTest, EioKeepsZerocopyEnabled) {
+  FakeSocket socket({{0, 0, EIO}});
+  receiver_.Receive(4 * kPageSize, socket, allocator_, received_);
+  EXPECT_EQ(received_.Length(), 0u);
+  EXPECT_TRUE(receiver_.enabled());
+}
+
+TEST_F(TcpZerocopyReceiverTest, OtherErrorsDisableZerocopy) {
+  FakeSocket socket({{kPageSize, 100}, {0, 0, EINVAL}});
+  receiver_.Receive(4 * kPageSize, socket, allocator_, received_);
+  // What was received before the error is kept.
+  EXPECT_EQ(received_.Length(), kPageSize + 100);
+  EXPECT_FALSE(receiver_.enabled());
+  EXPECT_FALSE(receiver_.ShouldReceive(4 * kPageSize));
+}
+
+TEST_F(TcpZerocopyReceiverTest, DisablesAfterUnmappedReads) {
+  FakeSocket socket({});
+  for (int i = 0; i < TcpZerocopyReceiver::kMaxUnmappedReads - 1; ++i) {
+    receiver_.Receive(kPageSize, socket, allocator_, received_);
+    EXPECT_TRUE(receiver_.enabled());
+  }
+  receiver_.Receive(kPageSize, socket, allocator_, received_);
+  EXPECT_FALSE(receiver_.enabled());
+}
+
+TEST_F(TcpZerocopyReceiverTest, MappedReadResetsUnmappedCount) {
+  std::vector<Step> steps(TcpZerocopyReceiver::kMaxUnmappedReads - 1);
+  steps.push_back({kPageSize, 0});
+  FakeSocket socket(steps);
+  for (int i = 0; i < TcpZerocopyReceiver::kMaxUnmappedReads; ++i) {
+    receiver_.Receive(kPageSize, socket, allocator_, received_);
+  }
+  for (int i = 0; i < TcpZerocopyReceiver::kMaxUnmappedReads - 1; ++i) {
+    receiver_.Receive(kPageSize, socket, allocator_, received_);
+    EXPECT_TRUE(receiver_.enabled());
+  }
+  received_.Clear();
+  EXPECT_EQ(reserved(), 0u);
+}
+
+TEST_F(TcpZerocopyReceiverTest, HonorsThreshold) {
+  TcpZerocopyReceiver receiver(true, 64 * 1024);
+  EXPECT_FALSE(receiver.ShouldReceive(64 * 1024 - 1));
+  EXPECT_TRUE(receiver.ShouldReceive(64 * 1024));
+  EXPECT_FALSE(TcpZerocopyReceiver(false, 0).ShouldReceive(64 * 1024));
+}
+
+}  // namespace
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
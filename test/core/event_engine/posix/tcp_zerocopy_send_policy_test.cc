@@ -0,0 +1,161 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/tcp_zerocopy_send_policy.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "gtest/gtest.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+using Policy = TcpZerocopySendPolicy;
+
+constexpr size_t kSmallestZerocopy = 16 * 1024;
+
+// Writes of every size class, from kMinBytes up.
+size_t ClassBytes(int size_class) { return Policy::kMinBytes << size_class; }
+
+// Records enough sends of `bytes` at `ns_per_byte` for their size class to be
+// compared.
+void RecordSends(Policy& policy, bool zerocopy, size_t bytes,
+                 double ns_per_byte) {
+  for (int i = 0; i < Policy::kMinSamples; ++i) {
+    policy.RecordSend(zerocopy, bytes, bytes,
+                      std::chrono::nanoseconds(
+                          static_cast<int64_t>(ns_per_byte * bytes)));
+  }
+}
+
+TEST(TcpZerocopySendPolicyTest, StartsFromConfiguredValues) {
+  Policy policy(kSmallestZerocopy, 4, 32);
+  EXPECT_EQ(policy.threshold_bytes(), kSmallestZerocopy);
+  EXPECT_EQ(policy.max_sends(), 4);
+  EXPECT_FALSE(policy.ShouldZerocopy(Policy::kMinBytes - 1));
+  EXPECT_FALSE(policy.ShouldZerocopy(kSmallestZerocopy));
+  EXPECT_TRUE(policy.ShouldZerocopy(kSmallestZerocopy + 1));
+}
+
+TEST(TcpZerocopySendPolicyTest, ExploresTheOtherWay) {
+  Policy policy(kSmallestZerocopy, 4, 32);
+  int zerocopy = 0;
+  for (int i = 0; i < Policy::kExploreInterval; ++i) {
+    if (policy.ShouldZerocopy(ClassBytes(6))) ++zerocopy;
+  }
+  EXPECT_EQ(zerocopy, Policy::kExploreInterval - 1);
+  // Writes too small for zerocopy are never explored.
+  for (int i = 0; i < Policy::kExploreInterval; ++i) {
+    EXPECT_FALSE(policy.ShouldZerocopy(Policy::kMinBytes - 1));
+  }
+}
+
+TEST(TcpZerocopySendPolicyTest, ThresholdFollowsCheaperSends) {
+  Policy policy(kSmallestZerocopy, 4, 32);
+  for (int i = 0; i < Policy::kSizeClasses; ++i) {
+    RecordSends(policy, /*zerocopy=*/false, ClassBytes(i), 1.0);
+    RecordSends(policy, /*zerocopy=*/true, ClassBytes(i),
+                ClassBytes(i) >= 64 * 1024 ? 0.2 : 2.0);
+  }
+  EXPECT_EQ(policy.threshold_bytes(), 64 * 1024 - 1);
+  EXPECT_FALSE(policy.ShouldZerocopy(32 * 1024));
+  EXPECT_TRUE(policy.ShouldZerocopy(64 * 1024));
+}
+
+TEST(TcpZerocopySendPolicyTest, UnmeasuredClassesKeepTheirChoice) {
+  Policy policy(kSmallestZerocopy, 4, 32);
+  // Only 8KB writes are measured, and zerocopy wins for them: larger writes
+  // were already sent with zerocopy, so the threshold simply drops.
+  RecordSends(policy, /*zerocopy=*/false, ClassBytes(1), 1.0);
+  RecordSends(policy, /*zerocopy=*/true, ClassBytes(1), 0.5);
+  EXPECT_EQ(policy.threshold_bytes(), ClassBytes(1) - 1);
+}
+
+TEST(TcpZerocopySendPolicyTest, NeverWhenCopyingIsCheaper) {
+  Policy policy(kSmallestZerocopy, 4, 32);
+  for (int i = 0; i < Policy::kSizeClasses; ++i) {
+    RecordSends(policy, /*zerocopy=*/false, ClassBytes(i), 1.0);
+    RecordSends(policy, /*zerocopy=*/true, ClassBytes(i), 1.5);
+  }
+  EXPECT_EQ(policy.threshold_bytes(), Policy::kNever);
+  EXPECT_FALSE(policy.ShouldZerocopy(ClassBytes(Policy::kSizeClasses - 1)));
+}
+
+TEST(TcpZerocopySendPolicyTest, CopiedCompletionsCountAgainstZerocopy) {
+  Policy policy(kSmallestZerocopy, 4, 32);
+  // The kernel copies every send anyway, so zerocopy pays for both.
+  for (int i = 0; i < 64; ++i) {
+    policy.RecordCompletions(1, 1, std::chrono::nanoseconds(0));
+  }
+  for (int i = 0; i < Policy::kSizeClasses; ++i) {
+    RecordSends(policy, /*zerocopy=*/false, ClassBytes(i), 1.0);
+    RecordSends(policy, /*zerocopy=*/true, ClassBytes(i), 0.5);
+  }
+  EXPECT_EQ(policy.threshold_bytes(), Policy::kNever);
+}
+
+TEST(TcpZerocopySendPolicyTest, CompletionCostFavorsLargerWrites) {
+  Policy policy(kSmallestZerocopy, 4, 32);
+  // 64us to read each completion: 1ns per byte of a 64KB send.
+  for (int i = 0; i < 64; ++i) {
+    policy.RecordCompletions(1, 0, std::chrono::microseconds(64));
+  }
+  for (int i = 0; i < Policy::kSizeClasses; ++i) {
+    RecordSends(policy, /*zerocopy=*/false, ClassBytes(i), 1.0);
+    RecordSends(policy, /*zerocopy=*/true, ClassBytes(i), 0.5);
+  }
+  EXPECT_EQ(policy.threshold_bytes(), 128 * 1024 - 1);
+}
+
+TEST(TcpZerocopySendPolicyTest, MaxSendsGrowsWhenExhausted) {
+  Policy policy(kSmallestZerocopy, 4, 6);
+  policy.RecordSendsExhausted();
+  EXPECT_EQ(policy.max_sends(), 5);
+  for (int i = 0; i < 10; ++i) policy.RecordSendsExhausted();
+  EXPECT_EQ(policy.max_sends(), 6);
+}
+
+TEST(TcpZerocopySendPolicyTest, MaxSendsHalvesOnNoBufs) {
+  Policy policy(kSmallestZerocopy, 16, 32);
+  policy.RecordNoBufs();
+  EXPECT_EQ(policy.max_sends(), 8);
+  for (int i = 0; i < 10; ++i) policy.RecordNoBufs();
+  EXPECT_EQ(policy.max_sends(), 1);
+}
+
+TEST(TcpZerocopySendPolicyTest, MaxSendsHalvesWhenCompletionsSlowDown) {
+  Policy policy(kSmallestZerocopy, 16, 32);
+  for (int i = 0; i < 64; ++i) {
+    policy.RecordCompletionLatency(std::chrono::microseconds(10));
+  }
+  EXPECT_EQ(policy.max_sends(), 16);
+  for (int i = 0; i < 64; ++i) {
+    policy.RecordCompletionLatency(std::chrono::milliseconds(1));
+  }
+  EXPECT_LT(policy.max_sends(), 16);
+}
+
+}  // namespace
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,270 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/util/time.h"
+#include "gtest/gtest.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+class FakeHost final : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override { return now; }
+  void Kick() override { ++kicks; }
+
+  grpc_core::Timestamp now =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  int kicks = 0;
+};
+
+class CountingClosure final : public experimental::EventEngine::Closure {
+ public:
+  void Run() override { ++runs; }
+  int runs = 0;
+};
+
+// Runs every expired closure, returning how many there were.
+size_t RunExpired(TimerWheel& wheel, grpc_core::Timestamp* next = nullptr) {
+  std::optional<std::vector<experimental::EventEngine::Closure*>> result =
+      wheel.TimerCheck(next);
+  EXPECT_TRUE(result.has_value());
+  for (auto* closure : *result) closure->Run();
+  return result->size();
+}
+
+}  // namespace
+
+TEST(TimerWheelTest, Add) {
+  Timer timers[20];
+  CountingClosure closures[20];
+  FakeHost host;
+  const grpc_core::Timestamp start = host.now;
+  TimerWheel wheel(&host);
+
+  for (int i = 0; i < 10; i++) {
+    wheel.TimerInit(&timers[i], start + grpc_core::Duration::Milliseconds(10),
+                    &closures[i]);
+  }
+  for (int i = 10; i < 20; i++) {
+    wheel.TimerInit(&timers[i], start + grpc_core::Duration::Milliseconds(1010),
+                    &closures[i]);
+  }
+
+  host.now = start + grpc_core::Duration::Milliseconds(500);
+  EXPECT_EQ(RunExpired(wheel), 10);
+  for (int i = 0; i < 20; i++) EXPECT_EQ(closures[i].runs, i < 10 ? 1 : 0);
+
+  host.now = start + grpc_core::Duration::Milliseconds(600);
+  EXPECT_EQ(RunExpired(wheel), 0);
+
+  host.now = start + grpc_core::Duration::Milliseconds(1500);
+  EXPECT_EQ(RunExpired(wheel), 10);
+  for (int i = 0; i < 20; i++) EXPECT_EQ(closures[i].runs, 1);
+
+  host.now = start + grpc_core::Duration::Milliseconds(1600);
+  EXPECT_EQ(RunExpired(wheel), 0);
+}
+
+TEST(TimerWheelTest, Cancel) {
+  Timer timers[3];
+  CountingClosure closures[3];
+  FakeHost host;
+  const grpc_core::Timestamp start = host.now;
+  TimerWheel wheel(&host);
+
+  wheel.TimerInit(&timers[0], start + grpc_core::Duration::Milliseconds(1),
+                  &closures[0]);
+  wheel.TimerInit(&timers[1], start + grpc_core::Duration::Milliseconds(100),
+                  &closures[1]);
+  wheel.TimerInit(&timers[2], start + grpc_core::Duration::Hours(25 * 24),
+                  &closures[2]);
+
+  host.now = start + grpc_core::Duration::Milliseconds(2);
+  EXPECT_EQ(RunExpired(wheel), 1);
+  EXPECT_FALSE(wheel.TimerCancel(&timers[0]));
+  EXPECT_TRUE(wheel.TimerCancel(&timers[1]));
+  EXPECT_FALSE(wheel.TimerCancel(&timers[1]));
+  EXPECT_TRUE(wheel.TimerCancel(&timers[2]));
+
+  host.now = start + grpc_core::Duration::Hours(30 * 24);
+  EXPECT_EQ(RunExpired(wheel), 0);
+  EXPECT_EQ(closures[1].runs, 0);
+  EXPECT_EQ(closures[2].runs, 0);
+}
+
+TEST(TimerWheelTest, PastDeadlineFiresOnNextCheck) {
+  Timer timer;
+  CountingClosure closure;
+  FakeHost host;
+  const grpc_core::Timestamp start = host.now;
+  TimerWheel wheel(&host);
+
+  const int kicks = host.kicks;
+  wheel.TimerInit(&timer, start - grpc_core::Duration::Seconds(1), &closure);
+  EXPECT_GT(host.kicks, kicks);
+  EXPECT_EQ(RunExpired(wheel), 1);
+  EXPECT_EQ(closure.runs, 1);
+}
+
+// Timers on every level of the wheel, and beyond it, must fire on the exact
+// millisecond they are due, no sooner and no later.
+TEST(TimerWheelTest, FiresExactlyOnDeadlineAcrossLevels) {
+  const int64_t kDelays[] = {1,      2,          63,         64,
+                             65,     4095,       4096,       4097,
+                             262143, 262144,     16777215,   16777216,
+                             16777217, 100000000};
+  constexpr size_t kNumTimers = sizeof(kDelays) / sizeof(kDelays[0]);
+  Timer timers[kNumTimers];
+  CountingClosure closures[kNumTimers];
+  FakeHost host;
+  const grpc_core::Timestamp start = host.now;
+  TimerWheel wheel(&host);
+
+  for (size_t i = 0; i < kNumTimers; i++) {
+    wheel.TimerInit(&timers[i],
+                    start + grpc_core::Duration::Milliseconds(kDelays[i]),
+                    &closures[i]);
+  }
+  for (size_t i = 0; i < kNumTimers; i++) {
+    host.now = start + grpc_core::Duration::Milliseconds(kDelays[i] - 1);
+    RunExpired(wheel);
+    EXPECT_EQ(closures[i].runs, 0) << "delay " << kDelays[i];
+    host.now = start + grpc_core::Duration::Milliseconds(kDelays[i]);
+    RunExpired(wheel);
+    EXPECT_EQ(closures[i].runs, 1) << "delay " << kDelays[i];
+  }
+}
+
+TEST(TimerWheelTest, ReportsNextCheckNoLaterThanEarliestDeadline) {
+  Timer timers[2];
+  CountingClosure closures[2];
+  FakeHost host;
+  const grpc_core::Timestamp start = host.now;
+  TimerWheel wheel(&host);
+
+  grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+  EXPECT_EQ(RunExpired(wheel, &next), 0);
+  EXPECT_EQ(next, grpc_core::Timestamp::InfFuture());
+
+  wheel.TimerInit(&timers[0], start + grpc_core::Duration::Seconds(10),
+                  &closures[0]);
+  wheel.TimerInit(&timers[1], start + grpc_core::Duration::Seconds(5),
+                  &closures[1]);
+  while (closures[1].runs == 0) {
+    next = grpc_core::Timestamp::InfFuture();
+    RunExpired(wheel, &next);
+    if (closures[1].runs != 0) break;
+    ASSERT_GT(next, host.now);
+    ASSERT_LE(next, start + grpc_core::Duration::Seconds(5));
+    host.now = next;
+  }
+  EXPECT_EQ(host.now, start + grpc_core::Duration::Seconds(5));
+  EXPECT_EQ(closures[0].runs, 0);
+  EXPECT_TRUE(wheel.TimerCancel(&timers[0]));
+}
+
+TEST(TimerWheelTest, LongRunningServiceCleanup) {
+  Timer timers[2];
+  CountingClosure closures[2];
+  FakeHost host;
+  host.now = grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+      grpc_core::Duration::Hours(25 * 24).millis());
+  TimerWheel wheel(&host);
+
+  wheel.TimerInit(&timers[0],
+                  grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                      std::numeric_limits<int64_t>::max() - 1),
+                  &closures[0]);
+  wheel.TimerInit(&timers[1], host.now + grpc_core::Duration::Milliseconds(3),
+                  &closures[1]);
+  host.now += grpc_core::Duration::Milliseconds(4);
+  EXPECT_EQ(RunExpired(wheel), 1);
+  EXPECT_TRUE(wheel.TimerCancel(&timers[0]));
+  EXPECT_FALSE(wheel.TimerCancel(&timers[1]));
+}
+
+// Compares the wheel against a brute force model under a random mix of adds,
+// cancels and clock advances.
+TEST(TimerWheelTest, RandomizedAgainstModel) {
+  constexpr size_t kNumTimers = 1000;
+  std::vector<Timer> timers(kNumTimers);
+  std::vector<CountingClosure> closures(kNumTimers);
+  std::vector<std::optional<grpc_core::Timestamp>> model(kNumTimers);
+  FakeHost host;
+  TimerWheel wheel(&host);
+  std::mt19937 rng(42);
+
+  for (int step = 0; step < 20000; step++) {
+    const size_t i = rng() % kNumTimers;
+    switch (rng() % 4) {
+      case 0:
+      case 1:
+        if (!model[i].has_value()) {
+          // Mostly short deadlines, with a tail reaching past the wheel.
+          const int64_t delay = (rng() % 8 == 0)
+                                    ? static_cast<int64_t>(rng() % (1 << 26))
+                                    : static_cast<int64_t>(rng() % 5000);
+          model[i] = host.now + grpc_core::Duration::Milliseconds(delay);
+          wheel.TimerInit(&timers[i], *model[i], &closures[i]);
+        }
+        break;
+      case 2:
+        EXPECT_EQ(wheel.TimerCancel(&timers[i]), model[i].has_value());
+        model[i].reset();
+        break;
+      case 3: {
+        host.now += grpc_core::Duration::Milliseconds(
+            (rng() % 16 == 0) ? rng() % (1 << 25) : rng() % 100);
+        std::vector<int> expected_runs(kNumTimers);
+        for (size_t j = 0; j < kNumTimers; j++) {
+          expected_runs[j] = closures[j].runs;
+          if (model[j].has_value() && *model[j] <= host.now) {
+            ++expected_runs[j];
+            model[j].reset();
+          }
+        }
+        RunExpired(wheel);
+        for (size_t j = 0; j < kNumTimers; j++) {
+          ASSERT_EQ(closures[j].runs, expected_runs[j])
+              << "timer " << j << " at step " << step;
+        }
+        break;
+      }
+    }
+  }
+  for (size_t i = 0; i < kNumTimers; i++) {
+    EXPECT_EQ(wheel.TimerCancel(&timers[i]), model[i].has_value());
+  }
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -16,6 +16,7 @@
 #include <grpc/grpc.h>
 #include <grpc/support/thd_id.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cmath>
@@ -26,23 +27,61 @@
 #include <tuple>
 #include <vector>
 
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/notification.h"
 #include "src/core/util/thd.h"
 #include "src/core/util/time.h"
 #include "test/core/test_util/test_config.h"
 #include "gtest/gtest.h"
+#include "absl/functional/any_invocable.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 
 namespace grpc_event_engine {
 namespace experimental {
 
+// Four cache domains, alternating between two NUMA nodes, that share out this
+// machine's CPUs.
+CpuTopology TwoNodeTopology() {
+  constexpr int kNumDomains = 4;
+  std::vector<CpuTopology::Domain> domains(kNumDomains);
+  for (int i = 0; i < kNumDomains; ++i) domains[i].node = i % 2;
+  const int num_cpus = std::max(1u, std::thread::hardware_concurrency());
+  for (int cpu = 0; cpu < num_cpus; ++cpu) {
+    domains[cpu % kNumDomains].cpus.push_back(cpu);
+  }
+  return CpuTopology(std::move(domains));
+}
+
+// A WorkStealingThreadPool over TwoNodeTopology(), so that the suite runs
+// with per-domain queues, signals and stealing on any machine.
+class MultiDomainWorkStealingThreadPool final : public ThreadPool {
+ public:
+  explicit MultiDomainWorkStealingThreadPool(size_t reserve_threads)
+      : pool_(reserve_threads, TwoNodeTopology(), /*pin_threads=*/false) {}
+  void Quiesce() override { pool_.Quiesce(); }
+  void Run(absl::AnyInvocable<void()> callback) override {
+    pool_.Run(std::move(callback));
+  }
+  void Run(EventEngine::Closure* closure) override { pool_.Run(closure); }
+#if GRPC_ENABLE_FORK_SUPPORT
+  void PrepareFork() override { pool_.PrepareFork(); }
+  void PostFork() override { pool_.PostFork(); }
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+
+ private:
+  WorkStealingThreadPool pool_;
+};
+
 template <typename T>
 class ThreadPoolTest : public testing::Test {};
 
-using ThreadPoolTypes = ::testing::Types<WorkStealingThreadPool>;
+using ThreadPoolTypes = ::testing::Types<WorkStealingThreadPool,
+                                         MultiDomainWorkStealingThreadPool>;
 TYPED_TEST_SUITE(ThreadPoolTest, ThreadPoolTypes);
 
 TYPED_TEST(ThreadPoolTest, CanRunAnyInvocable) {
@@ -261,6 +300,27 @@ TYPED_TEST(ThreadPoolTest, QuiesceRaceStressTest) {
   }
 }
 
+TYPED_TEST(ThreadPoolTest, QuiesceRunsClosuresFromThreadsOutsideThePool) {
+  // Threads outside the pool queue closures under the domain of whichever
+  // CPU they run on.
+  constexpr int thread_count = 8;
+  constexpr int run_count = 1000;
+  TypeParam p(4);
+  std::atomic<int> runcount{0};
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count);
+  for (int i = 0; i < thread_count; i++) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < run_count; j++) {
+        p.Run([&]() { runcount.fetch_add(1); });
+      }
+    });
+  }
+  for (auto& thd : threads) thd.join();
+  p.Quiesce();
+  ASSERT_EQ(runcount.load(), thread_count * run_count);
+}
+
 TYPED_TEST(ThreadPoolTest, WorkerThreadLocalRunWorksWithOtherPools) {
   // WorkStealingThreadPools may queue work onto a thread-local queue, and that
   // work may be stolen by other threads. This test tries to ensure that work
@@ -300,6 +360,30 @@ TYPED_TEST(ThreadPoolTest, DISABLED_TestDumpStack) {
   p1.Quiesce();
 }
 
+TEST(MultiDomainThreadPoolTest, StealsFromBusyThreadsOfOtherNodes) {
+  // The two threads are in the first two domains, one on each node. One
+  // queues closures locally and stays busy until they have all run, so the
+  // other has to steal them all across nodes.
+  constexpr int run_count = 100;
+  WorkStealingThreadPool p(2, TwoNodeTopology(), /*pin_threads=*/false);
+  auto before = grpc_core::global_stats().Collect();
+  std::atomic<int> runcount{0};
+  grpc_core::Notification all_ran;
+  p.Run([&]() {
+    for (int i = 0; i < run_count; i++) {
+      p.Run([&]() {
+        if (runcount.fetch_add(1) + 1 == run_count) all_ran.Notify();
+      });
+    }
+    all_ran.WaitForNotification();
+  });
+  all_ran.WaitForNotification();
+  auto diff = grpc_core::global_stats().Collect()->Diff(*before);
+  EXPECT_GE(diff->thread_pool_steals, run_count);
+  EXPECT_GE(diff->thread_pool_cross_node_steals, 1);
+  p.Quiesce();
+}
+
 class BusyThreadCountTest : public testing::Test {};
 
 TEST_F(BusyThreadCountTest, StressTest) {
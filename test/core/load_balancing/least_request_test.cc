@@ -0,0 +1,176 @@
+//
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/grpc.h>
+
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/core/config/core_configuration.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/orphanable.h"
+#include "src/core/util/ref_counted_ptr.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class LeastRequestTest : public LoadBalancingPolicyTest {
+ protected:
+  LeastRequestTest() : LoadBalancingPolicyTest("least_request_experimental") {}
+
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakeLeastRequestConfig(
+      Json::Object config = {}) {
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"least_request_experimental",
+          Json::FromObject(std::move(config))}})}));
+  }
+
+  // Connects every endpoint and returns the picker reported once all of
+  // them are READY.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> ExpectStartup(
+      absl::Span<const absl::string_view> addresses,
+      SourceLocation location = SourceLocation()) {
+    std::vector<SubchannelState*> subchannels;
+    for (absl::string_view address : addresses) {
+      auto* subchannel = FindSubchannel(address);
+      EXPECT_NE(subchannel, nullptr)
+          << address << "\n"
+          << location.file() << ":" << location.line();
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested())
+          << location.file() << ":" << location.line();
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      subchannels.push_back(subchannel);
+    }
+    DrainConnectingUpdates(location);
+    RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+    for (auto* subchannel : subchannels) {
+      subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+      picker = ExpectState(GRPC_CHANNEL_READY, absl::OkStatus(), location);
+    }
+    return picker;
+  }
+
+  // Does num_picks picks, completing each call right away, and returns
+  // the number of picks that went to each address.
+  std::map<std::string, size_t> CountPicks(
+      LoadBalancingPolicy::SubchannelPicker* picker, size_t num_picks) {
+    std::map<std::string, size_t> counts;
+    for (size_t i = 0; i < num_picks; ++i) {
+      auto address = ExpectPickComplete(picker);
+      if (!address.has_value()) break;
+      ++counts[*address];
+    }
+    return counts;
+  }
+};
+
+TEST_F(LeastRequestTest, Basic) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, MakeLeastRequestConfig()),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // With no calls in flight, every endpoint is equally likely to be picked.
+  auto counts = CountPicks(picker.get(), 300);
+  EXPECT_EQ(counts.size(), kAddresses.size());
+  for (absl::string_view address : kAddresses) {
+    EXPECT_GT(counts[std::string(address)], 0u) << address;
+  }
+}
+
+TEST_F(LeastRequestTest, PrefersEndpointWithFewerOutstandingRequests) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto config =
+      MakeLeastRequestConfig({{"choiceCount", Json::FromNumber(10)}});
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, std::move(config)),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Start a call and leave it outstanding.
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+      busy_tracker;
+  auto busy_address = ExpectPickComplete(picker.get(), {}, {}, &busy_tracker);
+  ASSERT_TRUE(busy_address.has_value());
+  ASSERT_NE(busy_tracker, nullptr);
+  // Every pick that samples the idle endpoint at least once goes to it,
+  // so with ten choices all but about one in a thousand picks do.
+  auto counts = CountPicks(picker.get(), 100);
+  EXPECT_LE(counts[*busy_address], 5u);
+  // Once the call finishes, the endpoint is picked again.
+  ReportCompletionToCallTracker(std::move(busy_tracker), *busy_address);
+  counts = CountPicks(picker.get(), 100);
+  EXPECT_GT(counts[*busy_address], 5u);
+}
+
+TEST_F(LeastRequestTest, TrackerDestroyedWithoutFinishReleasesCall) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto config =
+      MakeLeastRequestConfig({{"choiceCount", Json::FromNumber(10)}});
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, std::move(config)),
+                        lb_policy()),
+            absl::OkStatus());
+  auto picker = ExpectStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+      busy_tracker;
+  auto busy_address = ExpectPickComplete(picker.get(), {}, {}, &busy_tracker);
+  ASSERT_TRUE(busy_address.has_value());
+  // The channel drops the tracker without calling Finish() when the
+  // picked subchannel turns out to be disconnected.
+  busy_tracker.reset();
+  auto counts = CountPicks(picker.get(), 100);
+  EXPECT_GT(counts[*busy_address], 5u);
+}
+
+TEST(LeastRequestConfigTest, ChoiceCountTooLow) {
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          Json::FromArray({Json::FromObject(
+              {{"least_request_experimental",
+                Json::FromObject({{"choiceCount", Json::FromNumber(1)}})}})}));
+  EXPECT_EQ(config.status(),
+            absl::InvalidArgumentError(
+                "errors validating least_request LB policy config: ["
+                "field:choiceCount error:must be at least 2]"));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,113 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the ring_hash policy's lookup tables: the time to rebuild them on
+// an endpoint update, and the time to map a request hash to an endpoint.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "src/core/load_balancing/ring_hash/lookup_table.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_core {
+namespace {
+
+std::vector<HashLookupEndpoint> MakeEndpoints(int64_t count) {
+  std::vector<HashLookupEndpoint> endpoints;
+  for (int64_t i = 0; i < count; ++i) {
+    endpoints.push_back(
+        {absl::StrCat("10.", i / 65536, ".", i / 256 % 256, ".", i % 256,
+                      ":443")});
+  }
+  return endpoints;
+}
+
+std::vector<uint64_t> MakeRequestHashes() {
+  std::mt19937_64 rng(42);
+  std::vector<uint64_t> hashes(1024);
+  for (uint64_t& hash : hashes) hash = rng();
+  return hashes;
+}
+
+// range(0) endpoints, range(1) ring entries or table slots. The sizes are
+// primes so that both tables can be built with the same number of entries.
+void LookupTableArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"endpoints", "size"});
+  for (int endpoints : {10, 100, 1000, 10000}) {
+    for (int size : {4093, 65537, 1000003}) {
+      b->Args({endpoints, size});
+    }
+  }
+}
+
+void BM_HashRingBuild(benchmark::State& state) {
+  const std::vector<HashLookupEndpoint> endpoints =
+      MakeEndpoints(state.range(0));
+  for (auto _ : state) {
+    HashRing ring(endpoints, state.range(1), state.range(1));
+    benchmark::DoNotOptimize(ring.size());
+  }
+}
+BENCHMARK(BM_HashRingBuild)->Apply(LookupTableArguments);
+
+void BM_MaglevTableBuild(benchmark::State& state) {
+  const std::vector<HashLookupEndpoint> endpoints =
+      MakeEndpoints(state.range(0));
+  for (auto _ : state) {
+    MaglevTable table(endpoints, state.range(1));
+    benchmark::DoNotOptimize(table.size());
+  }
+}
+BENCHMARK(BM_MaglevTableBuild)->Apply(LookupTableArguments);
+
+template <typename Table>
+void Pick(benchmark::State& state, const Table& table) {
+  const std::vector<uint64_t> hashes = MakeRequestHashes();
+  size_t next = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        table.endpoint_index(table.FindIndex(hashes[next])));
+    next = (next + 1) % hashes.size();
+  }
+}
+
+void BM_HashRingPick(benchmark::State& state) {
+  Pick(state, HashRing(MakeEndpoints(state.range(0)), state.range(1),
+                       state.range(1)));
+}
+BENCHMARK(BM_HashRingPick)->Apply(LookupTableArguments);
+
+void BM_MaglevTablePick(benchmark::State& state) {
+  Pick(state, MaglevTable(MakeEndpoints(state.range(0)), state.range(1)));
+}
+BENCHMARK(BM_MaglevTablePick)->Apply(LookupTableArguments);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,204 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/load_balancing/ring_hash/lookup_table.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_core {
+namespace {
+
+std::vector<HashLookupEndpoint> MakeEndpoints(size_t count) {
+  std::vector<HashLookupEndpoint> endpoints;
+  for (size_t i = 0; i < count; ++i) {
+    endpoints.push_back({absl::StrCat("10.0.", i / 256, ".", i % 256, ":443")});
+  }
+  return endpoints;
+}
+
+// Number of slots (or ring entries) held by each endpoint.
+template <typename Table>
+std::vector<size_t> SlotsPerEndpoint(const Table& table, size_t endpoints) {
+  std::vector<size_t> slots(endpoints);
+  for (size_t i = 0; i < table.size(); ++i) ++slots[table.endpoint_index(i)];
+  return slots;
+}
+
+TEST(HashRingTest, FindIndexWrapsAround) {
+  const HashRing ring(MakeEndpoints(3), 1024, 4096);
+  ASSERT_EQ(ring.size(), 1026);
+  EXPECT_EQ(ring.FindIndex(std::numeric_limits<uint64_t>::max()), 0);
+  EXPECT_EQ(ring.FindIndex(0), 0);
+}
+
+TEST(HashRingTest, WeightsScaleEntries) {
+  std::vector<HashLookupEndpoint> endpoints = MakeEndpoints(3);
+  endpoints[1].weight = 2;
+  endpoints[2].weight = 5;
+  const HashRing ring(endpoints, 800, 4096);
+  EXPECT_EQ(SlotsPerEndpoint(ring, 3), (std::vector<size_t>{100, 200, 500}));
+}
+
+TEST(MaglevTableTest, IsValidTableSize) {
+  EXPECT_FALSE(MaglevTable::IsValidTableSize(0));
+  EXPECT_FALSE(MaglevTable::IsValidTableSize(1));
+  EXPECT_TRUE(MaglevTable::IsValidTableSize(2));
+  EXPECT_TRUE(MaglevTable::IsValidTableSize(251));
+  EXPECT_FALSE(MaglevTable::IsValidTableSize(65536));
+  EXPECT_TRUE(MaglevTable::IsValidTableSize(MaglevTable::kDefaultTableSize));
+  EXPECT_TRUE(MaglevTable::IsValidTableSize(MaglevTable::kMaxTableSize));
+  EXPECT_FALSE(MaglevTable::IsValidTableSize(MaglevTable::kMaxTableSize + 2));
+}
+
+TEST(MaglevTableTest, LargestValidTableSize) {
+  EXPECT_EQ(MaglevTable::LargestValidTableSize(0), 2);
+  EXPECT_EQ(MaglevTable::LargestValidTableSize(2), 2);
+  EXPECT_EQ(MaglevTable::LargestValidTableSize(4096), 4093);
+  EXPECT_EQ(MaglevTable::LargestValidTableSize(MaglevTable::kDefaultTableSize),
+            MaglevTable::kDefaultTableSize);
+  EXPECT_EQ(MaglevTable::LargestValidTableSize(
+                std::numeric_limits<uint64_t>::max()),
+            MaglevTable::kMaxTableSize);
+}
+
+TEST(MaglevTableTest, TableSizeFor) {
+  constexpr uint64_t kNoCap = std::numeric_limits<uint64_t>::max();
+  // Few endpoints get the configured size.
+  EXPECT_EQ(MaglevTable::TableSizeFor(2, 251, kNoCap), 251);
+  EXPECT_EQ(MaglevTable::TableSizeFor(3, MaglevTable::kDefaultTableSize,
+                                      kNoCap),
+            MaglevTable::kDefaultTableSize);
+  // More get the next prime past kMinSlotsPerEndpoint slots each.
+  EXPECT_EQ(MaglevTable::TableSizeFor(3, 251, kNoCap), 307);
+  EXPECT_EQ(MaglevTable::TableSizeFor(1000, MaglevTable::kDefaultTableSize,
+                                      kNoCap),
+            100003);
+  EXPECT_EQ(MaglevTable::TableSizeFor(2000, 251, kNoCap), 200003);
+  // Up to the cap and kMaxTableSize.
+  EXPECT_EQ(MaglevTable::TableSizeFor(1000, MaglevTable::kDefaultTableSize,
+                                      4096),
+            4093);
+  EXPECT_EQ(MaglevTable::TableSizeFor(100000, 251, kNoCap),
+            MaglevTable::kMaxTableSize);
+}
+
+TEST(MaglevTableTest, EmptyEndpointList) {
+  const MaglevTable table({}, MaglevTable::kDefaultTableSize);
+  EXPECT_EQ(table.size(), 0);
+}
+
+TEST(MaglevTableTest, FindIndexIsHashModuloSize) {
+  const MaglevTable table(MakeEndpoints(3), 251);
+  ASSERT_EQ(table.size(), 251);
+  EXPECT_EQ(table.FindIndex(0), 0);
+  EXPECT_EQ(table.FindIndex(252), 1);
+}
+
+TEST(MaglevTableTest, SlotsAreEvenlySpread) {
+  constexpr size_t kNumEndpoints = 100;
+  const MaglevTable table(MakeEndpoints(kNumEndpoints),
+                          MaglevTable::kDefaultTableSize);
+  const std::vector<size_t> slots = SlotsPerEndpoint(table, kNumEndpoints);
+  const auto [min, max] = std::minmax_element(slots.begin(), slots.end());
+  EXPECT_LE(*max - *min, 1);
+}
+
+// Past the endpoint count the default table size was picked for, the table
+// grows so that every endpoint still gets kMinSlotsPerEndpoint slots.
+TEST(MaglevTableTest, ManyEndpointsGetMinSlots) {
+  constexpr size_t kNumEndpoints = 5000;
+  const MaglevTable table(
+      MakeEndpoints(kNumEndpoints),
+      MaglevTable::TableSizeFor(kNumEndpoints, MaglevTable::kDefaultTableSize,
+                                MaglevTable::kMaxTableSize));
+  const std::vector<size_t> slots = SlotsPerEndpoint(table, kNumEndpoints);
+  const auto [min, max] = std::minmax_element(slots.begin(), slots.end());
+  EXPECT_GE(*min, MaglevTable::kMinSlotsPerEndpoint);
+  EXPECT_LE(*max - *min, 1);
+}
+
+TEST(MaglevTableTest, WeightsScaleSlots) {
+  std::vector<HashLookupEndpoint> endpoints = MakeEndpoints(3);
+  endpoints[1].weight = 2;
+  endpoints[2].weight = 5;
+  const MaglevTable table(endpoints, MaglevTable::kDefaultTableSize);
+  const std::vector<size_t> slots = SlotsPerEndpoint(table, 3);
+  const double unit = static_cast<double>(MaglevTable::kDefaultTableSize) / 8;
+  EXPECT_NEAR(slots[0], unit, 2);
+  EXPECT_NEAR(slots[1], 2 * unit, 2);
+  EXPECT_NEAR(slots[2], 5 * unit, 2);
+}
+
+// One endpoint outweighing the others by far must neither starve them nor
+// take more than its share.
+TEST(MaglevTableTest, SkewedWeightsScaleSlots) {
+  constexpr size_t kNumEndpoints = 100;
+  constexpr uint32_t kHeavyWeight = 1000000;
+  std::vector<HashLookupEndpoint> endpoints = MakeEndpoints(kNumEndpoints);
+  endpoints[0].weight = kHeavyWeight;
+  const MaglevTable table(endpoints, MaglevTable::kMaxTableSize);
+  const std::vector<size_t> slots = SlotsPerEndpoint(table, kNumEndpoints);
+  const double unit = static_cast<double>(MaglevTable::kMaxTableSize) /
+                      (kHeavyWeight + kNumEndpoints - 1);
+  EXPECT_NEAR(slots[0], kHeavyWeight * unit, kNumEndpoints);
+  for (size_t i = 1; i < kNumEndpoints; ++i) {
+    EXPECT_NEAR(slots[i], unit, 1) << i;
+  }
+}
+
+TEST(MaglevTableTest, Deterministic) {
+  const MaglevTable table1(MakeEndpoints(10), 251);
+  const MaglevTable table2(MakeEndpoints(10), 251);
+  for (size_t i = 0; i < table1.size(); ++i) {
+    EXPECT_EQ(table1.endpoint_index(i), table2.endpoint_index(i)) << i;
+  }
+}
+
+// Removing an endpoint should hand its slots to the others while moving few
+// of theirs.
+TEST(MaglevTableTest, RemovingEndpointCausesLittleDisruption) {
+  constexpr size_t kNumEndpoints = 100;
+  constexpr size_t kRemoved = 42;
+  std::vector<HashLookupEndpoint> endpoints = MakeEndpoints(kNumEndpoints);
+  const MaglevTable before(endpoints, MaglevTable::kDefaultTableSize);
+  endpoints.erase(endpoints.begin() + kRemoved);
+  const MaglevTable after(endpoints, MaglevTable::kDefaultTableSize);
+  size_t moved = 0;
+  for (size_t i = 0; i < before.size(); ++i) {
+    const size_t old_index = before.endpoint_index(i);
+    if (old_index == kRemoved) continue;
+    size_t new_index = after.endpoint_index(i);
+    if (new_index >= kRemoved) ++new_index;
+    if (new_index != old_index) ++moved;
+  }
+  // Maglev gives up a little stability for even balance: some slots of the
+  // remaining endpoints move, but far fewer than the removed endpoint had.
+  EXPECT_LT(moved, before.size() / kNumEndpoints);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -70,6 +70,13 @@ class RingHashTest : public LoadBalancingPolicyTest {
         {{"ring_hash_experimental", Json::FromObject(fields)}})}));
   }
 
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakeMaglevConfig() {
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"ring_hash_experimental",
+          Json::FromObject({{"lookupTable", Json::FromString("maglev")},
+                            {"maglevTableSize", Json::FromNumber(251)}})}})}));
+  }
+
   RequestHashAttribute* MakeHashAttributeForString(absl::string_view key) {
     std::string key_str = absl::StrCat(key, "_0");
     uint64_t hash = XXH64(key_str.data(), key_str.size(), 0);
@@ -356,6 +363,40 @@ TEST_F(RingHashTest, EndpointHashKeys) {
   EXPECT_EQ(address, kAddresses[1]);
 }
 
+TEST_F(RingHashTest, MaglevLookupTable) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(kAddresses, MakeMaglevConfig()), lb_policy()),
+      absl::OkStatus());
+  auto picker = ExpectState(GRPC_CHANNEL_IDLE);
+  auto* hash_attribute = MakeHashAttributeForString("foo");
+  ExpectPickQueued(picker.get(), {hash_attribute});
+  WaitForWorkSerializerToFlush();
+  WaitForWorkSerializerToFlush();
+  // Only the endpoint the hash maps to is asked to connect.
+  SubchannelState* subchannel = nullptr;
+  absl::string_view selected_address;
+  for (absl::string_view address : kAddresses) {
+    auto* candidate = FindSubchannel(address);
+    if (candidate != nullptr && candidate->ConnectionRequested()) {
+      ASSERT_EQ(subchannel, nullptr) << address;
+      subchannel = candidate;
+      selected_address = address;
+    }
+  }
+  ASSERT_NE(subchannel, nullptr);
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  ExpectPickQueued(picker.get(), {hash_attribute});
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  for (int i = 0; i < 10; ++i) {
+    auto address = ExpectPickComplete(picker.get(), {hash_attribute});
+    EXPECT_EQ(address, selected_address);
+  }
+}
+
 TEST_F(RingHashTest, PickFailsWithoutRequestHashAttribute) {
   const std::array<absl::string_view, 3> kAddresses = {
       "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
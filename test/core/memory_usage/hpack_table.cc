@@ -0,0 +1,124 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Memory held by the HPACK decoder's dynamic table of each connection, once
+// the peer has filled it, with and without compact storage.
+
+#include <grpc/grpc.h>
+#include <stdio.h>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/core/call/metadata_batch.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_parser_table.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/util/grpc_check.h"
+#include "test/core/memory_usage/memstats.h"
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+
+ABSL_FLAG(int, size, 1000, "Number of connections (tables)");
+ABSL_FLAG(std::string, table_sizes, "4096,16384,65536",
+          "Comma separated SETTINGS_HEADER_TABLE_SIZE values to measure");
+
+namespace grpc_core {
+namespace {
+
+// Headers of the sort a proxy forwards on each request: most of them differ
+// from request to request, so the table keeps turning over. Returns the
+// bytes added to the table.
+uint32_t AddHeaders(HPackTable& table, int request, bool compact) {
+  const std::string headers[][2] = {
+      {"x-request-id", absl::StrCat("5f0c1e7a-", request, "-4d2b-9a61")},
+      {"traceparent",
+       absl::StrCat("00-4bf92f3577b34da6a3ce929d0e0e", request,
+                    "-00f067aa0ba902b7-01")},
+      {"authorization", absl::StrCat("Bearer eyJhbGciOiJSUzI1NiJ9.", request,
+                                     ".c2lnbmF0dXJlLXBsYWNlaG9sZGVy")},
+      {"x-forwarded-for", absl::StrCat("10.", request % 256, ".",
+                                       request / 256 % 256, ".17")},
+      {"grpc-timeout", absl::StrCat(1000 + request % 1000, "m")},
+      {"user-agent", "grpc-c++/1.76.0 grpc-c/51.0.0 (linux; chttp2)"},
+  };
+  uint32_t added = 0;
+  for (const auto& header : headers) {
+    const absl::string_view key = header[0];
+    const absl::string_view value = header[1];
+    const uint32_t transport_size = key.size() + value.size() + 32;
+    HPackTable::Memento memento{
+        grpc_metadata_batch::Parse(key, Slice::FromCopiedString(value),
+                                   !compact, transport_size,
+                                   [](absl::string_view, const Slice&) {}),
+        nullptr};
+    GRPC_CHECK(table.Add(std::move(memento), key, value));
+    added += transport_size;
+  }
+  return added;
+}
+
+// Bytes of RSS per table, after filling `connections` tables of `table_size`
+// bytes.
+double MeasureBytesPerTable(int connections, uint32_t table_size,
+                            bool compact) {
+  std::vector<HPackTable> tables(connections);
+  const long before_kb = GetMemUsage();
+  for (HPackTable& table : tables) {
+    table.SetCompactStorage(compact);
+    table.SetMaxBytes(table_size);
+    GRPC_CHECK(table.SetCurrentTableSize(table_size));
+    // Enough requests to fill the table twice over, so the ring has wrapped.
+    uint32_t added = 0;
+    for (int request = 0; added < 2 * table_size; ++request) {
+      added += AddHeaders(table, request, compact);
+    }
+  }
+  const long after_kb = GetMemUsage();
+  return (after_kb - before_kb) * 1024.0 / connections;
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  absl::ParseCommandLine(argc, argv);
+  grpc_init();
+  {
+    grpc_core::ExecCtx exec_ctx;
+    const int connections = absl::GetFlag(FLAGS_size);
+    for (absl::string_view text :
+         absl::StrSplit(absl::GetFlag(FLAGS_table_sizes), ',')) {
+      uint32_t table_size;
+      GRPC_CHECK(absl::SimpleAtoi(text, &table_size)) << text;
+      for (bool compact : {false, true}) {
+        const char* storage = compact ? "compact" : "memento";
+        printf("---------hpack table stats (%u bytes, %s)--------\n",
+               table_size, storage);
+        printf("hpack table %u %s memory usage: %f bytes per connection\n",
+               table_size, storage,
+               grpc_core::MeasureBytesPerTable(connections, table_size,
+                                               compact));
+      }
+    }
+  }
+  grpc_shutdown();
+  return 0;
+}
@@ -60,7 +60,8 @@ using grpc::testing::XdsResourceUtils;
 ABSL_FLAG(std::string, benchmark_names, "",
           "Which benchmark to run.  If empty, defaults to 'call,channel' "
           "if --use_xds is false, or 'call,channel,channel_multi_address' "
-          "if --use_xds is true.");
+          "if --use_xds is true. 'hpack_table' measures the HPACK decoder's "
+          "dynamic table alone.");
 
 ABSL_FLAG(int, size, 1000, "Number of channels/calls");
 ABSL_FLAG(
@@ -251,6 +252,19 @@ XdsServer StartXdsServerAndConfigureBootstrap(
   return xds_server;
 }
 
+// per-connection memory usage of the HPACK decoder's dynamic table
+int RunHpackTableBenchmark(char* root) {
+  Subprocess tables({absl::StrCat(root, "/memory_usage_hpack_table",
+                                  gpr_subprocess_binary_extension()),
+                     absl::StrCat("--size=", absl::GetFlag(FLAGS_size))});
+  LOG(INFO) << "hpack table benchmark started, pid " << tables.GetPID();
+  const int status = tables.Join();
+  if (status != 0) {
+    LOG(INFO) << "hpack table benchmark failed with status " << status;
+  }
+  return status;
+}
+
 int RunBenchmark(char* root, absl::string_view benchmark,
                  std::vector<std::string> server_scenario_flags,
                  std::vector<std::string> client_scenario_flags) {
@@ -267,7 +281,9 @@ int RunBenchmark(char* root, absl::string_view benchmark,
     xds_server = StartXdsServerAndConfigureBootstrap(server_ports);
   }
   int retval;
-  if (benchmark == "call") {
+  if (benchmark == "hpack_table") {
+    retval = RunHpackTableBenchmark(root);
+  } else if (benchmark == "call") {
     retval = RunCallBenchmark(server_ports[0], root, server_scenario_flags,
                               client_scenario_flags);
   } else if (benchmark == "channel" || benchmark == "channel_multi_address") {
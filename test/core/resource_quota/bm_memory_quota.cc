@@ -0,0 +1,77 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks many threads taking and returning memory from one shared quota,
+// the way per-call and per-connection allocators on a busy server do.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+
+#include <cstddef>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/util/ref_counted_ptr.h"
+
+namespace grpc_core {
+namespace {
+
+// Big enough that the quota never comes under pressure.
+constexpr size_t kQuotaSize = size_t{1} << 31;
+
+MemoryQuota* SharedQuota() {
+  static MemoryQuota* const quota = []() {
+    auto* quota =
+        new MemoryQuota(MakeRefCounted<channelz::ResourceQuotaNode>("bm"));
+    quota->SetSize(kQuotaSize);
+    return quota;
+  }();
+  return quota;
+}
+
+// Each iteration is a short lived allocator, as for a call: it takes
+// state.range(0) bytes from the quota and gives them back when destroyed.
+void BM_AllocatorChurn(benchmark::State& state) {
+  MemoryQuota* quota = SharedQuota();
+  const size_t reservation = state.range(0);
+  for (auto _ : state) {
+    ExecCtx exec_ctx;
+    auto allocator = quota->CreateMemoryAllocator("bm");
+    benchmark::DoNotOptimize(allocator.Reserve(reservation));
+    allocator.Release(reservation);
+  }
+}
+BENCHMARK(BM_AllocatorChurn)
+    ->Arg(1024)
+    ->Arg(64 * 1024)
+    ->Arg(512 * 1024)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
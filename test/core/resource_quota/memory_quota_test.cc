@@ -235,6 +235,52 @@ TEST(MemoryQuotaTest, ContainerMemoryAccountedFor) {
   ResourceTracker::Set(nullptr);
 }
 
+// Churns allocators on a few threads so that the quota's per-cpu reservation
+// caches are left holding bytes.
+void ChurnAllocators(MemoryQuota& memory_quota) {
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; i++) {
+    threads.emplace_back([&memory_quota]() {
+      for (int j = 0; j < 1000; j++) {
+        ExecCtx exec_ctx;
+        auto memory_allocator = memory_quota.CreateMemoryAllocator("bar");
+        auto n = memory_allocator.Reserve(MemoryRequest(4096, 65536));
+        memory_allocator.Release(n);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+}
+
+TEST(MemoryQuotaTest, ReservationCacheCountsAsFree) {
+  MemoryQuota memory_quota(MakeRefCounted<channelz::ResourceQuotaNode>("foo"));
+  memory_quota.SetSize(size_t{1} << 31);
+  auto owner = memory_quota.CreateMemoryOwner();
+  ChurnAllocators(memory_quota);
+  // Everything has been given back, so only the owner itself counts as used.
+  EXPECT_LT(owner.GetPressureInfo().instantaneous_pressure, 1e-6);
+}
+
+TEST(MemoryQuotaTest, ShrinkingQuotaReturnsCachedBytes) {
+  ExecCtx exec_ctx;
+  MemoryQuota memory_quota(MakeRefCounted<channelz::ResourceQuotaNode>("foo"));
+  memory_quota.SetSize(size_t{1} << 31);
+  auto owner = memory_quota.CreateMemoryOwner();
+  ChurnAllocators(memory_quota);
+  // The quota is now too small to cache reservations: whatever the caches
+  // were holding must be free again, without any reclamation.
+  memory_quota.SetSize(1024 * 1024);
+  bool reclaimed = false;
+  owner.PostReclaimer(ReclamationPass::kDestructive,
+                      [&reclaimed](std::optional<ReclamationSweep> sweep) {
+                        if (sweep.has_value()) reclaimed = true;
+                      });
+  auto n = owner.Reserve(512 * 1024);
+  exec_ctx.Flush();
+  EXPECT_FALSE(reclaimed);
+  owner.Release(n);
+}
+
 }  // namespace testing
 
 namespace memory_quota_detail {
@@ -0,0 +1,239 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks how fast a server matches incoming calls to the calls requested
+// by the application, when requests are spread over many completion queues,
+// each drained by its own thread. Calls go over the in-process transport so
+// that the matching is a large share of the work per call.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+#include <grpc/support/time.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "src/core/util/grpc_check.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// Calls each completion queue's thread keeps requested at any time.
+constexpr int kRequestsPerCq = 4;
+// Calls the client has in flight per benchmark iteration.
+constexpr int kCallsPerIteration = 64;
+
+gpr_timespec InfFuture() { return gpr_inf_future(GPR_CLOCK_REALTIME); }
+
+// A call requested from the server, and then answered with an OK status.
+class ServerSlot {
+ public:
+  ServerSlot(grpc_server* server, grpc_completion_queue* cq)
+      : server_(server), cq_(cq) {
+    grpc_call_details_init(&details_);
+    grpc_metadata_array_init(&request_metadata_);
+  }
+  ~ServerSlot() {
+    grpc_call_details_destroy(&details_);
+    grpc_metadata_array_destroy(&request_metadata_);
+  }
+
+  void Request() {
+    call_ = nullptr;
+    requested_ = true;
+    GRPC_CHECK_EQ(grpc_server_request_call(server_, &call_, &details_,
+                                           &request_metadata_, cq_, cq_, this),
+                  GRPC_CALL_OK);
+  }
+
+  // Handles the completion of whatever this slot last started.
+  void OnComplete(bool success) {
+    if (requested_) {
+      // Failed requests mean the server is shutting down.
+      if (!success) return;
+      requested_ = false;
+      Respond();
+      return;
+    }
+    grpc_call_unref(call_);
+    if (success) Request();
+  }
+
+ private:
+  void Respond() {
+    grpc_op ops[3] = {};
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[1].op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+    ops[1].data.recv_close_on_server.cancelled = &cancelled_;
+    ops[2].op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+    ops[2].data.send_status_from_server.status = GRPC_STATUS_OK;
+    GRPC_CHECK_EQ(grpc_call_start_batch(call_, ops, 3, this, nullptr),
+                  GRPC_CALL_OK);
+  }
+
+  grpc_server* const server_;
+  grpc_completion_queue* const cq_;
+  grpc_call* call_ = nullptr;
+  grpc_call_details details_;
+  grpc_metadata_array request_metadata_;
+  int cancelled_ = 0;
+  bool requested_ = false;
+};
+
+// A client call with nothing to send or receive but its status.
+class ClientCall {
+ public:
+  ClientCall() {
+    grpc_metadata_array_init(&initial_metadata_);
+    grpc_metadata_array_init(&trailing_metadata_);
+  }
+  ~ClientCall() {
+    grpc_metadata_array_destroy(&initial_metadata_);
+    grpc_metadata_array_destroy(&trailing_metadata_);
+  }
+
+  void Start(grpc_channel* channel, grpc_completion_queue* cq) {
+    grpc_slice method = grpc_slice_from_static_string("/bm/Match");
+    call_ = grpc_channel_create_call(channel, nullptr, GRPC_PROPAGATE_DEFAULTS,
+                                     cq, method, nullptr, InfFuture(),
+                                     nullptr);
+    grpc_op ops[4] = {};
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[1].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+    ops[2].op = GRPC_OP_RECV_INITIAL_METADATA;
+    ops[2].data.recv_initial_metadata.recv_initial_metadata =
+        &initial_metadata_;
+    ops[3].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+    ops[3].data.recv_status_on_client.trailing_metadata = &trailing_metadata_;
+    ops[3].data.recv_status_on_client.status = &status_;
+    ops[3].data.recv_status_on_client.status_details = &status_details_;
+    GRPC_CHECK_EQ(grpc_call_start_batch(call_, ops, 4, this, nullptr),
+                  GRPC_CALL_OK);
+  }
+
+  void Finish() {
+    GRPC_CHECK_EQ(status_, GRPC_STATUS_OK);
+    grpc_slice_unref(status_details_);
+    grpc_call_unref(call_);
+    grpc_metadata_array_destroy(&initial_metadata_);
+    grpc_metadata_array_destroy(&trailing_metadata_);
+    grpc_metadata_array_init(&initial_metadata_);
+    grpc_metadata_array_init(&trailing_metadata_);
+  }
+
+ private:
+  grpc_call* call_ = nullptr;
+  grpc_metadata_array initial_metadata_;
+  grpc_metadata_array trailing_metadata_;
+  grpc_status_code status_;
+  grpc_slice status_details_;
+};
+
+class Fixture {
+ public:
+  explicit Fixture(int num_cqs) {
+    server_ = grpc_server_create(nullptr, nullptr);
+    for (int i = 0; i < num_cqs; i++) {
+      cqs_.push_back(grpc_completion_queue_create_for_next(nullptr));
+      grpc_server_register_completion_queue(server_, cqs_.back(), nullptr);
+    }
+    grpc_server_start(server_);
+    channel_ = grpc_inproc_channel_create(server_, nullptr, nullptr);
+    client_cq_ = grpc_completion_queue_create_for_next(nullptr);
+    for (grpc_completion_queue* cq : cqs_) {
+      threads_.emplace_back([this, cq]() { ServeCq(cq); });
+    }
+  }
+
+  ~Fixture() {
+    grpc_channel_destroy(channel_);
+    grpc_completion_queue* shutdown_cq =
+        grpc_completion_queue_create_for_pluck(nullptr);
+    grpc_server_shutdown_and_notify(server_, shutdown_cq, nullptr);
+    grpc_completion_queue_pluck(shutdown_cq, nullptr, InfFuture(), nullptr);
+    grpc_completion_queue_destroy(shutdown_cq);
+    grpc_server_destroy(server_);
+    for (grpc_completion_queue* cq : cqs_) grpc_completion_queue_shutdown(cq);
+    for (std::thread& thread : threads_) thread.join();
+    for (grpc_completion_queue* cq : cqs_) grpc_completion_queue_destroy(cq);
+    grpc_completion_queue_shutdown(client_cq_);
+    while (grpc_completion_queue_next(client_cq_, InfFuture(), nullptr).type !=
+           GRPC_QUEUE_SHUTDOWN) {
+    }
+    grpc_completion_queue_destroy(client_cq_);
+  }
+
+  // Makes calls.size() calls at once and waits for all of them.
+  void RunCalls(std::vector<ClientCall>& calls) {
+    for (ClientCall& call : calls) call.Start(channel_, client_cq_);
+    for (size_t i = 0; i < calls.size(); i++) {
+      grpc_event ev =
+          grpc_completion_queue_next(client_cq_, InfFuture(), nullptr);
+      GRPC_CHECK_EQ(ev.type, GRPC_OP_COMPLETE);
+      GRPC_CHECK(ev.success);
+      static_cast<ClientCall*>(ev.tag)->Finish();
+    }
+  }
+
+ private:
+  void ServeCq(grpc_completion_queue* cq) {
+    std::vector<std::unique_ptr<ServerSlot>> slots;
+    for (int i = 0; i < kRequestsPerCq; i++) {
+      slots.push_back(std::make_unique<ServerSlot>(server_, cq));
+      slots.back()->Request();
+    }
+    while (true) {
+      grpc_event ev = grpc_completion_queue_next(cq, InfFuture(), nullptr);
+      if (ev.type == GRPC_QUEUE_SHUTDOWN) return;
+      static_cast<ServerSlot*>(ev.tag)->OnComplete(ev.success);
+    }
+  }
+
+  grpc_server* server_;
+  std::vector<grpc_completion_queue*> cqs_;
+  grpc_channel* channel_;
+  grpc_completion_queue* client_cq_;
+  std::vector<std::thread> threads_;
+};
+
+void BM_MatchCalls(benchmark::State& state) {
+  Fixture fixture(state.range(0));
+  std::vector<ClientCall> calls(kCallsPerIteration);
+  for (auto _ : state) {
+    fixture.RunCalls(calls);
+  }
+  state.SetItemsProcessed(state.iterations() * kCallsPerIteration);
+}
+BENCHMARK(BM_MatchCalls)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
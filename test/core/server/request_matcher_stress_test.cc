@@ -0,0 +1,209 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Shuts servers down while calls are being matched to requests on many
+// completion queues at once: every call must still complete before its
+// deadline, and the server must not be left holding a pending call.
+
+#include <grpc/grpc.h>
+#include <grpc/support/time.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int kIterations = 50;
+constexpr int kNumCqs = 4;
+constexpr int kCalls = 64;
+
+gpr_timespec InfFuture() { return gpr_inf_future(GPR_CLOCK_REALTIME); }
+
+// Requests one call at a time on a cq and answers it, until the request
+// fails: with far more calls than requests, most calls wait as pending.
+class ServerLoop {
+ public:
+  ServerLoop(grpc_server* server, grpc_completion_queue* cq)
+      : server_(server), cq_(cq) {
+    grpc_call_details_init(&details_);
+    grpc_metadata_array_init(&request_metadata_);
+  }
+  ~ServerLoop() {
+    grpc_call_details_destroy(&details_);
+    grpc_metadata_array_destroy(&request_metadata_);
+  }
+
+  void Run() {
+    Request();
+    while (true) {
+      grpc_event ev = grpc_completion_queue_next(cq_, InfFuture(), nullptr);
+      if (ev.type == GRPC_QUEUE_SHUTDOWN) return;
+      ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+      if (ev.tag == &request_tag_) {
+        // Failed requests mean the server is shutting down.
+        if (ev.success) Respond();
+      } else {
+        grpc_call_unref(call_);
+        Request();
+      }
+    }
+  }
+
+ private:
+  void Request() {
+    call_ = nullptr;
+    ASSERT_EQ(grpc_server_request_call(server_, &call_, &details_,
+                                       &request_metadata_, cq_, cq_,
+                                       &request_tag_),
+              GRPC_CALL_OK);
+  }
+
+  void Respond() {
+    grpc_op ops[3] = {};
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[1].op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+    ops[1].data.recv_close_on_server.cancelled = &cancelled_;
+    ops[2].op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+    ops[2].data.send_status_from_server.status = GRPC_STATUS_OK;
+    ASSERT_EQ(grpc_call_start_batch(call_, ops, 3, &respond_tag_, nullptr),
+              GRPC_CALL_OK);
+  }
+
+  grpc_server* const server_;
+  grpc_completion_queue* const cq_;
+  grpc_call* call_ = nullptr;
+  grpc_call_details details_;
+  grpc_metadata_array request_metadata_;
+  int cancelled_ = 0;
+  int request_tag_ = 0;
+  int respond_tag_ = 0;
+};
+
+// A client call with nothing to send or receive but its status.
+class ClientCall {
+ public:
+  ClientCall() {
+    grpc_metadata_array_init(&initial_metadata_);
+    grpc_metadata_array_init(&trailing_metadata_);
+  }
+  ~ClientCall() {
+    grpc_slice_unref(status_details_);
+    grpc_call_unref(call_);
+    grpc_metadata_array_destroy(&initial_metadata_);
+    grpc_metadata_array_destroy(&trailing_metadata_);
+  }
+
+  void Start(grpc_channel* channel, grpc_completion_queue* cq) {
+    grpc_slice method = grpc_slice_from_static_string("/stress/Match");
+    call_ = grpc_channel_create_call(channel, nullptr, GRPC_PROPAGATE_DEFAULTS,
+                                     cq, method, nullptr,
+                                     grpc_timeout_seconds_to_deadline(30),
+                                     nullptr);
+    grpc_op ops[4] = {};
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[1].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+    ops[2].op = GRPC_OP_RECV_INITIAL_METADATA;
+    ops[2].data.recv_initial_metadata.recv_initial_metadata =
+        &initial_metadata_;
+    ops[3].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+    ops[3].data.recv_status_on_client.trailing_metadata = &trailing_metadata_;
+    ops[3].data.recv_status_on_client.status = &status_;
+    ops[3].data.recv_status_on_client.status_details = &status_details_;
+    ASSERT_EQ(grpc_call_start_batch(call_, ops, 4, this, nullptr),
+              GRPC_CALL_OK);
+  }
+
+  grpc_status_code status() const { return status_; }
+
+ private:
+  grpc_call* call_ = nullptr;
+  grpc_metadata_array initial_metadata_;
+  grpc_metadata_array trailing_metadata_;
+  grpc_status_code status_ = GRPC_STATUS_UNKNOWN;
+  grpc_slice status_details_ = grpc_empty_slice();
+};
+
+TEST(RequestMatcherStressTest, ShutdownWhileMatching) {
+  for (int iteration = 0; iteration < kIterations; iteration++) {
+    grpc_server* server = grpc_server_create(nullptr, nullptr);
+    std::vector<grpc_completion_queue*> cqs;
+    for (int i = 0; i < kNumCqs; i++) {
+      cqs.push_back(grpc_completion_queue_create_for_next(nullptr));
+      grpc_server_register_completion_queue(server, cqs.back(), nullptr);
+    }
+    grpc_server_start(server);
+    grpc_channel* channel =
+        grpc_inproc_channel_create(server, nullptr, nullptr);
+    grpc_completion_queue* client_cq =
+        grpc_completion_queue_create_for_next(nullptr);
+    std::vector<std::unique_ptr<ServerLoop>> loops;
+    std::vector<std::thread> threads;
+    for (grpc_completion_queue* cq : cqs) {
+      loops.push_back(std::make_unique<ServerLoop>(server, cq));
+      threads.emplace_back([loop = loops.back().get()]() { loop->Run(); });
+    }
+    std::vector<ClientCall> calls(kCalls);
+    for (ClientCall& call : calls) call.Start(channel, client_cq);
+    // Shut down while the calls are still being matched.
+    grpc_completion_queue* shutdown_cq =
+        grpc_completion_queue_create_for_pluck(nullptr);
+    grpc_server_shutdown_and_notify(server, shutdown_cq, nullptr);
+    grpc_server_cancel_all_calls(server);
+    for (int i = 0; i < kCalls; i++) {
+      grpc_event ev =
+          grpc_completion_queue_next(client_cq, InfFuture(), nullptr);
+      ASSERT_EQ(ev.type, GRPC_OP_COMPLETE);
+      // A call left pending after the server closed would only complete
+      // when its deadline expired.
+      EXPECT_NE(static_cast<ClientCall*>(ev.tag)->status(),
+                GRPC_STATUS_DEADLINE_EXCEEDED)
+          << "iteration " << iteration;
+    }
+    ASSERT_EQ(grpc_completion_queue_pluck(shutdown_cq, nullptr, InfFuture(),
+                                          nullptr)
+                  .type,
+              GRPC_OP_COMPLETE);
+    grpc_completion_queue_destroy(shutdown_cq);
+    calls.clear();
+    grpc_channel_destroy(channel);
+    for (grpc_completion_queue* cq : cqs) grpc_completion_queue_shutdown(cq);
+    for (std::thread& thread : threads) thread.join();
+    // Checks that no pending call was left behind.
+    grpc_server_destroy(server);
+    for (grpc_completion_queue* cq : cqs) grpc_completion_queue_destroy(cq);
+    grpc_completion_queue_shutdown(client_cq);
+    while (grpc_completion_queue_next(client_cq, InfFuture(), nullptr).type !=
+           GRPC_QUEUE_SHUTDOWN) {
+    }
+    grpc_completion_queue_destroy(client_cq);
+  }
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
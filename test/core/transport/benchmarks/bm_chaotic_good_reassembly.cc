@@ -0,0 +1,113 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Reassembly of large chunked chaotic_good messages on the receiving side.
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "src/core/ext/transport/chaotic_good/message_chunker.h"
+#include "src/core/ext/transport/chaotic_good/message_reassembly.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+constexpr uint32_t kAlignment = 64;
+
+// The chunks of a message of state.range(0) bytes cut into chunks of at most
+// state.range(1) bytes, each in its own allocation as if read from a
+// different data endpoint.
+std::vector<Slice> ReadChunks(benchmark::State& state) {
+  SliceBuffer payload;
+  payload.Append(Slice(grpc_slice_malloc(state.range(0))));
+  message_chunker_detail::PayloadChunker chunker(state.range(1), kAlignment,
+                                                 1, std::move(payload));
+  std::vector<Slice> chunks;
+  while (true) {
+    auto chunk = chunker.NextChunk();
+    chunks.emplace_back(grpc_slice_malloc(chunk.frame.payload.Length()));
+    if (chunk.done) break;
+  }
+  return chunks;
+}
+
+void BM_ReassembleChunkedMessage(benchmark::State& state) {
+  const std::vector<Slice> chunks = ReadChunks(state);
+  MessageReassemblyStats stats;
+  for (auto _ : state) {
+    ChunkedMessage message(state.range(0), kAlignment);
+    for (const Slice& chunk : chunks) {
+      SliceBuffer payload(chunk.Ref());
+      message.AddChunk(payload);
+    }
+    SliceBuffer reassembled = message.TakePayload(&stats);
+    benchmark::DoNotOptimize(reassembled);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  state.counters["chunks"] = chunks.size();
+  state.counters["bytes_copied_per_message"] =
+      static_cast<double>(stats.bytes_copied.load()) / state.iterations();
+}
+BENCHMARK(BM_ReassembleChunkedMessage)
+    ->ArgsProduct({benchmark::CreateRange(1 << 20, 64 << 20, 4),
+                   {64 * 1024, 1024 * 1024}});
+
+// For comparison: what the same reassembly would cost were the chunks copied
+// into one contiguous buffer.
+void BM_ReassembleChunkedMessageByCopy(benchmark::State& state) {
+  const std::vector<Slice> chunks = ReadChunks(state);
+  for (auto _ : state) {
+    MutableSlice reassembled =
+        MutableSlice::CreateUninitialized(state.range(0));
+    uint8_t* out = reassembled.begin();
+    for (const Slice& chunk : chunks) {
+      memcpy(out, chunk.data(), chunk.size());
+      out += chunk.size();
+    }
+    benchmark::DoNotOptimize(reassembled);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  state.counters["chunks"] = chunks.size();
+  state.counters["bytes_copied_per_message"] = state.range(0);
+}
+BENCHMARK(BM_ReassembleChunkedMessageByCopy)
+    ->ArgsProduct({benchmark::CreateRange(1 << 20, 64 << 20, 4),
+                   {64 * 1024, 1024 * 1024}});
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
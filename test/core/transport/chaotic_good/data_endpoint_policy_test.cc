@@ -0,0 +1,306 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/data_endpoint_policy.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "src/core/ext/transport/chaotic_good/scheduler.h"
+#include "src/core/ext/transport/chaotic_good/send_rate.h"
+#include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+constexpr double kUnmeasured = SendRate::kUnmeasuredBytesPerSecond;
+
+SendRate::DeliveryData Endpoint(double bytes_per_second) {
+  return SendRate::DeliveryData{0, bytes_per_second, {}, {}};
+}
+
+DataEndpointPolicy::Sample MakeSample(double outstanding_bytes,
+                                      std::vector<double> rates) {
+  DataEndpointPolicy::Sample sample;
+  sample.outstanding_bytes = outstanding_bytes;
+  for (double rate : rates) sample.endpoints.push_back(Endpoint(rate));
+  return sample;
+}
+
+DataEndpointPolicy::Options TestOptions() {
+  DataEndpointPolicy::Options options;
+  options.min_endpoints = 1;
+  options.max_endpoints = 4;
+  return options;
+}
+
+TEST(DataEndpointPolicyTest, AddsAfterSustainedBacklog) {
+  DataEndpointPolicy policy(TestOptions());
+  // One second of backlog at 1MB/s.
+  auto sample = MakeSample(1e6, {1e6});
+  EXPECT_EQ(policy.Update(sample), 1u);
+  EXPECT_EQ(policy.Update(sample), 1u);
+  EXPECT_EQ(policy.Update(sample), 2u);
+  // Keeps asking until the endpoint shows up.
+  EXPECT_EQ(policy.Update(sample), 2u);
+}
+
+TEST(DataEndpointPolicyTest, HoldsWhileUnmeasured) {
+  DataEndpointPolicy policy(TestOptions());
+  auto sample = MakeSample(1e9, {1e6, kUnmeasured});
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(policy.Update(sample), 2u);
+}
+
+TEST(DataEndpointPolicyTest, RetiresAfterSustainedIdle) {
+  DataEndpointPolicy policy(TestOptions());
+  auto sample = MakeSample(0, {1e6, 1e6, 1e6});
+  EXPECT_EQ(policy.Update(sample), 3u);
+  EXPECT_EQ(policy.Update(sample), 3u);
+  EXPECT_EQ(policy.Update(sample), 2u);
+}
+
+TEST(DataEndpointPolicyTest, StaysWithinBounds) {
+  DataEndpointPolicy policy(TestOptions());
+  auto busy = MakeSample(1e9, {1e6, 1e6, 1e6, 1e6});
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(policy.Update(busy), 4u);
+  auto idle = MakeSample(0, {1e6});
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(policy.Update(idle), 1u);
+}
+
+TEST(DataEndpointPolicyTest, UndoesAdditionThatDidNotHelp) {
+  DataEndpointPolicy policy(TestOptions());
+  auto one = MakeSample(1e9, {1e6});
+  policy.Update(one);
+  policy.Update(one);
+  ASSERT_EQ(policy.Update(one), 2u);
+  // The path was already full: two endpoints share the same bandwidth.
+  auto two = MakeSample(1e9, {5e5, 5e5});
+  EXPECT_EQ(policy.Update(two), 2u);
+  EXPECT_EQ(policy.Update(two), 2u);
+  EXPECT_EQ(policy.Update(two), 1u);
+  // And does not try again while the load persists.
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(policy.Update(one), 1u);
+}
+
+TEST(DataEndpointPolicyTest, EndpointToRetireIsTheSlowest) {
+  EXPECT_EQ(DataEndpointPolicy::EndpointToRetire(MakeSample(0, {})),
+            std::nullopt);
+  EXPECT_EQ(DataEndpointPolicy::EndpointToRetire(MakeSample(0, {3, 1, 2})),
+            1u);
+}
+
+// Simulates a connection whose data endpoints each take a different path to
+// the peer: every path is policed to kPerPathRate, and all of them share a
+// bottleneck of kBottleneckRate. Payloads are placed on endpoints by a real
+// scheduler from the rates that each endpoint's SendRate reports, and the
+// policy is sampled periodically as TcpFrameTransport does.
+class MultiPathLink {
+ public:
+  static constexpr double kPerPathRate = 50e6;
+  static constexpr double kBottleneckRate = 200e6;
+  static constexpr uint64_t kTickNanos = 1000000;
+  static constexpr uint64_t kMessageSize = 64 * 1024;
+  // An endpoint is ready to take more payloads while this little is queued
+  // in its socket.
+  static constexpr uint64_t kSendBufferSize = 512 * 1024;
+  // The application stops producing once this much is outstanding.
+  static constexpr uint64_t kMaxOutstandingBytes = 64 * 1024 * 1024;
+
+  explicit MultiPathLink(DataEndpointPolicy::Options options)
+      : policy_(options), scheduler_(MakeScheduler("spanrr")) {
+    paths_.emplace_back();
+  }
+
+  // Run for `seconds` with the application producing `offered_rate`
+  // bytes/second. Returns the bytes delivered per second, keyed by the
+  // number of endpoints that payloads were being scheduled on. Ticks soon
+  // after the count changed are left out.
+  std::map<size_t, double> Run(double seconds, double offered_rate) {
+    std::map<size_t, std::pair<double, double>> delivered;
+    const uint64_t ticks = static_cast<uint64_t>(seconds * 1e9 / kTickNanos);
+    for (uint64_t i = 0; i < ticks; ++i) {
+      now_ += kTickNanos;
+      Produce(offered_rate);
+      Schedule();
+      const double bytes = Transmit();
+      if (now_ % (10 * kTickNanos) == 0) MeasurePaths();
+      if (now_ % (50 * kTickNanos) == 0) Adapt();
+      if (now_ - last_change_ >= 50 * kTickNanos) {
+        auto& entry = delivered[ActivePaths()];
+        entry.first += bytes;
+        entry.second += kTickNanos * 1e-9;
+      }
+    }
+    std::map<size_t, double> rates;
+    for (const auto& [count, entry] : delivered) {
+      rates[count] = entry.first / entry.second;
+    }
+    return rates;
+  }
+
+  size_t ActivePaths() const {
+    return std::count_if(paths_.begin(), paths_.end(),
+                         [](const Path& path) { return !path.retiring; });
+  }
+  size_t max_active_paths() const { return max_active_paths_; }
+
+ private:
+  struct Path {
+    SendRate send_rate;
+    uint64_t queued_bytes = 0;
+    bool retiring = false;
+  };
+
+  void Produce(double offered_rate) {
+    if (outstanding_bytes_ >= kMaxOutstandingBytes) return;
+    produced_bytes_ += offered_rate * kTickNanos * 1e-9;
+    while (produced_bytes_ >= kMessageSize) {
+      produced_bytes_ -= kMessageSize;
+      outstanding_bytes_ += kMessageSize;
+    }
+  }
+
+  void Schedule() {
+    if (outstanding_bytes_ == 0) return;
+    scheduler_->NewStep(outstanding_bytes_, kMessageSize);
+    for (size_t i = 0; i < paths_.size(); ++i) {
+      if (paths_[i].retiring) continue;
+      scheduler_->AddChannel(i, paths_[i].queued_bytes < kSendBufferSize,
+                             paths_[i].send_rate.GetDeliveryData(now_));
+    }
+    scheduler_->MakePlan(ztrace_collector_);
+    while (outstanding_bytes_ >= kMessageSize) {
+      auto id = scheduler_->AllocateMessage(kMessageSize, {});
+      if (!id.has_value()) break;
+      Path& path = paths_[*id];
+      // Like a reader, an endpoint takes what it is given and goes off to
+      // write it: once one has more than it can queue, end this step.
+      const bool was_full = path.queued_bytes >= kSendBufferSize;
+      path.queued_bytes += kMessageSize;
+      path.send_rate.EnqueueToReader(kMessageSize, now_);
+      path.send_rate.DequeueFromReader(now_);
+      outstanding_bytes_ -= kMessageSize;
+      if (was_full) break;
+    }
+  }
+
+  // Each path with data sends its share of the bottleneck, up to its own
+  // limit, this tick.
+  double Transmit() {
+    const double share = PathRate() * kTickNanos * 1e-9;
+    double total = 0;
+    for (Path& path : paths_) {
+      const uint64_t sent =
+          std::min<uint64_t>(path.queued_bytes, static_cast<uint64_t>(share));
+      path.queued_bytes -= sent;
+      total += sent;
+    }
+    // Retired endpoints go away once they have drained.
+    for (auto it = paths_.begin(); it != paths_.end();) {
+      if (it->retiring && it->queued_bytes == 0) {
+        it = paths_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    return total;
+  }
+
+  double PathRate() const {
+    return std::min(kPerPathRate, kBottleneckRate / paths_.size());
+  }
+
+  // What the kernel would report for a backlogged flow on each path.
+  void MeasurePaths() {
+    const double rate = PathRate();
+    for (Path& path : paths_) {
+      path.send_rate.SetNetworkMetrics(
+          SendRate::NetworkSend{now_, path.queued_bytes},
+          SendRate::NetworkMetrics{1000, rate * 1e-9});
+    }
+  }
+
+  void Adapt() {
+    DataEndpointPolicy::Sample sample;
+    sample.outstanding_bytes = outstanding_bytes_;
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < paths_.size(); ++i) {
+      if (paths_[i].retiring) continue;
+      sample.endpoints.push_back(paths_[i].send_rate.GetDeliveryData(now_));
+      indices.push_back(i);
+    }
+    const size_t desired = policy_.Update(sample);
+    if (desired > indices.size()) {
+      paths_.emplace_back();
+      last_change_ = now_;
+    } else if (desired < indices.size()) {
+      auto retire = DataEndpointPolicy::EndpointToRetire(sample);
+      ASSERT_TRUE(retire.has_value());
+      paths_[indices[*retire]].retiring = true;
+      last_change_ = now_;
+    }
+    max_active_paths_ = std::max(max_active_paths_, ActivePaths());
+  }
+
+  DataEndpointPolicy policy_;
+  std::unique_ptr<Scheduler> scheduler_;
+  TcpZTraceCollector ztrace_collector_;
+  // Scheduler channel ids are indices into this; erasing a drained path
+  // renumbers the rest, which is fine since every step re-adds them all.
+  std::vector<Path> paths_;
+  uint64_t now_ = 1000000000;
+  uint64_t last_change_ = 0;
+  double produced_bytes_ = 0;
+  uint64_t outstanding_bytes_ = 0;
+  size_t max_active_paths_ = 1;
+};
+
+TEST(DataEndpointPolicyTest, ThroughputScalesWithEndpointsOnMultiPathLink) {
+  DataEndpointPolicy::Options options;
+  options.min_endpoints = 1;
+  options.max_endpoints = 8;
+  MultiPathLink link(options);
+  // Offer more than the bottleneck can carry.
+  auto rates = link.Run(3, 300e6);
+  for (size_t count = 1; count <= 4; ++count) {
+    ASSERT_TRUE(rates.count(count)) << "never ran with " << count;
+    const double expected =
+        std::min(count * MultiPathLink::kPerPathRate,
+                 MultiPathLink::kBottleneckRate);
+    EXPECT_GT(rates[count], 0.8 * expected) << count << " endpoints";
+    EXPECT_LT(rates[count], 1.05 * expected) << count << " endpoints";
+  }
+  // A fifth endpoint was tried, did not help, and was retired.
+  EXPECT_EQ(link.max_active_paths(), 5u);
+  EXPECT_EQ(link.ActivePaths(), 4u);
+  // Once the load drops the extra endpoints are retired again.
+  rates = link.Run(2, 20e6);
+  EXPECT_EQ(link.ActivePaths(), 1u);
+  EXPECT_GT(rates[1], 0.8 * 20e6);
+}
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -48,7 +48,7 @@ void MessageChunkerTest(uint32_t max_chunk_size, uint32_t alignment,
   EXPECT_THAT(chunker.Send(Arena::MakePooled<Message>(
                                SliceBuffer(Slice::FromCopiedString(payload)),
                                message_flags),
-                           stream_id, nullptr, sender)(),
+                           stream_id, nullptr, {}, sender)(),
               IsReady(Success{}));
   if (max_chunk_size == 0) {
     // No chunking ==> one frame with just a message.
@@ -75,6 +75,11 @@ void MessageChunkerTest(uint32_t max_chunk_size, uint32_t alignment,
       for (size_t i = 1; i < sender.frames.size(); i++) {
         auto& f = std::get<chaotic_good::MessageChunkFrame>(sender.frames[i]);
         EXPECT_LE(f.payload.Length(), max_chunk_size);
+        // All but the last chunk keep the next one aligned.
+        if (i + 1 < sender.frames.size() && alignment > 1 &&
+            max_chunk_size >= alignment) {
+          EXPECT_EQ(f.payload.Length() % alignment, 0);
+        }
         EXPECT_EQ(f.stream_id, stream_id);
         received_payload.append(f.payload.JoinIntoString());
       }
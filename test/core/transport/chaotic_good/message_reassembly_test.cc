@@ -0,0 +1,129 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/message_reassembly.h"
+
+#include <grpc/slice.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+
+#include "src/core/ext/transport/chaotic_good/message_chunker.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+constexpr uint32_t kAlignment = 64;
+
+// `length` bytes starting `offset` bytes past a kAlignment boundary.
+Slice SliceAt(size_t offset, size_t length) {
+  const size_t units = (offset + length + kAlignment - 1) / kAlignment;
+  void* memory = std::aligned_alloc(kAlignment, units * kAlignment);
+  uint8_t* start = static_cast<uint8_t*>(memory) + offset;
+  for (size_t i = 0; i < length; ++i) start[i] = static_cast<uint8_t>(i);
+  return Slice(grpc_slice_new_with_user_data(start, length, free, memory));
+}
+
+TEST(MessageReassemblyTest, ChunksAreStitchedWithoutCopying) {
+  Slice read = SliceAt(0, 10000);
+  const uint8_t* start = read.data();
+  SliceBuffer payload(std::move(read));
+  message_chunker_detail::PayloadChunker chunker(1000, kAlignment, 1,
+                                                 std::move(payload));
+  ChunkedMessage message(10000, kAlignment);
+  while (true) {
+    auto chunk = chunker.NextChunk();
+    if (!chunk.done) {
+      EXPECT_EQ(chunk.frame.payload.Length() % kAlignment, 0u);
+    }
+    message.AddChunk(chunk.frame.payload);
+    if (chunk.done) break;
+  }
+  EXPECT_EQ(message.bytes_remaining(), 0u);
+  MessageReassemblyStats stats;
+  SliceBuffer reassembled = message.TakePayload(&stats);
+  // The chunks were cut from one slice, so they join back into it.
+  ASSERT_EQ(reassembled.Count(), 1u);
+  EXPECT_EQ(GRPC_SLICE_START_PTR(reassembled.c_slice_at(0)), start);
+  EXPECT_EQ(reassembled.Length(), 10000u);
+  EXPECT_EQ(stats.messages.load(), 1u);
+  EXPECT_EQ(stats.chunks.load(), 11u);
+  EXPECT_EQ(stats.bytes.load(), 10000u);
+  EXPECT_EQ(stats.bytes_copied.load(), 0u);
+  EXPECT_EQ(stats.misaligned_chunks.load(), 0u);
+}
+
+TEST(MessageReassemblyTest, ChunksReadSeparatelyStayWhereTheyWereRead) {
+  ChunkedMessage message(3 * 4096, kAlignment);
+  const uint8_t* starts[3];
+  for (int i = 0; i < 3; ++i) {
+    Slice read = SliceAt(0, 4096);
+    starts[i] = read.data();
+    SliceBuffer chunk(std::move(read));
+    message.AddChunk(chunk);
+  }
+  SliceBuffer reassembled = message.TakePayload(nullptr);
+  ASSERT_EQ(reassembled.Count(), 3u);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(GRPC_SLICE_START_PTR(reassembled.c_slice_at(i)), starts[i]);
+  }
+  EXPECT_EQ(message.chunks(), 3u);
+  EXPECT_EQ(message.bytes_copied(), 0u);
+  EXPECT_EQ(message.misaligned_chunks(), 0u);
+}
+
+TEST(MessageReassemblyTest, InlinedAndMisalignedChunksAreCounted) {
+  ChunkedMessage message(4096 + 4096 + 5, kAlignment);
+  SliceBuffer aligned(SliceAt(0, 4096));
+  message.AddChunk(aligned);
+  SliceBuffer misaligned(SliceAt(8, 4096));
+  message.AddChunk(misaligned);
+  SliceBuffer inlined(Slice::FromCopiedString("hello"));
+  message.AddChunk(inlined);
+  EXPECT_EQ(message.bytes_remaining(), 0u);
+  EXPECT_EQ(message.bytes_copied(), 5u);
+  // The inlined chunk lives inside the slice struct, wherever that is.
+  EXPECT_GE(message.misaligned_chunks(), 1u);
+  MessageReassemblyStats stats;
+  EXPECT_EQ(message.TakePayload(&stats).Length(), 4096u + 4096u + 5u);
+  EXPECT_EQ(stats.bytes_copied.load(), 5u);
+  EXPECT_EQ(stats.max_bytes_copied_per_message.load(), 5u);
+}
+
+TEST(MessageReassemblyTest, StatsKeepTheLargestCopy) {
+  MessageReassemblyStats stats;
+  stats.RecordMessage(1000, 2, 10, 0);
+  stats.RecordMessage(1000, 2, 30, 1);
+  stats.RecordMessage(1000, 2, 0, 0);
+  EXPECT_EQ(stats.messages.load(), 3u);
+  EXPECT_EQ(stats.chunks.load(), 6u);
+  EXPECT_EQ(stats.bytes.load(), 3000u);
+  EXPECT_EQ(stats.bytes_copied.load(), 40u);
+  EXPECT_EQ(stats.max_bytes_copied_per_message.load(), 30u);
+  EXPECT_EQ(stats.misaligned_chunks.load(), 1u);
+}
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
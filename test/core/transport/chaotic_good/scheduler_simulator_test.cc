@@ -0,0 +1,186 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/scheduler_simulator.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "src/core/ext/transport/chaotic_good/send_rate.h"
+#include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
+#include "gtest/gtest.h"
+#include "absl/log/log.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+constexpr uint64_t kMessageSize = 64 * 1024;
+
+TEST(SchedulerSimulatorTest, SyntheticFlowsAreSpacedEvenlyAndMerged) {
+  const SyntheticFlow flows[] = {
+      {/*start_time=*/0, /*end_time=*/1, /*bytes_per_second=*/4.0 * 1024,
+       /*message_size=*/1024},
+      {/*start_time=*/0.1, /*end_time=*/0.175, /*bytes_per_second=*/20.0 * 1024,
+       /*message_size=*/1024, /*priority=*/3},
+  };
+  auto workload = MakeSyntheticWorkload({}, flows);
+  ASSERT_EQ(workload.messages.size(), 6u);
+  EXPECT_DOUBLE_EQ(workload.messages[0].send_time, 0);
+  EXPECT_DOUBLE_EQ(workload.messages[1].send_time, 0.1);
+  EXPECT_EQ(workload.messages[1].priority, 3u);
+  EXPECT_DOUBLE_EQ(workload.messages[2].send_time, 0.15);
+  EXPECT_DOUBLE_EQ(workload.messages[3].send_time, 0.25);
+  EXPECT_DOUBLE_EQ(workload.messages[5].send_time, 0.75);
+}
+
+TEST(SchedulerSimulatorTest, LinkRatesArePiecewiseConstant) {
+  SimulatedLink link{{{0, 10}, {1, 20}, {3, 5}}, 0};
+  EXPECT_EQ(link.BytesPerSecondAt(0.5), 10);
+  EXPECT_EQ(link.BytesPerSecondAt(1), 20);
+  EXPECT_EQ(link.BytesPerSecondAt(2.9), 20);
+  EXPECT_EQ(link.BytesPerSecondAt(100), 5);
+}
+
+TEST(SchedulerSimulatorTest, LightLoadIsDeliveredAfterTransmissionAndDelay) {
+  const SyntheticFlow flows[] = {{0, 1, 5e6, kMessageSize}};
+  auto workload =
+      MakeSyntheticWorkload({SimulatedLink::Constant(10e6, 0.005)}, flows);
+  auto result = SimulateScheduler("spanrr", workload);
+  LOG(INFO) << result.ToString();
+  EXPECT_EQ(result.messages_delivered, result.messages_sent);
+  EXPECT_EQ(result.deadlines_missed, 0u);
+  // One tick of scheduling, the time on the wire, and the delay.
+  EXPECT_LE(result.queueing_delay.max, 0.001);
+  EXPECT_GE(result.latency.p50, 0.005 + kMessageSize / 10e6);
+  EXPECT_LE(result.latency.p99, 0.005 + kMessageSize / 10e6 + 0.002);
+}
+
+TEST(SchedulerSimulatorTest, OverloadIsDeliveredAtTheLinkRate) {
+  const SyntheticFlow flows[] = {{0, 1, 40e6, kMessageSize}};
+  auto workload =
+      MakeSyntheticWorkload({SimulatedLink::Constant(10e6, 0.001),
+                             SimulatedLink::Constant(10e6, 0.001)},
+                            flows);
+  auto result = SimulateScheduler("spanrr", workload);
+  LOG(INFO) << result.ToString();
+  EXPECT_EQ(result.messages_delivered, result.messages_sent);
+  EXPECT_NEAR(result.bytes_per_second, 20e6, 2e6);
+  // Both links carried their share.
+  ASSERT_EQ(result.bytes_per_link.size(), 2u);
+  EXPECT_GT(result.bytes_per_link[0], result.bytes_delivered * 0.4);
+  EXPECT_GT(result.bytes_per_link[1], result.bytes_delivered * 0.4);
+  // Half of what was sent waited for the links.
+  EXPECT_GT(result.latency.max, 0.9);
+}
+
+TEST(SchedulerSimulatorTest, SameConfigAndWorkloadGiveTheSameResult) {
+  // With a single link there is nothing for a scheduler to choose at random.
+  const SyntheticFlow flows[] = {{0, 0.5, 30e6, kMessageSize},
+                                 {0, 0.5, 1e6, 4096, /*priority=*/1}};
+  auto workload =
+      MakeSyntheticWorkload({SimulatedLink::Constant(20e6, 0.002)}, flows);
+  for (const char* config : {"spanrr", "deadline", "pick_best"}) {
+    auto a = SimulateScheduler(config, workload);
+    auto b = SimulateScheduler(config, workload);
+    EXPECT_EQ(a.ToString(), b.ToString()) << config;
+  }
+}
+
+TEST(SchedulerSimulatorTest, MessagesThatCannotBeSentAreReported) {
+  const SyntheticFlow flows[] = {
+      {0, 1, 1e6, kMessageSize, /*priority=*/0, /*deadline=*/0.1}};
+  auto workload = MakeSyntheticWorkload({SimulatedLink::Constant(0, 0)}, flows);
+  SchedulerSimulationOptions options;
+  options.max_seconds = 2;
+  auto result = SimulateScheduler("spanrr", workload, options);
+  EXPECT_EQ(result.messages_delivered, 0u);
+  EXPECT_EQ(result.deadlines_missed, result.messages_sent);
+  EXPECT_EQ(result.bytes_per_second, 0);
+}
+
+// The point of the harness: compare configs on the same workload. Small
+// priority calls share two links with more bulk data than they can carry.
+TEST(SchedulerSimulatorTest, DeadlineSchedulerKeepsUrgentCallsOutOfTheQueue) {
+  const SyntheticFlow flows[] = {
+      {0, 1, 150e6, kMessageSize},
+      {0, 1, 1e6, 32 * 1024, /*priority=*/1},
+  };
+  auto workload = MakeSyntheticWorkload({SimulatedLink::Constant(50e6, 0.001),
+                                         SimulatedLink::Constant(50e6, 0.001)},
+                                        flows);
+  auto spanrr = SimulateScheduler("spanrr", workload);
+  auto deadline = SimulateScheduler("deadline", workload);
+  LOG(INFO) << spanrr.ToString() << deadline.ToString();
+  EXPECT_EQ(spanrr.messages_delivered, spanrr.messages_sent);
+  EXPECT_EQ(deadline.messages_delivered, deadline.messages_sent);
+  // Without costing the bulk data throughput.
+  EXPECT_GE(deadline.bytes_per_second, spanrr.bytes_per_second * 0.9);
+  EXPECT_LT(deadline.latency_by_priority[1].p99 * 5,
+            spanrr.latency_by_priority[1].p99);
+}
+
+TraceWriteSchedule Schedule(double start_time0, double rate0,
+                            double start_time1, double rate1) {
+  TraceWriteSchedule schedule{};
+  schedule.channels.push_back({0, true, start_time0, rate0, 0});
+  schedule.channels.push_back({3, false, start_time1, rate1, 0});
+  return schedule;
+}
+
+TEST(SchedulerSimulatorTest, WorkloadIsRebuiltFromTrace) {
+  TraceWorkloadBuilder builder;
+  builder.AddSchedule(
+      0, Schedule(0.004, SendRate::kUnmeasuredBytesPerSecond, 0.003,
+                  SendRate::kUnmeasuredBytesPerSecond));
+  builder.AddSchedule(0.1, Schedule(0.002, 10e6, 0.005, 20e6));
+  builder.AddSchedule(0.2, Schedule(0.006, 10e6, 0.001, 30e6));
+  builder.AddWrite(0.25, WriteLargeFrameHeaderTrace{1, 1000, 3});
+  builder.AddWrite(0.15, WriteLargeFrameHeaderTrace{2, 2000, 0});
+  auto workload = builder.Build();
+  ASSERT_TRUE(workload.ok()) << workload.status();
+  ASSERT_EQ(workload->links.size(), 2u);
+  EXPECT_DOUBLE_EQ(workload->links[0].one_way_delay, 0.002);
+  EXPECT_EQ(workload->links[0].rates.size(), 1u);
+  EXPECT_EQ(workload->links[0].BytesPerSecondAt(0), 10e6);
+  EXPECT_DOUBLE_EQ(workload->links[1].one_way_delay, 0.001);
+  EXPECT_EQ(workload->links[1].BytesPerSecondAt(0.15), 20e6);
+  EXPECT_EQ(workload->links[1].BytesPerSecondAt(0.2), 30e6);
+  ASSERT_EQ(workload->messages.size(), 2u);
+  EXPECT_EQ(workload->messages[0].bytes, 2000u);
+  EXPECT_EQ(workload->messages[1].bytes, 1000u);
+  auto result = SimulateScheduler("spanrr", *workload);
+  EXPECT_EQ(result.messages_delivered, 2u);
+}
+
+TEST(SchedulerSimulatorTest, TraceWithoutMeasurementsOrWritesIsRejected) {
+  TraceWorkloadBuilder unmeasured;
+  unmeasured.AddSchedule(
+      0, Schedule(0.001, SendRate::kUnmeasuredBytesPerSecond, 0.001,
+                  SendRate::kUnmeasuredBytesPerSecond));
+  unmeasured.AddWrite(0, WriteLargeFrameHeaderTrace{1, 1000, 0});
+  EXPECT_FALSE(unmeasured.Build().ok());
+  TraceWorkloadBuilder unwritten;
+  unwritten.AddSchedule(0, Schedule(0.001, 1e6, 0.001, 1e6));
+  EXPECT_FALSE(unwritten.Build().ok());
+}
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
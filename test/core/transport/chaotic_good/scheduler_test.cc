@@ -0,0 +1,129 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/scheduler.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "src/core/ext/transport/chaotic_good/call_urgency.h"
+#include "src/core/ext/transport/chaotic_good/send_rate.h"
+#include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
+#include "src/core/util/time.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+constexpr uint64_t kBulkMessageSize = 64 * 1024;
+constexpr uint64_t kUrgentMessageSize = 32 * 1024;
+constexpr MessageUrgency kBulk{};
+constexpr MessageUrgency kUrgent{/*deadline=*/30, /*priority=*/1};
+
+SendRate::DeliveryData Delivery(double start_time, double bytes_per_second) {
+  return SendRate::DeliveryData{start_time, bytes_per_second, {}, {0, 0}};
+}
+
+// One step of a scheduler over two data endpoints of 10MB/s, only the first
+// of which is ready: the second is busy for another half second. With a
+// single ready endpoint nothing is shuffled, so every decision is exact.
+class OneReadyEndpointTest : public ::testing::Test {
+ protected:
+  void MakePlan(const char* config, double outstanding_bytes) {
+    scheduler_ = MakeScheduler(config);
+    scheduler_->NewStep(outstanding_bytes, kBulkMessageSize);
+    scheduler_->AddChannel(0, true, Delivery(0, 10e6));
+    scheduler_->AddChannel(1, false, Delivery(0.5, 10e6));
+    scheduler_->MakePlan(ztrace_collector_);
+  }
+
+  std::optional<uint32_t> Allocate(uint64_t bytes,
+                                   const MessageUrgency& urgency) {
+    return scheduler_->AllocateMessage(bytes, urgency);
+  }
+
+  std::unique_ptr<Scheduler> scheduler_;
+  TcpZTraceCollector ztrace_collector_;
+};
+
+TEST_F(OneReadyEndpointTest, DeadlineSchedulerHoldsBulkBackForTheBusyOne) {
+  MakePlan("deadline", 1e6);
+  // The 10ms step lets the ready endpoint take 100KB: the bulk messages
+  // that start within it go, the rest wait for the next step.
+  EXPECT_EQ(Allocate(kBulkMessageSize, kBulk), 0u);
+  EXPECT_EQ(Allocate(kBulkMessageSize, kBulk), 0u);
+  EXPECT_EQ(Allocate(kBulkMessageSize, kBulk), std::nullopt);
+  // An urgent call is not held to the plan.
+  EXPECT_EQ(Allocate(kUrgentMessageSize, kUrgent), 0u);
+  EXPECT_EQ(Allocate(kUrgentMessageSize, kUrgent), 0u);
+  // Neither is a call whose deadline is close.
+  EXPECT_EQ(Allocate(kBulkMessageSize, MessageUrgency{/*deadline=*/0.5}), 0u);
+  EXPECT_EQ(Allocate(kBulkMessageSize, kBulk), std::nullopt);
+}
+
+TEST_F(OneReadyEndpointTest, DeadlineSchedulerUrgentPriorityIsConfigurable) {
+  MakePlan("deadline:urgent_priority=2:urgent_deadline=0", 1e6);
+  EXPECT_EQ(Allocate(kBulkMessageSize, kBulk), 0u);
+  EXPECT_EQ(Allocate(kBulkMessageSize, kBulk), 0u);
+  EXPECT_EQ(Allocate(kUrgentMessageSize, kUrgent), std::nullopt);
+  EXPECT_EQ(Allocate(kUrgentMessageSize, MessageUrgency{30, 2}), 0u);
+}
+
+TEST_F(OneReadyEndpointTest, SpanrrTreatsEveryMessageAlike) {
+  // Over its 1s step, spanrr gives the ready endpoint 7.5MB of the 10MB and
+  // the busy one the rest.
+  MakePlan("spanrr", 10e6);
+  int placed = 0;
+  while (Allocate(kBulkMessageSize, kBulk).has_value()) ++placed;
+  EXPECT_EQ(placed, 114);
+  // Once bulk data is refused, so is an urgent call: spanrr leaves it queued
+  // behind the bulk data.
+  EXPECT_EQ(Allocate(kUrgentMessageSize, kUrgent), std::nullopt);
+}
+
+// The transport offers queued messages in this order to schedulers that
+// order by urgency, so the most urgent get the plan first.
+TEST(CallUrgencyTest, MoreUrgentOrdersByPriorityThenDeadline) {
+  const Timestamp now = Timestamp::ProcessEpoch() + Duration::Seconds(100);
+  std::vector<CallUrgency> calls = {
+      {Timestamp::InfFuture(), 0},
+      {now + Duration::Seconds(5), 0},
+      {Timestamp::InfFuture(), 1},
+      {now + Duration::Seconds(1), 0},
+      {now + Duration::Seconds(10), 1},
+  };
+  std::stable_sort(calls.begin(), calls.end(), CallUrgency::MoreUrgent);
+  EXPECT_EQ(calls[0].priority, 1u);
+  EXPECT_EQ(calls[0].deadline, now + Duration::Seconds(10));
+  EXPECT_EQ(calls[1].priority, 1u);
+  EXPECT_EQ(calls[1].deadline, Timestamp::InfFuture());
+  EXPECT_EQ(calls[2].deadline, now + Duration::Seconds(1));
+  EXPECT_EQ(calls[3].deadline, now + Duration::Seconds(5));
+  EXPECT_EQ(calls[4].deadline, Timestamp::InfFuture());
+  EXPECT_TRUE(MakeScheduler("deadline")->OrdersByUrgency());
+  EXPECT_FALSE(MakeScheduler("spanrr")->OrdersByUrgency());
+}
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,145 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Settings exchange between a client and a server Config, as the connector
+// and the server run it, with shared memory enabled on either side.
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/ext/transport/chaotic_good/chaotic_good_frame.pb.h"
+#include "src/core/ext/transport/chaotic_good/config.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/util/crash.h"
+#include "src/core/util/grpc_check.h"
+#include "gtest/gtest.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::URIToResolvedAddress;
+
+class FakeClientConnectionFactory : public ClientConnectionFactory {
+ public:
+  PendingConnection Connect(absl::string_view) override {
+    Crash("Connect not implemented");
+  }
+  void Orphaned() override {}
+};
+
+ChannelArgs SharedMemoryArgs(int size) {
+  return ChannelArgs().Set(GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_SIZE, size);
+}
+
+EventEngine::ResolvedAddress Address(const char* uri) {
+  auto address = URIToResolvedAddress(uri);
+  GRPC_CHECK_OK(address);
+  return *address;
+}
+
+struct Negotiation {
+  Config client;
+  Config server;
+  chaotic_good_frame::Settings client_settings;
+  chaotic_good_frame::Settings server_settings;
+  absl::Status client_status;
+};
+
+// Runs the settings exchange, letting tamper edit the server's settings
+// before the client sees them.
+Negotiation Negotiate(
+    const ChannelArgs& client_args, const ChannelArgs& server_args,
+    const char* server_uri = "ipv4:127.0.0.1:443",
+    absl::AnyInvocable<void(chaotic_good_frame::Settings&)> tamper =
+        [](chaotic_good_frame::Settings&) {}) {
+  Negotiation n{Config(client_args), Config(server_args), {}, {}, {}};
+  n.client.ClientPrepareSharedMemory(Address(server_uri));
+  n.client.PrepareClientOutgoingSettings(n.client_settings);
+  GRPC_CHECK_OK(n.server.ReceiveClientIncomingSettings(n.client_settings));
+  n.server.ServerAcceptSharedMemory(n.client_settings,
+                                    Address("ipv4:127.0.0.1:50000"));
+  n.server.PrepareServerOutgoingSettings(n.server_settings);
+  tamper(n.server_settings);
+  FakeClientConnectionFactory factory;
+  n.client_status =
+      n.client.ReceiveServerIncomingSettings(n.server_settings, factory);
+  return n;
+}
+
+TEST(SharedMemoryNegotiationTest, OfferIsAnsweredAndAttached) {
+  Negotiation n = Negotiate(SharedMemoryArgs(64 * 1024),
+                            SharedMemoryArgs(1024 * 1024));
+  ASSERT_TRUE(n.client_settings.has_shared_memory());
+  EXPECT_FALSE(n.client_settings.shared_memory().socket_name().empty());
+  EXPECT_TRUE(n.client_settings.shared_memory().nonce().empty());
+  ASSERT_TRUE(n.server_settings.has_shared_memory());
+  EXPECT_EQ(n.server_settings.shared_memory().ring_size(), 64 * 1024);
+  EXPECT_FALSE(n.server_settings.shared_memory().nonce().empty());
+  EXPECT_TRUE(n.client_status.ok()) << n.client_status;
+  EXPECT_TRUE(n.server.uses_shared_memory());
+  EXPECT_TRUE(n.client.uses_shared_memory());
+}
+
+TEST(SharedMemoryNegotiationTest, ServerWithoutSharedMemoryFallsBack) {
+  Negotiation n = Negotiate(SharedMemoryArgs(64 * 1024), ChannelArgs());
+  EXPECT_TRUE(n.client_settings.has_shared_memory());
+  EXPECT_FALSE(n.server_settings.has_shared_memory());
+  EXPECT_TRUE(n.client_status.ok()) << n.client_status;
+  EXPECT_FALSE(n.server.uses_shared_memory());
+  EXPECT_FALSE(n.client.uses_shared_memory());
+}
+
+TEST(SharedMemoryNegotiationTest, OversizedOfferFallsBack) {
+  Negotiation n = Negotiate(SharedMemoryArgs(1024 * 1024),
+                            SharedMemoryArgs(64 * 1024));
+  EXPECT_FALSE(n.server_settings.has_shared_memory());
+  EXPECT_TRUE(n.client_status.ok()) << n.client_status;
+  EXPECT_FALSE(n.client.uses_shared_memory());
+}
+
+TEST(SharedMemoryNegotiationTest, RemoteServerIsNotOffered) {
+  Negotiation n = Negotiate(SharedMemoryArgs(64 * 1024),
+                            SharedMemoryArgs(64 * 1024), "ipv4:10.0.0.1:443");
+  EXPECT_FALSE(n.client_settings.has_shared_memory());
+  EXPECT_FALSE(n.server_settings.has_shared_memory());
+  EXPECT_TRUE(n.client_status.ok()) << n.client_status;
+  EXPECT_FALSE(n.client.uses_shared_memory());
+}
+
+TEST(SharedMemoryNegotiationTest, MismatchedAnswerFailsHandshake) {
+  // The server gave up its data connections for the region, so the client
+  // cannot fall back to them.
+  Negotiation n = Negotiate(
+      SharedMemoryArgs(64 * 1024), SharedMemoryArgs(64 * 1024),
+      "ipv4:127.0.0.1:443", [](chaotic_good_frame::Settings& settings) {
+        settings.mutable_shared_memory()->mutable_nonce()->front() ^= 1;
+      });
+  EXPECT_TRUE(n.server.uses_shared_memory());
+  EXPECT_FALSE(n.client_status.ok());
+  EXPECT_FALSE(n.client.uses_shared_memory());
+}
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,256 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/shared_memory_region.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace {
+
+struct ConnectedRegions {
+  RefCountedPtr<SharedMemoryRegion> client;
+  RefCountedPtr<SharedMemoryRegion> server;
+};
+
+ConnectedRegions Connect(uint64_t ring_size) {
+  auto rendezvous = SharedMemoryRendezvous::Listen(ring_size);
+  EXPECT_TRUE(rendezvous.ok()) << rendezvous.status();
+  if (!rendezvous.ok()) return {};
+  chaotic_good_frame::SharedMemoryOffer offer;
+  (*rendezvous)->FillOffer(offer);
+  auto server = SharedMemoryRegion::Create(offer.ring_size());
+  EXPECT_TRUE(server.ok()) << server.status();
+  if (!server.ok()) return {};
+  absl::Status status = (*server)->HandOver(offer);
+  EXPECT_TRUE(status.ok()) << status;
+  if (!status.ok()) return {};
+  (*server)->FillAnswer(offer);
+  auto client = (*rendezvous)->Accept(offer);
+  EXPECT_TRUE(client.ok()) << client.status();
+  if (!client.ok()) return {};
+  return {std::move(*client), std::move(*server)};
+}
+
+// Connect to the rendezvous in offer and send it fd, or nothing for -1, as
+// a server or some other local process could.
+void SendFd(const chaotic_good_frame::SharedMemoryOffer& offer, int fd) {
+  sockaddr_un addr = {};
+  addr.sun_family = AF_UNIX;
+  ASSERT_LT(offer.socket_name().size() + 1, sizeof(addr.sun_path));
+  memcpy(addr.sun_path + 1, offer.socket_name().data(),
+         offer.socket_name().size());
+  int sock = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+  ASSERT_GE(sock, 0);
+  ASSERT_EQ(connect(sock, reinterpret_cast<const sockaddr*>(&addr),
+                    offsetof(sockaddr_un, sun_path) + 1 +
+                        offer.socket_name().size()),
+            0);
+  char byte = 0;
+  iovec iov = {&byte, 1};
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+  msghdr msg = {};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  if (fd >= 0) {
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+  }
+  EXPECT_EQ(sendmsg(sock, &msg, 0), 1);
+  close(sock);
+}
+
+std::optional<uint64_t> Write(SharedMemoryRegion& region,
+                              const std::string& payload) {
+  SliceBuffer buffer;
+  buffer.Append(Slice::FromCopiedString(payload));
+  return region.WritePayload(buffer);
+}
+
+TEST(SharedMemoryRegionTest, PayloadsGoBothWays) {
+  auto regions = Connect(64 * 1024);
+  ASSERT_NE(regions.client, nullptr);
+  const std::string request(10000, 'a');
+  const std::string response(20000, 'b');
+  auto request_tag = Write(*regions.client, request);
+  ASSERT_TRUE(request_tag.has_value());
+  auto response_tag = Write(*regions.server, response);
+  ASSERT_TRUE(response_tag.has_value());
+  auto received_request =
+      regions.server->ReadPayload(*request_tag, request.size());
+  ASSERT_TRUE(received_request.ok()) << received_request.status();
+  EXPECT_EQ(received_request->JoinIntoString(), request);
+  auto received_response =
+      regions.client->ReadPayload(*response_tag, response.size());
+  ASSERT_TRUE(received_response.ok()) << received_response.status();
+  EXPECT_EQ(received_response->JoinIntoString(), response);
+}
+
+TEST(SharedMemoryRegionTest, FullRingRefusesUntilPayloadReleased) {
+  auto regions = Connect(SharedMemoryRegion::kPageSize);
+  ASSERT_NE(regions.client, nullptr);
+  const std::string payload(2000, 'x');
+  auto first = Write(*regions.client, payload);
+  ASSERT_TRUE(first.has_value());
+  // The second payload needs to wrap, and there is no room to.
+  EXPECT_EQ(Write(*regions.client, payload), std::nullopt);
+  auto received = regions.server->ReadPayload(*first, payload.size());
+  ASSERT_TRUE(received.ok()) << received.status();
+  EXPECT_EQ(Write(*regions.client, payload), std::nullopt);
+  // Dropping the received payload gives its chunk back to the sender.
+  received->Clear();
+  auto second = Write(*regions.client, payload);
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(regions.server->ReadPayload(*second, payload.size())
+                ->JoinIntoString(),
+            payload);
+}
+
+TEST(SharedMemoryRegionTest, ReceivedPayloadOutlivesRegion) {
+  auto regions = Connect(64 * 1024);
+  ASSERT_NE(regions.client, nullptr);
+  const std::string payload(3000, 'y');
+  auto tag = Write(*regions.client, payload);
+  ASSERT_TRUE(tag.has_value());
+  auto received = regions.server->ReadPayload(*tag, payload.size());
+  ASSERT_TRUE(received.ok()) << received.status();
+  regions.client.reset();
+  regions.server.reset();
+  EXPECT_EQ(received->JoinIntoString(), payload);
+}
+
+TEST(SharedMemoryRegionTest, BadTagsAreRejected) {
+  auto regions = Connect(64 * 1024);
+  ASSERT_NE(regions.client, nullptr);
+  EXPECT_FALSE(regions.server->ReadPayload(0, 1).ok());
+  EXPECT_FALSE(regions.server->ReadPayload(1u << 20, 1).ok());
+  // Nothing has been written at this tag yet.
+  EXPECT_FALSE(regions.server->ReadPayload(1, 1).ok());
+  auto tag = Write(*regions.client, std::string(100, 'z'));
+  ASSERT_TRUE(tag.has_value());
+  EXPECT_FALSE(regions.server->ReadPayload(*tag, 100000).ok());
+}
+
+TEST(SharedMemoryRegionTest, AcceptChecksNonce) {
+  auto rendezvous = SharedMemoryRendezvous::Listen(64 * 1024);
+  ASSERT_TRUE(rendezvous.ok()) << rendezvous.status();
+  chaotic_good_frame::SharedMemoryOffer offer;
+  (*rendezvous)->FillOffer(offer);
+  auto server = SharedMemoryRegion::Create(offer.ring_size());
+  ASSERT_TRUE(server.ok()) << server.status();
+  ASSERT_TRUE((*server)->HandOver(offer).ok());
+  (*server)->FillAnswer(offer);
+  offer.mutable_nonce()->front() ^= 1;
+  EXPECT_FALSE((*rendezvous)->Accept(offer).ok());
+}
+
+TEST(SharedMemoryRegionTest, AcceptWithoutHandOverFails) {
+  auto rendezvous = SharedMemoryRendezvous::Listen(64 * 1024);
+  ASSERT_TRUE(rendezvous.ok()) << rendezvous.status();
+  chaotic_good_frame::SharedMemoryOffer offer;
+  (*rendezvous)->FillOffer(offer);
+  auto server = SharedMemoryRegion::Create(offer.ring_size());
+  ASSERT_TRUE(server.ok()) << server.status();
+  (*server)->FillAnswer(offer);
+  EXPECT_FALSE((*rendezvous)->Accept(offer).ok());
+}
+
+TEST(SharedMemoryRegionTest, AcceptRefusesUnsealedMemfd) {
+  auto rendezvous = SharedMemoryRendezvous::Listen(64 * 1024);
+  ASSERT_TRUE(rendezvous.ok()) << rendezvous.status();
+  chaotic_good_frame::SharedMemoryOffer offer;
+  (*rendezvous)->FillOffer(offer);
+  // A region that looks right, but whose sender could still shrink it.
+  auto server = SharedMemoryRegion::Create(offer.ring_size());
+  ASSERT_TRUE(server.ok()) << server.status();
+  (*server)->FillAnswer(offer);
+  const uint64_t region_size =
+      SharedMemoryRegion::kPageSize + 2 * offer.ring_size();
+  int fd = memfd_create("unsealed", MFD_CLOEXEC);
+  ASSERT_GE(fd, 0);
+  ASSERT_EQ(ftruncate(fd, region_size), 0);
+  SendFd(offer, fd);
+  close(fd);
+  auto client = (*rendezvous)->Accept(offer);
+  EXPECT_FALSE(client.ok());
+  EXPECT_THAT(client.status().message(), ::testing::HasSubstr("sealed"));
+}
+
+TEST(SharedMemoryRegionTest, AcceptSkipsOtherConnections) {
+  auto rendezvous = SharedMemoryRendezvous::Listen(64 * 1024);
+  ASSERT_TRUE(rendezvous.ok()) << rendezvous.status();
+  chaotic_good_frame::SharedMemoryOffer offer;
+  (*rendezvous)->FillOffer(offer);
+  // Someone else connects first, with no memfd and then with another one.
+  SendFd(offer, -1);
+  auto other = SharedMemoryRegion::Create(offer.ring_size());
+  ASSERT_TRUE(other.ok()) << other.status();
+  ASSERT_TRUE((*other)->HandOver(offer).ok());
+  auto server = SharedMemoryRegion::Create(offer.ring_size());
+  ASSERT_TRUE(server.ok()) << server.status();
+  ASSERT_TRUE((*server)->HandOver(offer).ok());
+  (*server)->FillAnswer(offer);
+  auto client = (*rendezvous)->Accept(offer);
+  ASSERT_TRUE(client.ok()) << client.status();
+  const std::string payload(100, 'w');
+  auto tag = Write(**server, payload);
+  ASSERT_TRUE(tag.has_value());
+  EXPECT_EQ((*client)->ReadPayload(*tag, payload.size())->JoinIntoString(),
+            payload);
+}
+
+TEST(SharedMemoryRegionTest, SameHostPeers) {
+  auto is_same_host = [](const char* uri) {
+    auto address = grpc_event_engine::experimental::URIToResolvedAddress(uri);
+    EXPECT_TRUE(address.ok()) << address.status();
+    return address.ok() && IsSameHostPeer(*address);
+  };
+  EXPECT_TRUE(is_same_host("ipv4:127.0.0.1:443"));
+  EXPECT_TRUE(is_same_host("ipv6:[::1]:443"));
+  EXPECT_TRUE(is_same_host("ipv6:[::ffff:127.0.0.1]:443"));
+  EXPECT_FALSE(is_same_host("ipv4:10.0.0.1:443"));
+  EXPECT_FALSE(is_same_host("ipv6:[2001:db8::1]:443"));
+}
+
+}  // namespace
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -22,14 +22,18 @@
 #include <string.h>
 
 #include <memory>
+#include <random>
+#include <string>
 
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/util/string.h"
 #include "test/core/test_util/test_config.h"
 #include "gtest/gtest.h"
 #include "absl/log/log.h"
+#include "absl/strings/escaping.h"
 
 static int all_ok = 1;
 
@@ -164,6 +168,35 @@ TEST(BinDecoderTest, MainTest) {
   EXPECT_DECODED_LENGTH("abcde===", 0);
 }
 
+// Covers every tail case and inputs long enough to exercise the bulk loop, and
+// checks that a bad character anywhere in the input is caught.
+TEST(BinDecoderTest, LongInputsRoundTrip) {
+  grpc_core::ExecCtx exec_ctx;
+  std::mt19937 rng(42);
+  for (size_t length = 0; length < 2048; length += 1 + length / 16) {
+    std::string input;
+    for (size_t i = 0; i < length; i++) input += static_cast<char>(rng());
+    std::string padded = absl::Base64Escape(input);
+    std::string unpadded = padded;
+    while (!unpadded.empty() && unpadded.back() == '=') unpadded.pop_back();
+
+    grpc_slice decoded = base64_decode(padded.c_str());
+    EXPECT_EQ(grpc_core::StringViewFromSlice(decoded), input)
+        << "length " << length;
+    grpc_slice_unref(decoded);
+    decoded = base64_decode_with_length(unpadded.c_str(), length);
+    EXPECT_EQ(grpc_core::StringViewFromSlice(decoded), input)
+        << "length " << length;
+    grpc_slice_unref(decoded);
+
+    if (unpadded.empty()) continue;
+    unpadded[rng() % unpadded.size()] = ':';
+    decoded = base64_decode_with_length(unpadded.c_str(), length);
+    EXPECT_EQ(GRPC_SLICE_LENGTH(decoded), 0) << "length " << length;
+    grpc_slice_unref(decoded);
+  }
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
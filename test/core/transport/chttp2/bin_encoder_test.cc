@@ -23,12 +23,16 @@
 #include <string.h>
 
 #include <memory>
+#include <random>
+#include <string>
 
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/util/string.h"
 #include "test/core/test_util/test_config.h"
 #include "gtest/gtest.h"
 #include "absl/log/log.h"
+#include "absl/strings/escaping.h"
 
 static int all_ok = 1;
 
@@ -173,6 +177,25 @@ TEST(BinEncoderTest, MainTest) {
   expect_binary_header("-bin", 0);
 }
 
+// Covers every tail case and inputs long enough to exercise the bulk loops.
+TEST(BinEncoderTest, LongInputsMatchReference) {
+  std::mt19937 rng(42);
+  for (size_t length = 0; length < 2048; length += 1 + length / 16) {
+    std::string input;
+    for (size_t i = 0; i < length; i++) input += static_cast<char>(rng());
+    std::string expected = absl::Base64Escape(input);
+    while (!expected.empty() && expected.back() == '=') expected.pop_back();
+    grpc_slice slice = grpc_slice_from_copied_buffer(input.data(), length);
+    grpc_slice encoded = grpc_chttp2_base64_encode(slice);
+    EXPECT_EQ(grpc_core::StringViewFromSlice(encoded), expected)
+        << "length " << length;
+    grpc_slice_unref(encoded);
+    grpc_slice_unref(slice);
+    expect_combined_equiv(input.data(), length, __LINE__);
+  }
+  ASSERT_TRUE(all_ok);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
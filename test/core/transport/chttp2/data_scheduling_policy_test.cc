@@ -0,0 +1,125 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/data_scheduling_policy.h"
+
+#include <cstdint>
+#include <limits>
+
+#include "src/core/call/metadata_batch.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/slice/slice.h"
+#include "gtest/gtest.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_core {
+namespace {
+
+uint32_t WeightFor(const char* priority) {
+  grpc_metadata_batch md;
+  md.Append(kHttp2StreamPriorityMetadataKey, Slice::FromCopiedString(priority),
+            [](absl::string_view error, const Slice& value) {
+              FAIL() << error << " value:" << value.as_string_view();
+            });
+  return Chttp2StreamWeightFromMetadata(md);
+}
+
+TEST(DataSchedulingPolicyTest, DisabledByDefault) {
+  Chttp2DataSchedulingPolicy policy{ChannelArgs()};
+  EXPECT_FALSE(policy.fair());
+  EXPECT_FALSE(policy.IsSmall(0));
+  EXPECT_FALSE(policy.IsSmall(1));
+  Chttp2StreamDataShare share;
+  EXPECT_EQ(share.BeginTurn(policy), std::numeric_limits<uint64_t>::max());
+}
+
+TEST(DataSchedulingPolicyTest, NegativeArgsDisable) {
+  Chttp2DataSchedulingPolicy policy{
+      ChannelArgs()
+          .Set(GRPC_ARG_HTTP2_FAIR_SCHEDULING_QUANTUM_BYTES, -1)
+          .Set(GRPC_ARG_HTTP2_SMALL_MESSAGE_LANE_BYTES, -1)};
+  EXPECT_FALSE(policy.fair());
+  EXPECT_FALSE(policy.IsSmall(0));
+}
+
+TEST(DataSchedulingPolicyTest, TinyQuantumIsRaised) {
+  Chttp2DataSchedulingPolicy policy{
+      ChannelArgs().Set(GRPC_ARG_HTTP2_FAIR_SCHEDULING_QUANTUM_BYTES, 1)};
+  ASSERT_TRUE(policy.fair());
+  EXPECT_EQ(policy.quantum(), kMinHttp2FairSchedulingQuantumBytes);
+}
+
+TEST(DataSchedulingPolicyTest, SmallMessageLane) {
+  Chttp2DataSchedulingPolicy policy{
+      ChannelArgs().Set(GRPC_ARG_HTTP2_SMALL_MESSAGE_LANE_BYTES, 1024)};
+  EXPECT_FALSE(policy.fair());
+  EXPECT_TRUE(policy.IsSmall(0));
+  EXPECT_TRUE(policy.IsSmall(1024));
+  EXPECT_FALSE(policy.IsSmall(1025));
+}
+
+TEST(DataSchedulingPolicyTest, WeightFromMetadata) {
+  EXPECT_EQ(Chttp2StreamWeightFromMetadata(grpc_metadata_batch()), 1u);
+  EXPECT_EQ(WeightFor("0"), 1u);
+  EXPECT_EQ(WeightFor("7"), 8u);
+  EXPECT_EQ(WeightFor("255"), 256u);
+  EXPECT_EQ(WeightFor("100000"), 256u);
+  EXPECT_EQ(WeightFor("-3"), 1u);
+  EXPECT_EQ(WeightFor("high"), 1u);
+}
+
+TEST(DataSchedulingPolicyTest, DeficitCarriesOverWhileBacklogged) {
+  Chttp2DataSchedulingPolicy policy{
+      ChannelArgs().Set(GRPC_ARG_HTTP2_FAIR_SCHEDULING_QUANTUM_BYTES, 2000)};
+  ASSERT_TRUE(policy.fair());
+  Chttp2StreamDataShare share;
+  EXPECT_EQ(share.BeginTurn(policy), 2000u);
+  // A frame boundary left 100 bytes of the quantum unused.
+  share.Sent(1900);
+  share.EndTurn(/*drained=*/false);
+  EXPECT_EQ(share.deficit(), 100u);
+  EXPECT_EQ(share.BeginTurn(policy), 2100u);
+  share.Sent(2100);
+  share.EndTurn(/*drained=*/false);
+  EXPECT_EQ(share.deficit(), 0u);
+}
+
+TEST(DataSchedulingPolicyTest, DrainedStreamForfeitsDeficit) {
+  Chttp2DataSchedulingPolicy policy{
+      ChannelArgs().Set(GRPC_ARG_HTTP2_FAIR_SCHEDULING_QUANTUM_BYTES, 2000)};
+  Chttp2StreamDataShare share;
+  share.BeginTurn(policy);
+  share.Sent(10);
+  share.EndTurn(/*drained=*/true);
+  EXPECT_EQ(share.deficit(), 0u);
+  EXPECT_EQ(share.BeginTurn(policy), 2000u);
+}
+
+TEST(DataSchedulingPolicyTest, WeightScalesTheQuantum) {
+  Chttp2DataSchedulingPolicy policy{
+      ChannelArgs().Set(GRPC_ARG_HTTP2_FAIR_SCHEDULING_QUANTUM_BYTES, 2000)};
+  Chttp2StreamDataShare low;
+  Chttp2StreamDataShare high;
+  high.set_weight(WeightFor("3"));
+  EXPECT_EQ(low.BeginTurn(policy), 2000u);
+  EXPECT_EQ(high.BeginTurn(policy), 8000u);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
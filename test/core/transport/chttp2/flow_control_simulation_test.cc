@@ -0,0 +1,350 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Simulates one stream carrying a bulk transfer over links of a range of
+// bandwidths and round trip times. The receiver drives its flow control as
+// chttp2 does: BDP pings, PeriodicUpdate() on each ping ack, and SETTINGS and
+// WINDOW_UPDATE frames that take effect at the sender half a round trip
+// later. Checks that throughput converges to the link rate and that the
+// advertised max frame size follows the BDP.
+
+#include <grpc/support/time.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <utility>
+
+#include "src/core/ext/transport/chttp2/transport/flow_control.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/bdp_estimator.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/time.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "gtest/gtest.h"
+
+extern gpr_timespec (*gpr_now_impl)(gpr_clock_type clock_type);
+
+namespace grpc_core {
+namespace chttp2 {
+namespace {
+
+constexpr gpr_timespec kStart = {1, 0, GPR_CLOCK_MONOTONIC};
+gpr_timespec g_now = kStart;
+
+gpr_timespec now_impl(gpr_clock_type clock_type) {
+  GRPC_CHECK(clock_type != GPR_TIMESPAN);
+  gpr_timespec ts = g_now;
+  ts.clock_type = clock_type;
+  return ts;
+}
+
+constexpr int64_t kNanosPerSecond = 1000000000;
+constexpr uint32_t kFrameHeaderBytes = 9;
+// Cost to the sender of each frame, over and above its bytes.
+constexpr int64_t kPerFrameNanos = 1000;
+// The application reads everything as it arrives, from one message larger
+// than any of the simulations send.
+constexpr int64_t kMessageSize = int64_t{1} << 40;
+constexpr uint32_t kMinFrameSize = 16384;
+constexpr uint32_t kMaxFrameSize = 16777215;
+
+class FlowControlSimulation {
+ public:
+  FlowControlSimulation(double bits_per_second, Duration round_trip_time,
+                        bool autotune_frame_size)
+      : bits_per_second_(bits_per_second),
+        one_way_nanos_(round_trip_time.millis() * 1000000 / 2) {
+    g_now = kStart;
+    tfc_.set_autotune_frame_size(autotune_frame_size);
+    At(0, [this] { SenderMaybeSendData(); });
+  }
+
+  ~FlowControlSimulation() { memory_owner_.Release(reserved_memory_); }
+
+  // Runs the simulation until `duration` after it started.
+  void RunUntil(Duration duration) {
+    const int64_t end = duration.millis() * 1000000;
+    while (!events_.empty() && events_.begin()->first.first <= end) {
+      auto event = events_.extract(events_.begin());
+      now_ = event.key().first;
+      g_now = gpr_time_add(kStart, gpr_time_from_nanos(now_, GPR_TIMESPAN));
+      ExecCtx::Get()->InvalidateNow();
+      event.mapped()();
+    }
+  }
+
+  // Takes all of the memory quota, so that the pressure on it is at its
+  // highest from now on.
+  void ExhaustMemoryQuota() {
+    constexpr size_t kQuotaSize = 1024 * 1024;
+    resource_quota_->memory_quota()->SetSize(kQuotaSize);
+    reserved_memory_ += memory_owner_.Reserve(kQuotaSize);
+  }
+
+  int64_t bytes_received() const { return bytes_received_; }
+  uint32_t TakeLargestFrameReceived() {
+    return std::exchange(largest_frame_received_, 0);
+  }
+  int64_t target_frame_size() const {
+    return tfc_.test_only_target_frame_size();
+  }
+
+ private:
+  void At(int64_t time, absl::AnyInvocable<void()> event) {
+    events_.emplace(std::pair(time, next_event_++), std::move(event));
+  }
+  // Control frames from the receiver reach the sender half a round trip
+  // later.
+  void ToSender(absl::AnyInvocable<void()> event) {
+    At(now_ + one_way_nanos_, std::move(event));
+  }
+  // Control frames from the sender go out behind the data frame it is
+  // sending, if any.
+  void ToReceiver(absl::AnyInvocable<void()> event) {
+    At(std::max(now_, link_busy_until_) + one_way_nanos_, std::move(event));
+  }
+
+  // Receiver: chttp2's read path.
+
+  void ReceiveData(uint32_t size) {
+    EXPECT_LE(size, acked_max_frame_size_);
+    bytes_received_ += size;
+    largest_frame_received_ = std::max(largest_frame_received_, size);
+    if (bdp_ping_blocked_) {
+      bdp_ping_blocked_ = false;
+      SendBdpPing();
+    }
+    tfc_.bdp_estimator()->AddIncomingBytes(size);
+    FlowControlAction action;
+    {
+      StreamFlowControl::IncomingUpdateContext upd(&sfc_);
+      EXPECT_EQ(upd.RecvData(size), absl::OkStatus());
+      upd.SetMinProgressSize(kMessageSize);
+      action = upd.MakeAction();
+    }
+    Act(action);
+  }
+
+  void ReceiveSettingsAck(std::optional<uint32_t> initial_window_size,
+                          std::optional<uint32_t> max_frame_size) {
+    if (max_frame_size.has_value()) acked_max_frame_size_ = *max_frame_size;
+    if (initial_window_size.has_value()) {
+      Act(tfc_.SetAckedInitialWindow(*initial_window_size));
+    }
+  }
+
+  void ReceiveBdpPingAck() {
+    const Timestamp next_ping = tfc_.bdp_estimator()->CompletePing();
+    Act(tfc_.PeriodicUpdate());
+    const int64_t delay =
+        std::max<int64_t>(0, (next_ping - Timestamp::Now()).millis());
+    At(now_ + delay * 1000000, [this] {
+      if (tfc_.bdp_estimator()->accumulator() == 0) {
+        bdp_ping_blocked_ = true;
+      } else {
+        SendBdpPing();
+      }
+    });
+  }
+
+  void SendBdpPing() {
+    tfc_.bdp_estimator()->SchedulePing();
+    tfc_.bdp_estimator()->StartPing();
+    Write();
+    ToSender([this] { ToReceiver([this] { ReceiveBdpPingAck(); }); });
+  }
+
+  void Act(FlowControlAction action) {
+    if (action.send_initial_window_update() !=
+        FlowControlAction::Urgency::NO_ACTION_NEEDED) {
+      queued_initial_window_size_ = action.initial_window_size();
+    }
+    if (action.send_max_frame_size_update() !=
+        FlowControlAction::Urgency::NO_ACTION_NEEDED) {
+      queued_max_frame_size_ = action.max_frame_size();
+      EXPECT_GE(action.max_frame_size(), kMinFrameSize);
+      EXPECT_LE(action.max_frame_size(), kMaxFrameSize);
+    }
+    if (action.AnyUpdateImmediately()) Write();
+  }
+
+  // Sends queued SETTINGS, and window updates for whatever has been read.
+  void Write() {
+    if (queued_initial_window_size_.has_value() ||
+        queued_max_frame_size_.has_value()) {
+      tfc_.FlushedSettings();
+      ToSender([this,
+                initial_window_size =
+                    std::exchange(queued_initial_window_size_, std::nullopt),
+                max_frame_size =
+                    std::exchange(queued_max_frame_size_, std::nullopt)] {
+        SenderReceiveSettings(initial_window_size, max_frame_size);
+      });
+    }
+    const uint32_t stream_update = sfc_.MaybeSendUpdate();
+    const uint32_t transport_update = tfc_.MaybeSendUpdate(true);
+    if (stream_update > 0 || transport_update > 0) {
+      ToSender([this, stream_update, transport_update] {
+        peer_stream_window_delta_ += stream_update;
+        peer_transport_window_ += transport_update;
+        SenderMaybeSendData();
+      });
+    }
+  }
+
+  // Sender: sends frames as large as the settings and windows it has been
+  // given allow, one at a time at the link rate.
+
+  void SenderReceiveSettings(std::optional<uint32_t> initial_window_size,
+                             std::optional<uint32_t> max_frame_size) {
+    if (initial_window_size.has_value()) {
+      peer_initial_window_size_ = *initial_window_size;
+    }
+    if (max_frame_size.has_value()) peer_max_frame_size_ = *max_frame_size;
+    ToReceiver([this, initial_window_size, max_frame_size] {
+      ReceiveSettingsAck(initial_window_size, max_frame_size);
+    });
+    SenderMaybeSendData();
+  }
+
+  void SenderMaybeSendData() {
+    if (sending_) return;
+    const int64_t size = std::min(
+        {int64_t{peer_max_frame_size_}, peer_transport_window_,
+         peer_initial_window_size_ + peer_stream_window_delta_});
+    if (size <= 0) return;
+    peer_transport_window_ -= size;
+    peer_stream_window_delta_ -= size;
+    sending_ = true;
+    link_busy_until_ =
+        now_ + kPerFrameNanos +
+        static_cast<int64_t>(std::ceil((size + kFrameHeaderBytes) * 8.0 *
+                                       kNanosPerSecond / bits_per_second_));
+    At(link_busy_until_, [this] {
+      sending_ = false;
+      SenderMaybeSendData();
+    });
+    At(link_busy_until_ + one_way_nanos_,
+       [this, size] { ReceiveData(static_cast<uint32_t>(size)); });
+  }
+
+  const double bits_per_second_;
+  const int64_t one_way_nanos_;
+  int64_t now_ = 0;
+  uint64_t next_event_ = 0;
+  std::map<std::pair<int64_t, uint64_t>, absl::AnyInvocable<void()>> events_;
+
+  ResourceQuotaRefPtr resource_quota_ =
+      MakeResourceQuota("flow_control_simulation");
+  MemoryOwner memory_owner_ =
+      resource_quota_->memory_quota()->CreateMemoryOwner();
+  size_t reserved_memory_ = 0;
+  TransportFlowControl tfc_{"simulation", true, &memory_owner_};
+  StreamFlowControl sfc_{&tfc_};
+  std::optional<uint32_t> queued_initial_window_size_;
+  std::optional<uint32_t> queued_max_frame_size_;
+  uint32_t acked_max_frame_size_ = kMinFrameSize;
+  bool bdp_ping_blocked_ = true;
+  int64_t bytes_received_ = 0;
+  uint32_t largest_frame_received_ = 0;
+
+  int64_t peer_initial_window_size_ = 65535;
+  int64_t peer_stream_window_delta_ = 0;
+  int64_t peer_transport_window_ = 65535;
+  uint32_t peer_max_frame_size_ = kMinFrameSize;
+  int64_t link_busy_until_ = 0;
+  bool sending_ = false;
+};
+
+struct Link {
+  double bits_per_second;
+  Duration round_trip_time;
+};
+
+class FlowControlSimulationOverLinkTest
+    : public ::testing::TestWithParam<Link> {};
+
+TEST_P(FlowControlSimulationOverLinkTest, ThroughputConvergesToLinkRate) {
+  ExecCtx exec_ctx;
+  const Link link = GetParam();
+  const double bdp = link.bits_per_second / 8 *
+                     link.round_trip_time.millis() / 1000.0;
+  FlowControlSimulation sim(link.bits_per_second, link.round_trip_time,
+                            /*autotune_frame_size=*/true);
+  sim.RunUntil(Duration::Milliseconds(7500));
+  const int64_t converged_bytes = sim.bytes_received();
+  sim.RunUntil(Duration::Seconds(10));
+  const double throughput =
+      (sim.bytes_received() - converged_bytes) * 8 / 2.5;
+  EXPECT_GE(throughput, 0.8 * link.bits_per_second);
+  // A fraction of the BDP: not pinned to the minimum on long fat links, and
+  // not as large as the window on short thin ones.
+  EXPECT_GE(sim.target_frame_size(),
+            std::min(bdp / 16, static_cast<double>(kMaxFrameSize)));
+  EXPECT_LE(sim.target_frame_size(),
+            std::max(4 * bdp, static_cast<double>(kMinFrameSize)));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Links, FlowControlSimulationOverLinkTest,
+    ::testing::Values(Link{10e6, Duration::Milliseconds(1)},
+                      Link{10e6, Duration::Milliseconds(200)},
+                      Link{1e9, Duration::Milliseconds(1)},
+                      Link{1e9, Duration::Milliseconds(10)},
+                      Link{1e9, Duration::Milliseconds(200)},
+                      Link{10e9, Duration::Milliseconds(1)},
+                      Link{10e9, Duration::Milliseconds(50)}));
+
+TEST(FlowControlSimulationTest, WithoutAutotuningFramesAreAsLargeAsTheWindow) {
+  ExecCtx exec_ctx;
+  FlowControlSimulation sim(10e6, Duration::Milliseconds(1),
+                            /*autotune_frame_size=*/false);
+  sim.RunUntil(Duration::Seconds(5));
+  EXPECT_GE(sim.target_frame_size(), 4 * 1024 * 1024);
+}
+
+TEST(FlowControlSimulationTest, MemoryPressureShrinksFramesToTheMinimum) {
+  ExecCtx exec_ctx;
+  FlowControlSimulation sim(1e9, Duration::Milliseconds(10),
+                            /*autotune_frame_size=*/true);
+  sim.RunUntil(Duration::Seconds(5));
+  EXPECT_GT(sim.target_frame_size(), kMinFrameSize);
+  sim.ExhaustMemoryQuota();
+  sim.RunUntil(Duration::Seconds(8));
+  sim.TakeLargestFrameReceived();
+  const int64_t bytes_received = sim.bytes_received();
+  sim.RunUntil(Duration::Seconds(10));
+  EXPECT_EQ(sim.target_frame_size(), kMinFrameSize);
+  EXPECT_LE(sim.TakeLargestFrameReceived(), kMinFrameSize);
+  // Data still flows, a stream window at a time.
+  EXPECT_GT(sim.bytes_received(), bytes_received);
+}
+
+}  // namespace
+}  // namespace chttp2
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_core::chttp2::g_now = grpc_core::chttp2::kStart;
+  grpc_core::TestOnlySetProcessEpoch(grpc_core::chttp2::g_now);
+  gpr_now_impl = grpc_core::chttp2::now_impl;
+  return RUN_ALL_TESTS();
+}
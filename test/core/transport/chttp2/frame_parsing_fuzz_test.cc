@@ -0,0 +1,258 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The read path parses frame headers and HPACK integers from whole words when
+// enough bytes are contiguous, and a byte at a time otherwise: check that both
+// give the same answers for all inputs.
+
+#include <grpc/grpc.h>
+#include <grpc/slice.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "fuzztest/fuzztest.h"
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
+#include "src/core/ext/transport/chttp2/transport/varint.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "src/core/util/orphanable.h"
+#include "test/core/test_util/mock_endpoint.h"
+#include "gtest/gtest.h"
+#include "absl/status/status.h"
+
+namespace grpc_core {
+namespace {
+
+// A frame a client transport takes at any point after the server's first
+// SETTINGS, with an effect that shows whether its header was read right:
+// (kind, value, flags).
+using FrameSpec = std::tuple<uint8_t, uint32_t, uint8_t>;
+
+// Most frames in one input, which keeps the sum of the WINDOW_UPDATE
+// increments within the largest window.
+constexpr size_t kMaxFrames = 256;
+
+std::string BigEndian(uint64_t value, size_t bytes) {
+  std::string out(bytes, '\0');
+  for (size_t i = 0; i < bytes; ++i) {
+    out[bytes - 1 - i] = static_cast<char>(value >> (8 * i));
+  }
+  return out;
+}
+
+std::string Frame(uint8_t type, uint8_t flags, uint32_t stream_id,
+                  const std::string& payload) {
+  return BigEndian(payload.size(), 3) + BigEndian(type, 1) +
+         BigEndian(flags, 1) + BigEndian(stream_id, 4) + payload;
+}
+
+std::string Serialize(const std::vector<FrameSpec>& frames) {
+  std::string out = Frame(GRPC_CHTTP2_FRAME_SETTINGS, 0, 0, "");
+  for (const auto& [kind, value, flags] : frames) {
+    // The reserved bit of the stream id must be ignored.
+    const uint32_t reserved = (flags & 0x80) != 0 ? 0x80000000u : 0;
+    switch (kind % 3) {
+      case 0:
+        // Queues an ack carrying the opaque data.
+        out += Frame(GRPC_CHTTP2_FRAME_PING,
+                     static_cast<uint8_t>(flags & ~GRPC_CHTTP2_FLAG_ACK),
+                     reserved, BigEndian(value, 8));
+        break;
+      case 1:
+        // Grows the transport's send window.
+        out += Frame(GRPC_CHTTP2_FRAME_WINDOW_UPDATE, flags, reserved,
+                     BigEndian(1 + value % 0xffff, 4));
+        break;
+      case 2:
+        // Skipped as an unknown type: only its length has an effect, and its
+        // fields are left in the transport if it is the last frame.
+        out += Frame(0x10 + kind % 0x80, flags, (value & 0x7fffffff) | reserved,
+                     std::string(value % 64, 'x'));
+        break;
+    }
+  }
+  return out;
+}
+
+// What a client transport made of the bytes it read.
+struct ReadOutcome {
+  absl::Status status;
+  grpc_chttp2_deframe_transport_state deframe_state;
+  uint32_t frame_size;
+  uint8_t frame_type;
+  uint8_t frame_flags;
+  uint32_t stream_id;
+  std::vector<uint64_t> ping_acks;
+  int64_t remote_window;
+};
+
+// Feeds `bytes` to a new client transport through grpc_chttp2_perform_read(),
+// in slices of the sizes in `slice_sizes` taken in turn, or in a single slice
+// if there are none.
+ReadOutcome ReadInSlices(const std::string& bytes,
+                         const std::vector<size_t>& slice_sizes) {
+  ExecCtx exec_ctx;
+  auto engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  auto controller =
+      grpc_event_engine::experimental::MockEndpointController::Create(engine);
+  controller->NoMoreReads();
+  auto* t = reinterpret_cast<grpc_chttp2_transport*>(
+      grpc_create_chttp2_transport(
+          ChannelArgs()
+              .SetObject(ResourceQuota::Default())
+              .SetObject(std::move(engine)),
+          OrphanablePtr<grpc_endpoint>(controller->TakeCEndpoint()),
+          /*is_client=*/true));
+  ReadOutcome outcome;
+  // Parse under the transport's combiner, as its read loop does.
+  t->combiner->Run(
+      NewClosure([&](absl::Status) {
+        size_t offset = 0;
+        size_t next_size = 0;
+        while (offset < bytes.size() && outcome.status.ok()) {
+          const size_t length =
+              slice_sizes.empty()
+                  ? bytes.size()
+                  : std::min(slice_sizes[next_size++ % slice_sizes.size()],
+                             bytes.size() - offset);
+          grpc_slice slice =
+              grpc_slice_from_copied_buffer(bytes.data() + offset, length);
+          size_t requests_started = 0;
+          auto result = grpc_chttp2_perform_read(t, slice, requests_started);
+          CSliceUnref(slice);
+          // Only HEADERS frames start requests, and so stop a read early.
+          auto* status = std::get_if<absl::Status>(&result);
+          ASSERT_NE(status, nullptr);
+          outcome.status = *status;
+          offset += length;
+        }
+        outcome.deframe_state = t->deframe_state;
+        outcome.frame_size = t->incoming_frame_size;
+        outcome.frame_type = t->incoming_frame_type;
+        outcome.frame_flags = t->incoming_frame_flags;
+        outcome.stream_id = t->incoming_stream_id;
+        outcome.ping_acks.assign(t->ping_acks,
+                                 t->ping_acks + t->ping_ack_count);
+        outcome.remote_window = t->flow_control.remote_window();
+      }),
+      absl::OkStatus());
+  exec_ctx.Flush();
+  t->Orphan();
+  return outcome;
+}
+
+void ExpectSameOutcome(const ReadOutcome& actual,
+                       const ReadOutcome& expected) {
+  EXPECT_EQ(actual.status.ok(), expected.status.ok());
+  EXPECT_EQ(actual.status.message(), expected.status.message());
+  EXPECT_EQ(actual.deframe_state, expected.deframe_state);
+  EXPECT_EQ(actual.frame_size, expected.frame_size);
+  EXPECT_EQ(actual.frame_type, expected.frame_type);
+  EXPECT_EQ(actual.frame_flags, expected.frame_flags);
+  EXPECT_EQ(actual.stream_id, expected.stream_id);
+  EXPECT_EQ(actual.ping_acks, expected.ping_acks);
+  EXPECT_EQ(actual.remote_window, expected.remote_window);
+}
+
+void SplitReadsMatchByteAtATime(std::vector<FrameSpec> frames,
+                                std::vector<size_t> slice_sizes) {
+  grpc_init();
+  const std::string bytes = Serialize(frames);
+  // One byte per slice never has a whole header at hand, so every header goes
+  // through the FH_0 to FH_8 states.
+  const ReadOutcome byte_at_a_time = ReadInSlices(bytes, {1});
+  EXPECT_TRUE(byte_at_a_time.status.ok()) << byte_at_a_time.status;
+  ExpectSameOutcome(ReadInSlices(bytes, slice_sizes), byte_at_a_time);
+  // A single slice has every header whole.
+  ExpectSameOutcome(ReadInSlices(bytes, {}), byte_at_a_time);
+  grpc_shutdown();
+}
+FUZZ_TEST(FrameParsing, SplitReadsMatchByteAtATime)
+    .WithDomains(
+        fuzztest::VectorOf(fuzztest::Arbitrary<FrameSpec>())
+            .WithMaxSize(kMaxFrames),
+        fuzztest::VectorOf(fuzztest::InRange<size_t>(1, 64)).WithMaxSize(16));
+
+TEST(FrameParsing, HeadersSplitAtEveryOffset) {
+  const std::vector<FrameSpec> frames = {{0, 0x01020304, 0x80},
+                                         {1, 0x7fffffff, 0x81},
+                                         {2, 0xffffffff, 0xff},
+                                         {0, 0, 0}};
+  for (size_t size = 1; size <= 2 * kFrameHeaderSize; ++size) {
+    SplitReadsMatchByteAtATime(frames, {size});
+  }
+}
+
+TEST(FrameParsing, FrameHeaderParseReservedBit) {
+  const std::array<uint8_t, kFrameHeaderSize> input = {
+      0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff};
+  EXPECT_EQ(Http2FrameHeader::Parse(input.data()),
+            (Http2FrameHeader{0xffffff, 0xfe, 0xfd, 0x7fffffff}));
+}
+
+// As HPackParser reads the bytes after an integer's prefix when they are split
+// across slices.
+VarintTail ReadVarintTailByteAtATime(const std::array<uint8_t, 4>& input) {
+  VarintTail tail{0, 0};
+  for (size_t i = 0; i < input.size(); ++i) {
+    tail.value += static_cast<uint32_t>(input[i] & 0x7f) << (7 * i);
+    if ((input[i] & 0x80) == 0) {
+      tail.length = i + 1;
+      break;
+    }
+  }
+  return tail;
+}
+
+void ReadVarintTailMatchesByteAtATime(std::array<uint8_t, 4> input) {
+  const VarintTail fast = ReadVarintTail(input.data());
+  const VarintTail slow = ReadVarintTailByteAtATime(input);
+  EXPECT_EQ(fast.value, slow.value);
+  EXPECT_EQ(fast.length, slow.length);
+}
+FUZZ_TEST(FrameParsing, ReadVarintTailMatchesByteAtATime);
+
+TEST(FrameParsing, ReadVarintTailLengths) {
+  for (const std::array<uint8_t, 4>& input :
+       {std::array<uint8_t, 4>{0x00, 0xff, 0xff, 0xff},
+        std::array<uint8_t, 4>{0x81, 0x7f, 0xff, 0xff},
+        std::array<uint8_t, 4>{0xff, 0xff, 0x01, 0x80},
+        std::array<uint8_t, 4>{0xff, 0xff, 0xff, 0x7f},
+        std::array<uint8_t, 4>{0x80, 0x80, 0x80, 0x80}}) {
+    ReadVarintTailMatchesByteAtATime(input);
+  }
+  const std::array<uint8_t, 4> longest = {0xff, 0xff, 0xff, 0x7f};
+  EXPECT_EQ(ReadVarintTail(longest.data()).value, 0x0fffffffu);
+  EXPECT_EQ(ReadVarintTail(longest.data()).length, 4u);
+}
+
+}  // namespace
+}  // namespace grpc_core
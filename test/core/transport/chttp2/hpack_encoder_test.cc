@@ -27,6 +27,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -41,6 +42,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
 
 grpc_core::HPackCompressor* g_compressor;
 grpc_core::Http2ZTraceCollector* g_ztrace_collector =
@@ -421,6 +423,69 @@ TEST(HpackEncoderTest, EncodeBinaryAsTrueBinary) {
   EXPECT_EQ(compressor.test_only_table_size(), 114);
 }
 
+grpc_core::Slice EncodeRequestHeaders(grpc_core::HPackCompressor& compressor,
+                                      absl::string_view path) {
+  grpc_metadata_batch b;
+  b.Set(grpc_core::HttpPathMetadata(),
+        grpc_core::Slice::FromCopiedString(path));
+  b.Set(grpc_core::HttpAuthorityMetadata(),
+        grpc_core::Slice::FromStaticString("foo.test.google.fr:1234"));
+  b.Set(grpc_core::HttpMethodMetadata(),
+        grpc_core::HttpMethodMetadata::kPost);
+  b.Set(grpc_core::HttpSchemeMetadata(),
+        grpc_core::HttpSchemeMetadata::kHttp);
+  b.Set(grpc_core::ContentTypeMetadata(),
+        grpc_core::ContentTypeMetadata::kApplicationGrpc);
+  b.Set(grpc_core::TeMetadata(), grpc_core::TeMetadata::kTrailers);
+  b.Set(grpc_core::UserAgentMetadata(),
+        grpc_core::Slice::FromStaticString("grpc-c/3.0.0-dev (linux)"));
+  grpc_core::FakeCallTracer call_tracer;
+  grpc_core::HPackCompressor::EncodeHeaderOptions hopt = {
+      0xdeadbeef,  // stream_id
+      false,       // is_eof
+      false,       // use_true_binary_metadata
+      16384,       // max_frame_size
+      &call_tracer, g_ztrace_collector};
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&output);
+  EXPECT_TRUE(compressor.EncodeHeaders(hopt, b, &output));
+  grpc_core::Slice merged(grpc_slice_merge(output.slices, output.count));
+  grpc_slice_buffer_destroy(&output);
+  return merged;
+}
+
+// Request header blocks served from the cache must be exactly what encoding
+// the headers one by one would have produced, including once the table starts
+// evicting entries.
+TEST(HpackEncoderTest, RequestHeaderCacheMatchesUncachedEncoding) {
+  grpc_core::ExecCtx exec_ctx;
+  for (uint32_t table_size : {4096u, 256u, 0u}) {
+    grpc_core::HPackCompressor cached;
+    grpc_core::HPackCompressor uncached;
+    uncached.SetRequestHeaderCacheSize(0);
+    cached.SetMaxTableSize(table_size);
+    uncached.SetMaxTableSize(table_size);
+    for (int i = 0; i < 200; i++) {
+      const std::string path = absl::StrCat("/foo.Service/Method", i % 7 % 4);
+      EXPECT_EQ(EncodeRequestHeaders(cached, path),
+                EncodeRequestHeaders(uncached, path))
+          << "call " << i << " table size " << table_size;
+    }
+  }
+}
+
+TEST(HpackEncoderTest, RequestHeaderCacheRepeatsIndexedBlock) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::HPackCompressor compressor;
+  const grpc_core::Slice first = EncodeRequestHeaders(compressor, "/a.B/C");
+  const grpc_core::Slice second = EncodeRequestHeaders(compressor, "/a.B/C");
+  const grpc_core::Slice third = EncodeRequestHeaders(compressor, "/a.B/C");
+  // The first call adds the headers to the table, the second refers to them
+  // by index, and from then on the block is reused unchanged.
+  EXPECT_LT(second.length(), first.length());
+  EXPECT_EQ(second, third);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
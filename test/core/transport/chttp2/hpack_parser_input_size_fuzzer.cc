@@ -26,6 +26,8 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "fuzztest/fuzztest.h"
 #include "src/core/call/metadata_batch.h"
@@ -146,5 +148,25 @@ void SameHpackResultRegardlessOfSplitMode(std::vector<uint8_t> buffer) {
 }
 FUZZ_TEST(HpackParser, SameHpackResultRegardlessOfSplitMode);
 
+// Whole, the input's integers are read by ParseVarint's fast path; split a
+// byte at a time, by its byte at a time fallback. Build inputs that are mostly
+// integers with their prefixes full, so that both paths are exercised on
+// every length of tail, padding included.
+void SameVarintResultRegardlessOfSplitMode(
+    std::vector<std::pair<uint8_t, std::vector<uint8_t>>> fields) {
+  std::vector<uint8_t> buffer;
+  for (const auto& field : fields) {
+    buffer.push_back(field.first);
+    buffer.insert(buffer.end(), field.second.begin(), field.second.end());
+  }
+  SameHpackResultRegardlessOfSplitMode(std::move(buffer));
+}
+FUZZ_TEST(HpackParser, SameVarintResultRegardlessOfSplitMode)
+    .WithDomains(fuzztest::VectorOf(fuzztest::PairOf(
+        // Indexed field, table size update, and literal with indexed name:
+        // each with its prefix full, so that an integer tail follows.
+        fuzztest::ElementOf<uint8_t>({0xff, 0x3f, 0x7f, 0x0f}),
+        fuzztest::VectorOf(fuzztest::Arbitrary<uint8_t>()).WithMaxSize(24))));
+
 }  // namespace
 }  // namespace grpc_core
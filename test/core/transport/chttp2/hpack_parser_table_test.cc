@@ -20,15 +20,19 @@
 
 #include <grpc/grpc.h>
 
+#include <algorithm>
+#include <memory>
 #include <string>
 #include <utility>
 
+#include "src/core/ext/transport/chttp2/transport/hpack_parse_result.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/telemetry/stats.h"
 #include "test/core/test_util/test_config.h"
 #include "gtest/gtest.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 
 namespace grpc_core {
 namespace {
@@ -38,6 +42,16 @@ void AssertIndex(HPackTable* tbl, uint32_t idx, const char* key,
   ASSERT_NE(md, nullptr);
   EXPECT_EQ(md->md.DebugString(), absl::StrCat(key, ": ", value));
 }
+
+HPackTable::Memento MakeMemento(absl::string_view key,
+                                absl::string_view value) {
+  return HPackTable::Memento{
+      ParsedMetadata<grpc_metadata_batch>(
+          ParsedMetadata<grpc_metadata_batch>::FromSlicePair{},
+          Slice::FromCopiedString(key), Slice::FromCopiedString(value),
+          key.length() + value.length() + 32),
+      nullptr};
+}
 }  // namespace
 
 TEST(HpackParserTableTest, StaticTable) {
@@ -188,6 +202,84 @@ TEST(HpackParserTableTest, ManyUnusedAdditions) {
   EXPECT_GT(num_buckets_changed, 0);
 }
 
+TEST(HpackParserTableTest, CompactManyAdditions) {
+  HPackTable tbl;
+  tbl.SetCompactStorage(true);
+
+  ExecCtx exec_ctx;
+
+  auto stats_before = http2_global_stats().Collect();
+
+  for (int i = 0; i < 100000; i++) {
+    std::string key = absl::StrCat("K.", i);
+    std::string value = absl::StrCat("VALUE.", i);
+    ASSERT_TRUE(tbl.Add(MakeMemento(key, value), key, value));
+    AssertIndex(&tbl, 1 + hpack_constants::kLastStaticEntry, key.c_str(),
+                value.c_str());
+    if (i) {
+      std::string key = absl::StrCat("K.", i - 1);
+      std::string value = absl::StrCat("VALUE.", i - 1);
+      AssertIndex(&tbl, 2 + hpack_constants::kLastStaticEntry, key.c_str(),
+                  value.c_str());
+    }
+  }
+
+  auto stats_after = http2_global_stats().Collect();
+
+  EXPECT_EQ(stats_after->http2_hpack_hits - stats_before->http2_hpack_hits,
+            100000);
+  EXPECT_EQ(stats_after->http2_hpack_misses, stats_before->http2_hpack_misses);
+}
+
+TEST(HpackParserTableTest, CompactStorageMatchesMementos) {
+  ExecCtx exec_ctx;
+  HPackTable mementos;
+  HPackTable compact;
+  compact.SetCompactStorage(true);
+  auto expect_same = [&]() {
+    ASSERT_EQ(compact.num_entries(), mementos.num_entries());
+    EXPECT_EQ(compact.test_only_table_size(), mementos.test_only_table_size());
+    EXPECT_EQ(compact.TestOnlyDynamicTableAsString(),
+              mementos.TestOnlyDynamicTableAsString());
+  };
+  auto add = [&](int i) {
+    // Entries of varied lengths, so that they straddle the end of the ring.
+    std::string key = absl::StrCat("key-", i % 7);
+    std::string value(i % 300, static_cast<char>('a' + i % 26));
+    if (i % 5 == 0) key = "content-type";
+    ASSERT_TRUE(mementos.Add(MakeMemento(key, value), key, value));
+    ASSERT_TRUE(compact.Add(MakeMemento(key, value), key, value));
+  };
+  for (uint32_t table_size : {4096u, 65536u, 1000u, 0u, 16384u}) {
+    for (HPackTable* tbl : {&mementos, &compact}) {
+      tbl->SetMaxBytes(std::max(table_size, 4096u));
+      ASSERT_TRUE(tbl->SetCurrentTableSize(table_size));
+    }
+    expect_same();
+    for (int i = 0; i < 2000; i++) {
+      add(i);
+      if (i % 97 == 0) expect_same();
+    }
+    expect_same();
+  }
+}
+
+TEST(HpackParserTableTest, CompactStorageKeepsParseErrors) {
+  ExecCtx exec_ctx;
+  HPackTable tbl;
+  tbl.SetCompactStorage(true);
+  auto memento = MakeMemento("grpc-timeout", "bogus");
+  memento.parse_status = std::make_unique<HpackParseResult>(
+      HpackParseResult::MetadataParseError("grpc-timeout"));
+  ASSERT_TRUE(tbl.Add(std::move(memento), "grpc-timeout", "bogus"));
+  for (int i = 0; i < 2; i++) {
+    const auto* md = tbl.Lookup(1 + hpack_constants::kLastStaticEntry);
+    ASSERT_NE(md, nullptr);
+    ASSERT_NE(md->parse_status.get(), nullptr);
+    EXPECT_FALSE(md->parse_status->ok());
+  }
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
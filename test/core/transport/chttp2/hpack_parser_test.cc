@@ -97,6 +97,8 @@ class ParseTest : public ::testing::TestWithParam<Test> {
     }
   }
 
+  void UseCompactTable() { parser_->hpack_table()->SetCompactStorage(true); }
+
   static bool IsStreamError(const absl::Status& status) {
     intptr_t stream_id;
     return grpc_error_get_int(status, StatusIntProperty::kStreamId, &stream_id);
@@ -214,6 +216,22 @@ TEST_P(ParseTest, OneByteAtATime) {
   }
 }
 
+TEST_P(ParseTest, CompactTableWholeSlices) {
+  UseCompactTable();
+  for (const auto& input : GetParam().inputs) {
+    TestVector(GRPC_SLICE_SPLIT_MERGE_ALL, GetParam().max_metadata_size,
+               input.input, input.expected_parse, input.flags);
+  }
+}
+
+TEST_P(ParseTest, CompactTableOneByteAtATime) {
+  UseCompactTable();
+  for (const auto& input : GetParam().inputs) {
+    TestVector(GRPC_SLICE_SPLIT_ONE_BYTE, GetParam().max_metadata_size,
+               input.input, input.expected_parse, input.flags);
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     ParseTest, ParseTest,
     ::testing::Values(
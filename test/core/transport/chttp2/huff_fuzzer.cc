@@ -26,6 +26,7 @@
 #include "fuzztest/fuzztest.h"
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multi.h"
 #include "src/core/ext/transport/chttp2/transport/huffsyms.h"
 #include "src/core/util/dump_args.h"
 #include "gtest/gtest.h"
@@ -52,6 +53,14 @@ void EncodeDecodeRoundTrips(std::vector<uint8_t> buffer) {
                                          GRPC_SLICE_END_PTR(compressed))
                   .Run());
   EXPECT_EQ(buffer, uncompressed_again);
+  std::vector<uint8_t> multi_symbol(
+      HuffDecodeMultiSymbolBufferSize(GRPC_SLICE_LENGTH(compressed)));
+  std::optional<size_t> decoded = HuffDecodeMultiSymbol(
+      GRPC_SLICE_START_PTR(compressed), GRPC_SLICE_END_PTR(compressed),
+      multi_symbol.data());
+  ASSERT_TRUE(decoded.has_value());
+  multi_symbol.resize(*decoded);
+  EXPECT_EQ(buffer, multi_symbol);
   grpc_slice_unref(uncompressed);
   grpc_slice_unref(compressed);
 }
@@ -117,5 +126,23 @@ void DifferentialOptimizedTest(std::vector<uint8_t> buffer) {
 }
 FUZZ_TEST(HuffTest, DifferentialOptimizedTest);
 
+std::optional<std::vector<uint8_t>> DecodeHuffMultiSymbol(const uint8_t* begin,
+                                                          const uint8_t* end) {
+  std::vector<uint8_t> v(HuffDecodeMultiSymbolBufferSize(end - begin));
+  std::optional<size_t> decoded = HuffDecodeMultiSymbol(begin, end, v.data());
+  if (!decoded.has_value()) return std::nullopt;
+  v.resize(*decoded);
+  return v;
+}
+
+void DifferentialMultiSymbolTest(std::vector<uint8_t> buffer) {
+  auto slow = DecodeHuffSlow(buffer.data(), buffer.data() + buffer.size());
+  auto multi =
+      DecodeHuffMultiSymbol(buffer.data(), buffer.data() + buffer.size());
+  EXPECT_EQ(multi, slow) << GRPC_DUMP_ARGS(ToString(buffer), ToString(slow),
+                                           ToString(multi));
+}
+FUZZ_TEST(HuffTest, DifferentialMultiSymbolTest);
+
 }  // namespace
 }  // namespace grpc_core
@@ -453,6 +453,63 @@ TEST_F(WritableStreamsTest, TestForceReadyForWrite) {
   event_engine()->UnsetGlobalHooks();
 }
 
+TEST_F(WritableStreamsTest, SmallMessageLaneTest) {
+  // Test to ensure that streams in the small message lane are dequeued ahead
+  // of default priority streams that were enqueued before them.
+  WritableStreams writable_streams(/*max_queue_size=*/3);
+  EnqueueAndCheckSuccess(writable_streams,
+                         /*stream=*/MakeRefCounted<Stream>(1),
+                         WritableStreamPriority::kDefault);
+  EnqueueAndCheckSuccess(writable_streams,
+                         /*stream=*/MakeRefCounted<Stream>(3),
+                         WritableStreamPriority::kSmallMessage);
+  DequeueAndCheckSuccess(writable_streams, /*expected_stream_id=*/3);
+  DequeueAndCheckSuccess(writable_streams, /*expected_stream_id=*/1);
+
+  event_engine()->TickUntilIdle();
+  event_engine()->UnsetGlobalHooks();
+}
+
+TEST_F(WritableStreamsTest, RequeueAfterTurnTest) {
+  // Test to ensure that a stream requeued after its turn goes behind the
+  // streams already waiting at its priority, and is available without another
+  // round trip through the mpsc queue.
+  WritableStreams writable_streams(/*max_queue_size=*/3);
+  RefCountedPtr<Stream> stream1 = MakeRefCounted<Stream>(1);
+  EnqueueAndCheckSuccess(writable_streams, stream1,
+                         WritableStreamPriority::kDefault);
+  EnqueueAndCheckSuccess(writable_streams,
+                         /*stream=*/MakeRefCounted<Stream>(3),
+                         WritableStreamPriority::kDefault);
+  DequeueAndCheckSuccess(writable_streams, /*expected_stream_id=*/1);
+  EXPECT_TRUE(writable_streams
+                  .RequeueAfterTurn(stream1, WritableStreamPriority::kDefault,
+                                    /*transport_tokens_available=*/true)
+                  .ok());
+  std::optional<RefCountedPtr<Stream>> next =
+      writable_streams.ImmediateNext(/*transport_tokens_available=*/true);
+  ASSERT_TRUE(next.has_value());
+  EXPECT_EQ((*next)->GetStreamId(), 3u);
+  next = writable_streams.ImmediateNext(/*transport_tokens_available=*/true);
+  ASSERT_TRUE(next.has_value());
+  EXPECT_EQ((*next)->GetStreamId(), 1u);
+
+  // Without transport flow control tokens the stream waits for them.
+  EXPECT_TRUE(writable_streams
+                  .RequeueAfterTurn(stream1, WritableStreamPriority::kDefault,
+                                    /*transport_tokens_available=*/false)
+                  .ok());
+  EXPECT_FALSE(writable_streams.ImmediateNext(
+                   /*transport_tokens_available=*/false)
+                   .has_value());
+  next = writable_streams.ImmediateNext(/*transport_tokens_available=*/true);
+  ASSERT_TRUE(next.has_value());
+  EXPECT_EQ((*next)->GetStreamId(), 1u);
+
+  event_engine()->TickUntilIdle();
+  event_engine()->UnsetGlobalHooks();
+}
+
 }  // namespace testing
 }  // namespace http2
 }  // namespace grpc_core
@@ -0,0 +1,82 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/write_coalescing_policy.h"
+
+#include <chrono>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+using Clock = Chttp2WriteCoalescingPolicy::Clock;
+
+TEST(WriteCoalescingPolicyTest, DisabledByDefault) {
+  Chttp2WriteCoalescingPolicy policy{ChannelArgs()};
+  EXPECT_FALSE(policy.enabled());
+  EXPECT_FALSE(policy.ShouldHold(true));
+}
+
+TEST(WriteCoalescingPolicyTest, DelayIsClamped) {
+  Chttp2WriteCoalescingPolicy negative{
+      ChannelArgs().Set(GRPC_ARG_HTTP2_WRITE_COALESCING_MAX_DELAY_US, -5)};
+  EXPECT_FALSE(negative.enabled());
+  Chttp2WriteCoalescingPolicy huge{ChannelArgs().Set(
+      GRPC_ARG_HTTP2_WRITE_COALESCING_MAX_DELAY_US, 1000000000)};
+  EXPECT_EQ(huge.max_delay(), Chttp2WriteCoalescingPolicy::kMaxDelay);
+}
+
+TEST(WriteCoalescingPolicyTest, HoldsUntilTargetBytesQueued) {
+  Chttp2WriteCoalescingPolicy policy{
+      ChannelArgs()
+          .Set(GRPC_ARG_HTTP2_WRITE_COALESCING_MAX_DELAY_US, 50)
+          .Set(GRPC_ARG_HTTP2_WRITE_COALESCING_TARGET_BYTES, 1000)};
+  EXPECT_TRUE(policy.enabled());
+  EXPECT_EQ(policy.max_delay(), std::chrono::microseconds(50));
+  EXPECT_TRUE(policy.ShouldHold(true));
+  // Writes carrying anything urgent are never held.
+  EXPECT_FALSE(policy.ShouldHold(false));
+  policy.QueuedBytes(600);
+  EXPECT_TRUE(policy.ShouldHold(true));
+  policy.QueuedBytes(400);
+  EXPECT_FALSE(policy.ShouldHold(true));
+  // Beginning a write takes everything queued so far.
+  policy.BeginWrite(Clock::now());
+  EXPECT_TRUE(policy.ShouldHold(true));
+}
+
+TEST(WriteCoalescingPolicyTest, ReportsHowLongAWriteWasHeld) {
+  Chttp2WriteCoalescingPolicy policy{
+      ChannelArgs().Set(GRPC_ARG_HTTP2_WRITE_COALESCING_MAX_DELAY_US, 50)};
+  const Clock::time_point start = Clock::now();
+  EXPECT_FALSE(policy.BeginWrite(start).has_value());
+  policy.Hold(start);
+  // Holding an already held write does not restart the clock.
+  policy.Hold(start + std::chrono::microseconds(10));
+  auto held = policy.BeginWrite(start + std::chrono::microseconds(30));
+  ASSERT_TRUE(held.has_value());
+  EXPECT_EQ(*held, std::chrono::microseconds(30));
+  EXPECT_FALSE(
+      policy.BeginWrite(start + std::chrono::microseconds(40)).has_value());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
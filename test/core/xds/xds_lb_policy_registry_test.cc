@@ -29,6 +29,7 @@
 #include "envoy/config/cluster/v3/cluster.pb.h"
 #include "envoy/config/core/v3/extension.pb.h"
 #include "envoy/extensions/load_balancing_policies/client_side_weighted_round_robin/v3/client_side_weighted_round_robin.pb.h"
+#include "envoy/extensions/load_balancing_policies/least_request/v3/least_request.pb.h"
 #include "envoy/extensions/load_balancing_policies/pick_first/v3/pick_first.pb.h"
 #include "envoy/extensions/load_balancing_policies/ring_hash/v3/ring_hash.pb.h"
 #include "envoy/extensions/load_balancing_policies/round_robin/v3/round_robin.pb.h"
@@ -59,6 +60,8 @@ using LoadBalancingPolicyProto =
     ::envoy::config::cluster::v3::LoadBalancingPolicy;
 using ::envoy::extensions::load_balancing_policies::
     client_side_weighted_round_robin::v3::ClientSideWeightedRoundRobin;
+using ::envoy::extensions::load_balancing_policies::least_request::v3::
+    LeastRequest;
 using ::envoy::extensions::load_balancing_policies::pick_first::v3::PickFirst;
 using ::envoy::extensions::load_balancing_policies::ring_hash::v3::RingHash;
 using ::envoy::extensions::load_balancing_policies::round_robin::v3::RoundRobin;
@@ -477,6 +480,56 @@ TEST(PickFirst, ShuffleOmitted) {
   EXPECT_EQ(*result, "{\"pick_first\":{\"shuffleAddressList\":false}}");
 }
 
+//
+// LeastRequest
+//
+
+TEST(LeastRequest, DefaultConfig) {
+  LoadBalancingPolicyProto policy;
+  policy.add_policies()
+      ->mutable_typed_extension_config()
+      ->mutable_typed_config()
+      ->PackFrom(LeastRequest());
+  auto result = ConvertXdsPolicy(policy);
+  ASSERT_TRUE(result.ok()) << result.status();
+  EXPECT_EQ(*result, "{\"least_request_experimental\":{\"choiceCount\":2}}");
+}
+
+TEST(LeastRequest, FieldsExplicitlySet) {
+  LeastRequest least_request;
+  least_request.mutable_choice_count()->set_value(3);
+  // Fields gRPC does not support are ignored.
+  least_request.mutable_active_request_bias()->set_default_value(1.5);
+  least_request.set_selection_method(LeastRequest::FULL_SCAN);
+  LoadBalancingPolicyProto policy;
+  policy.add_policies()
+      ->mutable_typed_extension_config()
+      ->mutable_typed_config()
+      ->PackFrom(least_request);
+  auto result = ConvertXdsPolicy(policy);
+  ASSERT_TRUE(result.ok()) << result.status();
+  EXPECT_EQ(*result, "{\"least_request_experimental\":{\"choiceCount\":3}}");
+}
+
+TEST(LeastRequest, ChoiceCountTooLow) {
+  LeastRequest least_request;
+  least_request.mutable_choice_count()->set_value(1);
+  LoadBalancingPolicyProto policy;
+  policy.add_policies()
+      ->mutable_typed_extension_config()
+      ->mutable_typed_config()
+      ->PackFrom(least_request);
+  auto result = ConvertXdsPolicy(policy);
+  EXPECT_EQ(result.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(result.status().message(),
+            "validation errors: ["
+            "field:load_balancing_policy.policies[0].typed_extension_config"
+            ".typed_config.value[envoy.extensions.load_balancing_policies"
+            ".least_request.v3.LeastRequest].choice_count "
+            "error:must be at least 2]")
+      << result.status();
+}
+
 //
 // CustomPolicy
 //
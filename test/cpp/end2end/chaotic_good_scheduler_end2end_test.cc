@@ -0,0 +1,206 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Small urgent unary calls sharing a chaotic_good connection with bulk
+// streams under the deadline scheduler: everything must arrive intact with
+// urgent frames offered ahead of bulk ones. How much sooner urgent calls
+// complete than under spanrr is checked in simulated time, by
+// scheduler_simulator_test, where it does not depend on the machine.
+
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/core/ext/transport/chaotic_good/call_urgency.h"
+#include "src/core/ext/transport/chaotic_good/chaotic_good.h"
+#include "src/core/ext/transport/chaotic_good/config.h"
+#include "src/core/lib/experiments/experiments.h"
+#include "src/core/transport/endpoint_transport.h"
+#include "src/core/util/host_port.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+#include "gtest/gtest.h"
+#include "absl/log/log.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+constexpr size_t kBulkStreams = 2;
+constexpr size_t kBulkBytesPerStream = 16 * 1024 * 1024;
+constexpr size_t kBulkMessageSize = 1024 * 1024;
+// Big enough to go to a data endpoint rather than being inlined.
+constexpr size_t kUnaryMessageSize = 32 * 1024;
+constexpr size_t kMinUnaryCalls = 20;
+
+class BulkAndUnaryService final : public EchoTestService::Service {
+ public:
+  Status Echo(ServerContext*, const EchoRequest* request,
+              EchoResponse* response) override {
+    response->set_message(request->message().substr(0, 16));
+    return Status::OK;
+  }
+
+  Status RequestStream(ServerContext*, ServerReader<EchoRequest>* reader,
+                       EchoResponse* response) override {
+    EchoRequest request;
+    size_t bytes = 0;
+    while (reader->Read(&request)) bytes += request.message().size();
+    response->set_message(std::to_string(bytes));
+    return Status::OK;
+  }
+};
+
+class ChaoticGoodSchedulerEnd2endTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    if (!grpc_core::IsEventEngineClientEnabled() ||
+        !grpc_core::IsEventEngineListenerEnabled()) {
+      GTEST_SKIP() << "chaotic_good needs the event engine client & listener";
+    }
+  }
+
+  void StartServer(const std::string& scheduler_config) {
+    port_ = grpc_pick_unused_port_or_die();
+    address_ = grpc_core::JoinHostPort("localhost", port_);
+    ServerBuilder builder;
+    builder.AddChannelArgument(
+        GRPC_ARG_PREFERRED_TRANSPORT_PROTOCOLS,
+        std::string(grpc_core::chaotic_good::WireFormatPreferences()));
+    builder.AddChannelArgument(GRPC_ARG_CHAOTIC_GOOD_DATA_CONNECTIONS, 2);
+    builder.AddChannelArgument(GRPC_ARG_CHAOTIC_GOOD_SCHEDULER_CONFIG,
+                               scheduler_config);
+    builder.AddListeningPort(address_, InsecureServerCredentials());
+    builder.RegisterService(&service_);
+    server_ = builder.BuildAndStart();
+    ASSERT_NE(server_, nullptr);
+  }
+
+  std::unique_ptr<EchoTestService::Stub> MakeStub(
+      const std::string& scheduler_config) {
+    ChannelArguments args;
+    args.SetString(
+        GRPC_ARG_PREFERRED_TRANSPORT_PROTOCOLS,
+        std::string(grpc_core::chaotic_good::WireFormatPreferences()));
+    args.SetString(GRPC_ARG_CHAOTIC_GOOD_SCHEDULER_CONFIG, scheduler_config);
+    return EchoTestService::NewStub(
+        CreateCustomChannel(address_, InsecureChannelCredentials(), args));
+  }
+
+  // Runs the bulk streams and, for as long as they last, urgent unary calls
+  // one after another, using `scheduler_config` on both sides.
+  void RunBulkAndUrgentCalls(const std::string& scheduler_config) {
+    StartServer(scheduler_config);
+    if (HasFatalFailure()) return;
+    auto stub = MakeStub(scheduler_config);
+    // Make sure the connection is up before timing anything.
+    {
+      ClientContext context;
+      EchoRequest request;
+      EchoResponse response;
+      request.set_message("warmup");
+      ASSERT_TRUE(stub->Echo(&context, request, &response).ok());
+    }
+    std::atomic<size_t> bulk_streams_done{0};
+    const auto bulk_start = std::chrono::steady_clock::now();
+    std::vector<std::thread> bulk_threads;
+    for (size_t i = 0; i < kBulkStreams; ++i) {
+      bulk_threads.emplace_back([&stub, &bulk_streams_done]() {
+        ClientContext context;
+        EchoResponse response;
+        auto writer = stub->RequestStream(&context, &response);
+        EchoRequest request;
+        request.set_message(std::string(kBulkMessageSize, 'b'));
+        for (size_t sent = 0; sent < kBulkBytesPerStream;
+             sent += kBulkMessageSize) {
+          if (!writer->Write(request)) break;
+        }
+        writer->WritesDone();
+        EXPECT_TRUE(writer->Finish().ok());
+        EXPECT_EQ(response.message(), std::to_string(kBulkBytesPerStream));
+        bulk_streams_done.fetch_add(1);
+      });
+    }
+    std::vector<double> latencies_ms;
+    EchoRequest request;
+    request.set_message(std::string(kUnaryMessageSize, 'u'));
+    while (bulk_streams_done.load() < kBulkStreams ||
+           latencies_ms.size() < kMinUnaryCalls) {
+      ClientContext context;
+      context.AddMetadata(
+          std::string(grpc_core::chaotic_good::kCallPriorityMetadataKey), "1");
+      context.set_deadline(std::chrono::system_clock::now() +
+                           std::chrono::seconds(30));
+      EchoResponse response;
+      const auto start = std::chrono::steady_clock::now();
+      Status status = stub->Echo(&context, request, &response);
+      const auto end = std::chrono::steady_clock::now();
+      EXPECT_TRUE(status.ok()) << status.error_message();
+      latencies_ms.push_back(
+          std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    for (auto& thread : bulk_threads) thread.join();
+    const double bulk_ms = std::chrono::duration<double, std::milli>(
+                               std::chrono::steady_clock::now() - bulk_start)
+                               .count();
+    // For information only: wall clock latencies vary too much from one
+    // machine to another to assert on.
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+    LOG(INFO) << scheduler_config << ": bulk transfer took " << bulk_ms
+              << "ms; " << latencies_ms.size() << " unary calls: p50="
+              << latencies_ms[latencies_ms.size() / 2] << "ms p99="
+              << latencies_ms[latencies_ms.size() * 99 / 100] << "ms";
+  }
+
+  void TearDown() override {
+    if (server_ != nullptr) server_->Shutdown();
+    if (port_ != 0) grpc_recycle_unused_port(port_);
+  }
+
+  int port_ = 0;
+  std::string address_;
+  BulkAndUnaryService service_;
+  std::unique_ptr<Server> server_;
+};
+
+TEST_F(ChaoticGoodSchedulerEnd2endTest,
+       UrgentUnaryCallsCompleteAlongsideBulkStreams) {
+  RunBulkAndUrgentCalls("deadline");
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
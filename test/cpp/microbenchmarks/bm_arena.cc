@@ -20,6 +20,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include "src/core/call/call_arena_allocator.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "test/core/test_util/test_config.h"
@@ -92,6 +93,29 @@ static void BM_Arena_NewDeleteComparison_Small(benchmark::State& state) {
 }
 BENCHMARK(BM_Arena_NewDeleteComparison_Small);
 
+// A unary call's worth of arena use: one arena per call, sized by the
+// channel's call size estimate, with a handful of allocations.
+static void BM_CallArena_MakeArena(benchmark::State& state) {
+  static auto* allocator = new grpc_core::RefCountedPtr<
+      grpc_core::CallArenaAllocator>(
+      grpc_core::MakeRefCounted<grpc_core::CallArenaAllocator>(
+          grpc_core::ResourceQuota::Default()
+              ->memory_quota()
+              ->CreateMemoryAllocator("bm_call_arena"),
+          1024));
+  for (auto _ : state) {
+    auto a = (*allocator)->MakeArena();
+    for (int i = 0; i < 8; i++) {
+      benchmark::DoNotOptimize(a->Alloc(state.range(0)));
+    }
+  }
+}
+BENCHMARK(BM_CallArena_MakeArena)
+    ->Arg(64)
+    ->Arg(1024)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
@@ -0,0 +1,95 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks the base64 and base64+huffman coding applied to -bin metadata,
+// for values from a few bytes up to the multi-kilobyte trace and auth context
+// headers some services attach to every call.
+
+#include <benchmark/benchmark.h>
+#include <grpc/slice.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "src/core/ext/transport/chttp2/transport/bin_decoder.h"
+#include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
+#include "src/core/lib/slice/slice.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+grpc_core::Slice RandomBytes(size_t length) {
+  std::mt19937 rng(42);
+  std::vector<uint8_t> bytes(length);
+  for (uint8_t& byte : bytes) byte = static_cast<uint8_t>(rng());
+  return grpc_core::Slice::FromCopiedBuffer(bytes);
+}
+
+void BM_Base64Encode(benchmark::State& state) {
+  grpc_core::Slice input = RandomBytes(state.range(0));
+  for (auto _ : state) {
+    grpc_core::Slice output(grpc_chttp2_base64_encode(input.c_slice()));
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Base64Encode)->RangeMultiplier(4)->Range(16, 16 * 1024);
+
+// The path HPACK takes for -bin values when true binary is not negotiated.
+void BM_Base64EncodeAndHuffmanCompress(benchmark::State& state) {
+  grpc_core::Slice input = RandomBytes(state.range(0));
+  for (auto _ : state) {
+    uint32_t wire_size;
+    grpc_core::Slice output(grpc_chttp2_base64_encode_and_huffman_compress(
+        input.c_slice(), &wire_size));
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Base64EncodeAndHuffmanCompress)
+    ->RangeMultiplier(4)
+    ->Range(16, 16 * 1024);
+
+void BM_Base64Decode(benchmark::State& state) {
+  grpc_core::Slice input = RandomBytes(state.range(0));
+  grpc_core::Slice encoded(grpc_chttp2_base64_encode(input.c_slice()));
+  for (auto _ : state) {
+    grpc_core::Slice output(grpc_chttp2_base64_decode_with_length(
+        encoded.c_slice(), state.range(0)));
+    benchmark::DoNotOptimize(output.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Base64Decode)->RangeMultiplier(4)->Range(16, 16 * 1024);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
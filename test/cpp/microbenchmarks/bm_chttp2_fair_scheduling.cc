@@ -0,0 +1,196 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Latency of unary pings sharing one HTTP/2 connection with a bulk stream,
+// under each of the chttp2 DATA scheduling policies.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "src/core/ext/transport/chttp2/transport/data_scheduling_policy.h"
+#include "src/core/util/grpc_check.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/callback_test_service.h"
+#include "test/cpp/microbenchmarks/fullstack_fixtures.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+constexpr int kBulkMessageSize = 1024 * 1024;
+
+class SchedulingConfiguration : public FixtureConfiguration {
+ public:
+  SchedulingConfiguration(int quantum, int small_message_lane)
+      : quantum_(quantum), small_message_lane_(small_message_lane) {}
+
+  void ApplyCommonChannelArguments(ChannelArguments* c) const override {
+    FixtureConfiguration::ApplyCommonChannelArguments(c);
+    c->SetInt(GRPC_ARG_HTTP2_FAIR_SCHEDULING_QUANTUM_BYTES, quantum_);
+    c->SetInt(GRPC_ARG_HTTP2_SMALL_MESSAGE_LANE_BYTES, small_message_lane_);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+    b->AddChannelArgument(GRPC_ARG_HTTP2_FAIR_SCHEDULING_QUANTUM_BYTES,
+                          quantum_);
+    b->AddChannelArgument(GRPC_ARG_HTTP2_SMALL_MESSAGE_LANE_BYTES,
+                          small_message_lane_);
+  }
+
+ private:
+  const int quantum_;
+  const int small_message_lane_;
+};
+
+// Streams bulk messages to the server for as long as the benchmark runs.
+class BulkClient : public ClientBidiReactor<EchoRequest, EchoResponse> {
+ public:
+  explicit BulkClient(EchoTestService::Stub* stub) {
+    request_.set_message(std::string(kBulkMessageSize, 'a'));
+    stub->async()->BidiStream(&cli_ctx_, this);
+    StartWrite(&request_);
+    StartRead(&response_);
+    StartCall();
+  }
+
+  void OnWriteDone(bool ok) override {
+    if (!ok) return;
+    bytes_sent_.fetch_add(kBulkMessageSize, std::memory_order_relaxed);
+    if (stop_.load(std::memory_order_acquire)) {
+      StartWritesDone();
+    } else {
+      StartWrite(&request_);
+    }
+  }
+
+  void OnReadDone(bool ok) override {
+    if (ok) StartRead(&response_);
+  }
+
+  void OnDone(const Status& s) override {
+    GRPC_CHECK(s.ok()) << s.error_message();
+    std::lock_guard<std::mutex> l(mu_);
+    done_ = true;
+    cv_.notify_one();
+  }
+
+  // Stops streaming and waits for the call to finish; returns the number of
+  // bytes sent.
+  int64_t Stop() {
+    stop_.store(true, std::memory_order_release);
+    std::unique_lock<std::mutex> l(mu_);
+    while (!done_) cv_.wait(l);
+    return bytes_sent_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  ClientContext cli_ctx_;
+  EchoRequest request_;
+  EchoResponse response_;
+  std::atomic<bool> stop_{false};
+  std::atomic<int64_t> bytes_sent_{0};
+  std::mutex mu_;
+  std::condition_variable cv_;
+  bool done_ = false;
+};
+
+// Args: fair scheduling quantum, small message lane size, priority of the
+// unary calls.
+static void BM_UnaryPingUnderBulkStream(benchmark::State& state) {
+  CallbackStreamingTestService service;
+  std::unique_ptr<TCP> fixture(new TCP(
+      &service, SchedulingConfiguration(state.range(0), state.range(1))));
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  const std::string priority = std::to_string(state.range(2));
+  // Make sure the connection is up before the bulk stream takes it over.
+  {
+    ClientContext cli_ctx;
+    EchoRequest request;
+    EchoResponse response;
+    GRPC_CHECK(stub->Echo(&cli_ctx, request, &response).ok());
+  }
+  auto bulk = std::make_unique<BulkClient>(stub.get());
+  std::vector<double> latencies_us;
+  const auto start = std::chrono::steady_clock::now();
+  for (auto _ : state) {
+    ClientContext cli_ctx;
+    cli_ctx.AddMetadata(
+        std::string(grpc_core::kHttp2StreamPriorityMetadataKey), priority);
+    EchoRequest request;
+    EchoResponse response;
+    const auto call_start = std::chrono::steady_clock::now();
+    Status status = stub->Echo(&cli_ctx, request, &response);
+    latencies_us.push_back(std::chrono::duration<double, std::micro>(
+                               std::chrono::steady_clock::now() - call_start)
+                               .count());
+    GRPC_CHECK(status.ok()) << status.error_message();
+  }
+  const int64_t bulk_bytes = bulk->Stop();
+  const double seconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+  bulk.reset();
+  stub.reset();
+  fixture.reset();
+  std::sort(latencies_us.begin(), latencies_us.end());
+  auto percentile = [&latencies_us](double p) {
+    if (latencies_us.empty()) return 0.0;
+    return latencies_us[std::min(latencies_us.size() - 1,
+                                 static_cast<size_t>(p * latencies_us.size()))];
+  };
+  state.counters["p50_us"] = percentile(0.5);
+  state.counters["p99_us"] = percentile(0.99);
+  state.counters["bulk_bytes_per_second"] = bulk_bytes / seconds;
+}
+BENCHMARK(BM_UnaryPingUnderBulkStream)
+    // FIFO, as without a scheduling policy.
+    ->Args({0, 0, 0})
+    // Deficit round robin, unary calls at the same priority as the bulk
+    // stream and then above it.
+    ->Args({16384, 0, 0})
+    ->Args({16384, 0, 15})
+    // Small message lane, alone and with deficit round robin.
+    ->Args({0, 1024, 0})
+    ->Args({16384, 1024, 0})
+    ->UseRealTime();
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,192 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Parsing of HTTP/2 frame headers and HPACK integers: whole, as the read path
+// does when they are contiguous, against a byte at a time, as it does when
+// they are split across slices.
+
+#include <benchmark/benchmark.h>
+#include <grpc/slice.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "src/core/call/metadata_batch.h"
+#include "src/core/ext/transport/chttp2/transport/frame.h"
+#include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
+#include "src/core/ext/transport/chttp2/transport/varint.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/util/grpc_check.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+#include "absl/random/random.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr size_t kFrameHeaders = 1024;
+
+std::vector<uint8_t> RandomFrameHeaders() {
+  absl::BitGen bitgen;
+  std::vector<uint8_t> headers(kFrameHeaders * kFrameHeaderSize);
+  for (uint8_t& byte : headers) byte = absl::Uniform<uint8_t>(bitgen);
+  return headers;
+}
+
+void BM_ParseFrameHeaderWhole(benchmark::State& state) {
+  const std::vector<uint8_t> headers = RandomFrameHeaders();
+  for (auto _ : state) {
+    for (size_t i = 0; i < headers.size(); i += kFrameHeaderSize) {
+      benchmark::DoNotOptimize(Http2FrameHeader::Parse(&headers[i]));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kFrameHeaders);
+}
+BENCHMARK(BM_ParseFrameHeaderWhole);
+
+// The states parsing.cc steps through for a header split across slices.
+void BM_ParseFrameHeaderByteAtATime(benchmark::State& state) {
+  const std::vector<uint8_t> headers = RandomFrameHeaders();
+  for (auto _ : state) {
+    Http2FrameHeader header{};
+    int byte_in_header = 0;
+    for (uint8_t byte : headers) {
+      switch (byte_in_header) {
+        case 0:
+          header.length = static_cast<uint32_t>(byte) << 16;
+          break;
+        case 1:
+          header.length |= static_cast<uint32_t>(byte) << 8;
+          break;
+        case 2:
+          header.length |= byte;
+          break;
+        case 3:
+          header.type = byte;
+          break;
+        case 4:
+          header.flags = byte;
+          break;
+        case 5:
+          header.stream_id = (static_cast<uint32_t>(byte) & 0x7f) << 24;
+          break;
+        case 6:
+          header.stream_id |= static_cast<uint32_t>(byte) << 16;
+          break;
+        case 7:
+          header.stream_id |= static_cast<uint32_t>(byte) << 8;
+          break;
+        case 8:
+          header.stream_id |= byte;
+          benchmark::DoNotOptimize(header);
+          break;
+      }
+      byte_in_header = byte_in_header == 8 ? 0 : byte_in_header + 1;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kFrameHeaders);
+}
+BENCHMARK(BM_ParseFrameHeaderByteAtATime);
+
+// An HPACK block of indexed fields, each referring to one of the last
+// state.range(0) entries of a full dynamic table: indices past 127 take a
+// varint tail. Parsed as one slice, or as one slice per byte.
+void BM_HpackParseIndexedFields(benchmark::State& state) {
+  const uint32_t entries = state.range(0);
+  const bool byte_at_a_time = state.range(1) != 0;
+  std::vector<uint8_t> init;
+  for (uint32_t i = 0; i < entries; ++i) {
+    // Literal with incremental indexing, new name "x", value of one digit.
+    init.insert(init.end(), {0x40, 0x01, 'x', 0x01,
+                             static_cast<uint8_t>('0' + i % 10)});
+  }
+  std::vector<uint8_t> block;
+  for (uint32_t i = 0; i < 256; ++i) {
+    uint32_t index = hpack_constants::kLastStaticEntry + 1 + i % entries;
+    if (index < 0x7f) {
+      block.push_back(0x80 | index);
+      continue;
+    }
+    block.push_back(0xff);
+    index -= 0x7f;
+    while (index >= 0x80) {
+      block.push_back(0x80 | (index & 0x7f));
+      index >>= 7;
+    }
+    block.push_back(index);
+  }
+  std::vector<grpc_slice> slices;
+  if (byte_at_a_time) {
+    for (uint8_t byte : block) {
+      slices.push_back(grpc_slice_from_copied_buffer(
+          reinterpret_cast<const char*>(&byte), 1));
+    }
+  } else {
+    slices.push_back(grpc_slice_from_copied_buffer(
+        reinterpret_cast<const char*>(block.data()), block.size()));
+  }
+  ExecCtx exec_ctx;
+  HPackParser parser;
+  grpc_metadata_batch batch;
+  absl::BitGen bitgen;
+  auto parse = [&](const std::vector<grpc_slice>& slices) {
+    parser.BeginFrame(
+        &batch, std::numeric_limits<uint32_t>::max(),
+        std::numeric_limits<uint32_t>::max(), HPackParser::Boundary::None,
+        HPackParser::Priority::None,
+        HPackParser::LogInfo{1, HPackParser::LogInfo::kHeaders, false});
+    for (size_t i = 0; i < slices.size(); ++i) {
+      GRPC_CHECK_OK(parser.Parse(slices[i], i == slices.size() - 1,
+                                 absl::BitGenRef(bitgen),
+                                 /*call_tracer=*/nullptr));
+    }
+    parser.FinishFrame();
+  };
+  parser.hpack_table()->SetMaxBytes(entries * 64);
+  GRPC_CHECK(parser.hpack_table()->SetCurrentTableSize(entries * 64));
+  grpc_slice init_slice = grpc_slice_from_copied_buffer(
+      reinterpret_cast<const char*>(init.data()), init.size());
+  parse({init_slice});
+  grpc_slice_unref(init_slice);
+  for (auto _ : state) {
+    batch.Clear();
+    parse(slices);
+    ExecCtx::Get()->Flush();
+  }
+  state.SetItemsProcessed(state.iterations() * 256);
+  for (grpc_slice& slice : slices) grpc_slice_unref(slice);
+}
+BENCHMARK(BM_HpackParseIndexedFields)
+    ->ArgsProduct({{64, 1024, 16384}, {0, 1}});
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
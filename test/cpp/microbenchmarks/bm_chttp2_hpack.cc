@@ -26,6 +26,7 @@
 
 #include <memory>
 #include <sstream>
+#include <vector>
 
 #include "src/core/call/metadata_batch.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
@@ -42,6 +43,7 @@
 #include "test/cpp/util/test_config.h"
 #include "absl/log/log.h"
 #include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
 
 static grpc_slice MakeSlice(const std::vector<uint8_t>& bytes) {
   grpc_slice s = grpc_slice_malloc(bytes.size());
@@ -345,6 +347,57 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader,
                    RepresentativeServerTrailingMetadata)
     ->Args({1, 16384});
 
+// Client initial metadata for calls cycling through range(1) methods, with the
+// request header block cache holding range(0) entries (0 disables it).
+template <class Fixture>
+static void BM_HpackEncoderEncodeRequestHeaders(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  std::vector<grpc_metadata_batch> batches;
+  for (int64_t i = 0; i < state.range(1); i++) {
+    grpc_metadata_batch& b = batches.emplace_back();
+    Fixture::Prepare(&b);
+    b.Set(grpc_core::HttpPathMetadata(),
+          grpc_core::Slice::FromCopiedString(
+              absl::StrCat("/grpc.test.FooService/Method", i)));
+  }
+
+  grpc_core::HPackCompressor c;
+  c.SetRequestHeaderCacheSize(state.range(0));
+  grpc_core::FakeCallTracer call_tracer;
+  grpc_slice_buffer outbuf;
+  grpc_slice_buffer_init(&outbuf);
+  size_t next = 0;
+  for (auto _ : state) {
+    c.EncodeHeaders(
+        grpc_core::HPackCompressor::EncodeHeaderOptions{
+            static_cast<uint32_t>(state.iterations()), false,
+            Fixture::kEnableTrueBinary, size_t{16384}, &call_tracer,
+            grpc_core::ztrace_collector},
+        batches[next], &outbuf);
+    if (++next == batches.size()) next = 0;
+    grpc_slice_buffer_reset_and_unref(&outbuf);
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  grpc_slice_buffer_destroy(&outbuf);
+}
+
+static void RequestHeaderCacheArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"cache_size", "methods"});
+  for (int cache_size :
+       {0, static_cast<int>(
+               grpc_core::HPackCompressor::kDefaultRequestHeaderCacheSize)}) {
+    for (int methods : {1, 8}) {
+      b->Args({cache_size, methods});
+    }
+  }
+}
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeRequestHeaders,
+                   RepresentativeClientInitialMetadata)
+    ->Apply(RequestHeaderCacheArguments);
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeRequestHeaders,
+                   MoreRepresentativeClientInitialMetadata)
+    ->Apply(RequestHeaderCacheArguments);
+
 }  // namespace hpack_encoder_fixtures
 
 ////////////////////////////////////////////////////////////////////////////////
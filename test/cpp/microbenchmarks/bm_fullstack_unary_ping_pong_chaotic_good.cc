@@ -24,6 +24,7 @@
 #include <grpcpp/security/server_credentials.h>
 
 #include "src/core/ext/transport/chaotic_good/chaotic_good.h"
+#include "src/core/ext/transport/chaotic_good/config.h"
 #include "src/core/transport/endpoint_transport.h"
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/microbenchmarks/fullstack_unary_ping_pong.h"
@@ -36,12 +37,15 @@ class ChaoticGoodFixture : public BaseFixture {
  public:
   explicit ChaoticGoodFixture(
       Service* service,
-      const FixtureConfiguration& config = FixtureConfiguration()) {
+      const FixtureConfiguration& config = FixtureConfiguration(),
+      int shared_memory_size = 0) {
     auto address = MakeAddress(&port_);
     ServerBuilder b;
     b.AddChannelArgument(
         GRPC_ARG_PREFERRED_TRANSPORT_PROTOCOLS,
         std::string(grpc_core::chaotic_good::WireFormatPreferences()));
+    b.AddChannelArgument(GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_SIZE,
+                         shared_memory_size);
     if (!address.empty()) {
       b.AddListeningPort(address, InsecureServerCredentials());
     }
@@ -54,6 +58,7 @@ class ChaoticGoodFixture : public BaseFixture {
     args.SetString(
         GRPC_ARG_PREFERRED_TRANSPORT_PROTOCOLS,
         std::string(grpc_core::chaotic_good::WireFormatPreferences()));
+    args.SetInt(GRPC_ARG_CHAOTIC_GOOD_SHARED_MEMORY_SIZE, shared_memory_size);
     if (!address.empty()) {
       channel_ = grpc::CreateCustomChannel(address,
                                            InsecureChannelCredentials(), args);
@@ -89,6 +94,15 @@ class ChaoticGoodFixture : public BaseFixture {
   int port_;
 };
 
+// Client and server on the same host, passing payloads through shared memory
+// rather than loopback TCP.
+class ChaoticGoodSharedMemoryFixture : public ChaoticGoodFixture {
+ public:
+  explicit ChaoticGoodSharedMemoryFixture(Service* service)
+      : ChaoticGoodFixture(service, FixtureConfiguration(),
+                           /*shared_memory_size=*/256 * 1024 * 1024) {}
+};
+
 //******************************************************************************
 // CONFIGURATIONS
 //
@@ -107,6 +121,9 @@ static void SweepSizesArgs(benchmark::internal::Benchmark* b) {
 BENCHMARK_TEMPLATE(BM_UnaryPingPong, ChaoticGoodFixture, NoOpMutator,
                    NoOpMutator)
     ->Apply(SweepSizesArgs);
+BENCHMARK_TEMPLATE(BM_UnaryPingPong, ChaoticGoodSharedMemoryFixture,
+                   NoOpMutator, NoOpMutator)
+    ->Apply(SweepSizesArgs);
 
 }  // namespace testing
 }  // namespace grpc
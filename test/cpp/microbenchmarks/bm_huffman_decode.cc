@@ -16,14 +16,18 @@
 
 #include <cstdint>
 #include <random>
+#include <string>
+#include <vector>
 
 #include "src/core/ext/transport/chttp2/transport/bin_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/decode_huff.h"
+#include "src/core/ext/transport/chttp2/transport/decode_huff_multi.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/util/no_destruct.h"
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/microbenchmarks/huffman_geometries/index.h"
 #include "absl/strings/escaping.h"
+#include "absl/strings/str_cat.h"
 
 std::vector<uint8_t> MakeInput(int min, int max) {
   std::vector<uint8_t> v;
@@ -85,6 +89,105 @@ static void BM_Decode(benchmark::State& state, CharSet chars_gen) {
 
 DECL_HUFFMAN_VARIANTS();
 
+static void BM_DecodeMultiSymbol(benchmark::State& state, CharSet chars_gen) {
+  const std::vector<uint8_t>& chars = chars_gen();
+  std::vector<uint8_t> output(
+      grpc_core::HuffDecodeMultiSymbolBufferSize(chars.size()));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(grpc_core::HuffDecodeMultiSymbol(
+        chars.data(), chars.data() + chars.size(), output.data()));
+  }
+}
+BENCHMARK_CAPTURE(BM_DecodeMultiSymbol, all_chars, AllChars);
+BENCHMARK_CAPTURE(BM_DecodeMultiSymbol, base64_chars, Base64Chars);
+BENCHMARK_CAPTURE(BM_DecodeMultiSymbol, ascii_chars, AsciiChars);
+BENCHMARK_CAPTURE(BM_DecodeMultiSymbol, alpha_chars, AlphaChars);
+
+// Huffman coded values of the headers a typical gRPC request carries: mostly
+// short strings, with a few long tokens.
+std::vector<std::vector<uint8_t>> MakeHeaders() {
+  std::mt19937 rd(0);
+  auto random_string = [&rd](absl::string_view alphabet, size_t length) {
+    std::string s;
+    for (size_t i = 0; i < length; i++) s += alphabet[rd() % alphabet.size()];
+    return s;
+  };
+  constexpr absl::string_view kHex = "0123456789abcdef";
+  constexpr absl::string_view kBase64Url =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+  std::vector<std::vector<uint8_t>> headers;
+  for (int i = 0; i < 256; i++) {
+    const std::string values[] = {
+        absl::StrCat("/my.package.v1.Service", rd() % 10, "/GetResource",
+                     rd() % 50),
+        absl::StrCat("backend-", rd() % 100,
+                     ".production.svc.cluster.local:443"),
+        "application/grpc",
+        absl::StrCat("grpc-c++/1.", 60 + rd() % 20, ".0 grpc-c/",
+                     30 + rd() % 20, ".0.0 (linux; chttp2)"),
+        absl::StrCat(rd() % 100000, "u"),
+        absl::StrCat("00-", random_string(kHex, 32), "-",
+                     random_string(kHex, 16), "-01"),
+        absl::StrCat(random_string(kHex, 8), "-", random_string(kHex, 4), "-",
+                     random_string(kHex, 4), "-", random_string(kHex, 4), "-",
+                     random_string(kHex, 12)),
+        absl::StrCat("Bearer ", random_string(kBase64Url, 36), ".",
+                     random_string(kBase64Url, 180), ".",
+                     random_string(kBase64Url, 43)),
+    };
+    for (const std::string& value : values) {
+      grpc_core::Slice s = grpc_core::Slice::FromCopiedString(value);
+      grpc_core::Slice c(grpc_chttp2_huffman_compress(s.c_slice()));
+      headers.emplace_back(c.begin(), c.end());
+    }
+  }
+  return headers;
+}
+
+const std::vector<std::vector<uint8_t>>& Headers() {
+  static const auto* const data =
+      new std::vector<std::vector<uint8_t>>(MakeHeaders());
+  return *data;
+}
+
+int64_t HeaderBytes() {
+  int64_t bytes = 0;
+  for (const auto& header : Headers()) bytes += header.size();
+  return bytes;
+}
+
+// Decodes each header value into a fresh vector, as HPackParser does.
+static void BM_DecodeHeaders(benchmark::State& state) {
+  const auto& headers = Headers();
+  for (auto _ : state) {
+    for (const auto& header : headers) {
+      std::vector<uint8_t> output;
+      auto add = [&output](uint8_t c) { output.push_back(c); };
+      grpc_core::HuffDecoder<decltype(add)>(add, header.data(),
+                                            header.data() + header.size())
+          .Run();
+      benchmark::DoNotOptimize(output.data());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * HeaderBytes());
+}
+BENCHMARK(BM_DecodeHeaders);
+
+static void BM_DecodeHeadersMultiSymbol(benchmark::State& state) {
+  const auto& headers = Headers();
+  for (auto _ : state) {
+    for (const auto& header : headers) {
+      std::vector<uint8_t> output(
+          grpc_core::HuffDecodeMultiSymbolBufferSize(header.size()));
+      output.resize(*grpc_core::HuffDecodeMultiSymbol(
+          header.data(), header.data() + header.size(), output.data()));
+      benchmark::DoNotOptimize(output.data());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * HeaderBytes());
+}
+BENCHMARK(BM_DecodeHeadersMultiSymbol);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
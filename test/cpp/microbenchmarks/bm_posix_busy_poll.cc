@@ -0,0 +1,231 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Ping-pong between two endpoints of a posix EventEngine, with the engine
+// blocking in its poller (busy_poll_threads=0) or spinning on it from
+// GRPC_EVENT_ENGINE_BUSY_POLL_THREADS threads. Reports the median and 99.9th
+// percentile round trip besides the mean.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
+#include <grpc/grpc.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/core/config/config_vars.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/notification.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::ChannelArgsEndpointConfig;
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::MemoryAllocator;
+using ::grpc_event_engine::experimental::PosixEventEngine;
+using ::grpc_event_engine::experimental::Slice;
+using ::grpc_event_engine::experimental::SliceBuffer;
+using ::grpc_event_engine::experimental::URIToResolvedAddress;
+
+// Writes back whatever it reads, until its peer goes away.
+class Echo {
+ public:
+  explicit Echo(std::unique_ptr<EventEngine::Endpoint> endpoint)
+      : endpoint_(std::move(endpoint)) {}
+
+  void Start() { Read(); }
+
+  // Waits for the peer to go away, then destroys the endpoint.
+  void Stop() {
+    done_.WaitForNotification();
+    endpoint_.reset();
+  }
+
+ private:
+  void Read() {
+    buffer_.Clear();
+    if (endpoint_->Read([this](absl::Status status) { OnRead(status); },
+                        &buffer_, EventEngine::Endpoint::ReadArgs())) {
+      OnRead(absl::OkStatus());
+    }
+  }
+
+  void OnRead(const absl::Status& status) {
+    if (!status.ok()) {
+      done_.Notify();
+      return;
+    }
+    if (endpoint_->Write([this](absl::Status status) { OnWrite(status); },
+                         &buffer_, EventEngine::Endpoint::WriteArgs())) {
+      OnWrite(absl::OkStatus());
+    }
+  }
+
+  void OnWrite(const absl::Status& status) {
+    if (!status.ok()) {
+      done_.Notify();
+      return;
+    }
+    Read();
+  }
+
+  std::unique_ptr<EventEngine::Endpoint> endpoint_;
+  SliceBuffer buffer_;
+  grpc_core::Notification done_;
+};
+
+// Writes `message` on `endpoint` and waits for as many bytes to come back.
+void RoundTrip(EventEngine::Endpoint* endpoint, const std::string& message) {
+  SliceBuffer buffer;
+  buffer.Append(Slice::FromCopiedString(message));
+  grpc_core::Notification write_done;
+  absl::Status status;
+  if (!endpoint->Write(
+          [&](absl::Status s) {
+            status = std::move(s);
+            write_done.Notify();
+          },
+          &buffer, EventEngine::Endpoint::WriteArgs())) {
+    write_done.WaitForNotification();
+  }
+  GRPC_CHECK_OK(status);
+  size_t length = message.size();
+  while (length > 0) {
+    buffer.Clear();
+    EventEngine::Endpoint::ReadArgs args;
+    args.set_read_hint_bytes(length);
+    grpc_core::Notification read_done;
+    if (!endpoint->Read(
+            [&](absl::Status s) {
+              status = std::move(s);
+              read_done.Notify();
+            },
+            &buffer, std::move(args))) {
+      read_done.WaitForNotification();
+    }
+    GRPC_CHECK_OK(status);
+    length -= std::min(length, buffer.Length());
+  }
+}
+
+double Percentile(std::vector<double>& samples, double p) {
+  if (samples.empty()) return 0;
+  auto nth = samples.begin() + static_cast<size_t>(p * (samples.size() - 1));
+  std::nth_element(samples.begin(), nth, samples.end());
+  return *nth;
+}
+
+void BM_PingPong(benchmark::State& state) {
+  const int busy_poll_threads = state.range(0);
+  const std::string message(state.range(1), 'a');
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.event_engine_busy_poll_threads = busy_poll_threads;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  auto engine = PosixEventEngine::MakePosixEventEngine();
+  ChannelArgsEndpointConfig config(grpc_core::ChannelArgs().Set(
+      GRPC_ARG_RESOURCE_QUOTA, grpc_core::ResourceQuota::Default()));
+  auto memory_quota = std::make_unique<grpc_core::MemoryQuota>(
+      grpc_core::MakeRefCounted<grpc_core::channelz::ResourceQuotaNode>(
+          "bm_posix_busy_poll"));
+  std::unique_ptr<Echo> server;
+  grpc_core::Notification accepted;
+  grpc_core::Notification listener_shutdown;
+  auto listener = engine->CreateListener(
+      [&](std::unique_ptr<EventEngine::Endpoint> endpoint,
+          MemoryAllocator /*memory_allocator*/) {
+        server = std::make_unique<Echo>(std::move(endpoint));
+        accepted.Notify();
+      },
+      [&listener_shutdown](absl::Status) { listener_shutdown.Notify(); },
+      config,
+      std::make_unique<grpc_core::MemoryQuota>(
+          grpc_core::MakeRefCounted<grpc_core::channelz::ResourceQuotaNode>(
+              "bm_posix_busy_poll_listener")));
+  GRPC_CHECK_OK(listener);
+  auto port = (*listener)->Bind(*URIToResolvedAddress("ipv4:127.0.0.1:0"));
+  GRPC_CHECK_OK(port);
+  GRPC_CHECK_OK((*listener)->Start());
+  std::unique_ptr<EventEngine::Endpoint> client;
+  grpc_core::Notification connected;
+  engine->Connect(
+      [&](absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>> endpoint) {
+        GRPC_CHECK_OK(endpoint);
+        client = std::move(*endpoint);
+        connected.Notify();
+      },
+      *URIToResolvedAddress(absl::StrCat("ipv4:127.0.0.1:", *port)), config,
+      memory_quota->CreateMemoryAllocator("client"), std::chrono::seconds(10));
+  connected.WaitForNotification();
+  accepted.WaitForNotification();
+  server->Start();
+  std::vector<double> samples;
+  for (auto _ : state) {
+    const auto start = std::chrono::steady_clock::now();
+    RoundTrip(client.get(), message);
+    samples.push_back(std::chrono::duration<double, std::micro>(
+                          std::chrono::steady_clock::now() - start)
+                          .count());
+  }
+  state.counters["p50_us"] = Percentile(samples, 0.5);
+  state.counters["p999_us"] = Percentile(samples, 0.999);
+  client.reset();
+  server->Stop();
+  listener->reset();
+  listener_shutdown.WaitForNotification();
+  engine.reset();
+  grpc_core::ConfigVars::Reset();
+}
+// Blocking and busy-polling from 1 or 2 threads, for messages of 64B to 16KB.
+BENCHMARK(BM_PingPong)
+    ->ArgNames({"busy_poll_threads", "message_size"})
+    ->ArgsProduct({{0, 1, 2}, {64, 1024, 16 * 1024}})
+    ->UseRealTime();
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
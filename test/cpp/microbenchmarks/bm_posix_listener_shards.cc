@@ -0,0 +1,178 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Accept throughput of the posix EventEngine listener under a storm of
+// connections from many client threads, with one socket per address and with
+// GRPC_ARG_TCP_LISTENER_SHARDS sockets steered by CPU. Besides connections per
+// second, reports the fraction of connections accepted on a CPU other than the
+// one that received their packets (SO_INCOMING_CPU): each of those pulls the
+// new socket's cache lines across cores.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/grpc.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/extensions/supports_fd.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine.h"
+#include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
+#include "src/core/lib/event_engine/query_extensions.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/notification.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::ChannelArgsEndpointConfig;
+using ::grpc_event_engine::experimental::EndpointSupportsFdExtension;
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::MemoryAllocator;
+using ::grpc_event_engine::experimental::PosixEventEngine;
+using ::grpc_event_engine::experimental::QueryExtension;
+using ::grpc_event_engine::experimental::URIToResolvedAddress;
+
+constexpr int kClientThreads = 16;
+constexpr int kConnectionsPerClient = 32;
+
+struct AcceptStats {
+  std::atomic<int64_t> accepted{0};
+  // Accepted on a CPU other than the one that received the connection.
+  std::atomic<int64_t> cross_cpu{0};
+};
+
+void RecordAccept(EventEngine::Endpoint* endpoint, AcceptStats* stats) {
+#ifdef SO_INCOMING_CPU
+  auto* supports_fd = QueryExtension<EndpointSupportsFdExtension>(endpoint);
+  int incoming_cpu = -1;
+  socklen_t len = sizeof(incoming_cpu);
+  if (supports_fd != nullptr &&
+      getsockopt(supports_fd->GetWrappedFd(), SOL_SOCKET, SO_INCOMING_CPU,
+                 &incoming_cpu, &len) == 0 &&
+      incoming_cpu != sched_getcpu()) {
+    stats->cross_cpu.fetch_add(1, std::memory_order_relaxed);
+  }
+#endif  // SO_INCOMING_CPU
+  stats->accepted.fetch_add(1, std::memory_order_release);
+}
+
+// Opens kConnectionsPerClient connections to `addr`, and returns their fds.
+std::vector<int> Connect(const EventEngine::ResolvedAddress& addr) {
+  std::vector<int> fds;
+  for (int i = 0; i < kConnectionsPerClient; ++i) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    GRPC_CHECK_GE(fd, 0);
+    // Close with a RST, so that no TIME_WAIT sockets pile up on either side.
+    struct linger linger = {1, 0};
+    GRPC_CHECK_EQ(
+        setsockopt(fd, SOL_SOCKET, SO_LINGER, &linger, sizeof(linger)), 0);
+    GRPC_CHECK_EQ(connect(fd, addr.address(), addr.size()), 0);
+    fds.push_back(fd);
+  }
+  return fds;
+}
+
+void BM_AcceptConnections(benchmark::State& state) {
+  const int shards = state.range(0);
+  auto engine = PosixEventEngine::MakePosixEventEngine();
+  AcceptStats stats;
+  ChannelArgsEndpointConfig config(
+      grpc_core::ChannelArgs()
+          .Set(GRPC_ARG_RESOURCE_QUOTA, grpc_core::ResourceQuota::Default())
+          .Set(GRPC_ARG_TCP_LISTENER_SHARDS, shards));
+  grpc_core::Notification listener_shutdown;
+  auto listener = engine->CreateListener(
+      [&stats](std::unique_ptr<EventEngine::Endpoint> endpoint,
+               MemoryAllocator /*memory_allocator*/) {
+        RecordAccept(endpoint.get(), &stats);
+      },
+      [&listener_shutdown](absl::Status) { listener_shutdown.Notify(); },
+      config,
+      std::make_unique<grpc_core::MemoryQuota>(
+          grpc_core::MakeRefCounted<grpc_core::channelz::ResourceQuotaNode>(
+              "bm_posix_listener_shards")));
+  GRPC_CHECK_OK(listener);
+  auto port = (*listener)->Bind(*URIToResolvedAddress("ipv4:127.0.0.1:0"));
+  GRPC_CHECK_OK(port);
+  GRPC_CHECK_OK((*listener)->Start());
+  const EventEngine::ResolvedAddress addr =
+      *URIToResolvedAddress(absl::StrCat("ipv4:127.0.0.1:", *port));
+  int64_t expected = 0;
+  for (auto _ : state) {
+    std::vector<std::vector<int>> fds(kClientThreads);
+    std::vector<std::thread> clients;
+    for (int i = 0; i < kClientThreads; ++i) {
+      clients.emplace_back([&addr, &fds, i]() { fds[i] = Connect(addr); });
+    }
+    for (auto& client : clients) client.join();
+    expected += kClientThreads * kConnectionsPerClient;
+    while (stats.accepted.load(std::memory_order_acquire) < expected) {
+      std::this_thread::yield();
+    }
+    for (const auto& client_fds : fds) {
+      for (int fd : client_fds) close(fd);
+    }
+  }
+  const int64_t accepted = stats.accepted.load();
+  state.SetItemsProcessed(accepted);
+  state.counters["cross_cpu_fraction"] =
+      accepted == 0 ? 0.0
+                    : static_cast<double>(stats.cross_cpu.load()) / accepted;
+  listener->reset();
+  listener_shutdown.WaitForNotification();
+}
+// 0: one socket per address; -1: one shard per CPU.
+BENCHMARK(BM_AcceptConnections)
+    ->ArgName("shards")
+    ->Arg(0)
+    ->Arg(2)
+    ->Arg(8)
+    ->Arg(-1)
+    ->UseRealTime();
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,183 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the posix EventEngine pollers (epoll1 and io_uring_poll) on the path
+// that dominates small-message RPC workloads: a socket becomes readable, the
+// poller reports it, and the read callback drains it and re-arms. Both pollers
+// leave the read itself to the callback, so only the cost of readiness differs.
+
+#include <benchmark/benchmark.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/util/grpc_check.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::EventHandle;
+using ::grpc_event_engine::experimental::MakeEpoll1Poller;
+using ::grpc_event_engine::experimental::MakeIoUringPoller;
+using ::grpc_event_engine::experimental::PosixEngineClosure;
+using ::grpc_event_engine::experimental::PosixEventPoller;
+using ::grpc_event_engine::experimental::ThreadPool;
+
+enum PollerKind { kEpoll1 = 0, kIoUring = 1 };
+
+// Runs every callback inline on the polling thread, so that the benchmark only
+// measures the poller itself.
+class InlineThreadPool final : public ThreadPool {
+ public:
+  void Quiesce() override {}
+  void Run(absl::AnyInvocable<void()> callback) override { callback(); }
+  void Run(EventEngine::Closure* closure) override { closure->Run(); }
+#if GRPC_ENABLE_FORK_SUPPORT
+  void PrepareFork() override {}
+  void PostFork() override {}
+#endif  // GRPC_ENABLE_FORK_SUPPORT
+};
+
+std::shared_ptr<PosixEventPoller> MakePoller(
+    PollerKind kind, std::shared_ptr<ThreadPool> thread_pool) {
+  switch (kind) {
+    case kEpoll1:
+      return MakeEpoll1Poller(std::move(thread_pool));
+    case kIoUring:
+      return MakeIoUringPoller(std::move(thread_pool));
+  }
+  return nullptr;
+}
+
+// One socket pair registered with the poller. The read callback drains the
+// socket and re-arms itself.
+class Connection {
+ public:
+  Connection(PosixEventPoller* poller, int* pending) : pending_(pending) {
+    int sv[2];
+    GRPC_CHECK_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+    for (int fd : sv) {
+      GRPC_CHECK_EQ(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK), 0);
+    }
+    read_fd_ = sv[0];
+    write_fd_ = sv[1];
+    handle_ = poller->CreateHandle(poller->posix_interface().Adopt(read_fd_),
+                                   "bm_posix_poller", false);
+    on_read_ = PosixEngineClosure::ToPermanentClosure(
+        [this](absl::Status status) { OnRead(std::move(status)); });
+    handle_->NotifyOnRead(on_read_);
+  }
+
+  ~Connection() {
+    handle_->OrphanHandle(nullptr, nullptr, "done");
+    close(write_fd_);
+    delete on_read_;
+  }
+
+  void Send() {
+    char byte = 0;
+    GRPC_CHECK_EQ(write(write_fd_, &byte, 1), 1);
+  }
+
+ private:
+  void OnRead(absl::Status status) {
+    if (!status.ok()) return;
+    char buf[16];
+    bool got_data = false;
+    while (read(read_fd_, buf, sizeof(buf)) > 0) got_data = true;
+    if (got_data) --*pending_;
+    handle_->NotifyOnRead(on_read_);
+  }
+
+  int* pending_;
+  int read_fd_;
+  int write_fd_;
+  EventHandle* handle_;
+  PosixEngineClosure* on_read_;
+};
+
+void BM_PollerReadReadiness(benchmark::State& state) {
+  auto kind = static_cast<PollerKind>(state.range(0));
+  const int num_connections = state.range(1);
+  auto thread_pool = std::make_shared<InlineThreadPool>();
+  auto poller = MakePoller(kind, thread_pool);
+  if (poller == nullptr) {
+    state.SkipWithError("poller not supported on this platform");
+    return;
+  }
+  state.SetLabel(poller->Name());
+  int pending = 0;
+  std::vector<std::unique_ptr<Connection>> connections;
+  connections.reserve(num_connections);
+  for (int i = 0; i < num_connections; i++) {
+    connections.push_back(
+        std::make_unique<Connection>(poller.get(), &pending));
+  }
+  // Drain the initial writability notifications.
+  poller->Work(std::chrono::milliseconds(10), []() {});
+  for (auto _ : state) {
+    pending = num_connections;
+    for (auto& connection : connections) connection->Send();
+    while (pending > 0) {
+      poller->Work(std::chrono::seconds(10), []() {});
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_connections);
+  connections.clear();
+  // Let the poller observe the orphaned handles before it is destroyed.
+  poller->Work(std::chrono::milliseconds(1), []() {});
+}
+
+void PollerArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"poller", "connections"});
+  for (int kind : {kEpoll1, kIoUring}) {
+    for (int connections : {1, 16, 256}) {
+      b->Args({kind, connections});
+    }
+  }
+}
+BENCHMARK(BM_PollerReadReadiness)->Apply(PollerArguments);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
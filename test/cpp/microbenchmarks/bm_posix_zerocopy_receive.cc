@@ -0,0 +1,177 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// A stream of large messages received by a posix EventEngine endpoint, copied
+// out of the socket or mapped with GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED. Besides
+// throughput, reports the CPU time the receiving side spends per GB: that of
+// the whole process less the sending thread's. Over loopback the kernel
+// cannot map received pages, so the mapped runs only show up on a NIC that
+// splits headers from payloads.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/event_engine/slice_buffer.h>
+#include <grpc/grpc.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine.h"
+#include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/notification.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::ChannelArgsEndpointConfig;
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::MemoryAllocator;
+using ::grpc_event_engine::experimental::PosixEventEngine;
+using ::grpc_event_engine::experimental::SliceBuffer;
+using ::grpc_event_engine::experimental::URIToResolvedAddress;
+
+constexpr size_t kWriteSize = 1024 * 1024;
+
+double CpuSeconds(clockid_t clock) {
+  struct timespec ts;
+  GRPC_CHECK_EQ(clock_gettime(clock, &ts), 0);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Reads `length` bytes off `endpoint`, hinting that all of them are wanted.
+void ReadMessage(EventEngine::Endpoint* endpoint, size_t length) {
+  SliceBuffer buffer;
+  while (length > 0) {
+    EventEngine::Endpoint::ReadArgs args;
+    args.set_read_hint_bytes(length);
+    grpc_core::Notification read_done;
+    absl::Status status;
+    if (!endpoint->Read(
+            [&](absl::Status s) {
+              status = std::move(s);
+              read_done.Notify();
+            },
+            &buffer, std::move(args))) {
+      read_done.WaitForNotification();
+    }
+    GRPC_CHECK_OK(status);
+    length -= std::min(length, buffer.Length());
+    buffer.Clear();
+  }
+}
+
+void BM_StreamReceive(benchmark::State& state) {
+  const bool zerocopy = state.range(0) != 0;
+  const size_t message_size = state.range(1);
+  auto engine = PosixEventEngine::MakePosixEventEngine();
+  ChannelArgsEndpointConfig config(
+      grpc_core::ChannelArgs()
+          .Set(GRPC_ARG_RESOURCE_QUOTA, grpc_core::ResourceQuota::Default())
+          .Set(GRPC_ARG_TCP_RX_ZEROCOPY_ENABLED, zerocopy ? 1 : 0));
+  std::unique_ptr<EventEngine::Endpoint> server;
+  grpc_core::Notification accepted;
+  grpc_core::Notification listener_shutdown;
+  auto listener = engine->CreateListener(
+      [&](std::unique_ptr<EventEngine::Endpoint> endpoint,
+          MemoryAllocator /*memory_allocator*/) {
+        server = std::move(endpoint);
+        accepted.Notify();
+      },
+      [&listener_shutdown](absl::Status) { listener_shutdown.Notify(); },
+      config,
+      std::make_unique<grpc_core::MemoryQuota>(
+          grpc_core::MakeRefCounted<grpc_core::channelz::ResourceQuotaNode>(
+              "bm_posix_zerocopy_receive")));
+  GRPC_CHECK_OK(listener);
+  auto port = (*listener)->Bind(*URIToResolvedAddress("ipv4:127.0.0.1:0"));
+  GRPC_CHECK_OK(port);
+  GRPC_CHECK_OK((*listener)->Start());
+  const EventEngine::ResolvedAddress addr =
+      *URIToResolvedAddress(absl::StrCat("ipv4:127.0.0.1:", *port));
+  int client_fd = socket(AF_INET, SOCK_STREAM, 0);
+  GRPC_CHECK_GE(client_fd, 0);
+  GRPC_CHECK_EQ(connect(client_fd, addr.address(), addr.size()), 0);
+  accepted.WaitForNotification();
+  // Writes until the server endpoint goes away.
+  std::thread sender([client_fd]() {
+    std::vector<char> data(kWriteSize, 'a');
+    while (send(client_fd, data.data(), data.size(), MSG_NOSIGNAL) > 0) {
+    }
+  });
+  clockid_t sender_clock;
+  GRPC_CHECK_EQ(pthread_getcpuclockid(sender.native_handle(), &sender_clock),
+                0);
+  const double process_start = CpuSeconds(CLOCK_PROCESS_CPUTIME_ID);
+  const double sender_start = CpuSeconds(sender_clock);
+  for (auto _ : state) {
+    ReadMessage(server.get(), message_size);
+  }
+  const double receive_cpu = (CpuSeconds(CLOCK_PROCESS_CPUTIME_ID) -
+                              process_start) -
+                             (CpuSeconds(sender_clock) - sender_start);
+  const int64_t bytes = state.iterations() * message_size;
+  state.SetBytesProcessed(bytes);
+  state.counters["cpu_ms_per_gb"] =
+      bytes == 0 ? 0.0 : receive_cpu * 1e3 / (bytes * 1e-9);
+  server.reset();
+  shutdown(client_fd, SHUT_RDWR);
+  sender.join();
+  close(client_fd);
+  listener->reset();
+  listener_shutdown.WaitForNotification();
+}
+// Copied and mapped, for messages of 256KB to 16MB.
+BENCHMARK(BM_StreamReceive)
+    ->ArgNames({"zerocopy", "message_size"})
+    ->ArgsProduct({{0, 1}, {256 * 1024, 1024 * 1024, 4 * 1024 * 1024,
+                            16 * 1024 * 1024}})
+    ->UseRealTime();
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
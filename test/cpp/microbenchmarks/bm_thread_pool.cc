@@ -16,13 +16,20 @@
 #include <grpc/support/cpu.h>
 #include <grpcpp/impl/grpc_library.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
+#include <cstdint>
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/thread_pool/cpu_topology.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/crash.h"
 #include "src/core/util/grpc_check.h"
 #include "src/core/util/notification.h"
@@ -35,8 +42,10 @@
 namespace {
 
 using ::grpc_event_engine::experimental::AnyInvocableClosure;
+using ::grpc_event_engine::experimental::CpuTopology;
 using ::grpc_event_engine::experimental::EventEngine;
 using ::grpc_event_engine::experimental::ThreadPool;
+using ::grpc_event_engine::experimental::WorkStealingThreadPool;
 
 struct FanoutParameters {
   int depth;
@@ -239,6 +248,109 @@ void BM_ThreadPool_Closure_FanOut(benchmark::State& state) {
 }
 BENCHMARK(BM_ThreadPool_Closure_FanOut)->Apply(FanoutTestArguments);
 
+// How the pool in BM_ThreadPool_NumaAware sees the machine.
+enum class TopologyMode {
+  // One domain holding every CPU: no locality at all.
+  kFlat,
+  // The machine's topology.
+  kMachine,
+  // The machine's topology, with threads pinned to their domain.
+  kMachinePinned,
+  // The machine's CPUs split into two pretend nodes, with threads pinned, to
+  // exercise the node-aware paths on single-node machines.
+  kTwoNodesPinned,
+};
+
+CpuTopology TwoNodeTopology() {
+  std::vector<int> cpus;
+  for (const CpuTopology::Domain& domain : CpuTopology::Get().domains()) {
+    cpus.insert(cpus.end(), domain.cpus.begin(), domain.cpus.end());
+  }
+  std::sort(cpus.begin(), cpus.end());
+  const size_t half = cpus.size() / 2;
+  return CpuTopology({{0, std::vector<int>(cpus.begin(), cpus.begin() + half)},
+                      {1, std::vector<int>(cpus.begin() + half, cpus.end())}});
+}
+
+// One producer per domain, pinned to it, runs closures that each read a
+// buffer the producer wrote. Reports how many closures ran on a node other
+// than their producer's, and what share of the pool's steals crossed nodes.
+void BM_ThreadPool_NumaAware(benchmark::State& state) {
+  const auto mode = static_cast<TopologyMode>(state.range(0));
+  const int cb_count = state.range(1);
+  if (mode == TopologyMode::kTwoNodesPinned && gpr_cpu_num_cores() < 2) {
+    state.SkipWithError("Needs at least two CPUs");
+    return;
+  }
+  // Nodes are told apart by `reference`, which the pool may not know about.
+  const CpuTopology reference = mode == TopologyMode::kTwoNodesPinned
+                                    ? TwoNodeTopology()
+                                    : CpuTopology::Get();
+  std::vector<int> all_cpus;
+  for (const CpuTopology::Domain& domain : reference.domains()) {
+    all_cpus.insert(all_cpus.end(), domain.cpus.begin(), domain.cpus.end());
+  }
+  const CpuTopology flat({{0, std::move(all_cpus)}});
+  WorkStealingThreadPool pool(
+      grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 16u),
+      mode == TopologyMode::kFlat ? flat : reference,
+      mode == TopologyMode::kMachinePinned ||
+          mode == TopologyMode::kTwoNodesPinned);
+  const size_t producers = std::min<size_t>(reference.num_domains(), 16);
+  const int total = cb_count * static_cast<int>(producers);
+  std::atomic<int> runcount{0};
+  std::atomic<int> cross_node{0};
+  std::atomic<uint64_t> sink{0};
+  auto stats_before = grpc_core::global_stats().Collect();
+  for (auto _ : state) {
+    runcount.store(0);
+    grpc_core::Notification signal;
+    std::vector<std::thread> threads;
+    for (size_t d = 0; d < producers; ++d) {
+      threads.emplace_back([&, d]() {
+        reference.PinCurrentThread(d);
+        // Written here, so it lives on this producer's node.
+        auto buffer = std::make_shared<std::vector<uint64_t>>(512, d);
+        const int node = reference.domains()[d].node;
+        for (int i = 0; i < cb_count; ++i) {
+          pool.Run([&, buffer, node]() {
+            const int cpu = gpr_cpu_current_cpu();
+            if (reference.domains()[reference.DomainOfCpu(cpu)].node != node) {
+              cross_node.fetch_add(1, std::memory_order_relaxed);
+            }
+            uint64_t sum = 0;
+            for (uint64_t v : *buffer) sum += v;
+            sink.fetch_add(sum, std::memory_order_relaxed);
+            if (runcount.fetch_add(1, std::memory_order_acq_rel) + 1 == total) {
+              signal.Notify();
+            }
+          });
+        }
+      });
+    }
+    for (auto& thread : threads) thread.join();
+    signal.WaitForNotification();
+  }
+  auto stats = grpc_core::global_stats().Collect()->Diff(*stats_before);
+  state.SetItemsProcessed(total * state.iterations());
+  state.counters["cross_node_ratio"] =
+      static_cast<double>(cross_node.load()) / (total * state.iterations());
+  state.counters["cross_node_steal_ratio"] =
+      stats->thread_pool_steals == 0
+          ? 0
+          : static_cast<double>(stats->thread_pool_cross_node_steals) /
+                stats->thread_pool_steals;
+  pool.Quiesce();
+}
+BENCHMARK(BM_ThreadPool_NumaAware)
+    ->ArgsProduct({{static_cast<int>(TopologyMode::kFlat),
+                    static_cast<int>(TopologyMode::kMachine),
+                    static_cast<int>(TopologyMode::kMachinePinned),
+                    static_cast<int>(TopologyMode::kTwoNodesPinned)},
+                   {256, 4096}})
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+
 }  // namespace
 
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
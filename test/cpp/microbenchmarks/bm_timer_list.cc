@@ -0,0 +1,229 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the posix EventEngine timer lists (sharded heaps and timing wheels)
+// on cancel-heavy workloads: RPC deadlines, keepalive and retry timers are
+// nearly always cancelled long before they would fire.
+
+#include <benchmark/benchmark.h>
+#include <grpc/event_engine/event_engine.h>
+
+#include <atomic>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+#include "src/core/util/grpc_check.h"
+#include "src/core/util/time.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Timer;
+using ::grpc_event_engine::experimental::TimerList;
+using ::grpc_event_engine::experimental::TimerListHost;
+using ::grpc_event_engine::experimental::TimerListInterface;
+using ::grpc_event_engine::experimental::TimerWheel;
+
+enum TimerListKind { kHeap = 0, kWheel = 1 };
+
+class FakeHost final : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override {
+    return grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+        now_ms.load(std::memory_order_relaxed));
+  }
+  void Kick() override {}
+
+  std::atomic<int64_t> now_ms{1000};
+};
+
+class NoopClosure final : public EventEngine::Closure {
+ public:
+  void Run() override {}
+};
+
+std::unique_ptr<TimerListInterface> MakeTimerList(TimerListKind kind,
+                                                  TimerListHost* host) {
+  switch (kind) {
+    case kHeap:
+      return std::make_unique<TimerList>(host);
+    case kWheel:
+      return std::make_unique<TimerWheel>(host);
+  }
+  return nullptr;
+}
+
+const char* TimerListName(TimerListKind kind) {
+  return kind == kHeap ? "heap" : "wheel";
+}
+
+// A population of timers that stay pending for the duration of a benchmark,
+// spread over the next ten minutes.
+class BackgroundTimers {
+ public:
+  BackgroundTimers(TimerListInterface* timer_list, FakeHost* host, int count)
+      : timer_list_(timer_list), timers_(count) {
+    std::mt19937 rng(42);
+    for (Timer& timer : timers_) {
+      timer_list->TimerInit(
+          &timer,
+          host->Now() + grpc_core::Duration::Milliseconds(rng() % 600000),
+          &closure_);
+    }
+  }
+
+  ~BackgroundTimers() {
+    for (Timer& timer : timers_) {
+      GRPC_CHECK(timer_list_->TimerCancel(&timer));
+    }
+  }
+
+ private:
+  TimerListInterface* const timer_list_;
+  NoopClosure closure_;
+  std::vector<Timer> timers_;
+};
+
+// Schedules a timer and cancels it straight away, with range(1) other timers
+// pending.
+void BM_TimerInitCancel(benchmark::State& state) {
+  auto kind = static_cast<TimerListKind>(state.range(0));
+  FakeHost host;
+  auto timer_list = MakeTimerList(kind, &host);
+  BackgroundTimers background(timer_list.get(), &host, state.range(1));
+  state.SetLabel(TimerListName(kind));
+  NoopClosure closure;
+  Timer timer;
+  for (auto _ : state) {
+    timer_list->TimerInit(&timer,
+                          host.Now() + grpc_core::Duration::Seconds(20),
+                          &closure);
+    GRPC_CHECK(timer_list->TimerCancel(&timer));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void TimerListArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"timer_list", "pending"});
+  for (int kind : {kHeap, kWheel}) {
+    for (int pending : {0, 1000, 100000}) {
+      b->Args({kind, pending});
+    }
+  }
+}
+BENCHMARK(BM_TimerInitCancel)->Apply(TimerListArguments);
+
+// Keeps a window of range(1) timers in flight, cancelling the oldest each time
+// a new one is added. Every 16 timers the clock moves on by a millisecond and
+// TimerCheck runs; one in a hundred timers is short enough to actually fire.
+void BM_TimerChurn(benchmark::State& state) {
+  auto kind = static_cast<TimerListKind>(state.range(0));
+  const size_t window = state.range(1);
+  FakeHost host;
+  auto timer_list = MakeTimerList(kind, &host);
+  state.SetLabel(TimerListName(kind));
+  NoopClosure closure;
+  std::vector<Timer> timers(window);
+  std::vector<bool> armed(window, false);
+  std::mt19937 rng(42);
+  size_t next = 0;
+  int64_t fired = 0;
+  for (auto _ : state) {
+    Timer* timer = &timers[next];
+    if (armed[next] && !timer_list->TimerCancel(timer)) ++fired;
+    const auto delay = rng() % 100 == 0
+                           ? grpc_core::Duration::Milliseconds(rng() % 10)
+                           : grpc_core::Duration::Seconds(1 + rng() % 30);
+    timer_list->TimerInit(timer, host.Now() + delay, &closure);
+    armed[next] = true;
+    if (++next == window) next = 0;
+    if (next % 16 == 0) {
+      host.now_ms.fetch_add(1, std::memory_order_relaxed);
+      auto expired = timer_list->TimerCheck(nullptr);
+      GRPC_CHECK(expired.has_value());
+    }
+  }
+  for (size_t i = 0; i < window; i++) {
+    if (armed[i] && !timer_list->TimerCancel(&timers[i])) ++fired;
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["fired"] = benchmark::Counter(
+      fired, benchmark::Counter::kAvgIterations);
+}
+
+void ChurnArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"timer_list", "window"});
+  for (int kind : {kHeap, kWheel}) {
+    for (int window : {1000, 100000}) {
+      b->Args({kind, window});
+    }
+  }
+}
+BENCHMARK(BM_TimerChurn)->Apply(ChurnArguments);
+
+// Many threads scheduling and cancelling timers on a shared list.
+std::unique_ptr<TimerListInterface> g_shared_timer_list;
+FakeHost* g_shared_host;
+
+void BM_TimerInitCancelContended(benchmark::State& state) {
+  auto kind = static_cast<TimerListKind>(state.range(0));
+  if (state.thread_index() == 0) {
+    g_shared_host = new FakeHost();
+    g_shared_timer_list = MakeTimerList(kind, g_shared_host);
+  }
+  state.SetLabel(TimerListName(kind));
+  NoopClosure closure;
+  Timer timer;
+  for (auto _ : state) {
+    g_shared_timer_list->TimerInit(
+        &timer, g_shared_host->Now() + grpc_core::Duration::Seconds(20),
+        &closure);
+    GRPC_CHECK(g_shared_timer_list->TimerCancel(&timer));
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    g_shared_timer_list.reset();
+    delete g_shared_host;
+  }
+}
+BENCHMARK(BM_TimerInitCancelContended)
+    ->ArgName("timer_list")
+    ->Arg(kHeap)
+    ->Arg(kWheel)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
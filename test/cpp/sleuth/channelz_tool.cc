@@ -14,11 +14,13 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <fstream>
 #include <map>
 #include <optional>
 #include <string>
 #include <vector>
 
+#include "google/protobuf/text_format.h"
 #include "src/core/channelz/zviz/entity.h"
 #include "src/core/channelz/zviz/environment.h"
 #include "src/core/channelz/zviz/format_entity_list.h"
@@ -152,9 +154,11 @@ SLEUTH_TOOL(ls, "target=... [entity_kind=...]",
   return absl::OkStatus();
 }
 
-SLEUTH_TOOL(ztrace, "target=... entity_id=... [trace_name=...]",
+SLEUTH_TOOL(ztrace,
+            "target=... entity_id=... [trace_name=...] [destination=...]",
             "Dumps a ztrace. If trace_name is not specified, defaults to "
-            "'transport_frames'.") {
+            "'transport_frames'. If destination is specified, the events are "
+            "written there as a text format QueryTraceResponse instead.") {
   auto target = args.TryGetFlag<std::string>("target");
   if (!target.ok()) return target.status();
   auto entity_id = args.TryGetFlag<int64_t>("entity_id");
@@ -171,6 +175,27 @@ SLEUTH_TOOL(ztrace, "target=... entity_id=... [trace_name=...]",
       *target,
       ToolClientOptions(channelz_protocol.ok() ? *channelz_protocol : "h2",
                         channel_creds_type));
+  auto destination = args.TryGetFlag<std::string>("destination");
+  if (destination.ok()) {
+    std::ofstream file_out(*destination);
+    if (!file_out.is_open()) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Failed to open file: ", *destination));
+    }
+    grpc::channelz::v2::QueryTraceResponse recording;
+    auto status = client.QueryTrace(
+        *entity_id, trace_name.ok() ? *trace_name : "transport_frames",
+        [&](size_t, const auto& events) {
+          for (const auto* event : events) *recording.add_events() = *event;
+        });
+    if (!status.ok()) return status;
+    std::string text;
+    if (!google::protobuf::TextFormat::PrintToString(recording, &text)) {
+      return absl::InternalError("Failed to format trace");
+    }
+    file_out << text;
+    return absl::OkStatus();
+  }
   SleuthEnvironment env({});
   return client.QueryTrace(
       *entity_id, trace_name.ok() ? *trace_name : "transport_frames",
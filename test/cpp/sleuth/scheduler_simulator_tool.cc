@@ -0,0 +1,270 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "google/protobuf/text_format.h"
+#include "src/core/ext/transport/chaotic_good/scheduler_simulator.h"
+#include "src/core/ext/transport/chaotic_good/tcp_ztrace_collector.h"
+#include "src/proto/grpc/channelz/v2/property_list.pb.h"
+#include "src/proto/grpc/channelz/v2/service.pb.h"
+#include "test/cpp/sleuth/tool.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+
+namespace grpc_sleuth {
+
+namespace {
+
+using grpc_core::chaotic_good::SchedulerSimulationOptions;
+using grpc_core::chaotic_good::SchedulerWorkload;
+using grpc_core::chaotic_good::SimulatedLink;
+using grpc_core::chaotic_good::SyntheticFlow;
+using grpc_core::chaotic_good::TraceScheduledChannel;
+using grpc_core::chaotic_good::TraceWorkloadBuilder;
+using grpc_core::chaotic_good::TraceWriteSchedule;
+using grpc_core::chaotic_good::WriteLargeFrameHeaderTrace;
+
+absl::StatusOr<double> ParseNumber(absl::string_view spec,
+                                   absl::string_view text) {
+  double value;
+  if (!absl::SimpleAtod(text, &value)) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Bad number '", text, "' in '", spec, "'"));
+  }
+  return value;
+}
+
+// RATE@ONE_WAY_DELAY,...
+absl::StatusOr<std::vector<SimulatedLink>> ParseLinks(absl::string_view spec) {
+  std::vector<SimulatedLink> links;
+  for (absl::string_view link : absl::StrSplit(spec, ',')) {
+    std::vector<absl::string_view> parts = absl::StrSplit(link, '@');
+    if (parts.size() != 2) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Expected RATE@ONE_WAY_DELAY, got '", link, "'"));
+    }
+    auto rate = ParseNumber(link, parts[0]);
+    if (!rate.ok()) return rate.status();
+    auto delay = ParseNumber(link, parts[1]);
+    if (!delay.ok()) return delay.status();
+    links.push_back(SimulatedLink::Constant(*rate, *delay));
+  }
+  return links;
+}
+
+// RATE/MESSAGE_SIZE[/PRIORITY[/DEADLINE]],...
+absl::StatusOr<std::vector<SyntheticFlow>> ParseFlows(absl::string_view spec,
+                                                      double seconds) {
+  std::vector<SyntheticFlow> flows;
+  for (absl::string_view flow : absl::StrSplit(spec, ',')) {
+    std::vector<absl::string_view> parts = absl::StrSplit(flow, '/');
+    if (parts.size() < 2 || parts.size() > 4) {
+      return absl::InvalidArgumentError(absl::StrCat(
+          "Expected RATE/MESSAGE_SIZE[/PRIORITY[/DEADLINE]], got '", flow,
+          "'"));
+    }
+    std::vector<double> values;
+    for (absl::string_view part : parts) {
+      auto value = ParseNumber(flow, part);
+      if (!value.ok()) return value.status();
+      values.push_back(*value);
+    }
+    if (values[0] <= 0 || values[1] < 1) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Flow needs a positive rate and size: '", flow, "'"));
+    }
+    SyntheticFlow synthetic;
+    synthetic.end_time = seconds;
+    synthetic.bytes_per_second = values[0];
+    synthetic.message_size = static_cast<uint64_t>(values[1]);
+    if (values.size() > 2) {
+      synthetic.priority = static_cast<uint32_t>(values[2]);
+    }
+    if (values.size() > 3) synthetic.deadline = values[3];
+    flows.push_back(synthetic);
+  }
+  return flows;
+}
+
+const grpc::channelz::v2::PropertyValue* FindProperty(
+    const grpc::channelz::v2::PropertyList& list, absl::string_view key) {
+  for (const auto& element : list.properties()) {
+    if (element.key() == key) return &element.value();
+  }
+  return nullptr;
+}
+
+std::optional<double> NumericValue(
+    const grpc::channelz::v2::PropertyValue* value) {
+  if (value == nullptr) return std::nullopt;
+  switch (value->kind_case()) {
+    case grpc::channelz::v2::PropertyValue::kInt64Value:
+      return value->int64_value();
+    case grpc::channelz::v2::PropertyValue::kUint64Value:
+      return value->uint64_value();
+    case grpc::channelz::v2::PropertyValue::kDoubleValue:
+      return value->double_value();
+    case grpc::channelz::v2::PropertyValue::kBoolValue:
+      return value->bool_value() ? 1 : 0;
+    default:
+      return std::nullopt;
+  }
+}
+
+std::optional<TraceWriteSchedule> ScheduleFromProperties(
+    const grpc::channelz::v2::PropertyList& properties) {
+  const auto* channels = FindProperty(properties, "channels");
+  grpc::channelz::v2::PropertyTable table;
+  if (channels == nullptr || !channels->has_any_value() ||
+      !channels->any_value().UnpackTo(&table)) {
+    return std::nullopt;
+  }
+  auto column = [&table](absl::string_view name) -> int {
+    for (int i = 0; i < table.columns_size(); ++i) {
+      if (table.columns(i) == name) return i;
+    }
+    return -1;
+  };
+  const int id = column("id");
+  const int start_time = column("start_time");
+  const int bytes_per_second = column("bytes_per_second");
+  if (id < 0 || start_time < 0 || bytes_per_second < 0) return std::nullopt;
+  TraceWriteSchedule schedule{};
+  for (const auto& row : table.rows()) {
+    auto cell = [&row](int column) {
+      return NumericValue(column < row.value_size() ? &row.value(column)
+                                                    : nullptr);
+    };
+    auto channel_id = cell(id);
+    auto channel_start_time = cell(start_time);
+    auto channel_rate = cell(bytes_per_second);
+    if (!channel_id.has_value() || !channel_start_time.has_value() ||
+        !channel_rate.has_value()) {
+      continue;
+    }
+    schedule.channels.push_back(TraceScheduledChannel{
+        static_cast<uint32_t>(*channel_id), false, *channel_start_time,
+        *channel_rate, 0});
+  }
+  return schedule;
+}
+
+// The file holds a grpc.channelz.v2.QueryTraceResponse in text format, as
+// written by `ztrace destination=...` for a chaotic_good transport.
+absl::StatusOr<SchedulerWorkload> WorkloadFromTraceFile(
+    const std::string& path) {
+  std::ifstream in(path);
+  if (!in.is_open()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Failed to open file: ", path));
+  }
+  std::stringstream contents;
+  contents << in.rdbuf();
+  grpc::channelz::v2::QueryTraceResponse trace;
+  if (!google::protobuf::TextFormat::ParseFromString(contents.str(),
+                                                     &trace)) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Failed to parse trace: ", path));
+  }
+  TraceWorkloadBuilder builder;
+  std::optional<double> first_event_time;
+  for (const auto& event : trace.events()) {
+    const double event_time =
+        event.timestamp().seconds() + event.timestamp().nanos() * 1e-9;
+    if (!first_event_time.has_value()) first_event_time = event_time;
+    const double time = event_time - *first_event_time;
+    for (const auto& data : event.data()) {
+      grpc::channelz::v2::PropertyList properties;
+      if (!data.value().UnpackTo(&properties)) continue;
+      if (absl::EndsWith(data.name(), "::TraceWriteSchedule")) {
+        auto schedule = ScheduleFromProperties(properties);
+        if (schedule.has_value()) builder.AddSchedule(time, *schedule);
+      } else if (absl::EndsWith(data.name(), "::WriteLargeFrameHeaderTrace")) {
+        auto payload_size =
+            NumericValue(FindProperty(properties, "payload_size"));
+        if (!payload_size.has_value()) continue;
+        builder.AddWrite(time, WriteLargeFrameHeaderTrace{
+                                   0, static_cast<uint64_t>(*payload_size), 0});
+      }
+    }
+  }
+  return builder.Build();
+}
+
+}  // namespace
+
+SLEUTH_TOOL(simulate_chaotic_good_scheduler,
+            "configs=... (trace_file=... | links=... flows=... [seconds=...]) "
+            "[tick=...] [send_buffer=...]",
+            "Replays a chaotic_good workload through each of a comma separated "
+            "list of data endpoint scheduler configs, with no network, and "
+            "reports throughput, queueing delay and latency for each. The "
+            "workload is either a recorded ztrace of a chaotic_good transport "
+            "(as written by ztrace destination=...) or synthetic: links are "
+            "RATE@ONE_WAY_DELAY and flows RATE/MESSAGE_SIZE[/PRIORITY"
+            "[/DEADLINE]], comma separated, in bytes and seconds; flows run "
+            "for 'seconds' (default 1).") {
+  auto configs = args.TryGetFlag<std::string>("configs");
+  if (!configs.ok()) return configs.status();
+  absl::StatusOr<SchedulerWorkload> workload;
+  auto trace_file = args.TryGetFlag<std::string>("trace_file");
+  if (trace_file.ok()) {
+    workload = WorkloadFromTraceFile(*trace_file);
+  } else {
+    auto links_spec = args.TryGetFlag<std::string>("links");
+    if (!links_spec.ok()) return links_spec.status();
+    auto flows_spec = args.TryGetFlag<std::string>("flows");
+    if (!flows_spec.ok()) return flows_spec.status();
+    auto seconds = args.TryGetFlag<double>("seconds", 1.0);
+    if (!seconds.ok()) return seconds.status();
+    auto links = ParseLinks(*links_spec);
+    if (!links.ok()) return links.status();
+    auto flows = ParseFlows(*flows_spec, *seconds);
+    if (!flows.ok()) return flows.status();
+    workload = grpc_core::chaotic_good::MakeSyntheticWorkload(
+        std::move(*links), *flows);
+  }
+  if (!workload.ok()) return workload.status();
+  SchedulerSimulationOptions options;
+  auto tick = args.TryGetFlag<double>("tick", options.tick_seconds);
+  if (!tick.ok()) return tick.status();
+  if (*tick <= 0) return absl::InvalidArgumentError("tick must be positive");
+  options.tick_seconds = *tick;
+  auto send_buffer = args.TryGetFlag<int64_t>(
+      "send_buffer", static_cast<int64_t>(options.send_buffer_bytes));
+  if (!send_buffer.ok()) return send_buffer.status();
+  options.send_buffer_bytes = static_cast<uint64_t>(*send_buffer);
+  print_fn(absl::StrCat(workload->messages.size(), " messages over ",
+                        workload->links.size(), " links\n"));
+  for (absl::string_view config : absl::StrSplit(*configs, ',')) {
+    print_fn(grpc_core::chaotic_good::SimulateScheduler(config, *workload,
+                                                        options)
+                 .ToString());
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace grpc_sleuth
@@ -0,0 +1,130 @@
+// Copyright 2026 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/alloc.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "google/protobuf/text_format.h"
+#include "src/core/util/tmpfile.h"
+#include "src/proto/grpc/channelz/v2/property_list.pb.h"
+#include "src/proto/grpc/channelz/v2/service.pb.h"
+#include "test/cpp/sleuth/tool_test.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "absl/strings/str_cat.h"
+
+namespace grpc_sleuth {
+namespace {
+
+using ::testing::HasSubstr;
+
+TEST(SchedulerSimulatorToolTest, ComparesConfigsOnSyntheticWorkload) {
+  auto result = TestTool(
+      "simulate_chaotic_good_scheduler",
+      {"configs=spanrr,deadline:urgent_priority=2",
+       "links=50e6@0.001,50e6@0.002", "flows=80e6/65536,1e6/4096/2/0.05",
+       "seconds=0.2"});
+  ASSERT_TRUE(result.ok()) << result.status();
+  EXPECT_THAT(*result, HasSubstr("over 2 links"));
+  EXPECT_THAT(*result, HasSubstr("spanrr: delivered"));
+  EXPECT_THAT(*result, HasSubstr("deadline:urgent_priority=2: delivered"));
+  EXPECT_THAT(*result, HasSubstr("priority 2:"));
+}
+
+TEST(SchedulerSimulatorToolTest, RejectsBadSpecs) {
+  EXPECT_FALSE(TestTool("simulate_chaotic_good_scheduler",
+                        {"links=50e6@0.001", "flows=1e6/1024"})
+                   .ok());
+  EXPECT_FALSE(TestTool("simulate_chaotic_good_scheduler",
+                        {"configs=spanrr", "links=50e6", "flows=1e6/1024"})
+                   .ok());
+  EXPECT_FALSE(TestTool("simulate_chaotic_good_scheduler",
+                        {"configs=spanrr", "links=50e6@0", "flows=fast/1024"})
+                   .ok());
+  EXPECT_FALSE(TestTool("simulate_chaotic_good_scheduler",
+                        {"configs=spanrr", "trace_file=/does/not/exist"})
+                   .ok());
+}
+
+void AddNumber(grpc::channelz::v2::PropertyList& list, const std::string& key,
+               double value) {
+  auto* element = list.add_properties();
+  element->set_key(key);
+  element->mutable_value()->set_double_value(value);
+}
+
+void AddEvent(grpc::channelz::v2::QueryTraceResponse& trace, int64_t nanos,
+              const std::string& name,
+              const grpc::channelz::v2::PropertyList& properties) {
+  auto* event = trace.add_events();
+  event->mutable_timestamp()->set_seconds(1000);
+  event->mutable_timestamp()->set_nanos(nanos);
+  auto* data = event->add_data();
+  data->set_name(name);
+  data->mutable_value()->PackFrom(properties);
+}
+
+// What a chaotic_good connection records, cut down to what the replay uses.
+TEST(SchedulerSimulatorToolTest, ReplaysRecordedTrace) {
+  grpc::channelz::v2::QueryTraceResponse trace;
+  grpc::channelz::v2::PropertyTable channels;
+  for (const char* column : {"id", "ready", "start_time", "bytes_per_second",
+                             "allowed_bytes"}) {
+    channels.add_columns(column);
+  }
+  for (int id = 0; id < 2; ++id) {
+    auto* row = channels.add_rows();
+    row->add_value()->set_uint64_value(id);
+    row->add_value()->set_bool_value(true);
+    row->add_value()->set_double_value(0.001);
+    row->add_value()->set_double_value(20e6);
+    row->add_value()->set_double_value(0);
+  }
+  grpc::channelz::v2::PropertyList schedule;
+  auto* element = schedule.add_properties();
+  element->set_key("channels");
+  element->mutable_value()->mutable_any_value()->PackFrom(channels);
+  AddNumber(schedule, "outstanding_bytes", 1e6);
+  AddEvent(trace, 0, "grpc_core::chaotic_good::TraceWriteSchedule", schedule);
+  for (int i = 0; i < 20; ++i) {
+    grpc::channelz::v2::PropertyList write;
+    AddNumber(write, "payload_tag", i);
+    AddNumber(write, "payload_size", 65536);
+    AddNumber(write, "chosen_endpoint", i % 2);
+    AddEvent(trace, 1000000 * (i + 1),
+             "grpc_core::chaotic_good::WriteLargeFrameHeaderTrace", write);
+  }
+  std::string text;
+  ASSERT_TRUE(google::protobuf::TextFormat::PrintToString(trace, &text));
+  char* path = nullptr;
+  FILE* file = gpr_tmpfile("scheduler_trace", &path);
+  ASSERT_NE(file, nullptr);
+  fclose(file);
+  std::ofstream(path) << text;
+  auto result = TestTool("simulate_chaotic_good_scheduler",
+                         {"configs=spanrr,deadline",
+                          absl::StrCat("trace_file=", path)});
+  remove(path);
+  gpr_free(path);
+  ASSERT_TRUE(result.ok()) << result.status();
+  EXPECT_THAT(*result, HasSubstr("20 messages over 2 links"));
+  EXPECT_THAT(*result, HasSubstr("delivered 20/20 messages"));
+}
+
+}  // namespace
+}  // namespace grpc_sleuth
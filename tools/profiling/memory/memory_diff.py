@@ -84,6 +84,13 @@ _INTERESTING = {
         float,
     ),
 }
+for _table_size in (4096, 16384, 65536):
+    for _storage in ("memento", "compact"):
+        _INTERESTING["hpack_table/%d_%s" % (_table_size, _storage)] = (
+            rb"hpack table %d %s memory usage: ([0-9\.]+) bytes per connection"
+            % (_table_size, _storage.encode()),
+            float,
+        )
 
 _SCENARIOS = {
     "default": [],
@@ -98,6 +105,7 @@ _BENCHMARKS = {
         "--benchmark_names=channel_multi_address",
         "--size=10000",
     ],
+    "hpack_table": ["--benchmark_names=hpack_table", "--size=10000"],
 }
 
 
@@ -121,6 +129,9 @@ def _run():
                     continue
                 if name == "channel_multi_address" and not use_xds:
                     continue
+                # The hpack table is measured on its own, with no transport.
+                if name == "hpack_table" and (use_xds or scenario != "default"):
+                    continue
                 argv = (
                     ["bazel-bin/test/core/memory_usage/memory_usage_test"]
                     + benchmark_args